@@ -115,6 +115,9 @@ namespace AZ::IO::ZipDir
         bool WriteCDR(AZ::IO::HandleType fTarget);
 
         bool RelinkZip();
+
+        // returns the size of the buffer the codec needs to compress uncompressedSize bytes
+        static size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
     protected:
         bool RelinkZip(AZ::IO::HandleType fTmp);
         // writes out the file data in the queue into the given file. Empties the queue
@@ -127,8 +130,6 @@ namespace AZ::IO::ZipDir
         ZipFile::CrySignedCDRHeader& GetSignedHeader() { return m_headerSignature; }
         ZipFile::CryCustomExtendedHeader& GetExtendedHeader() { return m_headerExtended; }
 
-        size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
-
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
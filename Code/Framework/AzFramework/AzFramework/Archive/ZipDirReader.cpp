@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <AzFramework/Archive/ZipDirReader.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+
+#include <zlib.h>
+
+namespace AZ::IO::ZipDir
+{
+    namespace ZipDirReaderInternal
+    {
+        // the CDR End record is followed by the archive comment, which is at most 64K long
+        constexpr size_t MaxCDREndSearchSize = sizeof(ZipFile::CDREnd) + 0xFFFF;
+
+        // paths escaping the destination folder are refused, as zip tools do
+        static bool IsSafeToExtract(AZStd::string_view path)
+        {
+            if (path.empty() || path.front() == '/' || path.find(':') != AZStd::string_view::npos)
+            {
+                return false;
+            }
+
+            for (AZStd::string_view::size_type start = 0; start <= path.size();)
+            {
+                AZStd::string_view::size_type end = path.find('/', start);
+                if (end == AZStd::string_view::npos)
+                {
+                    end = path.size();
+                }
+                if (path.substr(start, end - start) == "..")
+                {
+                    return false;
+                }
+                start = end + 1;
+            }
+            return true;
+        }
+    }
+
+    bool Reader::Open(AZStd::string_view archivePath)
+    {
+        Close();
+
+        m_archivePath = archivePath;
+        if (!m_file.Open(m_archivePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Archive", false, "Could not open archive %s for reading", m_archivePath.c_str());
+            return false;
+        }
+
+        ZipFile::CDREnd cdrEnd;
+        if (!ReadCDREnd(cdrEnd))
+        {
+            AZ_Warning("Archive", false, "Could not find the central directory of archive %s", m_archivePath.c_str());
+            Close();
+            return false;
+        }
+
+        if (cdrEnd.nDisk != 0 || cdrEnd.nCDRStartDisk != 0 || cdrEnd.numEntriesOnDisk != cdrEnd.numEntriesTotal)
+        {
+            AZ_Warning("Archive", false, "Archive %s spans several disks, which is not supported", m_archivePath.c_str());
+            Close();
+            return false;
+        }
+
+        AZStd::vector<uint8_t> cdr(cdrEnd.lCDRSize);
+        m_file.Seek(cdrEnd.lCDROffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        if (m_file.Read(cdr.size(), cdr.data()) != cdr.size())
+        {
+            AZ_Warning("Archive", false, "Could not read the central directory of archive %s", m_archivePath.c_str());
+            Close();
+            return false;
+        }
+
+        m_entries.reserve(cdrEnd.numEntriesTotal);
+        size_t position = 0;
+        while (position + sizeof(ZipFile::CDRFileHeader) <= cdr.size())
+        {
+            Entry entry;
+            memcpy(&entry.m_header, cdr.data() + position, sizeof(ZipFile::CDRFileHeader));
+            if (entry.m_header.lSignature != ZipFile::CDRFileHeader::SIGNATURE)
+            {
+                break;
+            }
+
+            const size_t nameOffset = position + sizeof(ZipFile::CDRFileHeader);
+            position = nameOffset + entry.m_header.nFileNameLength + entry.m_header.nExtraFieldLength + entry.m_header.nFileCommentLength;
+            if (position > cdr.size())
+            {
+                break;
+            }
+
+            entry.m_path.assign(reinterpret_cast<const char*>(cdr.data() + nameOffset), entry.m_header.nFileNameLength);
+            AZStd::replace(entry.m_path.begin(), entry.m_path.end(), '\\', '/');
+            m_entries.push_back(AZStd::move(entry));
+        }
+
+        if (m_entries.size() != cdrEnd.numEntriesTotal)
+        {
+            AZ_Warning("Archive", false, "The central directory of archive %s is corrupt", m_archivePath.c_str());
+            Close();
+            return false;
+        }
+
+        m_lCDROffset = cdrEnd.lCDROffset;
+        return true;
+    }
+
+    void Reader::Close()
+    {
+        m_file.Close();
+        m_entries.clear();
+        m_lCDROffset = 0;
+    }
+
+    bool Reader::IsOpen() const
+    {
+        return m_file.IsOpen();
+    }
+
+    const Reader::Entry* Reader::FindEntry(AZStd::string_view path) const
+    {
+        AZStd::string normalizedPath{ path };
+        AZStd::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
+
+        auto entryIt = AZStd::find_if(m_entries.begin(), m_entries.end(), [&normalizedPath](const Entry& entry)
+        {
+            return entry.m_path == normalizedPath;
+        });
+        return entryIt != m_entries.end() ? &(*entryIt) : nullptr;
+    }
+
+    bool Reader::ReadRawData(const Entry& entry, AZStd::vector<uint8_t>& data)
+    {
+        data.resize_no_construct(entry.m_header.desc.lSizeCompressed);
+
+        AZStd::scoped_lock lock(m_fileMutex);
+
+        // the local header can have an extra field of another length than the one in the CDR, so it is read to find the data
+        ZipFile::LocalFileHeader localHeader;
+        m_file.Seek(entry.m_header.lLocalHeaderOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        if (m_file.Read(sizeof(localHeader), &localHeader) != sizeof(localHeader) || localHeader.lSignature != ZipFile::LocalFileHeader::SIGNATURE)
+        {
+            AZ_Warning("Archive", false, "The local header of %s in archive %s is corrupt", entry.m_path.c_str(), m_archivePath.c_str());
+            return false;
+        }
+
+        const uint64_t dataOffset = uint64_t{ entry.m_header.lLocalHeaderOffset } + sizeof(localHeader) + localHeader.nFileNameLength + localHeader.nExtraFieldLength;
+        m_file.Seek(dataOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        if (!data.empty() && m_file.Read(data.size(), data.data()) != data.size())
+        {
+            AZ_Warning("Archive", false, "Could not read %s from archive %s", entry.m_path.c_str(), m_archivePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool Reader::ReadFile(const Entry& entry, AZStd::vector<uint8_t>& data)
+    {
+        const ZipFile::CDRFileHeader& header = entry.m_header;
+        if ((header.nFlags & ZipFile::GPF_ENCRYPTED) || (header.nMethod != ZipFile::METHOD_STORE && header.nMethod != ZipFile::METHOD_DEFLATE))
+        {
+            AZ_Warning("Archive", false, "%s in archive %s is encrypted or compressed with an unsupported method (%u)",
+                entry.m_path.c_str(), m_archivePath.c_str(), header.nMethod);
+            return false;
+        }
+
+        if (header.nMethod == ZipFile::METHOD_STORE)
+        {
+            if (header.desc.lSizeCompressed != header.desc.lSizeUncompressed || !ReadRawData(entry, data))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            AZStd::vector<uint8_t> compressedData;
+            if (!ReadRawData(entry, compressedData))
+            {
+                return false;
+            }
+
+            data.resize_no_construct(header.desc.lSizeUncompressed);
+            size_t uncompressedSize = data.size();
+            if (!data.empty()
+                && (ZipRawUncompress(data.data(), &uncompressedSize, compressedData.data(), compressedData.size()) != Z_OK || uncompressedSize != data.size()))
+            {
+                AZ_Warning("Archive", false, "Could not uncompress %s from archive %s", entry.m_path.c_str(), m_archivePath.c_str());
+                return false;
+            }
+        }
+
+        if (static_cast<uint32_t>(AZ::Crc32(data.data(), data.size())) != header.desc.lCRC32)
+        {
+            AZ_Warning("Archive", false, "The CRC of %s in archive %s does not match its data", entry.m_path.c_str(), m_archivePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool Reader::ExtractFiles(const AZStd::vector<const Entry*>& entries, AZStd::string_view destinationFolder, bool overwrite,
+        uint32_t threadCount, const AZStd::function<bool()>& isCancelled)
+    {
+        if (threadCount == 0)
+        {
+            threadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        }
+        threadCount = aznumeric_cast<uint32_t>(AZStd::min<size_t>(threadCount, entries.size()));
+
+        // the workers take the next entry until there is none left, or one of them failed
+        AZStd::atomic_size_t nextEntry{ 0 };
+        AZStd::atomic_bool failed{ false };
+        auto extractEntries = [this, &entries, destinationFolder, overwrite, &isCancelled, &nextEntry, &failed]()
+        {
+            for (size_t index = nextEntry++; index < entries.size() && !failed; index = nextEntry++)
+            {
+                if ((isCancelled && isCancelled()) || !ExtractFile(*entries[index], destinationFolder, overwrite))
+                {
+                    failed = true;
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> workers;
+        if (threadCount > 1)
+        {
+            AZStd::thread_desc workerDesc;
+            workerDesc.m_name = "ZipDir Reader";
+            workers.reserve(threadCount - 1);
+            for (uint32_t workerIndex = 1; workerIndex < threadCount; ++workerIndex)
+            {
+                workers.emplace_back(extractEntries, &workerDesc);
+            }
+        }
+        extractEntries();
+
+        for (AZStd::thread& worker : workers)
+        {
+            worker.join();
+        }
+        return !failed;
+    }
+
+    bool Reader::ExtractAll(AZStd::string_view destinationFolder, bool overwrite, uint32_t threadCount, const AZStd::function<bool()>& isCancelled)
+    {
+        AZStd::vector<const Entry*> entries;
+        entries.reserve(m_entries.size());
+        for (const Entry& entry : m_entries)
+        {
+            entries.push_back(&entry);
+        }
+        return ExtractFiles(entries, destinationFolder, overwrite, threadCount, isCancelled);
+    }
+
+    bool Reader::ReadCDREnd(ZipFile::CDREnd& cdrEnd)
+    {
+        const size_t fileSize = m_file.Length();
+        if (fileSize < sizeof(ZipFile::CDREnd))
+        {
+            return false;
+        }
+
+        const size_t tailSize = AZStd::min(fileSize, ZipDirReaderInternal::MaxCDREndSearchSize);
+        AZStd::vector<uint8_t> tail(tailSize);
+        m_file.Seek(fileSize - tailSize, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        if (m_file.Read(tail.size(), tail.data()) != tail.size())
+        {
+            return false;
+        }
+
+        // the last record whose comment ends at the end of the file is the CDR End
+        for (size_t position = tailSize - sizeof(ZipFile::CDREnd) + 1; position-- > 0;)
+        {
+            memcpy(&cdrEnd, tail.data() + position, sizeof(ZipFile::CDREnd));
+            if (cdrEnd.lSignature == ZipFile::CDREnd::SIGNATURE
+                && position + sizeof(ZipFile::CDREnd) + cdrEnd.nCommentLength <= tailSize
+                && uint64_t{ cdrEnd.lCDROffset } + cdrEnd.lCDRSize <= fileSize - tailSize + position)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Reader::ExtractFile(const Entry& entry, AZStd::string_view destinationFolder, bool overwrite)
+    {
+        if (!ZipDirReaderInternal::IsSafeToExtract(entry.m_path))
+        {
+            AZ_Warning("Archive", false, "%s in archive %s would be extracted outside of the destination folder", entry.m_path.c_str(), m_archivePath.c_str());
+            return false;
+        }
+
+        const AZ::IO::Path destinationPath = (AZ::IO::Path(destinationFolder) / entry.m_path).LexicallyNormal();
+        if (entry.IsDirectory())
+        {
+            return AZ::IO::SystemFile::Exists(destinationPath.c_str()) || AZ::IO::SystemFile::CreateDir(destinationPath.c_str());
+        }
+
+        if (!overwrite && AZ::IO::SystemFile::Exists(destinationPath.c_str()))
+        {
+            return true;
+        }
+
+        AZStd::vector<uint8_t> data;
+        if (!ReadFile(entry, data))
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile destinationFile;
+        if (!destinationFile.Open(destinationPath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY)
+            || destinationFile.Write(data.data(), data.size()) != data.size())
+        {
+            AZ_Warning("Archive", false, "Could not write %s extracted from archive %s", destinationPath.c_str(), m_archivePath.c_str());
+            return false;
+        }
+        return true;
+    }
+}
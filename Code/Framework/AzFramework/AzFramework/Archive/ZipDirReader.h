@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+// Declaration of the class that reads zip archives in process, for the tools
+// which list and extract archives. Unlike the Cache, which lower cases the paths
+// for the case insensitive lookups of the engine, the Reader keeps the paths
+// exactly as they are stored, so that extracted files get their original names.
+//
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
+
+namespace AZ::IO::ZipDir
+{
+    class Reader
+    {
+    public:
+        struct Entry
+        {
+            // the path of the file in the archive, with '/' separators
+            AZStd::string m_path;
+            // the central directory record of the file
+            ZipFile::CDRFileHeader m_header;
+
+            // zip tools store the folders as entries of their own, with a path ending with '/'
+            bool IsDirectory() const
+            {
+                return !m_path.empty() && m_path.back() == '/';
+            }
+        };
+
+        Reader() = default;
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // opens the archive and reads its central directory
+        bool Open(AZStd::string_view archivePath);
+        void Close();
+        bool IsOpen() const;
+
+        const AZStd::vector<Entry>& GetEntries() const
+        {
+            return m_entries;
+        }
+
+        // finds the entry by exact path, '\' separators are accepted. Returns nullptr if there is none
+        const Entry* FindEntry(AZStd::string_view path) const;
+
+        // the offset of the central directory, which is where the data of the files ends
+        uint32_t GetCDROffset() const
+        {
+            return m_lCDROffset;
+        }
+
+        // reads the data of the file as it is stored in the archive, compressed or not.
+        // Can be called from several threads at once.
+        bool ReadRawData(const Entry& entry, AZStd::vector<uint8_t>& data);
+
+        // reads and uncompresses the data of the file, and checks its CRC.
+        // Can be called from several threads at once.
+        bool ReadFile(const Entry& entry, AZStd::vector<uint8_t>& data);
+
+        // extracts the given entries to the destination folder, keeping their paths within the archive.
+        // The files are uncompressed and written on threadCount threads, 0 meaning one per hardware thread.
+        // Existing files are skipped unless overwrite is set. Stops early, and fails, once isCancelled returns true.
+        bool ExtractFiles(const AZStd::vector<const Entry*>& entries, AZStd::string_view destinationFolder, bool overwrite,
+            uint32_t threadCount = 0, const AZStd::function<bool()>& isCancelled = {});
+
+        // extracts all the files of the archive
+        bool ExtractAll(AZStd::string_view destinationFolder, bool overwrite, uint32_t threadCount = 0, const AZStd::function<bool()>& isCancelled = {});
+
+    protected:
+        // searches for the CDR End record in the tail of the file
+        bool ReadCDREnd(ZipFile::CDREnd& cdrEnd);
+        bool ExtractFile(const Entry& entry, AZStd::string_view destinationFolder, bool overwrite);
+
+        AZStd::string m_archivePath;
+        AZ::IO::SystemFile m_file;
+        // guards the position of m_file, the data of the files is read with a seek and a read
+        AZStd::mutex m_fileMutex;
+        AZStd::vector<Entry> m_entries;
+        uint32_t m_lCDROffset = 0;
+    };
+}
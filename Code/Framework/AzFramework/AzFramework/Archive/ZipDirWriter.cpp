@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirReader.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+#include <AzFramework/Archive/ZipDirWriter.h>
+
+#include <ctime>
+#include <zlib.h>
+
+namespace AZ::IO::ZipDir
+{
+    namespace ZipDirWriterInternal
+    {
+        // the archive is written without the Zip64 extensions, as the engine doesn't read them
+        constexpr uint64_t MaxArchiveSize = 0xFFFFFFFF;
+        constexpr uint32_t MaxEntryCount = 0xFFFF;
+
+        // general purpose flag telling that the file name is UTF-8
+        constexpr uint16_t GPF_UTF8_NAME = 1 << 11;
+
+        static bool IsAscii(AZStd::string_view path)
+        {
+            return AZStd::all_of(path.begin(), path.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+        }
+    }
+
+    Writer::Writer(const Settings& settings)
+        : m_settings(settings)
+    {
+    }
+
+    void Writer::AddFile(AZStd::string_view pathInArchive, AZStd::string_view sourcePath)
+    {
+        PendingFile& file = m_files.emplace_back();
+        file.m_pathInArchive = NormalizePathInArchive(pathInArchive);
+        file.m_sourcePath = sourcePath;
+    }
+
+    void Writer::AddData(AZStd::string_view pathInArchive, AZStd::vector<uint8_t> data)
+    {
+        PendingFile& file = m_files.emplace_back();
+        file.m_pathInArchive = NormalizePathInArchive(pathInArchive);
+        file.m_data = AZStd::move(data);
+    }
+
+    bool Writer::Write(AZStd::string_view archivePath, bool append, const AZStd::function<bool()>& isCancelled)
+    {
+        // the compressed files are written as METHOD_DEFLATE, which nothing but the Cache would read as ZSTD or LZ4
+        if (m_settings.m_compressionMethod == ZipFile::METHOD_DEFLATE && m_settings.m_codec != CompressionCodec::Codec::ZLIB)
+        {
+            AZ_Warning("Archive", false, "Could not write archive %.*s, only the ZLIB codec can be written", AZ_STRING_ARG(archivePath));
+            m_files.clear();
+            return false;
+        }
+
+        AZStd::vector<PendingFile> files = AZStd::move(m_files);
+        m_files.clear();
+
+        // a file added again replaces the one added before
+        AZStd::unordered_map<AZStd::string, size_t> fileIndices;
+        for (size_t index = 0; index < files.size(); ++index)
+        {
+            fileIndices[files[index].m_pathInArchive] = index;
+        }
+        if (fileIndices.size() != files.size())
+        {
+            AZStd::vector<PendingFile> uniqueFiles;
+            uniqueFiles.reserve(fileIndices.size());
+            for (size_t index = 0; index < files.size(); ++index)
+            {
+                if (fileIndices[files[index].m_pathInArchive] == index)
+                {
+                    uniqueFiles.push_back(AZStd::move(files[index]));
+                }
+            }
+            files = AZStd::move(uniqueFiles);
+        }
+
+        const AZStd::string archivePathString{ archivePath };
+        const AZStd::string tempArchivePath = archivePathString + ".tmp";
+        AZ::IO::SystemFile archiveFile;
+        if (!archiveFile.Open(tempArchivePath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Archive", false, "Could not create archive %s", tempArchivePath.c_str());
+            return false;
+        }
+
+        m_offset = 0;
+        m_cdr.clear();
+        m_cdrEntryCount = 0;
+        m_padding.assign(AZStd::max(m_settings.m_storedAlignment, 1u), 0);
+
+        auto failWrite = [&archiveFile, &tempArchivePath]()
+        {
+            archiveFile.Close();
+            AZ::IO::SystemFile::Delete(tempArchivePath.c_str());
+            return false;
+        };
+
+        // the files of the existing archive which are not replaced are copied first, as they are stored
+        if (append && AZ::IO::SystemFile::Exists(archivePathString.c_str()))
+        {
+            Reader existingArchive;
+            if (!existingArchive.Open(archivePathString))
+            {
+                return failWrite();
+            }
+
+            AZStd::vector<uint8_t> data;
+            for (const Reader::Entry& entry : existingArchive.GetEntries())
+            {
+                if (fileIndices.contains(NormalizePathInArchive(entry.m_path)))
+                {
+                    continue;
+                }
+                if ((isCancelled && isCancelled()) || !existingArchive.ReadRawData(entry, data)
+                    || !WriteFile(archiveFile, entry.m_path, entry.m_header, data.data()))
+                {
+                    return failWrite();
+                }
+            }
+        }
+
+        // the new files are read and compressed by the workers, and written here in order.
+        // A worker doesn't start on another file while the compressed files waiting to be written
+        // exceed the limit, unless it's the next one to be written
+        AZStd::vector<CompressedFile> compressedFiles(files.size());
+        AZStd::mutex pipelineMutex;
+        AZStd::condition_variable pipelineCondition;
+        size_t nextToCompress = 0;
+        size_t nextToWrite = 0;
+        size_t pendingBytes = 0;
+        bool stopWorkers = false;
+
+        auto compressFiles = [this, &files, &compressedFiles, &pipelineMutex, &pipelineCondition, &nextToCompress, &nextToWrite, &pendingBytes, &stopWorkers]()
+        {
+            for (;;)
+            {
+                size_t index = 0;
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(pipelineMutex);
+                    pipelineCondition.wait(lock, [&]()
+                    {
+                        return stopWorkers || nextToCompress >= files.size() || nextToCompress == nextToWrite || pendingBytes < m_settings.m_maxPendingBytes;
+                    });
+                    if (stopWorkers || nextToCompress >= files.size())
+                    {
+                        return;
+                    }
+                    index = nextToCompress++;
+                }
+
+                CompressedFile compressedFile;
+                compressedFile.m_success = CompressFile(files[index], compressedFile);
+                compressedFile.m_done = true;
+                {
+                    AZStd::scoped_lock lock(pipelineMutex);
+                    pendingBytes += compressedFile.m_data.size();
+                    compressedFiles[index] = AZStd::move(compressedFile);
+                }
+                pipelineCondition.notify_all();
+            }
+        };
+
+        uint32_t threadCount = m_settings.m_threadCount ? m_settings.m_threadCount : AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        threadCount = aznumeric_cast<uint32_t>(AZStd::min<size_t>(threadCount, files.size()));
+        AZStd::vector<AZStd::thread> workers;
+        workers.reserve(threadCount);
+        AZStd::thread_desc workerDesc;
+        workerDesc.m_name = "ZipDir Writer";
+        for (uint32_t workerIndex = 0; workerIndex < threadCount; ++workerIndex)
+        {
+            workers.emplace_back(compressFiles, &workerDesc);
+        }
+
+        // all the files get the time of the write, as the Cache does for the files it updates
+        time_t currentTime;
+        time(&currentTime);
+        tm localTime;
+        azlocaltime(&currentTime, &localTime);
+        localTime.tm_mon += 1; // DOS months go from 1 to 12
+        const uint16_t lastModTime = DOSTime(&localTime);
+        const uint16_t lastModDate = DOSDate(&localTime);
+
+        bool success = true;
+        for (size_t index = 0; index < files.size(); ++index)
+        {
+            CompressedFile compressedFile;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(pipelineMutex);
+                pipelineCondition.wait(lock, [&compressedFiles, index]() { return compressedFiles[index].m_done; });
+                compressedFile = AZStd::move(compressedFiles[index]);
+            }
+
+            if (compressedFile.m_success && !(isCancelled && isCancelled()))
+            {
+                ZipFile::CDRFileHeader header;
+                header.nMethod = compressedFile.m_method;
+                header.nLastModTime = lastModTime;
+                header.nLastModDate = lastModDate;
+                header.desc = compressedFile.m_desc;
+                success = WriteFile(archiveFile, files[index].m_pathInArchive, header, compressedFile.m_data.data());
+            }
+            else
+            {
+                success = false;
+            }
+
+            {
+                AZStd::scoped_lock lock(pipelineMutex);
+                pendingBytes -= compressedFile.m_data.size();
+                nextToWrite = index + 1;
+                stopWorkers = !success;
+            }
+            pipelineCondition.notify_all();
+
+            if (!success)
+            {
+                break;
+            }
+        }
+
+        for (AZStd::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        if (!success || !WriteCDR(archiveFile))
+        {
+            return failWrite();
+        }
+
+        archiveFile.Close();
+        if (!AZ::IO::SystemFile::Rename(tempArchivePath.c_str(), archivePathString.c_str(), true))
+        {
+            AZ_Warning("Archive", false, "Could not replace archive %s with %s", archivePathString.c_str(), tempArchivePath.c_str());
+            AZ::IO::SystemFile::Delete(tempArchivePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool Writer::CompressFile(PendingFile& file, CompressedFile& result) const
+    {
+        AZStd::vector<uint8_t> data;
+        if (file.m_sourcePath.empty())
+        {
+            data = AZStd::move(file.m_data);
+        }
+        else
+        {
+            AZ::IO::SystemFile sourceFile;
+            if (!sourceFile.Open(file.m_sourcePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                AZ_Warning("Archive", false, "Could not open %s to add it to the archive", file.m_sourcePath.c_str());
+                return false;
+            }
+            data.resize_no_construct(sourceFile.Length());
+            if (sourceFile.Read(data.size(), data.data()) != data.size())
+            {
+                AZ_Warning("Archive", false, "Could not read %s to add it to the archive", file.m_sourcePath.c_str());
+                return false;
+            }
+        }
+
+        if (data.size() > ZipDirWriterInternal::MaxArchiveSize)
+        {
+            AZ_Warning("Archive", false, "%s is too large to be added to an archive", file.m_pathInArchive.c_str());
+            return false;
+        }
+
+        result.m_desc.lCRC32 = static_cast<uint32_t>(AZ::Crc32(data.data(), data.size()));
+        result.m_desc.lSizeUncompressed = aznumeric_cast<uint32_t>(data.size());
+
+        if (m_settings.m_compressionMethod == ZipFile::METHOD_DEFLATE && !data.empty())
+        {
+            size_t compressedSize = Cache::GetCompressedSizeEstimate(data.size(), m_settings.m_codec);
+            AZStd::vector<uint8_t> compressedData;
+            compressedData.resize_no_construct(compressedSize);
+
+            const int error = ZipRawCompress(data.data(), &compressedSize, compressedData.data(), data.size(), m_settings.m_compressionLevel);
+            if (error != Z_OK)
+            {
+                AZ_Warning("Archive", false, "Could not compress %s (error %d)", file.m_pathInArchive.c_str(), error);
+                return false;
+            }
+
+            // the files which don't get smaller are stored, and aligned
+            if (compressedSize < data.size())
+            {
+                compressedData.resize(compressedSize);
+                result.m_method = ZipFile::METHOD_DEFLATE;
+                result.m_desc.lSizeCompressed = aznumeric_cast<uint32_t>(compressedSize);
+                result.m_data = AZStd::move(compressedData);
+                return true;
+            }
+        }
+
+        result.m_method = ZipFile::METHOD_STORE;
+        result.m_desc.lSizeCompressed = result.m_desc.lSizeUncompressed;
+        result.m_data = AZStd::move(data);
+        return true;
+    }
+
+    bool Writer::WriteFile(AZ::IO::SystemFile& archiveFile, AZStd::string_view pathInArchive, const ZipFile::CDRFileHeader& header, const uint8_t* data)
+    {
+        const uint32_t alignment = aznumeric_cast<uint32_t>(m_padding.size());
+        const size_t nameLength = pathInArchive.size();
+        const size_t dataSize = header.desc.lSizeCompressed;
+
+        // the first file isn't aligned: padding in front of it would keep the archive from starting with a local header
+        // as zip tools expect, and padding in its extra field would be missed by the fast initialization of the Cache
+        size_t paddingSize = 0;
+        if (header.nMethod == ZipFile::METHOD_STORE && dataSize > 0 && m_offset > 0)
+        {
+            const uint64_t dataOffset = m_offset + sizeof(ZipFile::LocalFileHeader) + nameLength;
+            paddingSize = (alignment - dataOffset % alignment) % alignment;
+        }
+
+        if (m_cdrEntryCount >= ZipDirWriterInternal::MaxEntryCount
+            || m_offset + paddingSize + sizeof(ZipFile::LocalFileHeader) + nameLength + dataSize > ZipDirWriterInternal::MaxArchiveSize)
+        {
+            AZ_Warning("Archive", false, "Adding %.*s would make the archive too large", AZ_STRING_ARG(pathInArchive));
+            return false;
+        }
+
+        if (paddingSize > 0 && archiveFile.Write(m_padding.data(), paddingSize) != paddingSize)
+        {
+            return false;
+        }
+        m_offset += paddingSize;
+
+        // the files copied from an existing archive stay encrypted if they were
+        uint16_t flags = header.nFlags & ZipFile::GPF_ENCRYPTED;
+        if (!ZipDirWriterInternal::IsAscii(pathInArchive))
+        {
+            flags |= ZipDirWriterInternal::GPF_UTF8_NAME;
+        }
+
+        ZipFile::LocalFileHeader localHeader;
+        localHeader.lSignature = ZipFile::LocalFileHeader::SIGNATURE;
+        localHeader.nVersionNeeded = 20;
+        localHeader.nFlags = flags;
+        localHeader.nMethod = header.nMethod;
+        localHeader.nLastModTime = header.nLastModTime;
+        localHeader.nLastModDate = header.nLastModDate;
+        localHeader.desc = header.desc;
+        localHeader.nFileNameLength = aznumeric_cast<uint16_t>(nameLength);
+        localHeader.nExtraFieldLength = 0;
+
+        if (archiveFile.Write(&localHeader, sizeof(localHeader)) != sizeof(localHeader)
+            || archiveFile.Write(pathInArchive.data(), nameLength) != nameLength
+            || (dataSize > 0 && archiveFile.Write(data, dataSize) != dataSize))
+        {
+            AZ_Warning("Archive", false, "Could not write %.*s to the archive", AZ_STRING_ARG(pathInArchive));
+            return false;
+        }
+
+        ZipFile::CDRFileHeader cdrHeader;
+        cdrHeader.lSignature = ZipFile::CDRFileHeader::SIGNATURE;
+        cdrHeader.nVersionMadeBy = 20;
+        cdrHeader.nVersionNeeded = 20;
+        cdrHeader.nFlags = flags;
+        cdrHeader.nMethod = header.nMethod;
+        cdrHeader.nLastModTime = header.nLastModTime;
+        cdrHeader.nLastModDate = header.nLastModDate;
+        cdrHeader.desc = header.desc;
+        cdrHeader.nFileNameLength = aznumeric_cast<uint16_t>(nameLength);
+        cdrHeader.lAttrExternal = header.lAttrExternal;
+        cdrHeader.lLocalHeaderOffset = aznumeric_cast<uint32_t>(m_offset);
+
+        const auto* cdrHeaderBytes = reinterpret_cast<const uint8_t*>(&cdrHeader);
+        m_cdr.insert(m_cdr.end(), cdrHeaderBytes, cdrHeaderBytes + sizeof(cdrHeader));
+        m_cdr.insert(m_cdr.end(), pathInArchive.begin(), pathInArchive.end());
+        ++m_cdrEntryCount;
+
+        m_offset += sizeof(localHeader) + nameLength + dataSize;
+        return true;
+    }
+
+    bool Writer::WriteCDR(AZ::IO::SystemFile& archiveFile)
+    {
+        if (m_offset + m_cdr.size() + sizeof(ZipFile::CDREnd) > ZipDirWriterInternal::MaxArchiveSize)
+        {
+            AZ_Warning("Archive", false, "The central directory doesn't fit in the archive");
+            return false;
+        }
+
+        ZipFile::CDREnd cdrEnd;
+        cdrEnd.lSignature = ZipFile::CDREnd::SIGNATURE;
+        cdrEnd.numEntriesOnDisk = aznumeric_cast<uint16_t>(m_cdrEntryCount);
+        cdrEnd.numEntriesTotal = aznumeric_cast<uint16_t>(m_cdrEntryCount);
+        cdrEnd.lCDRSize = aznumeric_cast<uint32_t>(m_cdr.size());
+        cdrEnd.lCDROffset = aznumeric_cast<uint32_t>(m_offset);
+
+        return (m_cdr.empty() || archiveFile.Write(m_cdr.data(), m_cdr.size()) == m_cdr.size())
+            && archiveFile.Write(&cdrEnd, sizeof(cdrEnd)) == sizeof(cdrEnd);
+    }
+
+    AZStd::string Writer::NormalizePathInArchive(AZStd::string_view pathInArchive)
+    {
+        AZStd::string path{ pathInArchive };
+        AZStd::replace(path.begin(), path.end(), '\\', '/');
+        while (path.starts_with("./"))
+        {
+            path.erase(0, 2);
+        }
+        while (path.starts_with('/'))
+        {
+            path.erase(0, 1);
+        }
+        return path;
+    }
+}
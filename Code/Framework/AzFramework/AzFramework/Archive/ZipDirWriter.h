@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+// Declaration of the class that writes zip archives in process, for the tools
+// which create archives and bundles. The files are read and compressed on several
+// threads, and written to the archive one after the other in the order they were
+// added, so that the same files always produce the same layout.
+// The data of stored files starts at a multiple of the alignment, so that it can
+// be memory mapped or read by the streamer in whole blocks. The padding goes in
+// front of the local file header rather than in its extra field, because the fast
+// initialization of the Cache estimates the data offsets from the CDR alone.
+// The first file of the archive is the one exception: its local header has to be
+// at the very start of the archive, so its data is never aligned.
+//
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
+
+namespace AZ::IO::ZipDir
+{
+    class Writer
+    {
+    public:
+        inline static constexpr uint32_t DefaultStoredAlignment = 4096;
+        inline static constexpr size_t DefaultMaxPendingBytes = 256 * 1024 * 1024;
+
+        struct Settings
+        {
+            // METHOD_DEFLATE compresses the files with zlib, METHOD_STORE stores them as they are.
+            // The files zlib can't make smaller are stored either way.
+            uint16_t m_compressionMethod = ZipFile::METHOD_DEFLATE;
+            // zlib level, from 0 (fastest) to 9 (best), -1 for the zlib default
+            int m_compressionLevel = -1;
+            // only ZLIB can be written, as zip tools and the Reader expect METHOD_DEFLATE data to be zlib. Write fails with any other codec
+            CompressionCodec::Codec m_codec = CompressionCodec::Codec::ZLIB;
+            // the data of stored files starts at a multiple of this, 0 or 1 to pack the files without padding
+            uint32_t m_storedAlignment = DefaultStoredAlignment;
+            // the number of threads reading and compressing the files, 0 for one per hardware thread
+            uint32_t m_threadCount = 0;
+            // the size of the compressed files waiting to be written, beyond which the threads wait for the writes to catch up
+            size_t m_maxPendingBytes = DefaultMaxPendingBytes;
+        };
+
+        Writer() = default;
+        explicit Writer(const Settings& settings);
+
+        // queues the file at sourcePath to be written to the archive as pathInArchive.
+        // '\' separators are stored as '/', and a later file with the same path replaces an earlier one
+        void AddFile(AZStd::string_view pathInArchive, AZStd::string_view sourcePath);
+
+        // queues data to be written to the archive as pathInArchive
+        void AddData(AZStd::string_view pathInArchive, AZStd::vector<uint8_t> data);
+
+        size_t GetFileCount() const
+        {
+            return m_files.size();
+        }
+
+        // writes the queued files to the archive and empties the queue.
+        // If append is set and the archive exists, its files which are not replaced are kept, otherwise the archive is created anew.
+        // The archive is written to a temporary file which replaces it once complete, so it is left untouched on failure.
+        // Fails if a file can't be read, the archive can't be written or the codec isn't ZLIB, and stops early once isCancelled returns true.
+        bool Write(AZStd::string_view archivePath, bool append, const AZStd::function<bool()>& isCancelled = {});
+
+    protected:
+        struct PendingFile
+        {
+            AZStd::string m_pathInArchive;
+            AZStd::string m_sourcePath; // empty when the data was added directly
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        struct CompressedFile
+        {
+            bool m_done = false;
+            bool m_success = false;
+            uint16_t m_method = ZipFile::METHOD_STORE;
+            ZipFile::DataDescriptor m_desc;
+            AZStd::vector<uint8_t> m_data; // the data as it's written to the archive
+        };
+
+        // reads and compresses a file, on one of the worker threads
+        bool CompressFile(PendingFile& file, CompressedFile& result) const;
+
+        // writes the local header and the data of a file at the end of the archive, and records it in the CDR
+        bool WriteFile(AZ::IO::SystemFile& archiveFile, AZStd::string_view pathInArchive, const ZipFile::CDRFileHeader& header, const uint8_t* data);
+
+        bool WriteCDR(AZ::IO::SystemFile& archiveFile);
+
+        static AZStd::string NormalizePathInArchive(AZStd::string_view pathInArchive);
+
+        Settings m_settings;
+        AZStd::vector<PendingFile> m_files;
+
+        // state of the archive being written
+        uint64_t m_offset = 0;
+        AZStd::vector<uint8_t> m_cdr;
+        uint32_t m_cdrEntryCount = 0;
+        AZStd::vector<uint8_t> m_padding;
+    };
+}
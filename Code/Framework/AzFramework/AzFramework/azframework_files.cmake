@@ -32,14 +32,18 @@ set(FILES
     Archive/ZipDirCacheFactory.cpp
     Archive/ZipDirFind.cpp
     Archive/ZipDirList.cpp
+    Archive/ZipDirReader.cpp
     Archive/ZipDirStructures.cpp
     Archive/ZipDirTree.cpp
+    Archive/ZipDirWriter.cpp
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
     Archive/ZipDirList.h
+    Archive/ZipDirReader.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
+    Archive/ZipDirWriter.h
     Archive/ZipFileFormat.h
     Asset/SimpleAsset.cpp
     Asset/SimpleAsset.h
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/Archive/ZipDirReader.h>
+#include <AzFramework/Archive/ZipDirWriter.h>
+#include <AZTestShared/Utils/Utils.h>
+
+namespace UnitTest
+{
+    class ZipDirTestFixture
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        ZipDirTestFixture()
+            : m_application{ AZStd::make_unique<AzFramework::Application>() }
+        {
+        }
+
+        void SetUp() override
+        {
+            AZ::SettingsRegistryInterface* registry = AZ::SettingsRegistry::Get();
+
+            auto projectPathKey =
+                AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey) + "/project_path";
+            registry->Set(projectPathKey, "AutomatedTesting");
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*registry);
+
+            m_application->Start({});
+            // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
+            // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
+            // in the unit tests.
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            ASSERT_TRUE(m_tempDir.IsValid());
+        }
+
+        void TearDown() override
+        {
+            m_application->Stop();
+        }
+
+    protected:
+        AZStd::string GetTempPath(AZStd::string_view fileName) const
+        {
+            return (AZ::IO::Path(m_tempDir.GetDirectory()) / fileName).Native();
+        }
+
+        // data zlib can't make smaller, so that it is stored
+        static AZStd::vector<uint8_t> CreateRandomData(size_t size, uint32_t seed)
+        {
+            AZStd::vector<uint8_t> data(size);
+            uint32_t state = seed * 2654435761u + 1;
+            for (uint8_t& byte : data)
+            {
+                state = state * 1664525u + 1013904223u;
+                byte = static_cast<uint8_t>(state >> 24);
+            }
+            return data;
+        }
+
+        static AZStd::vector<uint8_t> CreateCompressibleData(size_t size, uint32_t seed)
+        {
+            AZStd::vector<uint8_t> data(size);
+            for (size_t index = 0; index < size; ++index)
+            {
+                data[index] = static_cast<uint8_t>('a' + (index / 16 + seed) % 4);
+            }
+            return data;
+        }
+
+        static AZStd::vector<uint8_t> ReadFile(AZ::IO::ZipDir::Reader& reader, AZStd::string_view path)
+        {
+            AZStd::vector<uint8_t> data;
+            const AZ::IO::ZipDir::Reader::Entry* entry = reader.FindEntry(path);
+            EXPECT_NE(nullptr, entry);
+            if (entry)
+            {
+                EXPECT_TRUE(reader.ReadFile(*entry, data));
+            }
+            return data;
+        }
+
+        ScopedTemporaryDirectory m_tempDir;
+
+    private:
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+    };
+
+    TEST_F(ZipDirTestFixture, Write_StoredFiles_DataStartsAtAMultipleOfTheAlignment)
+    {
+        AZ::IO::ZipDir::Writer::Settings settings;
+        settings.m_compressionMethod = AZ::IO::ZipFile::METHOD_STORE;
+        AZ::IO::ZipDir::Writer writer(settings);
+        writer.AddData("first.bin", CreateRandomData(1000, 1));
+        writer.AddData("folder/second.bin", CreateRandomData(5000, 2));
+        writer.AddData("folder/subfolder/third_with_a_longer_name.bin", CreateRandomData(3, 3));
+        writer.AddData("fourth.bin", CreateRandomData(4096, 4));
+
+        const AZStd::string archivePath = GetTempPath("stored.pak");
+        ASSERT_TRUE(writer.Write(archivePath, false));
+
+        AZ::IO::ZipDir::Reader reader;
+        ASSERT_TRUE(reader.Open(archivePath));
+        ASSERT_EQ(4u, reader.GetEntries().size());
+        for (const AZ::IO::ZipDir::Reader::Entry& entry : reader.GetEntries())
+        {
+            EXPECT_EQ(AZ::IO::ZipFile::METHOD_STORE, entry.m_header.nMethod);
+
+            // the first file starts the archive with its local header, so it is the only one which isn't aligned
+            if (entry.m_header.lLocalHeaderOffset == 0)
+            {
+                EXPECT_STREQ("first.bin", entry.m_path.c_str());
+                continue;
+            }
+            const uint64_t dataOffset = uint64_t{ entry.m_header.lLocalHeaderOffset } + sizeof(AZ::IO::ZipFile::LocalFileHeader) + entry.m_path.size();
+            EXPECT_EQ(0u, dataOffset % AZ::IO::ZipDir::Writer::DefaultStoredAlignment) << entry.m_path.c_str();
+        }
+
+        EXPECT_EQ(CreateRandomData(5000, 2), ReadFile(reader, "folder/second.bin"));
+        EXPECT_EQ(CreateRandomData(4096, 4), ReadFile(reader, "fourth.bin"));
+    }
+
+    TEST_F(ZipDirTestFixture, Write_Append_KeepsTheFilesWhichAreNotReplaced)
+    {
+        const AZStd::string archivePath = GetTempPath("append.pak");
+        {
+            AZ::IO::ZipDir::Writer writer;
+            writer.AddData("kept.txt", CreateCompressibleData(10000, 1));
+            writer.AddData("replaced.bin", CreateRandomData(2000, 2));
+            ASSERT_TRUE(writer.Write(archivePath, false));
+        }
+        {
+            AZ::IO::ZipDir::Writer writer;
+            writer.AddData("replaced.bin", CreateRandomData(3000, 3));
+            writer.AddData("added.txt", CreateCompressibleData(500, 4));
+            ASSERT_TRUE(writer.Write(archivePath, true));
+        }
+
+        AZ::IO::ZipDir::Reader reader;
+        ASSERT_TRUE(reader.Open(archivePath));
+        EXPECT_EQ(3u, reader.GetEntries().size());
+        EXPECT_EQ(CreateCompressibleData(10000, 1), ReadFile(reader, "kept.txt"));
+        EXPECT_EQ(CreateRandomData(3000, 3), ReadFile(reader, "replaced.bin"));
+        EXPECT_EQ(CreateCompressibleData(500, 4), ReadFile(reader, "added.txt"));
+    }
+
+    TEST_F(ZipDirTestFixture, Write_CodecOtherThanZlib_FailsWithoutWritingTheArchive)
+    {
+        AZ::IO::ZipDir::Writer::Settings settings;
+        settings.m_codec = AZ::IO::CompressionCodec::Codec::ZSTD;
+        AZ::IO::ZipDir::Writer writer(settings);
+        writer.AddData("file.txt", CreateCompressibleData(1000, 1));
+
+        const AZStd::string archivePath = GetTempPath("zstd.pak");
+        EXPECT_FALSE(writer.Write(archivePath, false));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(archivePath.c_str()));
+    }
+
+    TEST_F(ZipDirTestFixture, ReadFile_CorruptData_FailsTheCRCCheck)
+    {
+        AZ::IO::ZipDir::Writer::Settings settings;
+        settings.m_compressionMethod = AZ::IO::ZipFile::METHOD_STORE;
+        AZ::IO::ZipDir::Writer writer(settings);
+        writer.AddData("padding.bin", CreateRandomData(100, 1));
+        writer.AddData("corrupt.bin", CreateRandomData(1000, 2));
+
+        const AZStd::string archivePath = GetTempPath("corrupt.pak");
+        ASSERT_TRUE(writer.Write(archivePath, false));
+
+        uint64_t dataOffset = 0;
+        {
+            AZ::IO::ZipDir::Reader reader;
+            ASSERT_TRUE(reader.Open(archivePath));
+            const AZ::IO::ZipDir::Reader::Entry* entry = reader.FindEntry("corrupt.bin");
+            ASSERT_NE(nullptr, entry);
+            dataOffset = uint64_t{ entry->m_header.lLocalHeaderOffset } + sizeof(AZ::IO::ZipFile::LocalFileHeader) + entry->m_path.size();
+        }
+
+        {
+            AZ::IO::SystemFile archiveFile;
+            ASSERT_TRUE(archiveFile.Open(archivePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+            uint8_t byte = 0;
+            archiveFile.Seek(dataOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            ASSERT_EQ(1u, archiveFile.Read(1, &byte));
+            byte ^= 0xFF;
+            archiveFile.Seek(dataOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            ASSERT_EQ(1u, archiveFile.Write(&byte, 1));
+        }
+
+        AZ::IO::ZipDir::Reader reader;
+        ASSERT_TRUE(reader.Open(archivePath));
+        const AZ::IO::ZipDir::Reader::Entry* entry = reader.FindEntry("corrupt.bin");
+        ASSERT_NE(nullptr, entry);
+        AZStd::vector<uint8_t> data;
+        EXPECT_FALSE(reader.ReadFile(*entry, data));
+        EXPECT_FALSE(reader.ExtractAll(GetTempPath("extracted"), true));
+    }
+
+    TEST_F(ZipDirTestFixture, ExtractAll_PathOutsideOfTheDestination_IsRejected)
+    {
+        AZ::IO::ZipDir::Writer writer;
+        writer.AddData("../escaped.txt", CreateCompressibleData(100, 1));
+        writer.AddData("folder/../../escaped_through_folder.txt", CreateCompressibleData(100, 2));
+
+        const AZStd::string archivePath = GetTempPath("escape.pak");
+        ASSERT_TRUE(writer.Write(archivePath, false));
+
+        AZ::IO::ZipDir::Reader reader;
+        ASSERT_TRUE(reader.Open(archivePath));
+        for (const AZ::IO::ZipDir::Reader::Entry& entry : reader.GetEntries())
+        {
+            EXPECT_FALSE(reader.ExtractFiles({ &entry }, GetTempPath("destination/extracted"), true));
+        }
+
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(GetTempPath("destination/escaped.txt").c_str()));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(GetTempPath("destination/escaped_through_folder.txt").c_str()));
+    }
+
+    TEST_F(ZipDirTestFixture, Write_ManyFilesOnSeveralThreads_ReadBackInTheOrderTheyWereAdded)
+    {
+        constexpr uint32_t FileCount = 200;
+
+        AZ::IO::ZipDir::Writer::Settings settings;
+        settings.m_threadCount = 4;
+        // small enough for the workers to wait for the writes to catch up
+        settings.m_maxPendingBytes = 64 * 1024;
+        AZ::IO::ZipDir::Writer writer(settings);
+        for (uint32_t index = 0; index < FileCount; ++index)
+        {
+            const size_t size = (index * 7919) % 20000;
+            writer.AddData(AZStd::string::format("folder%u/file%u.bin", index % 5, index),
+                index % 2 ? CreateRandomData(size, index) : CreateCompressibleData(size, index));
+        }
+
+        const AZStd::string archivePath = GetTempPath("threaded.pak");
+        ASSERT_TRUE(writer.Write(archivePath, false));
+        EXPECT_EQ(0u, writer.GetFileCount());
+
+        AZ::IO::ZipDir::Reader reader;
+        ASSERT_TRUE(reader.Open(archivePath));
+        ASSERT_EQ(FileCount, reader.GetEntries().size());
+        for (uint32_t index = 0; index < FileCount; ++index)
+        {
+            const AZ::IO::ZipDir::Reader::Entry& entry = reader.GetEntries()[index];
+            EXPECT_STREQ(AZStd::string::format("folder%u/file%u.bin", index % 5, index).c_str(), entry.m_path.c_str());
+
+            const size_t size = (index * 7919) % 20000;
+            AZStd::vector<uint8_t> data;
+            EXPECT_TRUE(reader.ReadFile(entry, data));
+            EXPECT_EQ(index % 2 ? CreateRandomData(size, index) : CreateCompressibleData(size, index), data) << entry.m_path.c_str();
+        }
+    }
+
+    TEST_F(ZipDirTestFixture, Write_ArchiveOpenedByTheEngine_ReadsTheFiles)
+    {
+        AZ::IO::ZipDir::Writer writer;
+        writer.AddData("stored.bin", CreateRandomData(5000, 1));
+        writer.AddData("folder/compressed.txt", CreateCompressibleData(20000, 2));
+
+        const AZStd::string archivePath = GetTempPath("engine.pak");
+        ASSERT_TRUE(writer.Write(archivePath, false));
+
+        // the fast initialization estimates the data offsets from the CDR, which the padding mustn't throw off
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(archivePath.c_str());
+            ASSERT_TRUE(cache);
+
+            for (const auto& [path, expectedData] : {
+                AZStd::pair<AZStd::string_view, AZStd::vector<uint8_t>>{ "stored.bin", CreateRandomData(5000, 1) },
+                AZStd::pair<AZStd::string_view, AZStd::vector<uint8_t>>{ "folder/compressed.txt", CreateCompressibleData(20000, 2) } })
+            {
+                AZ::IO::ZipDir::FileEntry* fileEntry = cache->FindFile(path);
+                ASSERT_NE(nullptr, fileEntry);
+                AZStd::vector<uint8_t> data(fileEntry->desc.lSizeUncompressed);
+                EXPECT_EQ(AZ::IO::ZipDir::ZD_ERROR_SUCCESS, cache->ReadFile(fileEntry, nullptr, data.data()));
+                EXPECT_EQ(expectedData, data);
+            }
+        }
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+        ASSERT_TRUE(archive->OpenPack("@assets@/zipdirtest", archivePath));
+
+        AZ::IO::HandleType fileHandle = archive->FOpen("@assets@/zipdirtest/stored.bin", "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        AZStd::vector<uint8_t> data(archive->FGetSize(fileHandle));
+        EXPECT_EQ(data.size(), archive->FReadRaw(data.data(), 1, data.size(), fileHandle));
+        archive->FClose(fileHandle);
+        EXPECT_EQ(CreateRandomData(5000, 1), data);
+
+        EXPECT_TRUE(archive->ClosePack(archivePath));
+    }
+}
@@ -11,6 +11,7 @@ set(FILES
     Spawnable/SpawnableEntitiesManagerTests.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
+    ZipDirTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
     CameraInputTests.cpp
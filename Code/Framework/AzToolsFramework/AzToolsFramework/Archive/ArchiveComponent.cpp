@@ -10,103 +10,131 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Serialization/EditContext.h>
 
-#include <AzFramework/StringFunc/StringFunc.h>
-
-#include <AzFramework/Process/ProcessCommunicator.h>
-#include <AzFramework/Process/ProcessWatcher.h>
+#include <AzFramework/Archive/ZipDirReader.h>
+#include <AzFramework/Archive/ZipDirWriter.h>
 #include <AzFramework/FileFunc/FileFunc.h>
 
 namespace AzToolsFramework
 {
-    // Forward declare platform specific functions
-    namespace Platform
-    {
-        AZStd::string GetZipExePath();
-        AZStd::string GetUnzipExePath();
-
-        AZStd::string GetCreateArchiveCommand(const AZStd::string& archivePath, const AZStd::string& dirToArchive);
-        AZStd::string GetExtractArchiveCommand(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool includeRoot);
-        AZStd::string GetAddFileToArchiveCommand(const AZStd::string& archivePath, const AZStd::string& file);
-        AZStd::string GetAddFilesToArchiveCommand(const AZStd::string& archivePath, const AZStd::string& listFilePath);
-        AZStd::string GetExtractFileCommand(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overWrite);
-        AZStd::string GetListFilesInArchiveCommand(const AZStd::string& archivePath);
-        void ParseConsoleOutputFromListFilesInArchive(const AZStd::string& consoleOutput, AZStd::vector<AZStd::string>& fileEntries);
-    }
-
     const char s_traceName[] = "ArchiveComponent";
-    const unsigned int g_sleepDuration = 1;
 
-    // Echoes all results of stdout and stderr to console and never blocks
-    class ConsoleEchoCommunicator
+    namespace ArchiveComponentInternal
     {
-    public:
-        ConsoleEchoCommunicator(AzFramework::ProcessCommunicator* communicator)
-            : m_communicator(communicator)
+        // the level CreateArchive used to pass to the zip tool, favoring speed for the large folders it archives
+        static constexpr int CreateArchiveCompressionLevel = 1;
+
+        // the path a file added to an archive gets within it: relative paths are kept as they are,
+        // absolute paths are made relative to the working directory, or reduced to the file name if they are outside of it
+        static AZ::IO::Path GetPathInArchive(const AZStd::string& workingDirectory, const AZStd::string& file)
         {
+            AZ::IO::PathView filePath(file);
+            if (!filePath.IsAbsolute())
+            {
+                return AZ::IO::Path(filePath).LexicallyNormal();
+            }
+            if (!workingDirectory.empty() && filePath.IsRelativeTo(AZ::IO::PathView(workingDirectory)))
+            {
+                return AZ::IO::Path(filePath).LexicallyRelative(AZ::IO::PathView(workingDirectory));
+            }
+            return AZ::IO::Path(filePath.Filename());
         }
 
-        ~ConsoleEchoCommunicator()
+        static AZ::IO::Path GetSourcePath(const AZStd::string& workingDirectory, const AZStd::string& file)
         {
+            AZ::IO::PathView filePath(file);
+            if (filePath.IsAbsolute() || workingDirectory.empty())
+            {
+                return AZ::IO::Path(filePath);
+            }
+            return AZ::IO::Path(workingDirectory) / filePath;
         }
 
-        // Call this periodically to drain the buffers
-        void Pump()
+        static bool AddFilesToWriter(AZ::IO::ZipDir::Writer& writer, const AZStd::string& workingDirectory, const AZStd::vector<AZStd::string>& files)
         {
-            if (m_communicator->IsValid())
+            for (const AZStd::string& file : files)
             {
-                AZ::u32 readBufferSize = 0;
-                AZStd::string readBuffer;
-                // Don't call readOutput unless there is output or else it will block...
-                readBufferSize = m_communicator->PeekOutput();
-                if (readBufferSize)
+                AZ::IO::Path sourcePath = GetSourcePath(workingDirectory, file);
+                if (!AZ::IO::SystemFile::Exists(sourcePath.c_str()))
                 {
-                    readBuffer.resize_no_construct(readBufferSize + 1);
-                    readBuffer[readBufferSize] = '\0';
-                    m_communicator->ReadOutput(readBuffer.data(), readBufferSize);
-                    EchoBuffer(readBuffer);
+                    AZ_Error(s_traceName, false, "Unable to add ( %s ) to the archive, the file does not exist.\n", sourcePath.c_str());
+                    return false;
                 }
-                readBufferSize = m_communicator->PeekError();
-                if (readBufferSize)
+                writer.AddFile(GetPathInArchive(workingDirectory, file).Native(), sourcePath.Native());
+            }
+            return true;
+        }
+
+        // the list file has one path per line, as the zip tools expect it
+        static bool ReadListFile(const AZStd::string& listFilePath, AZStd::vector<AZStd::string>& files)
+        {
+            auto readResult = AzFramework::FileFunc::ReadTextFileByLine(listFilePath, [&files](const char* line)
+            {
+                AZStd::string_view file(line);
+                while (!file.empty() && (file.back() == '\n' || file.back() == '\r'))
                 {
-                    readBuffer.resize_no_construct(readBufferSize + 1);
-                    readBuffer[readBufferSize] = '\0';
-                    m_communicator->ReadError(readBuffer.data(), readBufferSize);
-                    EchoBuffer(readBuffer);
+                    file.remove_suffix(1);
                 }
+                if (!file.empty())
+                {
+                    files.emplace_back(file);
+                }
+                return true;
+            });
+            if (!readResult.IsSuccess())
+            {
+                AZ_Error(s_traceName, false, "%s\n", readResult.GetError().c_str());
+                return false;
             }
+            return true;
         }
 
-    private:
-        void EchoBuffer(const AZStd::string& buffer)
+        static bool ExtractArchive(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool extractWithRootDirectory,
+            const AZStd::function<bool()>& isCancelled)
         {
-            size_t startIndex = 0;
-            size_t endIndex = 0;
-            const size_t bufferSize = buffer.size();
-            for (size_t i = 0; i < bufferSize; ++i)
+            AZ::IO::ZipDir::Reader reader;
+            if (!reader.Open(archivePath))
             {
-                if (buffer[i] == '\n' || buffer[i] == '\0')
+                AZ_Error(s_traceName, false, "Unable to open the archive ( %s ).\n", archivePath.c_str());
+                return false;
+            }
+
+            // the archive is extracted in a folder of its name, like the zip tools do
+            AZ::IO::Path destination(destinationPath);
+            if (extractWithRootDirectory)
+            {
+                destination /= AZ::IO::PathView(archivePath).Stem();
+            }
+
+            // existing files are kept, as they were with the zip tools
+            return reader.ExtractAll(destination.Native(), false, 0, isCancelled);
+        }
+
+        static bool ListFilesInArchive(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& fileEntries)
+        {
+            AZ::IO::ZipDir::Reader reader;
+            if (!reader.Open(archivePath))
+            {
+                AZ_Error(s_traceName, false, "Unable to open the archive ( %s ).\n", archivePath.c_str());
+                return false;
+            }
+
+            for (const AZ::IO::ZipDir::Reader::Entry& entry : reader.GetEntries())
+            {
+                // folders are not reported, only the files in them
+                if (!entry.IsDirectory())
                 {
-                    endIndex = i;
-                    bool isEmptyMessage = (endIndex - startIndex == 1) && (buffer[startIndex] == '\r');
-                    if (!isEmptyMessage)
-                    {
-                        AZ_Printf(s_traceName, "%s", buffer.substr(startIndex, endIndex - startIndex).c_str());
-                    }
-                    startIndex = endIndex + 1;
+                    fileEntries.push_back(entry.m_path);
                 }
             }
+            return true;
         }
-
-        AzFramework::ProcessCommunicator* m_communicator = nullptr;
-    };
+    } // namespace ArchiveComponentInternal
 
     void ArchiveComponent::Activate()
     {
-        m_zipExePath = Platform::GetZipExePath();
-        m_unzipExePath = Platform::GetUnzipExePath();
-
         ArchiveCommands::Bus::Handler::BusConnect();
     }
 
@@ -149,8 +177,33 @@ namespace AzToolsFramework
 
     void ArchiveComponent::CreateArchive(const AZStd::string& archivePath, const AZStd::string& dirToArchive, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = AZStd::string::format(R"(a -tzip -mx=1 "%s" -r "%s\*")", archivePath.c_str(), dirToArchive.c_str());
-        LaunchZipExe(m_zipExePath, commandLineArgs, respCallback, taskHandle);
+        auto createArchiveTask = [archivePath, dirToArchive](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
+        {
+            auto filesResult = AzFramework::FileFunc::FindFilesInPath(dirToArchive, "*", true);
+            if (!filesResult.IsSuccess())
+            {
+                AZ_Error(s_traceName, false, "%s\n", filesResult.GetError().c_str());
+                return false;
+            }
+
+            AZ::IO::ZipDir::Writer::Settings settings;
+            settings.m_compressionLevel = ArchiveComponentInternal::CreateArchiveCompressionLevel;
+            AZ::IO::ZipDir::Writer writer(settings);
+
+            for (const AZStd::string& file : filesResult.GetValue())
+            {
+                // the archive may be written within the folder it archives, skip it and its temporary file
+                if (file.starts_with(archivePath))
+                {
+                    continue;
+                }
+                writer.AddFile(AZ::IO::Path(file).LexicallyRelative(AZ::IO::PathView(dirToArchive)).Native(), file);
+            }
+
+            // like the zip tools, an existing archive is updated rather than replaced
+            return writer.Write(archivePath, true, isCancelled);
+        };
+        RunArchiveTask(createArchiveTask, respCallback, taskHandle);
     }
 
     bool ArchiveComponent::CreateArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& dirToArchive)
@@ -160,15 +213,7 @@ namespace AzToolsFramework
             success = result;
         };
 
-        AZStd::string commandLineArgs = Platform::GetCreateArchiveCommand(archivePath, dirToArchive);
-
-        if (commandLineArgs.empty())
-        {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return false;
-        }
-
-        LaunchZipExe(m_zipExePath, commandLineArgs, createArchiveCallback, AZ::Uuid::CreateNull(), dirToArchive, false);
+        CreateArchive(archivePath, dirToArchive, AZ::Uuid::CreateNull(), createArchiveCallback);
         return success;
     }
 
@@ -180,111 +225,114 @@ namespace AzToolsFramework
 
     void ArchiveComponent::ExtractArchiveOutput(const AZStd::string& archivePath, const AZStd::string& destinationPath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, true);
-
-        if (commandLineArgs.empty())
+        auto extractArchiveTask = [archivePath, destinationPath](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
         {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return;
-        }
-
-        LaunchZipExe(m_unzipExePath, commandLineArgs, respCallback, taskHandle);
+            return ArchiveComponentInternal::ExtractArchive(archivePath, destinationPath, true, isCancelled);
+        };
+        RunArchiveTask(extractArchiveTask, respCallback, taskHandle);
     }
 
     void ArchiveComponent::ExtractArchiveWithoutRoot(const AZStd::string& archivePath, const AZStd::string& destinationPath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, false);
-
-        if (commandLineArgs.empty())
+        auto extractArchiveTask = [archivePath, destinationPath](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
         {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return;
-        }
-
-        LaunchZipExe(m_unzipExePath, commandLineArgs, respCallback, taskHandle);
+            return ArchiveComponentInternal::ExtractArchive(archivePath, destinationPath, false, isCancelled);
+        };
+        RunArchiveTask(extractArchiveTask, respCallback, taskHandle);
     }
 
     void ArchiveComponent::ExtractFile(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overWrite, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = AzToolsFramework::Platform::GetExtractFileCommand(archivePath, fileInArchive, destinationPath, overWrite);
-        if (commandLineArgs.empty())
+        auto extractFileTask = [archivePath, fileInArchive, destinationPath, overWrite](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
         {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return;
-        }
-        LaunchZipExe(m_unzipExePath, commandLineArgs, respCallback, taskHandle);
+            AZ::IO::ZipDir::Reader reader;
+            if (!reader.Open(archivePath))
+            {
+                AZ_Error(s_traceName, false, "Unable to open the archive ( %s ).\n", archivePath.c_str());
+                return false;
+            }
+
+            const AZ::IO::ZipDir::Reader::Entry* entry = reader.FindEntry(fileInArchive);
+            if (!entry)
+            {
+                AZ_Error(s_traceName, false, "Unable to find ( %s ) in the archive ( %s ).\n", fileInArchive.c_str(), archivePath.c_str());
+                return false;
+            }
+
+            // without a destination the file is extracted to the current directory
+            const AZStd::string_view destination = destinationPath.empty() ? AZStd::string_view(".") : AZStd::string_view(destinationPath);
+            return reader.ExtractFiles({ entry }, destination, overWrite, 1, isCancelled);
+        };
+        RunArchiveTask(extractFileTask, respCallback, taskHandle);
     }
 
     bool ArchiveComponent::ExtractFileBlocking(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overWrite)
     {
-        AZStd::string commandLineArgs = AzToolsFramework::Platform::GetExtractFileCommand(archivePath, fileInArchive, destinationPath, overWrite);
-        if (commandLineArgs.empty())
-        {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return false;
-        }
-
         bool success = false;
-        auto createArchiveCallback = [&success](bool result, AZStd::string consoleOutput) {
+        auto extractFileCallback = [&success](bool result, AZStd::string consoleOutput) {
             success = result;
         };
-        LaunchZipExe(m_unzipExePath, commandLineArgs, createArchiveCallback);
+        ExtractFile(archivePath, fileInArchive, destinationPath, overWrite, AZ::Uuid::CreateNull(), extractFileCallback);
         return success;
     }
 
     void ArchiveComponent::ListFilesInArchive(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& fileEntries, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = Platform::GetListFilesInArchiveCommand(archivePath);
-        
-        auto parseOutput = [respCallback, taskHandle, &fileEntries](bool exitCode, AZStd::string consoleOutput)
+        // the list is returned one file per line, and the file entries are filled on the main thread before the callback
+        auto listFilesTask = [archivePath](const AZStd::function<bool()>& /*isCancelled*/, AZStd::string& output)
         {
-            Platform::ParseConsoleOutputFromListFilesInArchive(consoleOutput, fileEntries);
-            AZ::TickBus::QueueFunction(respCallback, exitCode, AZStd::move(consoleOutput));
+            AZStd::vector<AZStd::string> files;
+            if (!ArchiveComponentInternal::ListFilesInArchive(archivePath, files))
+            {
+                return false;
+            }
+            for (const AZStd::string& file : files)
+            {
+                output.append(file).push_back('\n');
+            }
+            return true;
         };
-        LaunchZipExe(m_unzipExePath, commandLineArgs, parseOutput, taskHandle, "", true);
+
+        auto parseOutput = [respCallback, &fileEntries](bool result, AZStd::string output)
+        {
+            AZStd::string_view remaining(output);
+            for (size_t lineEnd = remaining.find('\n'); lineEnd != AZStd::string_view::npos; lineEnd = remaining.find('\n'))
+            {
+                fileEntries.emplace_back(remaining.substr(0, lineEnd));
+                remaining.remove_prefix(lineEnd + 1);
+            }
+            respCallback(result, AZStd::move(output));
+        };
+        RunArchiveTask(listFilesTask, parseOutput, taskHandle);
     }
 
     bool ArchiveComponent::ListFilesInArchiveBlocking(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& fileEntries)
     {
-        AZStd::string listOutput;
-        AZStd::string commandLineArgs = Platform::GetListFilesInArchiveCommand(archivePath.c_str());
-        bool success = false;
-
-        auto parseOutput = [&success, &fileEntries](bool result, AZStd::string consoleOutput)
-        {
-            Platform::ParseConsoleOutputFromListFilesInArchive(consoleOutput, fileEntries);
-            success = result;
-        };
-        LaunchZipExe(m_unzipExePath, commandLineArgs, parseOutput, AZ::Uuid::CreateNull(), "", true);
-        return success;
+        return ArchiveComponentInternal::ListFilesInArchive(archivePath, fileEntries);
     }
 
     void ArchiveComponent::AddFileToArchive(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& fileToAdd, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = Platform::GetAddFileToArchiveCommand(archivePath, fileToAdd);
-        if (commandLineArgs.empty())
+        auto addFileTask = [archivePath, workingDirectory, fileToAdd](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
         {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return;
-        }
-
-        LaunchZipExe(m_zipExePath, commandLineArgs, respCallback, taskHandle, workingDirectory);
+            AZ::IO::ZipDir::Writer writer;
+            if (!ArchiveComponentInternal::AddFilesToWriter(writer, workingDirectory, { fileToAdd }))
+            {
+                return false;
+            }
+            return writer.Write(archivePath, true, isCancelled);
+        };
+        RunArchiveTask(addFileTask, respCallback, taskHandle);
     }
 
     bool ArchiveComponent::AddFileToArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& fileToAdd)
     {
-        AZStd::string commandLineArgs = Platform::GetAddFileToArchiveCommand(archivePath, fileToAdd);
-        if (commandLineArgs.empty())
-        {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return false;
-        }
         bool success = false;
         auto addFileToArchiveCallback = [&success](bool result, AZStd::string consoleOutput) {
             success = result;
         };
 
-        LaunchZipExe(m_zipExePath, commandLineArgs, addFileToArchiveCallback, AZ::Uuid::CreateNull(), workingDirectory);
+        AddFileToArchive(archivePath, workingDirectory, fileToAdd, AZ::Uuid::CreateNull(), addFileToArchiveCallback);
         return success;
     }
 
@@ -296,47 +344,34 @@ namespace AzToolsFramework
             success = result;
         };
 
-        AZStd::string commandLineArgs = Platform::GetAddFilesToArchiveCommand(archivePath.c_str(), listFilePath.c_str());
-
-        if (commandLineArgs.empty())
-        {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return false;
-        }
-        LaunchZipExe(m_zipExePath, commandLineArgs, addFileToArchiveCallback, AZ::Uuid::CreateNull(), workingDirectory);
+        AddFilesToArchive(archivePath, workingDirectory, listFilePath, AZ::Uuid::CreateNull(), addFileToArchiveCallback);
         return success;
     }
 
     void ArchiveComponent::AddFilesToArchive(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& listFilePath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
-        AZStd::string commandLineArgs = Platform::GetAddFilesToArchiveCommand(archivePath, listFilePath);
-        if (commandLineArgs.empty())
+        auto addFilesTask = [archivePath, workingDirectory, listFilePath](const AZStd::function<bool()>& isCancelled, AZStd::string& /*output*/)
         {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return;
-        }
+            AZStd::vector<AZStd::string> files;
+            if (!ArchiveComponentInternal::ReadListFile(listFilePath, files))
+            {
+                return false;
+            }
 
-        LaunchZipExe(m_zipExePath, commandLineArgs, respCallback, taskHandle, workingDirectory);
+            AZ::IO::ZipDir::Writer writer;
+            if (!ArchiveComponentInternal::AddFilesToWriter(writer, workingDirectory, files))
+            {
+                return false;
+            }
+            return writer.Write(archivePath, true, isCancelled);
+        };
+        RunArchiveTask(addFilesTask, respCallback, taskHandle);
     }
 
 
     bool ArchiveComponent::ExtractArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool extractWithRootDirectory)
     {
-        AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, extractWithRootDirectory);
-
-        if (commandLineArgs.empty())
-        {
-            // The platform-specific implementation has already thrown its own error, no need to throw another one
-            return false;
-        }
-
-        bool success = false;
-        auto extractArchiveCallback = [&success](bool result, AZStd::string consoleOutput) {
-            success = result;
-        };
-
-        LaunchZipExe(m_unzipExePath, commandLineArgs, extractArchiveCallback);
-        return success;
+        return ArchiveComponentInternal::ExtractArchive(archivePath, destinationPath, extractWithRootDirectory, {});
     }
 
     void ArchiveComponent::CancelTasks(AZ::Uuid taskHandle)
@@ -357,9 +392,9 @@ namespace AzToolsFramework
         m_threadInfoMap.erase(it);
     }
     
-    void ArchiveComponent::LaunchZipExe(const AZStd::string& exePath, const AZStd::string& commandLineArgs, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle, const AZStd::string& workingDir, bool captureOutput)
+    void ArchiveComponent::RunArchiveTask(const ArchiveTask& task, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle)
     {
-        auto sevenZJob = [=]()
+        auto archiveJob = [=]()
         {
             if (!taskHandle.IsNull())
             {
@@ -368,70 +403,26 @@ namespace AzToolsFramework
                 m_cv.notify_all();
             }
 
-            AzFramework::ProcessLauncher::ProcessLaunchInfo info;
-            info.m_commandlineParameters = exePath + " " + commandLineArgs;
-            
-            info.m_showWindow = false;
-            if (!workingDir.empty())
+            auto isCancelled = [this, taskHandle]()
             {
-                info.m_workingDirectory = workingDir;
-            }
-            AZStd::unique_ptr<AzFramework::ProcessWatcher> watcher(AzFramework::ProcessWatcher::LaunchProcess(info, AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_STDINOUT));
-
-            AZStd::string consoleOutput;
-            AZ::u32 exitCode = static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess);
-            if (watcher)
-            {
-                // callback requires output captured from 7z 
-                if (captureOutput)
-                {
-                    AZStd::string consoleBuffer;
-                    while (watcher->IsProcessRunning(&exitCode))
-                    {
-                        if (!taskHandle.IsNull())
-                        {
-                            AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-                            if (m_threadInfoMap[taskHandle].shouldStop)
-                            {
-                                watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
-                            }
-                        }
-                        watcher->WaitForProcessToExit(g_sleepDuration, &exitCode);
-                        AZ::u32 outputSize = watcher->GetCommunicator()->PeekOutput();
-                        if (outputSize)
-                        {
-                            consoleBuffer.resize(outputSize);
-                            watcher->GetCommunicator()->ReadOutput(consoleBuffer.data(), outputSize);
-                            consoleOutput += consoleBuffer;
-                        }
-                    }
-                }
-                else
+                if (taskHandle.IsNull())
                 {
-                    ConsoleEchoCommunicator echoCommunicator(watcher->GetCommunicator());
-                    while (watcher->IsProcessRunning(&exitCode))
-                    {
-                        if (!taskHandle.IsNull())
-                        {
-                            AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-                            if (m_threadInfoMap[taskHandle].shouldStop)
-                            {
-                                watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
-                            }
-                        }
-                        watcher->WaitForProcessToExit(g_sleepDuration, &exitCode);
-                        echoCommunicator.Pump();
-                    }
+                    return false;
                 }
-            }
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
+                return m_threadInfoMap[taskHandle].shouldStop;
+            };
+
+            AZStd::string output;
+            const bool result = task(isCancelled, output);
 
             if (taskHandle.IsNull())
             {
-                respCallback(exitCode == static_cast<AZ::u32>(SevenZipExitCode::NoError), AZStd::move(consoleOutput));
+                respCallback(result, AZStd::move(output));
             }
             else
             {
-                AZ::TickBus::QueueFunction(respCallback, (exitCode == static_cast<AZ::u32>(SevenZipExitCode::NoError)), AZStd::move(consoleOutput));
+                AZ::TickBus::QueueFunction(respCallback, result, AZStd::move(output));
             }
 
             if (!taskHandle.IsNull())
@@ -444,7 +435,7 @@ namespace AzToolsFramework
         };
         if (!taskHandle.IsNull())
         {
-            AZStd::thread processThread(sevenZJob);
+            AZStd::thread processThread(archiveJob);
             AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
             ThreadInfo& info = m_threadInfoMap[taskHandle];
             m_cv.wait(lock, [&info, &processThread]() {
@@ -454,7 +445,7 @@ namespace AzToolsFramework
         }
         else
         {
-            sevenZJob();
+            archiveJob();
         }
     }
 } // namespace AzToolsFramework
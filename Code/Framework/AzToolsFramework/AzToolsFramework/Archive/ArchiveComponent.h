@@ -14,23 +14,14 @@
 #include <AzCore/std/parallel/conditional_variable.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/functional.h>
 
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 
 namespace AzToolsFramework
 {
-    enum class SevenZipExitCode : AZ::u32
-    {
-        NoError = 0,
-        Warning = 1,
-        FatalError = 2,
-        CommandLineError = 7,
-        NotEnoughMemory = 8,
-        UserStoppedProcess = 255
-    };
-
     // the ArchiveComponent's job is to execute zip commands.
-    // it parses the status of zip commands and returns results.
+    // the archives are read and written in process, compressing and extracting the files on several threads.
     class ArchiveComponent
         : public AZ::Component
         , private ArchiveCommands::Bus::Handler
@@ -68,12 +59,13 @@ namespace AzToolsFramework
         void CancelTasks(AZ::Uuid taskHandle) override;
         //////////////////////////////////////////////////////////////////////////
         
-        // Launches the input zip exe as a background child process in a detached background thread, if the task handle is not null 
-        // otherwise launches input zip exe in the calling thread.
-        void LaunchZipExe(const AZStd::string& exePath, const AZStd::string& commandLineArgs, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle = AZ::Uuid::CreateNull(), const AZStd::string& workingDir = "", bool captureOutput = false);
+        // an archive command: returns whether it succeeded, and fills the output passed to the callback.
+        // isCancelled returns true once the tasks of its handle are cancelled.
+        using ArchiveTask = AZStd::function<bool(const AZStd::function<bool()>& isCancelled, AZStd::string& output)>;
 
-        AZStd::string m_zipExePath;
-        AZStd::string m_unzipExePath;
+        // Runs the archive task in a detached background thread, if the task handle is not null
+        // otherwise runs it in the calling thread.
+        void RunArchiveTask(const ArchiveTask& task, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle = AZ::Uuid::CreateNull());
 
         // Struct for tracking background threads/tasks
         struct ThreadInfo
@@ -1263,7 +1263,8 @@ namespace AzToolsFramework
                    m_lastLogTime == other.m_lastLogTime &&
                    AzFramework::StringFunc::Equal(m_lastLogFile.c_str(), other.m_lastLogFile.c_str()) &&
                    m_errorCount == other.m_errorCount &&
-                   m_warningCount == other.m_warningCount;
+                   m_warningCount == other.m_warningCount &&
+                   m_processDurationMs == other.m_processDurationMs;
         }
 
         AZStd::string JobDatabaseEntry::ToString() const
@@ -1292,7 +1293,8 @@ namespace AzToolsFramework
                 MakeColumn("LastLogTime", m_lastLogTime),
                 MakeColumn("LastLogFile", m_lastLogFile),
                 MakeColumn("WarningCount", m_warningCount),
-                MakeColumn("ErrorCount", m_errorCount)
+                MakeColumn("ErrorCount", m_errorCount),
+                MakeColumn("ProcessDurationMs", m_processDurationMs)
             );
         }
 
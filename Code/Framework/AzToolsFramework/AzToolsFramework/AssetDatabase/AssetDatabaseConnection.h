@@ -65,6 +65,7 @@ namespace AzToolsFramework
             AddedScanTimeSecondsSinceEpochField = 29,
             ChangedSortFunctionFromQSortToStdStableSort = 30,
             RemoveOutputPrefixFromScanFolders,
+            AddedJobProcessDurationField,
             //Add all new versions before this
             DatabaseVersionCount,
             LatestVersion = DatabaseVersionCount - 1
@@ -187,6 +188,7 @@ namespace AzToolsFramework
             AZStd::string m_lastLogFile;
             AZ::u32 m_errorCount = 0;
             AZ::u32 m_warningCount = 0;
+            AZ::s64 m_processDurationMs = 0; // how long the builder took to process the job the last time it ran, 0 if unknown
         };
 
         typedef AZStd::vector<JobDatabaseEntry> JobDatabaseEntryContainer;
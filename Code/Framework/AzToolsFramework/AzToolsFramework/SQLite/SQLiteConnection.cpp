@@ -14,12 +14,46 @@
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/thread.h>
 #include <sqlite3.h>
 
 namespace AzToolsFramework
 {
     namespace SQLite
     {
+        namespace
+        {
+            // the busy timeout already waits for the lock, these retries only cover a connection holding it for even longer
+            constexpr int BusyRetryCount = 3;
+            constexpr int BusyRetryDelayMs = 100;
+
+            // Steps a statement, trying again a few times if the database stays locked by another connection.
+            // A statement that is part of an explicit transaction isn't retried: SQLite requires the transaction to be
+            // rolled back first, and when it is a deferred read that would become a write, it could never get the lock.
+            int StepWithRetry(sqlite3_stmt* statement)
+            {
+                int res = sqlite3_step(statement);
+                for (int retry = 0; (res == SQLITE_BUSY) && (retry < BusyRetryCount) && sqlite3_get_autocommit(sqlite3_db_handle(statement)); ++retry)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(BusyRetryDelayMs << retry));
+                    res = sqlite3_step(statement);
+                }
+                return res;
+            }
+
+            // Executes BEGIN, COMMIT and the like, which can always be tried again when the database is locked.
+            int ExecuteWithRetry(sqlite3* db, const char* sqlText)
+            {
+                int res = sqlite3_exec(db, sqlText, NULL, NULL, NULL);
+                for (int retry = 0; (res == SQLITE_BUSY) && (retry < BusyRetryCount); ++retry)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(BusyRetryDelayMs << retry));
+                    res = sqlite3_exec(db, sqlText, NULL, NULL, NULL);
+                }
+                return res;
+            }
+        }
+
         /**  A statement prototype represents a registered statement ("SELECT * FROM assets WHERE assets.name = :name")
         * To actually execute it, you'd call GetStatement on the manager which will create for you a Statement from a prototype
         */
@@ -87,6 +121,12 @@ namespace AzToolsFramework
                 return false;
             }
 
+            m_readOnly = readOnly;
+
+            // other connections to the database (the asset catalog, the tools) may be writing to it, wait for them rather
+            // than failing straight away with SQLITE_BUSY.
+            sqlite3_busy_timeout(m_db, BusyTimeoutMs);
+
             sqlite3_exec(m_db, "PRAGMA foreign_keys = ON;", NULL, NULL, NULL);
             //WAL journal mode enabled for better concurrency with external asset browser.
             //Reads do not block writes
@@ -97,6 +137,9 @@ namespace AzToolsFramework
             // you still don't lose data if the application crashes, only if you literally lose power while the disk is writing.
             // and because you're in WAL mode, you only lose the current transaction anyway.
             sqlite3_exec(m_db, "PRAGMA synchronous = 0;", NULL, NULL, NULL);
+
+            // temporary tables and indices, such as the ones built to sort the results of big queries, are kept in memory.
+            sqlite3_exec(m_db, "PRAGMA temp_store = MEMORY;", NULL, NULL, NULL);
             return      (res == SQLITE_OK);
         }
 
@@ -107,6 +150,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -217,7 +261,27 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            ResetTransactionDepthIfRolledBack();
+
+            // SQLite doesn't allow a transaction to begin within another one, but savepoints can be nested in a transaction.
+            if (m_transactionDepth == 0)
+            {
+                // a deferred transaction only asks for the write lock on its first write, when another connection may have
+                // written since it began reading. It then gets SQLITE_BUSY without ever waiting, so writes take the lock now.
+                const char* beginSql = m_readOnly ? "BEGIN TRANSACTION;" : "BEGIN IMMEDIATE TRANSACTION;";
+                int res = ExecuteWithRetry(m_db, beginSql);
+                if (res != SQLITE_OK)
+                {
+                    AZ_Error("SQLiteConnection", false, "Unable to begin a transaction, error code %d: %s", res, sqlite3_errmsg(m_db));
+                    return;
+                }
+            }
+            else if (!ExecuteTransactionStatement("SAVEPOINT nested_transaction_%d;", m_transactionDepth))
+            {
+                return;
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -227,7 +291,28 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+
+            if (ResetTransactionDepthIfRolledBack() || m_transactionDepth == 0)
+            {
+                return;
+            }
+
+            if (m_transactionDepth == 1)
+            {
+                m_transactionDepth = 0;
+                int res = ExecuteWithRetry(m_db, "COMMIT TRANSACTION;");
+                if (res != SQLITE_OK)
+                {
+                    // a COMMIT that fails leaves the transaction open
+                    AZ_Error("SQLiteConnection", false, "Unable to commit a transaction, its writes are rolled back. Error code %d: %s", res, sqlite3_errmsg(m_db));
+                    sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+                }
+            }
+            else
+            {
+                --m_transactionDepth;
+                ExecuteTransactionStatement("RELEASE SAVEPOINT nested_transaction_%d;", m_transactionDepth);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -237,7 +322,51 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+
+            if (ResetTransactionDepthIfRolledBack() || m_transactionDepth == 0)
+            {
+                return;
+            }
+
+            if (m_transactionDepth == 1)
+            {
+                m_transactionDepth = 0;
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // rolling back to a savepoint leaves it open, it still has to be released to end it.
+                --m_transactionDepth;
+                ExecuteTransactionStatement("ROLLBACK TO SAVEPOINT nested_transaction_%d;", m_transactionDepth);
+                ExecuteTransactionStatement("RELEASE SAVEPOINT nested_transaction_%d;", m_transactionDepth);
+            }
+        }
+
+        int Connection::GetTransactionDepth() const
+        {
+            return m_transactionDepth;
+        }
+
+        bool Connection::ExecuteTransactionStatement(const char* sqlFormat, int depth)
+        {
+            char sqlText[64];
+            azsnprintf(sqlText, AZ_ARRAY_SIZE(sqlText), sqlFormat, depth);
+            int res = sqlite3_exec(m_db, sqlText, NULL, NULL, NULL);
+            AZ_Error("SQLiteConnection", res == SQLITE_OK, "'%s' failed with error code %d: %s", sqlText, res, sqlite3_errmsg(m_db));
+            return res == SQLITE_OK;
+        }
+
+        bool Connection::ResetTransactionDepthIfRolledBack()
+        {
+            // errors such as running out of disk space or memory make SQLite roll back the transaction and every savepoint
+            // in it, which leaves the connection in autocommit mode.
+            if (m_transactionDepth > 0 && sqlite3_get_autocommit(m_db))
+            {
+                AZ_Warning("SQLiteConnection", false, "A transaction was rolled back by SQLite after an error, its writes are lost.");
+                m_transactionDepth = 0;
+                return true;
+            }
+            return false;
         }
 
         void Connection::Vacuum()
@@ -308,7 +437,7 @@ namespace AzToolsFramework
                 bindCallback(statement);
             }
 
-            res = sqlite3_step(statement);
+            res = StepWithRetry(statement);
             bool validResult = res == SQLITE_DONE;
 
             while(res == SQLITE_ROW)
@@ -317,7 +446,11 @@ namespace AzToolsFramework
 
                 if (resultCallback && resultCallback(statement))
                 {
-                    res = sqlite3_step(statement);
+                    res = StepWithRetry(statement);
+                }
+                else
+                {
+                    break;
                 }
             }
 
@@ -516,11 +649,9 @@ namespace AzToolsFramework
             {
                 return SqlError;
             }
-            int res = SQLITE_BUSY;
-            while (res == SQLITE_BUSY)
-            {
-                res = sqlite3_step(m_statement);
-            }
+            // the connection waits for up to BusyTimeoutMs on a locked database before giving up, and then it's only tried
+            // a few more times, since a transaction that can never get the lock would otherwise spin here forever.
+            int res = StepWithRetry(m_statement);
 
             // These 3 result codes are the ONLY non-error result codes for the v2 interface according to sqlite documentation, any other return value is an error.
             AZ_Error("SQLiteConnection", res == SQLITE_OK || res == SQLITE_ROW || res == SQLITE_DONE, "Statement::Step() resulted in error code %d.  This could indicate a problem with the asset database in the cache.", res);
@@ -46,11 +46,20 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions nest: one begun while another is open becomes a savepoint of it, which can be rolled back
+            //! on its own but is only written to the database when the outermost transaction is committed.
+            //! On a connection that isn't read-only, the outermost transaction takes the write lock as it begins, so other
+            //! connections wait for it to be committed before they write (up to BusyTimeoutMs, see Statement::Step).
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
+            //! Returns how many transactions are currently open, 0 when every statement is committed on its own.
+            int GetTransactionDepth() const;
             // -------------------------------
 
+            //! How long a statement waits for another connection to release its lock on the database before failing.
+            static constexpr int BusyTimeoutMs = 10000;
+
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
             void Vacuum();
 
@@ -86,7 +95,13 @@ namespace AzToolsFramework
             bool DoesTableExist(const char* name);
 
         private:
+            bool ExecuteTransactionStatement(const char* sqlFormat, int depth);
+            //! SQLite rolls the whole transaction back on its own after some errors, this catches up with it.
+            bool ResetTransactionDepthIfRolledBack();
+
             sqlite3* m_db;
+            bool m_readOnly = false;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
@@ -131,11 +131,7 @@ namespace UnitTest
             UnitTest::ScopedTemporaryDirectory m_tempDir;
         };
 
-#if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
-        TEST_F(ArchiveTest, DISABLED_CreateArchiveBlocking_FilesAtThreeDepths_ArchiveCreated)
-#else
         TEST_F(ArchiveTest, CreateArchiveBlocking_FilesAtThreeDepths_ArchiveCreated)
-#endif // AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
         {
             EXPECT_TRUE(m_tempDir.IsValid());
             CreateArchiveFolder();
@@ -145,11 +141,7 @@ namespace UnitTest
             EXPECT_EQ(createResult, true);
         }
 
-#if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
-        TEST_F(ArchiveTest, DISABLED_ListFilesInArchiveBlocking_FilesAtThreeDepths_FilesFound)
-#else
         TEST_F(ArchiveTest, ListFilesInArchiveBlocking_FilesAtThreeDepths_FilesFound)
-#endif // AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
         {
             EXPECT_TRUE(m_tempDir.IsValid());
             CreateArchiveFolder();
@@ -163,11 +155,48 @@ namespace UnitTest
             EXPECT_EQ(fileList.size(), 6);
         }
 
-#if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
-        TEST_F(ArchiveTest, DISABLED_CreateDeltaCatalog_AssetsNotRegistered_Failure)
-#else
+        TEST_F(ArchiveTest, ExtractArchiveBlocking_FilesAtThreeDepths_FilesExtracted)
+        {
+            EXPECT_TRUE(m_tempDir.IsValid());
+            CreateArchiveFolder();
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            QDir extractDir(QDir(m_tempDir.GetDirectory()).filePath("Extracted"));
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchiveBlocking,
+                GetArchivePath().toStdString().c_str(), extractDir.path().toStdString().c_str(), false);
+            EXPECT_TRUE(extractResult);
+
+            QDir archiveFolder(GetArchiveFolder());
+            for (const QString& file : CreateArchiveFileList())
+            {
+                QFile extractedFile(extractDir.filePath(file));
+                QFile sourceFile(archiveFolder.filePath(file));
+                ASSERT_TRUE(extractedFile.open(QFile::ReadOnly));
+                ASSERT_TRUE(sourceFile.open(QFile::ReadOnly));
+                EXPECT_EQ(extractedFile.readAll(), sourceFile.readAll());
+            }
+        }
+
+        TEST_F(ArchiveTest, ExtractFileBlocking_FileInFolder_OnlyFileExtracted)
+        {
+            EXPECT_TRUE(m_tempDir.IsValid());
+            CreateArchiveFolder();
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            QDir extractDir(QDir(m_tempDir.GetDirectory()).filePath("Extracted"));
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractFileBlocking,
+                GetArchivePath().toStdString().c_str(), "testfolder/folderfile.txt", extractDir.path().toStdString().c_str(), true);
+            EXPECT_TRUE(extractResult);
+
+            EXPECT_TRUE(QFileInfo::exists(extractDir.filePath("testfolder/folderfile.txt")));
+            EXPECT_FALSE(QFileInfo::exists(extractDir.filePath("basicfile.txt")));
+        }
+
         TEST_F(ArchiveTest, CreateDeltaCatalog_AssetsNotRegistered_Failure)
-#endif // AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
         {
             QStringList fileList = CreateArchiveFileList();
 
@@ -184,11 +213,7 @@ namespace UnitTest
             EXPECT_EQ(catalogCreated, false);
         }
 
-#if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
-        TEST_F(ArchiveTest, DISABLED_CreateDeltaCatalog_ArchiveWithoutCatalogAssetsRegistered_Success)
-#else
         TEST_F(ArchiveTest, CreateDeltaCatalog_ArchiveWithoutCatalogAssetsRegistered_Success)
-#endif // AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
         {
             QStringList fileList = CreateArchiveFileList();
 
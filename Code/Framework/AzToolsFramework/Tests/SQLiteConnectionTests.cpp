@@ -8,6 +8,8 @@
 
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -126,4 +128,103 @@ namespace UnitTest
         }
     }
 
+    // a ScopedTransaction used while another transaction is open becomes a savepoint of it:
+    // rolling it back must only undo its own writes, and committing it must not commit the outer transaction.
+    TEST_F(SQLiteTest, NestedTransaction_RolledBack_OnlyUndoesNestedWrites)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+        ASSERT_TRUE(m_database->ExecuteRawSqlQuery("CREATE TABLE testtable(rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);", nullptr, nullptr));
+
+        auto countRows = [this]()
+        {
+            int rowCount = -1;
+            m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM testtable;", [&rowCount](sqlite3_stmt* statement)
+            {
+                rowCount = SQLite::GetColumnInt(statement, 0);
+                return false;
+            }, nullptr);
+            return rowCount;
+        };
+
+        m_database->BeginTransaction();
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(1);", nullptr, nullptr));
+        {
+            SQLite::ScopedTransaction committedTransaction(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(2);", nullptr, nullptr));
+            committedTransaction.Commit();
+        }
+        {
+            SQLite::ScopedTransaction rolledBackTransaction(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(3);", nullptr, nullptr));
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 1);
+        EXPECT_EQ(countRows(), 2);
+
+        m_database->RollbackTransaction();
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+        EXPECT_EQ(countRows(), 0);
+    }
+
+    // a connection writing while another one holds a write transaction waits for it to be committed rather than failing
+    TEST_F(SQLiteTest, WriteWhileOtherConnectionIsInTransaction_WaitsForItsCommit)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+        ASSERT_TRUE(m_database->ExecuteRawSqlQuery("CREATE TABLE testtable(rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);", nullptr, nullptr));
+
+        SQLite::Connection otherConnection;
+        ASSERT_TRUE(otherConnection.Open(m_randomDatabaseFileName, false));
+
+        m_database->BeginTransaction();
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(1);", nullptr, nullptr));
+
+        AZStd::atomic_bool otherWriteDone{ false };
+        bool otherWriteSucceeded = false;
+        AZStd::thread otherWriter([&]()
+        {
+            otherWriteSucceeded = otherConnection.ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(2);", nullptr, nullptr);
+            otherWriteDone = true;
+        });
+
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(200));
+        EXPECT_FALSE(otherWriteDone);
+        m_database->CommitTransaction();
+        otherWriter.join();
+
+        EXPECT_TRUE(otherWriteSucceeded);
+        int rowCount = -1;
+        m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM testtable;", [&rowCount](sqlite3_stmt* statement)
+        {
+            rowCount = SQLite::GetColumnInt(statement, 0);
+            return false;
+        }, nullptr);
+        EXPECT_EQ(rowCount, 2);
+
+        otherConnection.Close();
+    }
+
+    // when SQLite ends a transaction on its own, the connection must not keep nesting savepoints into a transaction that's gone
+    TEST_F(SQLiteTest, TransactionEndedBySQLite_NextTransactionStartsOver)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+        ASSERT_TRUE(m_database->ExecuteRawSqlQuery("CREATE TABLE testtable(rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);", nullptr, nullptr));
+
+        m_database->BeginTransaction();
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(1);", nullptr, nullptr));
+        // stands in for the rollback SQLite does after errors such as a full disk
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("ROLLBACK;", nullptr, nullptr));
+
+        m_database->BeginTransaction();
+        EXPECT_EQ(m_database->GetTransactionDepth(), 1);
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("INSERT INTO testtable(value) VALUES(2);", nullptr, nullptr));
+        m_database->CommitTransaction();
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+
+        int rowCount = -1;
+        m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM testtable;", [&rowCount](sqlite3_stmt* statement)
+        {
+            rowCount = SQLite::GetColumnInt(statement, 0);
+            return false;
+        }, nullptr);
+        EXPECT_EQ(rowCount, 1);
+    }
 }
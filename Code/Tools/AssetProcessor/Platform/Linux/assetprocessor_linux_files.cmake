@@ -8,4 +8,6 @@
 
 set(FILES
     native/FileWatcher/FileWatcher_linux.cpp
+    native/utilities/BuildCache_linux.cpp
+    native/utilities/DirectoryWalker_linux.cpp
 )
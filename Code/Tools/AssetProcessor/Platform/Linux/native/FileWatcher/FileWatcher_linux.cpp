@@ -6,12 +6,26 @@
  *
  */
 #include <native/FileWatcher/FileWatcher.h>
+#include <native/FileWatcher/FileChangeCoalescer.h>
+#include <native/utilities/PlatformConfiguration.h>
+
+#include <AzCore/Settings/SettingsRegistry.h>
 
 #include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
 #include <QHash>
 #include <QMutex>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
 #include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/fanotify.h>
 #include <sys/inotify.h>
 
 
@@ -19,22 +33,55 @@ static constexpr int s_handleToFolderMapLockTimeout = 1000;      // 1 sec timeou
 static constexpr size_t s_iNotifyMaxEntries = 1024 * 16;         // Control the maximum number of entries (from inotify) that can be read at one time
 static constexpr size_t s_iNotifyEventSize = sizeof(struct inotify_event);
 static constexpr size_t s_iNotifyReadBufferSize = s_iNotifyMaxEntries * s_iNotifyEventSize;
+static constexpr uint32_t s_iNotifyWatchMask = IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO;
+static constexpr int s_maxChangesPerBatch = 1000;                // Keeps a branch switch from holding the main thread with a single batch
 
 struct FolderRootWatch::PlatformImplementation
 {
     PlatformImplementation() = default;
 
     int                         m_iNotifyHandle = -1;
+    int                         m_stopHandle = -1;              // eventfd signaled by Stop(), to wake up the watch thread
     QMutex                      m_handleToFolderMapLock;
     QHash<int, QString>         m_handleToFolderMap;
+    bool                        m_watchLimitReported = false;
+    bool                        m_queueOverflowReported = false;
+
+#if defined(FAN_REPORT_DFID_NAME)
+    // fanotify can watch a whole filesystem with a single mark, instead of a watch per folder, but it needs CAP_SYS_ADMIN
+    int                         m_fanotifyHandle = -1;
+    int                         m_mountHandle = -1;             // any open folder of the filesystem, for open_by_handle_at
+    QString                     m_root;
+    QString                     m_canonicalRoot;
+    QHash<QByteArray, QString>  m_folderHandleToFolderMap;
+#endif
 
-    bool Initialize()
+    bool Initialize(const QString& root)
     {
+        if (m_stopHandle < 0)
+        {
+            m_stopHandle = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        }
+
+#if defined(FAN_REPORT_DFID_NAME)
+        bool useFanotify = false;
+        if (auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(useFanotify, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey) + "/FileWatcher/useFanotify");
+        }
+        if (useFanotify && InitializeFanotify(root))
+        {
+            return m_stopHandle >= 0;
+        }
+#else
+        AZ_UNUSED(root);
+#endif
+
         if (m_iNotifyHandle < 0)
         {
-            m_iNotifyHandle = inotify_init();
+            m_iNotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
         }
-        return (m_iNotifyHandle >= 0);
+        return (m_iNotifyHandle >= 0) && (m_stopHandle >= 0);
     }
 
     void Finalize()
@@ -60,9 +107,48 @@ struct FolderRootWatch::PlatformImplementation
             ::close(m_iNotifyHandle);
             m_iNotifyHandle = -1;
         }
+
+#if defined(FAN_REPORT_DFID_NAME)
+        if (m_fanotifyHandle >= 0)
+        {
+            ::close(m_fanotifyHandle);
+            m_fanotifyHandle = -1;
+            ::close(m_mountHandle);
+            m_mountHandle = -1;
+            m_folderHandleToFolderMap.clear();
+        }
+#endif
+
+        if (m_stopHandle >= 0)
+        {
+            ::close(m_stopHandle);
+            m_stopHandle = -1;
+        }
+    }
+
+    bool IsUsingFanotify() const
+    {
+#if defined(FAN_REPORT_DFID_NAME)
+        return m_fanotifyHandle >= 0;
+#else
+        return false;
+#endif
+    }
+
+    //! The handle the watch thread reads the events from
+    int GetEventHandle() const
+    {
+#if defined(FAN_REPORT_DFID_NAME)
+        if (m_fanotifyHandle >= 0)
+        {
+            return m_fanotifyHandle;
+        }
+#endif
+        return m_iNotifyHandle;
     }
 
-    void AddWatchFolder(QString folder)
+    //! Watches the folder and all its subfolders, and adds the files found in them to foundFiles if given
+    void AddWatchFolder(QString folder, QStringList* foundFiles = nullptr)
     {
         if (m_iNotifyHandle >= 0)
         {
@@ -70,17 +156,7 @@ struct FolderRootWatch::PlatformImplementation
             QString cleanPath = QDir::cleanPath(folder);
 
             // Add the folder to watch and track it
-            int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                cleanPath.toUtf8().constData(),
-                                                IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
-            
-            if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
-            {
-                AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
-                return;
-            }
-            m_handleToFolderMap[watchHandle] = cleanPath;
-            m_handleToFolderMapLock.unlock();
+            AddWatch(cleanPath);
 
             // Add all the subfolders to watch and track them
             QDirIterator dirIter(folder, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
@@ -92,23 +168,56 @@ struct FolderRootWatch::PlatformImplementation
                 {
                     continue;
                 }
-                
-                int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                    dirName.toUtf8().constData(),
-                                                    IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
 
-                if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+                if (!dirIter.fileInfo().isDir())
                 {
-                    AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
-                    return;
+                    if (foundFiles)
+                    {
+                        foundFiles->push_back(dirName);
+                    }
+                    continue;
                 }
-                m_handleToFolderMap[watchHandle] = dirName;
-                m_handleToFolderMapLock.unlock();
+
+                AddWatch(dirName);
+            }
+        }
+    }
+
+    bool AddWatch(const QString& folder)
+    {
+        int watchHandle = inotify_add_watch(m_iNotifyHandle, folder.toUtf8().constData(), s_iNotifyWatchMask);
+        if (watchHandle < 0)
+        {
+            // every watch takes kernel memory, so their count is limited per user, which big projects can go over
+            if (errno == ENOSPC && !m_watchLimitReported)
+            {
+                m_watchLimitReported = true;
+                AZ_Warning("FileWatcher", false,
+                    "The limit of inotify watches (fs.inotify.max_user_watches = %s) was reached while watching %s. "
+                    "Changes to the files in the folders which couldn't be watched will be missed until the Asset Processor is restarted. "
+                    "Raise the limit, for example with 'sudo sysctl fs.inotify.max_user_watches=524288'.",
+                    ReadSystemSetting("/proc/sys/fs/inotify/max_user_watches").constData(), folder.toUtf8().constData());
+            }
+            else if (errno != ENOSPC && errno != ENOENT)
+            {
+                // the folder can be gone already, when it's removed right after being created
+                AZ_TracePrintf("FileWatcher", "Unable to watch %s: %s\n", folder.toUtf8().constData(), strerror(errno));
             }
+            return false;
+        }
+
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return false;
         }
+        m_handleToFolderMap[watchHandle] = folder;
+        m_handleToFolderMapLock.unlock();
+        return true;
     }
 
-    void RemoveWatchFolder(int watchHandle)
+    //! Stops watching the folder and all its subfolders, the watches follow the folders when they are moved
+    void RemoveWatchFolder(const QString& folder)
     {
         if (m_iNotifyHandle >= 0)
         {
@@ -118,16 +227,283 @@ struct FolderRootWatch::PlatformImplementation
                 return;
             }
 
-            QHash<int, QString>::iterator handleToRemove = m_handleToFolderMap.find(watchHandle);
-            if (handleToRemove != m_handleToFolderMap.end())
+            const QString subfolderPrefix = folder + QDir::separator();
+            for (auto handleIter = m_handleToFolderMap.begin(); handleIter != m_handleToFolderMap.end();)
             {
-                inotify_rm_watch(m_iNotifyHandle, watchHandle);
-                m_handleToFolderMap.erase(handleToRemove);
+                if (handleIter.value() == folder || handleIter.value().startsWith(subfolderPrefix))
+                {
+                    inotify_rm_watch(m_iNotifyHandle, handleIter.key());
+                    handleIter = m_handleToFolderMap.erase(handleIter);
+                }
+                else
+                {
+                    ++handleIter;
+                }
             }
 
             m_handleToFolderMapLock.unlock();
         }
     }
+
+    //! Forgets a watch which the kernel removed, because its folder was deleted or the watch was removed
+    void ForgetWatch(int watchHandle)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return;
+        }
+        m_handleToFolderMap.remove(watchHandle);
+        m_handleToFolderMapLock.unlock();
+    }
+
+    QString GetWatchFolder(int watchHandle)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return QString();
+        }
+        QString folder = m_handleToFolderMap.value(watchHandle);
+        m_handleToFolderMapLock.unlock();
+        return folder;
+    }
+
+    void ReportQueueOverflow()
+    {
+        AZ_Warning("FileWatcher", m_queueOverflowReported,
+            "Too many files changed at once, and some of the changes were dropped (fs.inotify.max_queued_events = %s). "
+            "Restart the Asset Processor to pick them up, and raise the limit to avoid it, for example with 'sudo sysctl fs.inotify.max_queued_events=65536'.",
+            ReadSystemSetting("/proc/sys/fs/inotify/max_queued_events").constData());
+        m_queueOverflowReported = true;
+    }
+
+    static QByteArray ReadSystemSetting(const char* settingPath)
+    {
+        QFile settingFile(settingPath);
+        return settingFile.open(QIODevice::ReadOnly) ? settingFile.readAll().trimmed() : QByteArray("unknown");
+    }
+
+    void ProcessINotifyEvent(const struct inotify_event* event, FileChangeCoalescer& coalescer, qint64 timeMs)
+    {
+        if (event->mask & IN_Q_OVERFLOW)
+        {
+            ReportQueueOverflow();
+            return;
+        }
+
+        if (event->mask & IN_IGNORED)
+        {
+            // the folder of the watch was deleted, which its parent folder reports as well
+            ForgetWatch(event->wd);
+            return;
+        }
+
+        if (event->len == 0)
+        {
+            // events about the watched folder itself, which its parent folder reports as well
+            return;
+        }
+
+        const QString folder = GetWatchFolder(event->wd);
+        if (folder.isEmpty())
+        {
+            // events which were queued before the watch was removed
+            return;
+        }
+        QString pathStr = QString("%1%2%3").arg(folder, QDir::separator(), event->name);
+
+        if (event->mask & IN_ISDIR)
+        {
+            if (event->mask & (IN_CREATE | IN_MOVED_TO))
+            {
+                // New Directory, add it to the watch. Files can be written to it before it's watched,
+                // and the files of a folder moved in don't have events of their own, so report the files already in it
+                QStringList foundFiles;
+                AddWatchFolder(pathStr, &foundFiles);
+                for (const QString& foundFile : foundFiles)
+                {
+                    coalescer.AddChange(FileAction::FileAction_Added, foundFile, timeMs);
+                }
+            }
+            else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+            {
+                if (event->mask & IN_MOVED_FROM)
+                {
+                    // the watches of a deleted folder are removed by the kernel, but a folder moved away keeps its watches
+                    RemoveWatchFolder(pathStr);
+                }
+                coalescer.AddChange(FileAction::FileAction_Removed, pathStr, timeMs);
+            }
+        }
+        else if (event->mask & (IN_CREATE | IN_MOVED_TO))
+        {
+            coalescer.AddChange(FileAction::FileAction_Added, pathStr, timeMs);
+        }
+        else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+        {
+            coalescer.AddChange(FileAction::FileAction_Removed, pathStr, timeMs);
+        }
+        else if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE))
+        {
+            coalescer.AddChange(FileAction::FileAction_Modified, pathStr, timeMs);
+        }
+    }
+
+#if defined(FAN_REPORT_DFID_NAME)
+    bool InitializeFanotify(const QString& root)
+    {
+        // needs Linux 5.9 or later, and CAP_SYS_ADMIN for a mark on the whole filesystem
+        m_fanotifyHandle = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK | FAN_REPORT_DFID_NAME, O_RDONLY | O_CLOEXEC);
+        if (m_fanotifyHandle < 0)
+        {
+            AZ_TracePrintf("FileWatcher", "fanotify isn't available (%s), using inotify to watch %s.\n", strerror(errno), root.toUtf8().constData());
+            return false;
+        }
+
+        const QByteArray rootName = QFile::encodeName(root);
+        const uint64_t eventMask = FAN_CREATE | FAN_DELETE | FAN_MODIFY | FAN_CLOSE_WRITE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_ONDIR;
+        m_mountHandle = open(rootName.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (m_mountHandle < 0 || fanotify_mark(m_fanotifyHandle, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, eventMask, AT_FDCWD, rootName.constData()) != 0)
+        {
+            AZ_TracePrintf("FileWatcher", "Unable to watch %s with fanotify (%s), using inotify instead.\n", root.toUtf8().constData(), strerror(errno));
+            if (m_mountHandle >= 0)
+            {
+                ::close(m_mountHandle);
+                m_mountHandle = -1;
+            }
+            ::close(m_fanotifyHandle);
+            m_fanotifyHandle = -1;
+            return false;
+        }
+
+        // the folders of the events are resolved to their real path, which is mapped back to the root as it was given
+        m_root = QDir::cleanPath(root);
+        m_canonicalRoot = QDir(root).canonicalPath();
+        AZ_TracePrintf("FileWatcher", "Watching %s with fanotify.\n", root.toUtf8().constData());
+        return true;
+    }
+
+    //! Returns the path of the folder of a file handle reported by fanotify, or an empty string if it's outside the root or gone
+    QString GetFolderOfHandle(const struct file_handle* folderHandle)
+    {
+        const QByteArray handleKey(reinterpret_cast<const char*>(folderHandle), sizeof(struct file_handle) + folderHandle->handle_bytes);
+        auto foundFolder = m_folderHandleToFolderMap.constFind(handleKey);
+        if (foundFolder != m_folderHandleToFolderMap.constEnd())
+        {
+            return foundFolder.value();
+        }
+
+        const int folderHandleFd = open_by_handle_at(m_mountHandle, const_cast<struct file_handle*>(folderHandle), O_PATH | O_CLOEXEC);
+        if (folderHandleFd < 0)
+        {
+            return QString();
+        }
+        char pathBuffer[PATH_MAX];
+        const ssize_t pathLength = readlink(QString("/proc/self/fd/%1").arg(folderHandleFd).toUtf8().constData(), pathBuffer, sizeof(pathBuffer));
+        ::close(folderHandleFd);
+
+        QString folder;
+        if (pathLength > 0)
+        {
+            const QString canonicalFolder = QFile::decodeName(QByteArray(pathBuffer, aznumeric_cast<int>(pathLength)));
+            if (canonicalFolder == m_canonicalRoot || canonicalFolder.startsWith(m_canonicalRoot + QDir::separator()))
+            {
+                folder = m_root + canonicalFolder.mid(m_canonicalRoot.length());
+            }
+        }
+        // folders outside of the root are remembered too, since the mark reports the changes of the whole filesystem
+        m_folderHandleToFolderMap.insert(handleKey, folder);
+        return folder;
+    }
+
+    void ProcessFanotifyEvents(const char* eventBuffer, ssize_t bytesRead, FileChangeCoalescer& coalescer, qint64 timeMs)
+    {
+        const struct fanotify_event_metadata* metadata = reinterpret_cast<const struct fanotify_event_metadata*>(eventBuffer);
+        for (; FAN_EVENT_OK(metadata, bytesRead); metadata = FAN_EVENT_NEXT(metadata, bytesRead))
+        {
+            if (metadata->mask & FAN_Q_OVERFLOW)
+            {
+                ReportQueueOverflow();
+                continue;
+            }
+
+            // the event names the folder the change happened in with a file handle, followed by the name of the file
+            const struct fanotify_event_info_fid* fidInfo = reinterpret_cast<const struct fanotify_event_info_fid*>(metadata + 1);
+            if (metadata->event_len < sizeof(*metadata) + sizeof(*fidInfo) || fidInfo->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME)
+            {
+                continue;
+            }
+            const struct file_handle* folderHandle = reinterpret_cast<const struct file_handle*>(fidInfo->handle);
+            const char* fileName = reinterpret_cast<const char*>(folderHandle->f_handle + folderHandle->handle_bytes);
+
+            const QString folder = GetFolderOfHandle(folderHandle);
+            if (folder.isEmpty() || strcmp(fileName, ".") == 0)
+            {
+                continue;
+            }
+            const QString pathStr = QString("%1%2%3").arg(folder, QDir::separator(), QFile::decodeName(fileName));
+
+            if (metadata->mask & FAN_ONDIR)
+            {
+                if (metadata->mask & (FAN_MOVED_FROM | FAN_MOVED_TO | FAN_DELETE))
+                {
+                    // the paths of the folder and its subfolders have changed
+                    m_folderHandleToFolderMap.clear();
+                }
+
+                if (metadata->mask & FAN_MOVED_TO)
+                {
+                    // the files of a folder moved in don't have events of their own
+                    QDirIterator fileIter(pathStr, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+                    while (fileIter.hasNext())
+                    {
+                        coalescer.AddChange(FileAction::FileAction_Added, fileIter.next(), timeMs);
+                    }
+                }
+                else if (metadata->mask & (FAN_DELETE | FAN_MOVED_FROM))
+                {
+                    coalescer.AddChange(FileAction::FileAction_Removed, pathStr, timeMs);
+                }
+            }
+            else if ((metadata->mask & (FAN_CREATE | FAN_MOVED_TO)) && (metadata->mask & (FAN_DELETE | FAN_MOVED_FROM)))
+            {
+                // fanotify merges the events of a file which are still queued, which loses their order
+                coalescer.AddChange(QFileInfo::exists(pathStr) ? FileAction::FileAction_Added : FileAction::FileAction_Removed, pathStr, timeMs);
+            }
+            else if (metadata->mask & (FAN_CREATE | FAN_MOVED_TO))
+            {
+                coalescer.AddChange(FileAction::FileAction_Added, pathStr, timeMs);
+            }
+            else if (metadata->mask & (FAN_DELETE | FAN_MOVED_FROM))
+            {
+                coalescer.AddChange(FileAction::FileAction_Removed, pathStr, timeMs);
+            }
+            else if (metadata->mask & (FAN_MODIFY | FAN_CLOSE_WRITE))
+            {
+                coalescer.AddChange(FileAction::FileAction_Modified, pathStr, timeMs);
+            }
+        }
+    }
+#endif // defined(FAN_REPORT_DFID_NAME)
+
+    void ProcessEvents(const char* eventBuffer, ssize_t bytesRead, FileChangeCoalescer& coalescer, qint64 timeMs)
+    {
+#if defined(FAN_REPORT_DFID_NAME)
+        if (m_fanotifyHandle >= 0)
+        {
+            ProcessFanotifyEvents(eventBuffer, bytesRead, coalescer, timeMs);
+            return;
+        }
+#endif
+
+        for (ssize_t index = 0; index < bytesRead;)
+        {
+            const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(&eventBuffer[index]);
+            ProcessINotifyEvent(event, coalescer, timeMs);
+            index += s_iNotifyEventSize + event->len;
+        }
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -150,12 +526,16 @@ FolderRootWatch::~FolderRootWatch()
 
 bool FolderRootWatch::Start()
 {
-    // inotify will be used by linux to monitor file changes within directories under the root folder
-    if (!m_platformImpl->Initialize())
+    // inotify will be used by linux to monitor file changes within directories under the root folder,
+    // unless fanotify is enabled in the settings and the Asset Processor is allowed to use it
+    if (!m_platformImpl->Initialize(m_root))
     {
         return false;
     }
-    m_platformImpl->AddWatchFolder(m_root);
+    if (!m_platformImpl->IsUsingFanotify())
+    {
+        m_platformImpl->AddWatchFolder(m_root);
+    }
 
     m_shutdownThreadSignal = false;
     m_thread = std::thread([this]() { WatchFolderLoop(); });
@@ -166,70 +546,67 @@ void FolderRootWatch::Stop()
 {
     m_shutdownThreadSignal = true;
 
-    m_platformImpl->Finalize();
-
     if (m_thread.joinable())
     {
+        // wake the thread up, it only closes the handles it reads from once it's finished with them
+        const uint64_t stopSignal = 1;
+        [[maybe_unused]] const ssize_t bytesWritten = ::write(m_platformImpl->m_stopHandle, &stopSignal, sizeof(stopSignal));
+
         m_thread.join(); // wait for the thread to finish
         m_thread = std::thread(); //destroy
     }
+
+    m_platformImpl->Finalize();
 }
 
 
 void FolderRootWatch::WatchFolderLoop()
 {
-    char eventBuffer[s_iNotifyReadBufferSize];
+    // changes are held until the file has settled, and then handed out in batches, see FileChangeCoalescer
+    FileChangeCoalescer coalescer;
+    QElapsedTimer clock;
+    clock.start();
+
+    // aligned for the fanotify events, which start with a 64 bit mask
+    alignas(uint64_t) char eventBuffer[s_iNotifyReadBufferSize];
     while (!m_shutdownThreadSignal)
     {
-        ssize_t bytesRead = ::read(m_platformImpl->m_iNotifyHandle, eventBuffer, s_iNotifyReadBufferSize);
-        if (bytesRead < 0)
+        const qint64 nextReadyTimeMs = coalescer.GetNextReadyTimeMs();
+        const int timeoutMs = nextReadyTimeMs < 0 ? -1 : aznumeric_cast<int>(AZStd::max<qint64>(nextReadyTimeMs - clock.elapsed(), 0));
+
+        struct pollfd pollHandles[2] = {
+            { m_platformImpl->m_stopHandle, POLLIN, 0 },
+            { m_platformImpl->GetEventHandle(), POLLIN, 0 },
+        };
+        if (::poll(pollHandles, 2, timeoutMs) < 0)
         {
-            // Break out of the loop when the notify handle was closed (outside of this thread)
+            if (errno == EINTR)
+            {
+                continue;
+            }
             break;
         }
-        else if (bytesRead > 0)
-        {
-            for (size_t index=0; index<bytesRead;)
-            {
-                struct inotify_event *event = ( struct inotify_event * ) &eventBuffer[ index ];
-                const char* eventName = event->name;
 
-                if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE ))
-                {
-                    QString pathStr = QString("%1%2%3").arg(m_platformImpl->m_handleToFolderMap[event->wd], QDir::separator(), event->name);
+        if (pollHandles[0].revents != 0 || (pollHandles[1].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+        {
+            // Break out of the loop when stopped (outside of this thread)
+            break;
+        }
 
-                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) 
-                    {
-                        if ( event->mask & IN_ISDIR ) 
-                        {
-                            // New Directory, add it to the watch
-                            m_platformImpl->AddWatchFolder(pathStr);
-                        }
-                        else 
-                        {
-                            ProcessNewFileEvent(pathStr);
-                        }
-                    }
-                    else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) 
-                    {
-                        if (event->mask & IN_ISDIR) 
-                        {
-                            // Directory Deleted, remove it from the watch
-                            m_platformImpl->RemoveWatchFolder(event->wd);
-                        }
-                        else 
-                        {
-                            ProcessDeleteFileEvent(pathStr);
-                        }
-                    }
-                    else if ((event->mask & IN_MODIFY) && ((event->mask & IN_ISDIR) != IN_ISDIR))
-                    {
-                        ProcessModifyFileEvent(pathStr);
-                    }
-                }
-                index += s_iNotifyEventSize + event->len;
+        if (pollHandles[1].revents & POLLIN)
+        {
+            ssize_t bytesRead = ::read(pollHandles[1].fd, eventBuffer, s_iNotifyReadBufferSize);
+            if (bytesRead > 0)
+            {
+                m_platformImpl->ProcessEvents(eventBuffer, bytesRead, coalescer, clock.elapsed());
             }
         }
+
+        for (QVector<FileChangeInfo> readyChanges = coalescer.TakeReadyChanges(clock.elapsed(), s_maxChangesPerBatch);
+            !readyChanges.isEmpty();
+            readyChanges = coalescer.TakeReadyChanges(clock.elapsed(), s_maxChangesPerBatch))
+        {
+            ProcessFileChanges(readyChanges);
+        }
     }
 }
-
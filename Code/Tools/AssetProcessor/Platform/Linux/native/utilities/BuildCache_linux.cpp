@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/BuildCache.h>
+
+#include <QFile>
+
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AssetProcessor
+{
+    LinkResult LinkOrCopyFile(const QString& existingPath, const QString& newPath)
+    {
+        const QByteArray existingName = QFile::encodeName(existingPath);
+        const QByteArray newName = QFile::encodeName(newPath);
+
+#if defined(FICLONE)
+        // a clone shares the data until either file is written, which is only supported by some filesystems, such as btrfs and xfs
+        const int existingFd = open(existingName.constData(), O_RDONLY | O_CLOEXEC);
+        if (existingFd >= 0)
+        {
+            struct stat existingStat;
+            const mode_t mode = fstat(existingFd, &existingStat) == 0 ? (existingStat.st_mode & 0777) : 0644;
+            const int newFd = open(newName.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+            if (newFd >= 0)
+            {
+                const bool cloned = ioctl(newFd, FICLONE, existingFd) == 0;
+                close(newFd);
+                if (cloned)
+                {
+                    close(existingFd);
+                    return LinkResult::Cloned;
+                }
+                unlink(newName.constData());
+            }
+            close(existingFd);
+        }
+#endif
+
+        // hardlinks work on any local filesystem, but not across filesystems
+        if (link(existingName.constData(), newName.constData()) == 0)
+        {
+            return LinkResult::Linked;
+        }
+
+        return QFile::copy(existingPath, newPath) ? LinkResult::Copied : LinkResult::Failed;
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/DirectoryWalker.h>
+
+#include <QFile>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AssetProcessor
+{
+    namespace Internal
+    {
+        // Layout of the records returned by the getdents64 system call
+        struct LinuxDirent64
+        {
+            ino64_t d_ino;
+            off64_t d_off;
+            unsigned short d_reclen;
+            unsigned char d_type;
+            char d_name[];
+        };
+
+        // Reads the type, size and modtime of an entry relative to its directory, which saves resolving the whole path.
+        // Links are followed, the same way QFileInfo does.
+        bool StatEntry(int directoryFd, const char* name, DirectoryEntry& entry)
+        {
+#if defined(STATX_BASIC_STATS)
+            struct statx entryStat;
+            if (statx(directoryFd, name, AT_STATX_SYNC_AS_STAT, STATX_TYPE | STATX_SIZE | STATX_MTIME, &entryStat) != 0)
+            {
+                return false;
+            }
+
+            const mode_t mode = entryStat.stx_mode;
+            const qint64 modTimeMs = static_cast<qint64>(entryStat.stx_mtime.tv_sec) * 1000 + entryStat.stx_mtime.tv_nsec / 1000000;
+            const AZ::u64 size = entryStat.stx_size;
+#else
+            struct stat entryStat;
+            if (fstatat(directoryFd, name, &entryStat, 0) != 0)
+            {
+                return false;
+            }
+
+            const mode_t mode = entryStat.st_mode;
+            const qint64 modTimeMs = static_cast<qint64>(entryStat.st_mtim.tv_sec) * 1000 + entryStat.st_mtim.tv_nsec / 1000000;
+            const AZ::u64 size = entryStat.st_size;
+#endif
+            if (!S_ISDIR(mode) && !S_ISREG(mode))
+            {
+                // sockets, pipes and devices are left out, as QDir does without QDir::System
+                return false;
+            }
+
+            entry.m_isDirectory = S_ISDIR(mode);
+            entry.m_fileSize = entry.m_isDirectory ? 0 : size;
+            entry.m_modTime = QDateTime::fromMSecsSinceEpoch(modTimeMs);
+            return true;
+        }
+    } // namespace Internal
+
+    bool ListDirectory(const QString& absolutePath, AZStd::vector<DirectoryEntry>& entries)
+    {
+        const int directoryFd = open(QFile::encodeName(absolutePath).constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directoryFd < 0)
+        {
+            return false;
+        }
+
+        // getdents64 fills the buffer with as many entries as fit, which takes far fewer system calls than readdir on big directories
+        alignas(Internal::LinuxDirent64) char buffer[32 * 1024];
+        while (true)
+        {
+            const long bytesRead = syscall(SYS_getdents64, directoryFd, buffer, sizeof(buffer));
+            if (bytesRead <= 0)
+            {
+                break;
+            }
+
+            for (long offset = 0; offset < bytesRead;)
+            {
+                const auto* dirent = reinterpret_cast<const Internal::LinuxDirent64*>(buffer + offset);
+                offset += dirent->d_reclen;
+
+                // hidden entries are skipped, which also takes care of . and ..
+                if (dirent->d_name[0] == '.')
+                {
+                    continue;
+                }
+
+                DirectoryEntry entry;
+                if (Internal::StatEntry(directoryFd, dirent->d_name, entry))
+                {
+                    entry.m_name = QFile::decodeName(dirent->d_name);
+                    entries.push_back(AZStd::move(entry));
+                }
+            }
+        }
+
+        close(directoryFd);
+        return true;
+    }
+} // namespace AssetProcessor
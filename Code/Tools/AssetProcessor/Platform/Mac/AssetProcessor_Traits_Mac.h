@@ -9,3 +9,5 @@
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "rc"
 #define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
+#define ASSETPROCESSOR_TRAIT_HAS_NATIVE_LIST_DIRECTORY false
+#define ASSETPROCESSOR_TRAIT_HAS_NATIVE_LINK_FILE false
@@ -39,6 +39,8 @@ set(FILES
     native/connection/connectionworker.h
     native/FileProcessor/FileProcessor.cpp
     native/FileProcessor/FileProcessor.h
+    native/FileWatcher/FileChangeCoalescer.cpp
+    native/FileWatcher/FileChangeCoalescer.h
     native/FileWatcher/FileWatcher.cpp
     native/FileWatcher/FileWatcher.h
     native/FileWatcher/FileWatcherAPI.h
@@ -87,10 +89,14 @@ set(FILES
     native/utilities/BuilderManager.cpp
     native/utilities/BuilderManager.h
     native/utilities/BuilderManager.inl
+    native/utilities/BuildCache.cpp
+    native/utilities/BuildCache.h
     native/utilities/ByteArrayStream.cpp
     native/utilities/ByteArrayStream.h
     native/utilities/CommunicatorTracePrinter.cpp
     native/utilities/CommunicatorTracePrinter.h
+    native/utilities/DirectoryWalker.cpp
+    native/utilities/DirectoryWalker.h
     native/utilities/IniConfiguration.cpp
     native/utilities/IniConfiguration.h
     native/utilities/JobDiagnosticTracker.cpp
@@ -20,6 +20,7 @@ set(FILES
     native/tests/AssetProcessorTest.cpp
     native/tests/BaseAssetProcessorTest.h
     native/tests/assetdatabase/AssetDatabaseTest.cpp
+    native/tests/assetdatabase/AssetDatabaseBenchmarks.cpp
     native/tests/resourcecompiler/RCBuilderTest.cpp
     native/tests/resourcecompiler/RCBuilderTest.h
     native/tests/resourcecompiler/RCControllerTest.cpp
@@ -32,6 +33,10 @@ set(FILES
     native/tests/assetmanager/AssetProcessorManagerTest.cpp
     native/tests/assetmanager/AssetProcessorManagerTest.h
     native/tests/utilities/assetUtilsTest.cpp
+    native/tests/utilities/BuildCacheTests.cpp
+    native/tests/utilities/BuilderManagerTests.cpp
+    native/tests/utilities/DirectoryWalkerBenchmarks.cpp
+    native/tests/utilities/DirectoryWalkerTests.cpp
     native/tests/platformconfiguration/platformconfigurationtests.cpp
     native/tests/platformconfiguration/platformconfigurationtests.h
     native/tests/utilities/JobModelTest.cpp
@@ -44,6 +49,7 @@ set(FILES
     native/tests/FileProcessor/FileProcessorTests.cpp
     native/tests/FileStateCache/FileStateCacheTests.h
     native/tests/FileStateCache/FileStateCacheTests.cpp
+    native/tests/FileWatcher/FileChangeCoalescerTests.cpp
     native/tests/InternalBuilders/SettingsRegistryBuilderTests.cpp
     native/tests/MissingDependencyScannerTests.cpp
     native/tests/SourceFileRelocatorTests.cpp
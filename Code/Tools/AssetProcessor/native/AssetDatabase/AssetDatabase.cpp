@@ -73,6 +73,7 @@ namespace AssetProcessor
             "    LastLogFile      TEXT collate nocase, "
             "    ErrorCount       INTEGER NOT NULL, "
             "    WarningCount     INTEGER NOT NULL, "
+            "    ProcessDurationMs INTEGER NOT NULL DEFAULT 0, "
             "    FOREIGN KEY (SourcePK) REFERENCES "
             "       Sources(SourceID) ON DELETE CASCADE);";
 
@@ -338,8 +339,8 @@ namespace AssetProcessor
 
         static const char* INSERT_JOB = "AssetProcessor::InsertJob";
         static const char* INSERT_JOB_STATEMENT =
-            "INSERT INTO Jobs (SourcePK, JobKey, Fingerprint, Platform, BuilderGuid, Status, JobRunKey, FirstFailLogTime, FirstFailLogFile, LastFailLogTime, LastFailLogFile, LastLogTime, LastLogFile, WarningCount, ErrorCount) "
-            "VALUES (:sourceid, :jobkey, :fingerprint, :platform, :builderguid, :status, :jobrunkey, :firstfaillogtime, :firstfaillogfile, :lastfaillogtime, :lastfaillogfile, :lastlogtime, :lastlogfile, :warningcount, :errorcount);";
+            "INSERT INTO Jobs (SourcePK, JobKey, Fingerprint, Platform, BuilderGuid, Status, JobRunKey, FirstFailLogTime, FirstFailLogFile, LastFailLogTime, LastFailLogFile, LastLogTime, LastLogFile, WarningCount, ErrorCount, ProcessDurationMs) "
+            "VALUES (:sourceid, :jobkey, :fingerprint, :platform, :builderguid, :status, :jobrunkey, :firstfaillogtime, :firstfaillogfile, :lastfaillogtime, :lastfaillogfile, :lastlogtime, :lastlogfile, :warningcount, :errorcount, :processdurationms);";
 
         static const auto s_InsertJobQuery = MakeSqlQuery(INSERT_JOB, INSERT_JOB_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":sourceid"),
@@ -356,7 +357,8 @@ namespace AssetProcessor
             SqlParam<AZ::s64>(":lastlogtime"),
             SqlParam<const char*>(":lastlogfile"),
             SqlParam<AZ::u32>(":warningcount"),
-            SqlParam<AZ::u32>(":errorcount")
+            SqlParam<AZ::u32>(":errorcount"),
+            SqlParam<AZ::s64>(":processdurationms")
         );
 
         static const char* UPDATE_JOB = "AssetProcessor::UpdateJob";
@@ -376,7 +378,8 @@ namespace AssetProcessor
             "LastLogTime = :lastlogtime, "
             "LastLogFile = :lastlogfile, "
             "WarningCount = :warningcount, "
-            "ErrorCount = :errorcount "
+            "ErrorCount = :errorcount, "
+            "ProcessDurationMs = :processdurationms "
             "WHERE JobID = :jobid;";
 
         static const auto s_UpdateJobQuery = MakeSqlQuery(UPDATE_JOB, UPDATE_JOB_STATEMENT, LOG_NAME,
@@ -395,6 +398,7 @@ namespace AssetProcessor
             SqlParam<const char*>(":lastlogfile"),
             SqlParam<AZ::u32>(":warningcount"),
             SqlParam<AZ::u32>(":errorcount"),
+            SqlParam<AZ::s64>(":processdurationms"),
             SqlParam<AZ::s64>(":jobid")
         );
 
@@ -725,6 +729,11 @@ namespace AssetProcessor
             "ALTER TABLE MissingProductDependencies "
             "ADD ScanTimeSecondsSinceEpoch INTEGER;";
 
+        static const char* INSERT_COLUMN_JOB_PROCESS_DURATION = "AssetProcessor::AddJobs_ProcessDurationMs";
+        static const char* INSERT_COLUMN_JOB_PROCESS_DURATION_STATEMENT =
+            "ALTER TABLE Jobs "
+            "ADD ProcessDurationMs INTEGER NOT NULL DEFAULT 0;";
+
         static const char* INSERT_FILE = "AssetProcessor::InsertFile";
         static const char* INSERT_FILE_STATEMENT =
             "INSERT INTO Files (ScanFolderPK, FileName, IsFolder, ModTime, Hash) "
@@ -812,11 +821,75 @@ namespace AssetProcessor
         {
             CloseDatabase();
         }
+        m_writeBatchDepth = 0;
         AZStd::string dbFilePath = GetAssetDatabaseFilePath();
         AZ::IO::SystemFile::Delete(dbFilePath.c_str());
         OpenDatabase();
     }
 
+    void AssetDatabaseConnection::BeginWriteBatch()
+    {
+        if (!m_databaseConnection)
+        {
+            return;
+        }
+
+        if (m_writeBatchDepth++ == 0)
+        {
+            m_writeBatchTimer.start();
+        }
+        m_databaseConnection->BeginTransaction();
+    }
+
+    void AssetDatabaseConnection::CommitWriteBatch()
+    {
+        if (!m_databaseConnection || m_writeBatchDepth == 0)
+        {
+            return;
+        }
+
+        --m_writeBatchDepth;
+        m_databaseConnection->CommitTransaction();
+    }
+
+    void AssetDatabaseConnection::CommitWriteBatchIfDue()
+    {
+        // a nested batch can't be committed without committing the ones it is part of
+        if (!m_databaseConnection || m_writeBatchDepth != 1 || m_writeBatchTimer.elapsed() < WriteBatchMaxDurationMs)
+        {
+            return;
+        }
+
+        m_databaseConnection->CommitTransaction();
+        m_databaseConnection->BeginTransaction();
+        m_writeBatchTimer.restart();
+    }
+
+    bool AssetDatabaseConnection::IsInWriteBatch() const
+    {
+        return m_writeBatchDepth > 0;
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::ScopedWriteBatch(AssetDatabaseConnection& connection)
+        : m_connection(&connection)
+    {
+        m_connection->BeginWriteBatch();
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::~ScopedWriteBatch()
+    {
+        Commit();
+    }
+
+    void AssetDatabaseConnection::ScopedWriteBatch::Commit()
+    {
+        if (m_connection)
+        {
+            m_connection->CommitWriteBatch();
+            m_connection = nullptr;
+        }
+    }
+
 
     bool AssetDatabaseConnection::PostOpenDatabase()
     {
@@ -1047,6 +1120,15 @@ namespace AssetProcessor
         // sqlite doesn't not support altering a table to remove a column
         // This is fine as the extra OutputPrefix column will not be queried
 
+        if (foundVersion == AssetDatabase::DatabaseVersion::RemoveOutputPrefixFromScanFolders)
+        {
+            if (m_databaseConnection->ExecuteOneOffStatement(INSERT_COLUMN_JOB_PROCESS_DURATION))
+            {
+                foundVersion = DatabaseVersion::AddedJobProcessDurationField;
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedJobProcessDurationField)\n", foundVersion)
+            }
+        }
+
         if (foundVersion == CurrentDatabaseVersion())
         {
             dropAllTables = false;
@@ -1265,6 +1347,7 @@ namespace AssetProcessor
         m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_HASH, INSERT_COLUMN_FILE_HASH_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_LAST_SCAN, INSERT_COLUMN_LAST_SCAN_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH, INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH_STATEMENT);
+        m_databaseConnection->AddStatement(INSERT_COLUMN_JOB_PROCESS_DURATION, INSERT_COLUMN_JOB_PROCESS_DURATION_STATEMENT);
         // ---------------------------------------------------------------------------------------------
         //                   Indices
         // ---------------------------------------------------------------------------------------------
@@ -1959,7 +2042,8 @@ namespace AssetProcessor
 
             if (!s_InsertJobQuery.BindAndStep(*m_databaseConnection, entry.m_sourcePK, entry.m_jobKey.c_str(), entry.m_fingerprint, entry.m_platform.c_str(),
                 entry.m_builderGuid, static_cast<int>(entry.m_status), entry.m_jobRunKey, entry.m_firstFailLogTime, entry.m_firstFailLogFile.c_str(),
-                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount))
+                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount,
+                entry.m_processDurationMs))
             {
                 return false;
             }
@@ -2001,7 +2085,8 @@ namespace AssetProcessor
 
             return s_UpdateJobQuery.BindAndStep(*m_databaseConnection, entry.m_sourcePK, entry.m_jobKey.c_str(), entry.m_fingerprint, entry.m_platform.c_str(),
                 entry.m_builderGuid, static_cast<int>(entry.m_status), entry.m_jobRunKey, entry.m_firstFailLogTime, entry.m_firstFailLogFile.c_str(),
-                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount, entry.m_jobID);
+                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount,
+                entry.m_processDurationMs, entry.m_jobID);
         }
     }
 
@@ -14,6 +14,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QSet>
 #include <QtCore/QString>
 
@@ -54,6 +55,39 @@ namespace AssetProcessor
         void LoadData();
         void ClearData();
 
+        //////////////////////////////////////////////////////////////////////////
+        //Write batches
+        //Groups the writes that follow into one transaction instead of committing every statement on its own.
+        //Batches nest, the writes are only committed when the outermost batch is.
+        //NOTE: writes made in a batch are not visible to other connections (the asset catalog, the tools) until
+        //it is committed, so commit it before notifying anyone about the data written.
+        //A batch holds the write lock of the database until it is committed, other connections that write (such as the
+        //FileProcessor's) wait for it, so keep batches short.
+        void BeginWriteBatch();
+        void CommitWriteBatch();
+        //Commits the outermost batch and begins a new one once it has been open for longer than WriteBatchMaxDurationMs,
+        //so that a long run of writes doesn't hold everything back from other connections and keep growing the WAL file.
+        void CommitWriteBatchIfDue();
+        bool IsInWriteBatch() const;
+
+        static constexpr qint64 WriteBatchMaxDurationMs = 250;
+
+        //! Begins a write batch, which is committed (not rolled back) when it goes out of scope.
+        class ScopedWriteBatch
+        {
+        public:
+            explicit ScopedWriteBatch(AssetDatabaseConnection& connection);
+            ~ScopedWriteBatch();
+
+            //! Commits the batch before the end of the scope.
+            void Commit();
+
+            ScopedWriteBatch(const ScopedWriteBatch&) = delete;
+            ScopedWriteBatch& operator=(const ScopedWriteBatch&) = delete;
+        private:
+            AssetDatabaseConnection* m_connection = nullptr;
+        };
+
         //////////////////////////////////////////////////////////////////////////
         //Queries
         //NOTE: When passing in a structure to the Set<> functions, a default constructed structure has -1 for
@@ -226,6 +260,9 @@ namespace AssetProcessor
 
     private:
         AZStd::vector<AZStd::string> m_createStatements; // contains all statements required to create the tables
+
+        int m_writeBatchDepth = 0;
+        QElapsedTimer m_writeBatchTimer;
     };
 }//namespace EditorFramework
 
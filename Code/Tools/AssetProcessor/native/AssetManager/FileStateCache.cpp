@@ -72,6 +72,23 @@ namespace AssetProcessor
         }
     }
 
+    void FileStateCache::AddHashSet(QVector<FileStateHash> hashSet)
+    {
+        LockGuardType scopeLock(m_mapMutex);
+        for (const FileStateHash& fileHash : hashSet)
+        {
+            QString key = PathToKey(fileHash.m_absolutePath);
+            auto fileInfoItr = m_fileInfoMap.find(key);
+
+            // Only keep the hash if the file is still in the state it was hashed in.
+            // If it changed since, the hash will be computed again next time it's requested
+            if (fileInfoItr != m_fileInfoMap.end() && !fileInfoItr.value().m_isDirectory && fileInfoItr.value().m_modTime == fileHash.m_modTime)
+            {
+                m_fileHashMap[key] = fileHash.m_hash;
+            }
+        }
+    }
+
     void FileStateCache::AddFile(const QString& absolutePath)
     {
         QFileInfo fileInfo(absolutePath);
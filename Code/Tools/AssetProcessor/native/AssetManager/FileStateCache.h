@@ -13,6 +13,7 @@
 #include <QString>
 #include <QSet>
 #include <QFileInfo>
+#include <QVector>
 #include <AzCore/Interface/Interface.h>
 
 namespace AssetProcessor
@@ -37,6 +38,19 @@ namespace AssetProcessor
         bool m_isDirectory{};
     };
 
+    //! A hash which is already known for a file, such as one recorded in the database by a previous run,
+    //! along with the modtime the file had when it was hashed
+    struct FileStateHash
+    {
+        FileStateHash() = default;
+        FileStateHash(QString filePath, QDateTime modTime, AZ::u64 hash)
+            : m_absolutePath(filePath), m_modTime(modTime), m_hash(hash) {}
+
+        QString m_absolutePath{};
+        QDateTime m_modTime{};
+        AZ::u64 m_hash{};
+    };
+
     struct IFileStateRequests
     {
         AZ_RTTI(IFileStateRequests, "{2D883B3A-DCA3-4CE0-976C-4511C3277371}");
@@ -72,6 +86,9 @@ namespace AssetProcessor
         /// Bulk adds file state to the cache
         virtual void AddInfoSet(QSet<AssetFileInfo> /*infoSet*/) {}
 
+        /// Bulk adds known hashes to the cache, so they don't have to be computed again when requested
+        virtual void AddHashSet(QVector<FileStateHash> /*hashSet*/) {}
+
         /// Adds a single file to the cache.  This will query the OS for the current state
         virtual void AddFile(const QString& /*absolutePath*/) {}
 
@@ -96,6 +113,7 @@ namespace AssetProcessor
         bool GetHash(const QString& absolutePath, FileHash* foundHash) override;
 
         void AddInfoSet(QSet<AssetFileInfo> infoSet) override;
+        void AddHashSet(QVector<FileStateHash> hashSet) override;
         void AddFile(const QString& absolutePath) override;
         void UpdateFile(const QString& absolutePath) override;
         void RemoveFile(const QString& absolutePath) override;
@@ -8,8 +8,13 @@
 #include <QStringList>
 #include <QCoreApplication>
 #include <QElapsedTimer>
+#include <QFuture>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
@@ -128,10 +133,15 @@ namespace AssetProcessor
     {
         if (status == AssetProcessor::AssetScanningStatus::Started)
         {
+            m_scanTimer.start();
+            m_scanHashMs = 0;
+            m_scanAssessMs = 0;
+            m_scanHashedFileCount = 0;
+            m_scanHashedBytes = 0;
+
             // Ensure that the source file list is populated before a scan begins
             m_sourceFilesInDatabase.clear();
-            m_fileModTimes.clear();
-            m_fileHashes.clear();
+            m_filesInDatabase.clear();
 
             auto sourcesFunction = [this](AzToolsFramework::AssetDatabase::SourceAndScanFolderDatabaseEntry& entry)
             {
@@ -146,7 +156,14 @@ namespace AssetProcessor
 
             m_stateData->QuerySourceAndScanfolder(sourcesFunction);
 
-            m_stateData->QueryFilesTable([this](AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry)
+            QHash<AZ::s64, QString> scanFolderPaths;
+            for (int i = 0; i < m_platformConfig->GetScanFolderCount(); ++i)
+            {
+                const auto& scanFolderInfo = m_platformConfig->GetScanFolderAt(i);
+                scanFolderPaths.insert(scanFolderInfo.ScanFolderID(), scanFolderInfo.ScanPath());
+            }
+
+            m_stateData->QueryFilesTable([this, &scanFolderPaths](AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry)
             {
                 if (entry.m_isFolder)
                 {
@@ -154,33 +171,40 @@ namespace AssetProcessor
                     return true;
                 }
 
-                QString scanFolderPath;
+                QString scanFolderPath = scanFolderPaths.value(entry.m_scanFolderPK);
                 QString relativeToScanFolderPath = QString::fromUtf8(entry.m_fileName.c_str());
-                
-                for (int i = 0; i < m_platformConfig->GetScanFolderCount(); ++i)
-                {
-                    const auto& scanFolderInfo = m_platformConfig->GetScanFolderAt(i);
-                    
-                    if (scanFolderInfo.ScanFolderID() == entry.m_scanFolderPK)
-                    {
-                        scanFolderPath = scanFolderInfo.ScanPath();
-                        break;
-                    }
-                }
 
                 QString finalAbsolute = (QString("%1/%2").arg(scanFolderPath).arg(relativeToScanFolderPath));
-                m_fileModTimes.emplace(finalAbsolute.toUtf8().data(), entry.m_modTime);
-                m_fileHashes.emplace(finalAbsolute.toUtf8().constData(), entry.m_hash);
+                m_filesInDatabase.push_back({ AZStd::move(finalAbsolute), entry.m_modTime, entry.m_hash });
 
                 return true;
             });
 
+            AZStd::sort(m_filesInDatabase.begin(), m_filesInDatabase.end(), [](const DatabaseFileState& lhs, const DatabaseFileState& rhs)
+            {
+                return lhs.m_absolutePath < rhs.m_absolutePath;
+            });
+
+            m_scanDatabaseLoadMs = m_scanTimer.elapsed();
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Loaded %d sources and %zu files from the database in %lld ms\n",
+                m_sourceFilesInDatabase.size(), m_filesInDatabase.size(), m_scanDatabaseLoadMs);
+
             m_isCurrentlyScanning = true;
         }
         else if ((status == AssetProcessor::AssetScanningStatus::Completed) ||
                  (status == AssetProcessor::AssetScanningStatus::Stopped))
         {
+            if (m_isCurrentlyScanning)
+            {
+                // the file system walk happens on the scanner thread while the database is loaded here, so it accounts for the rest of the time
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel,
+                    "Scan time breakdown: %lld ms total, %lld ms loading the database, %lld ms assessing files "
+                    "(of which %lld ms hashing %d modified files, %llu bytes)\n",
+                    m_scanTimer.elapsed(), m_scanDatabaseLoadMs, m_scanAssessMs, m_scanHashMs, m_scanHashedFileCount, m_scanHashedBytes);
+            }
+
             m_isCurrentlyScanning = false;
+            m_filesInDatabase.clear();
             // we cannot invoke this immediately - the scanner might be done, but we aren't actually ready until we've processed all remaining messages:
             QMetaObject::invokeMethod(this, "CheckMissingFiles", Qt::QueuedConnection);
         }
@@ -701,6 +725,7 @@ namespace AssetProcessor
 
         job.m_warningCount = info.m_warningCount;
         job.m_errorCount = info.m_errorCount;
+        job.m_processDurationMs = info.m_processDurationMs;
 
         // check to see if builder request deletion of LKG asset on failure, and delete them if so
         {
@@ -976,6 +1001,11 @@ namespace AssetProcessor
                 continue;
             }
 
+            // the dozens of rows written for a job are committed all at once rather than one statement at a time.
+            // messages about the new products are held back until then, since whoever receives them may go read those rows.
+            AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
+            AZStd::vector<AssetNotificationMessage> productMessages;
+
             if (m_stateData->GetSourcesBySourceNameScanFolderId(processedAsset.m_entry.m_databaseSourceName, scanFolder->ScanFolderID(), sources))
             {
                 AZ_Assert(sources.size() == 1, "Should have only found one source!!!");
@@ -1045,6 +1075,7 @@ namespace AssetProcessor
 
             job.m_warningCount = info.m_warningCount;
             job.m_errorCount = info.m_errorCount;
+            job.m_processDurationMs = info.m_processDurationMs;
 
             // create/update job:
             if (!m_stateData->SetJob(job))
@@ -1340,11 +1371,17 @@ namespace AssetProcessor
                     }
                 }
 
-                Q_EMIT AssetMessage( message);
+                productMessages.push_back(AZStd::move(message));
                 
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
             }
 
+            writeBatch.Commit();
+            for (const AssetNotificationMessage& productMessage : productMessages)
+            {
+                Q_EMIT AssetMessage(productMessage);
+            }
+
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
             // notify the system about inputs:
@@ -2060,6 +2097,12 @@ namespace AssetProcessor
         AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer jobs; //should only find one when we specify builder, job key, platform
         bool foundInDatabase = m_stateData->GetJobsBySourceName(jobDetails.m_jobEntry.m_databaseSourceName, jobs, jobDetails.m_jobEntry.m_builderGuid, jobDetails.m_jobEntry.m_jobKey, jobDetails.m_jobEntry.m_platformInfo.m_identifier.c_str());
 
+        if (foundInDatabase)
+        {
+            // how long the job took last time it ran, RCController uses it to start the longest chains of jobs first
+            jobDetails.m_estimatedProcessDurationMs = jobs[0].m_processDurationMs;
+        }
+
         if (foundInDatabase && jobs[0].m_fingerprint == jobDetails.m_jobEntry.m_computedFingerprint)
         {
             // If the fingerprint hasn't changed, we won't process it.. unless...is it missing a product.
@@ -2823,46 +2866,195 @@ namespace AssetProcessor
 
     void AssetProcessorManager::AssessFilesFromScanner(QSet<AssetFileInfo> filePaths)
     {
+        QElapsedTimer assessTimer;
+        assessTimer.start();
+
+        if (!m_allowModtimeSkippingFeature)
+        {
+            for (const AssetFileInfo& fileInfo : filePaths)
+            {
+                AssessFileInternal(fileInfo.m_filePath, false, true);
+            }
+
+            m_scanAssessMs += assessTimer.elapsed();
+            return;
+        }
+
         int processedFileCount = 0;
 
-        for (const AssetFileInfo& fileInfo : filePaths)
+        AZStd::vector<ScannedFile> scannedFiles = MatchScannedFilesWithDatabase(filePaths);
+        HashScannedFiles(scannedFiles);
+
+        // a scan can update the modtime of tens of thousands of files, which are committed a batch at a time
+        AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
+
+        for (const ScannedFile& scannedFile : scannedFiles)
         {
-            if (m_allowModtimeSkippingFeature)
+            m_stateData->CommitWriteBatchIfDue();
+
+            const AssetFileInfo& fileInfo = *scannedFile.m_fileInfo;
+
+            AZ::u64 fileHash = 0;
+            if (CanSkipProcessingFile(scannedFile, fileHash))
             {
-                AZ::u64 fileHash = 0;
-                if (CanSkipProcessingFile(fileInfo, fileHash))
-                {
-                    AddKnownFoldersRecursivelyForFile(fileInfo.m_filePath, fileInfo.m_scanFolder->ScanPath());
+                AddKnownFoldersRecursivelyForFile(fileInfo.m_filePath, fileInfo.m_scanFolder->ScanPath());
 
-                    if (fileHash != 0)
-                    {
-                        QString databaseName;
-                        m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
+                if (fileHash != 0)
+                {
+                    QString databaseName;
+                    m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
 
-                        // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
+                    // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
+                    bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
 
-                        if(!updated)
-                        {
-                            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
-                        }
+                    if(!updated)
+                    {
+                        AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
                     }
-
-                    continue;
                 }
+
+                continue;
             }
 
             processedFileCount++;
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
+        writeBatch.Commit();
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
+
+        m_scanAssessMs += assessTimer.elapsed();
+    }
+
+    AZStd::vector<AssetProcessorManager::ScannedFile> AssetProcessorManager::MatchScannedFilesWithDatabase(const QSet<AssetFileInfo>& filePaths) const
+    {
+        AZStd::vector<ScannedFile> scannedFiles;
+        scannedFiles.reserve(filePaths.size());
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            ScannedFile scannedFile;
+            scannedFile.m_fileInfo = &fileInfo;
+            scannedFiles.push_back(scannedFile);
+        }
+
+        AZStd::sort(scannedFiles.begin(), scannedFiles.end(), [](const ScannedFile& lhs, const ScannedFile& rhs)
+        {
+            return lhs.m_fileInfo->m_filePath < rhs.m_fileInfo->m_filePath;
+        });
+
+        // both lists are sorted the same way, so each one only has to be walked once
+        auto databaseItr = m_filesInDatabase.begin();
+        for (ScannedFile& scannedFile : scannedFiles)
+        {
+            const QString& filePath = scannedFile.m_fileInfo->m_filePath;
+            while (databaseItr != m_filesInDatabase.end() && databaseItr->m_absolutePath < filePath)
+            {
+                ++databaseItr;
+            }
+
+            if (databaseItr == m_filesInDatabase.end())
+            {
+                break;
+            }
+
+            if (databaseItr->m_absolutePath == filePath)
+            {
+                scannedFile.m_databaseState = &*databaseItr;
+            }
+        }
 
-        if (m_allowModtimeSkippingFeature)
+        return scannedFiles;
+    }
+
+    void AssetProcessorManager::HashScannedFiles(AZStd::vector<ScannedFile>& scannedFiles)
+    {
+        // below this many files, it isn't worth starting threads
+        constexpr int MinFilesForParallelHashing = 16;
+
+        if (m_buildersAddedOrRemoved)
+        {
+            // none of the files are going to be skipped, so there is no need to hash them
+            return;
+        }
+
+        QElapsedTimer hashTimer;
+        hashTimer.start();
+
+        // the files which are unchanged since the last run keep the hash recorded in the database, the others have to be hashed again
+        QVector<FileStateHash> knownHashes;
+        QVector<ScannedFile*> filesToHash;
+        for (ScannedFile& scannedFile : scannedFiles)
+        {
+            const DatabaseFileState* databaseState = scannedFile.m_databaseState;
+            if (!databaseState || databaseState->m_modTime == 0 || databaseState->m_hash == 0)
+            {
+                // CanSkipProcessingFile won't hash files which were never hashed before
+                continue;
+            }
+
+            const AssetFileInfo& fileInfo = *scannedFile.m_fileInfo;
+            if (databaseState->m_modTime == AssetUtilities::AdjustTimestamp(fileInfo.m_modTime))
+            {
+                knownHashes.push_back(FileStateHash(fileInfo.m_filePath, fileInfo.m_modTime, databaseState->m_hash));
+            }
+            else
+            {
+                filesToHash.push_back(&scannedFile);
+            }
+        }
+
+        AZStd::atomic<AZ::u64> bytesRead{ 0 };
+        AZStd::atomic_int nextFileIndex{ 0 };
+        // the file state cache hashes under its lock, so the files are hashed directly to actually do it in parallel
+        auto hashFiles = [&filesToHash, &bytesRead, &nextFileIndex]()
+        {
+            AZ::IO::SizeType threadBytesRead = 0;
+            for (int fileIndex = nextFileIndex++; fileIndex < filesToHash.size(); fileIndex = nextFileIndex++)
+            {
+                ScannedFile& scannedFile = *filesToHash[fileIndex];
+                scannedFile.m_currentHash = AssetUtilities::GetFileHash(scannedFile.m_fileInfo->m_filePath.toUtf8().constData(), true, &threadBytesRead);
+            }
+            bytesRead += threadBytesRead;
+        };
+
+        if (filesToHash.size() < MinFilesForParallelHashing)
         {
-            AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
+            hashFiles();
         }
+        else
+        {
+            // use a pool of our own, the global one runs the builders
+            QThreadPool hashThreadPool;
+            const int threadCount = AZStd::min(QThread::idealThreadCount(), filesToHash.size() / MinFilesForParallelHashing);
+            hashThreadPool.setMaxThreadCount(threadCount);
+
+            QVector<QFuture<void>> hashFutures;
+            for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                hashFutures.push_back(QtConcurrent::run(&hashThreadPool, hashFiles));
+            }
+            for (QFuture<void>& hashFuture : hashFutures)
+            {
+                hashFuture.waitForFinished();
+            }
+        }
+
+        for (const ScannedFile* scannedFile : filesToHash)
+        {
+            if (scannedFile->m_currentHash != 0)
+            {
+                knownHashes.push_back(FileStateHash(scannedFile->m_fileInfo->m_filePath, scannedFile->m_fileInfo->m_modTime, scannedFile->m_currentHash));
+            }
+        }
+
+        m_scanHashMs += hashTimer.elapsed();
+        m_scanHashedFileCount += filesToHash.size();
+        m_scanHashedBytes += bytesRead;
+
+        Q_EMIT FileHashesKnown(knownHashes);
     }
 
-    bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
+    bool AssetProcessorManager::CanSkipProcessingFile(const ScannedFile& scannedFile, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
         // If not, don't even bother processing the file
@@ -2872,18 +3064,16 @@ namespace AssetProcessor
             return false;
         }
 
-        auto fileItr = m_fileModTimes.find(fileInfo.m_filePath.toUtf8().data());
+        const AssetFileInfo& fileInfo = *scannedFile.m_fileInfo;
+        const DatabaseFileState* databaseState = scannedFile.m_databaseState;
 
-        if (fileItr == m_fileModTimes.end())
+        if (!databaseState)
         {
             // File has not been processed before
             return false;
         }
 
-        AZ::u64 databaseModTime = fileItr->second;
-
-        // Remove the file from the list, it's not needed anymore
-        m_fileModTimes.erase(fileItr);
+        AZ::u64 databaseModTime = databaseState->m_modTime;
 
         if(databaseModTime == 0)
         {
@@ -2898,18 +3088,7 @@ namespace AssetProcessor
         {
             // File timestamp has changed since last time
             // Check if the contents have changed or if its just a timestamp mismatch
-
-            auto hashItr = m_fileHashes.find(fileInfo.m_filePath.toUtf8().constData());
-
-            if(hashItr == m_fileHashes.end())
-            {
-                // No hash found
-                return false;
-            }
-
-            AZ::u64 databaseHashValue = hashItr->second;
-
-            m_fileHashes.erase(hashItr);
+            AZ::u64 databaseHashValue = databaseState->m_hash;
 
             if(databaseHashValue == 0)
             {
@@ -2917,8 +3096,9 @@ namespace AssetProcessor
                 return false;
             }
 
-            AZ::u64 fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
-                
+            // the file was hashed by HashScannedFiles
+            AZ::u64 fileHash = scannedFile.m_currentHash;
+
             if(fileHash != databaseHashValue)
             {
                 // File contents have changed
@@ -2928,7 +3108,7 @@ namespace AssetProcessor
             fileHashOut = fileHash;
         }
 
-        auto sourceFileItr = m_sourceFilesInDatabase.find(fileInfo.m_filePath.toUtf8().data());
+        auto sourceFileItr = m_sourceFilesInDatabase.find(fileInfo.m_filePath);
 
         if (sourceFileItr != m_sourceFilesInDatabase.end())
         {
@@ -2979,6 +3159,25 @@ namespace AssetProcessor
         AssessFileInternal(filePath, true);
     }
 
+    void AssetProcessorManager::AssessFileChanges(QVector<FileChangeInfo> changes)
+    {
+        for (const FileChangeInfo& change : changes)
+        {
+            if (change.m_action & FileAction::FileAction_Removed)
+            {
+                AssessDeletedFile(change.m_filePath);
+            }
+            else if (change.m_action & FileAction::FileAction_Added)
+            {
+                AssessAddedFile(change.m_filePath);
+            }
+            else if (change.m_action & FileAction::FileAction_Modified)
+            {
+                AssessModifiedFile(change.m_filePath);
+            }
+        }
+    }
+
     void AssetProcessorManager::ScheduleNextUpdate()
     {
         m_alreadyScheduledUpdate = false;
@@ -3149,6 +3348,14 @@ namespace AssetProcessor
             AZStd::lock_guard<AssetProcessor::ProcessingJobInfoBus::MutexType> lock(AssetProcessor::ProcessingJobInfoBus::GetOrCreateContext().m_contextMutex);
             m_jobFingerprintMap[jobIndentifier] = job.m_jobEntry.m_computedFingerprint;
         }
+        if (BuildCacheBus::HasHandlers())
+        {
+            // jobs which depend on this one are keyed with its key, whether this one runs or is up to date.
+            // Jobs are analyzed after the jobs they depend on, so their keys are known by then.
+            AZStd::string buildCacheKey = AssetUtilities::GenerateBuildCacheKey(job);
+            AZStd::lock_guard<AssetProcessor::ProcessingJobInfoBus::MutexType> lock(AssetProcessor::ProcessingJobInfoBus::GetOrCreateContext().m_contextMutex);
+            m_jobBuildCacheKeyMap[jobIndentifier] = AZStd::move(buildCacheKey);
+        }
         job.m_jobEntry.m_computedFingerprintTimeStamp = QDateTime::currentMSecsSinceEpoch();
         if (job.m_jobEntry.m_computedFingerprint == 0)
         {
@@ -3502,6 +3709,7 @@ namespace AssetProcessor
                         {
                             AZStd::lock_guard<AssetProcessor::ProcessingJobInfoBus::MutexType> lock(AssetProcessor::ProcessingJobInfoBus::GetOrCreateContext().m_contextMutex);
                              m_jobFingerprintMap.erase(jobIdentifier); 
+                             m_jobBuildCacheKeyMap.erase(jobIdentifier);
                         }
 
                         entry.m_jobsToAnalyze.push_back(AZStd::move(newJob));
@@ -3827,6 +4035,17 @@ namespace AssetProcessor
         }
     }
 
+    AZStd::string AssetProcessorManager::GetJobBuildCacheKey(const AssetProcessor::JobIndentifier& jobIndentifier)
+    {
+        auto jobFound = m_jobBuildCacheKeyMap.find(jobIndentifier);
+        if (jobFound == m_jobBuildCacheKeyMap.end())
+        {
+            // the job wasn't analyzed this session, or the build cache is disabled
+            return {};
+        }
+        return jobFound->second;
+    }
+
     AZ::s64 AssetProcessorManager::GenerateNewJobRunKey()
     {
         return m_highestJobRunKeySoFar++;
@@ -19,6 +19,7 @@
 #include <QMap>
 #include <QPair>
 #include <QMutex>
+#include <QElapsedTimer>
 
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -32,6 +33,8 @@
 #include "native/utilities/ThreadHelper.h"
 #include "native/AssetManager/AssetCatalog.h"
 #include "native/AssetDatabase/AssetDatabase.h"
+#include "native/AssetManager/FileStateCache.h"
+#include "native/FileWatcher/FileWatcherAPI.h"
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/map.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
@@ -182,6 +185,7 @@ namespace AssetProcessor
         void BeginCacheFileUpdate(const char* productPath) override;
         void EndCacheFileUpdate(const char* productPath, bool queueAgainForDeletion) override;
         AZ::u32 GetJobFingerprint(const AssetProcessor::JobIndentifier& jobIndentifier) override;
+        AZStd::string GetJobBuildCacheKey(const AssetProcessor::JobIndentifier& jobIndentifier) override;
         //////////////////////////////////////////////////////////////////////////
 
         //! Controls whether or not we are allowed to skip analysis on a file when the source files modtimes have not changed
@@ -261,6 +265,10 @@ namespace AssetProcessor
 
         void AddedToCatalog(JobEntry jobEntry);
 
+        //! Emitted during the scan with the hashes of files which are already known, either recorded in the database
+        //! by a previous run or computed while checking which files changed, so they don't need to be computed again.
+        void FileHashesKnown(QVector<AssetProcessor::FileStateHash> hashSet);
+
     public Q_SLOTS:
         void AssetProcessed(JobEntry jobEntry, AssetBuilderSDK::ProcessJobResponse response);
         void AssetProcessed_Impl();
@@ -273,6 +281,8 @@ namespace AssetProcessor
         void AssessModifiedFile(QString filePath);
         void AssessAddedFile(QString filePath);
         void AssessDeletedFile(QString filePath);
+        //! Assesses a batch of changes from the file watcher, with a single queued call for the whole batch
+        void AssessFileChanges(QVector<FileChangeInfo> changes);
         void OnAssetScannerStatusChange(AssetProcessor::AssetScanningStatus status);
         void OnJobStatusChanged(JobEntry jobEntry, JobStatus status);
         
@@ -364,8 +374,31 @@ namespace AssetProcessor
         void AddSourceToDatabase(AzToolsFramework::AssetDatabase::SourceDatabaseEntry& sourceDatabaseEntry, const ScanFolderInfo* scanFolder, QString relativeSourceFilePath);
 
     protected:
+        //! The state of a file recorded in the database by the last run
+        struct DatabaseFileState
+        {
+            QString m_absolutePath;
+            AZ::u64 m_modTime = 0;
+            AZ::u64 m_hash = 0;
+        };
+
+        //! A file found by the scanner, matched up with the state the database has for it
+        struct ScannedFile
+        {
+            const AssetFileInfo* m_fileInfo = nullptr;
+            const DatabaseFileState* m_databaseState = nullptr; // null when the file wasn't seen by the last run
+            AZ::u64 m_currentHash = 0; // only computed for the files whose modtime changed since the last run
+        };
+
+        //! Sorts the scanned files by path and merge-joins them with the files loaded from the database, in a single pass.
+        AZStd::vector<ScannedFile> MatchScannedFilesWithDatabase(const QSet<AssetFileInfo>& filePaths) const;
+
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
-        bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
+        bool CanSkipProcessingFile(const ScannedFile& scannedFile, AZ::u64& fileHash);
+
+        //! Hashes, in parallel, the scanned files whose modtime doesn't match the one in the database so CanSkipProcessingFile
+        //! doesn't have to hash them one at a time, and reports the hashes known for the scanned files with FileHashesKnown.
+        void HashScannedFiles(AZStd::vector<ScannedFile>& scannedFiles);
 
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
@@ -423,11 +456,17 @@ namespace AssetProcessor
         // the key to this map is the absolute path of the file from last run, but with the current scan folder setup
         QMap<QString, SourceInfoWithFingerprints> m_sourceFilesInDatabase;
 
-        // this map contains modtimes of all files AP processed last time it ran
-        AZStd::unordered_map<AZStd::string, AZ::u64> m_fileModTimes;
+        // this list contains the modtimes and hashes of all files AP processed last time it ran,
+        // sorted by absolute path so the files found by the scanner can be matched up with it in a single pass
+        AZStd::vector<DatabaseFileState> m_filesInDatabase;
 
-        // this map contains hashes of all files AP processed last time it ran
-        AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
+        // time spent in each step of the scan, reported once the scan is complete
+        QElapsedTimer m_scanTimer;
+        qint64 m_scanDatabaseLoadMs = 0;
+        qint64 m_scanHashMs = 0;
+        qint64 m_scanAssessMs = 0;
+        int m_scanHashedFileCount = 0;
+        AZ::u64 m_scanHashedBytes = 0;
 
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
@@ -457,6 +496,8 @@ namespace AssetProcessor
         //! This map is required to prevent multiple sourceFile modified events been send by the APM 
         AZStd::unordered_map<AZ::Uuid, qint64> m_sourceFileModTimeMap;
         AZStd::unordered_map<JobIndentifier, AZ::u32> m_jobFingerprintMap; 
+        //! Build cache keys of the jobs analyzed this session, only kept when the build cache is enabled.
+        AZStd::unordered_map<JobIndentifier, AZStd::string> m_jobBuildCacheKeyMap;
         AZStd::unordered_map<JobDesc, AZStd::unordered_set<AZ::Uuid>> m_jobDescToBuilderUuidMap;
         
         AZStd::unique_ptr<PathDependencyManager> m_pathDependencyManager;
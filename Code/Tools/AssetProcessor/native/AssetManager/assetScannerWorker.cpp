@@ -9,6 +9,7 @@
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
+#include <QElapsedTimer>
 
 using namespace AssetProcessor;
 
@@ -28,15 +29,13 @@ void AssetScannerWorker::StartScan()
     m_doScan = true;
 
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
+    QElapsedTimer scanTimer;
+    scanTimer.start();
 
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
-    {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
-    }
+    ScanForSourceFiles();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -49,12 +48,13 @@ void AssetScannerWorker::StartScan()
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
-    else
-    {
-        EmitFiles();
-    }
 
-    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "File system scan done.\n");
+    const qint64 walkMs = scanTimer.elapsed();
+    const int fileCount = m_fileList.size();
+    const int folderCount = m_folderList.size();
+    EmitFiles();
+
+    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "File system scan done: found %d files and %d folders in %lld ms.\n", fileCount, folderCount, walkMs);
 
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Completed);
 }
@@ -65,70 +65,92 @@ void AssetScannerWorker::StartScan()
 void AssetScannerWorker::StopScan()
 {
     m_doScan = false;
+    m_directoryWalker.Cancel();
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles()
 {
-    if (!m_doScan)
+    // the root index of each scan folder given by the walker is its index in the platform configuration
+    AZStd::vector<const ScanFolderInfo*> rootScanFolders;
+    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
     {
-        return;
+        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+        rootScanFolders.push_back(&scanFolderInfo);
+        m_directoryWalker.AddRoot(scanFolderInfo.ScanPath(), scanFolderInfo.RecurseSubFolders());
     }
+    const int rootCount = aznumeric_cast<int>(rootScanFolders.size());
 
-    QDir dir(scanFolderInfo.ScanPath());
-
-    QFileInfoList entries;
-
-    //Only scan sub folders if recurseSubFolders flag is set
-    if (!scanFolderInfo.RecurseSubFolders())
-    {
-        entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
-    }
-    else
+    // what each walking thread found under each scan folder, merged once the walk is done so the threads never wait on each other
+    struct FoundEntries
     {
-        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
-    }
-
-    for (const QFileInfo& entry : entries)
+        AZStd::vector<AssetFileInfo> m_files;
+        AZStd::vector<AssetFileInfo> m_folders;
+        AZStd::vector<AssetFileInfo> m_excluded;
+    };
+    AZStd::vector<FoundEntries> foundEntries(m_directoryWalker.GetThreadCount() * rootCount);
+
+    QDir projectCacheRoot;
+    AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
+    const QString normalizedCacheRootPath = AssetUtilities::NormalizeDirectoryPath(projectCacheRoot.absolutePath());
+
+    m_directoryWalker.Walk([this, &foundEntries, &rootScanFolders, rootCount, &normalizedCacheRootPath](
+        int threadIndex, int rootIndex, const QString& absPath, const DirectoryEntry& entry)
     {
         if (!m_doScan) // scan was cancelled!
         {
-            return;
+            return false;
         }
 
-        QString absPath = entry.absoluteFilePath();
-        const bool isDirectory = entry.isDir();
-        QDateTime modTime = entry.lastModified();
-        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
-
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
-        QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
-        if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
+        if (absPath.startsWith(normalizedCacheRootPath, Qt::CaseInsensitive)
+            && (absPath.size() == normalizedCacheRootPath.size() || absPath[normalizedCacheRootPath.size()] == '/'))
         {
             // The Cache folder should not be scanned
-            continue;
+            return false;
         }
 
+        AssetFileInfo assetFileInfo(absPath, entry.m_modTime, entry.m_fileSize, rootScanFolders[rootIndex], entry.m_isDirectory);
+        FoundEntries& threadEntries = foundEntries[threadIndex * rootCount + rootIndex];
+
         // Filtering out excluded files
         if (m_platformConfiguration->IsFileExcluded(absPath))
         {
-            m_excludedList.insert(AZStd::move(assetFileInfo));
-            continue;
+            threadEntries.m_excluded.push_back(AZStd::move(assetFileInfo));
+            return false;
         }
 
-        if (isDirectory)
+        if (entry.m_isDirectory)
         {
             //Entry is a directory
-            m_folderList.insert(AZStd::move(assetFileInfo));
-            ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo, rootScanFolder);
+            threadEntries.m_folders.push_back(AZStd::move(assetFileInfo));
+            return true;
         }
-        else
+
+        //Entry is a file
+        threadEntries.m_files.push_back(AZStd::move(assetFileInfo));
+        return false;
+    });
+
+    // scan folders can overlap, in which case a file is found once under each of them. It belongs to the one with the
+    // highest priority, which comes first in the platform configuration, so merge scan folder by scan folder and keep
+    // the first entry found for each path, whichever thread found it.
+    for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+    {
+        for (int threadIndex = 0; threadIndex < m_directoryWalker.GetThreadCount(); ++threadIndex)
         {
-            //Entry is a file
-            m_fileList.insert(AZStd::move(assetFileInfo));
+            FoundEntries& threadEntries = foundEntries[threadIndex * rootCount + rootIndex];
+            for (AssetFileInfo& assetFileInfo : threadEntries.m_files)
+            {
+                m_fileList.insert(AZStd::move(assetFileInfo));
+            }
+            for (AssetFileInfo& assetFileInfo : threadEntries.m_folders)
+            {
+                m_folderList.insert(AZStd::move(assetFileInfo));
+            }
+            for (AssetFileInfo& assetFileInfo : threadEntries.m_excluded)
+            {
+                m_excludedList.insert(AZStd::move(assetFileInfo));
+            }
         }
     }
 }
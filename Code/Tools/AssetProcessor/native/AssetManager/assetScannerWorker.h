@@ -11,6 +11,7 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include "native/utilities/DirectoryWalker.h"
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -43,13 +44,13 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // walks all the scan folders at once, on as many threads as there are cores, and collects what it finds
+        void ScanForSourceFiles();
         void EmitFiles();
 
     private:
         volatile bool m_doScan = true;
+        ParallelDirectoryWalker m_directoryWalker;
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "FileChangeCoalescer.h"
+
+#include <AzCore/std/algorithm.h>
+
+FileChangeCoalescer::FileChangeCoalescer(qint64 debounceMs, qint64 maxDelayMs)
+    : m_debounceMs(debounceMs)
+    , m_maxDelayMs(AZStd::max(debounceMs, maxDelayMs))
+{
+}
+
+void FileChangeCoalescer::AddChange(FileAction action, const QString& filePath, qint64 timeMs)
+{
+    const AZ::u64 sequence = m_nextSequence++;
+
+    auto pendingIter = m_pendingChanges.find(filePath);
+    if (pendingIter == m_pendingChanges.end())
+    {
+        PendingChange pendingChange;
+        pendingChange.m_action = action;
+        pendingChange.m_firstSequence = sequence;
+        pendingChange.m_lastSequence = sequence;
+        m_pendingChanges.insert(filePath, pendingChange);
+        m_byFirstChange.enqueue({ filePath, sequence, timeMs });
+    }
+    else
+    {
+        pendingIter->m_action = MergeActions(pendingIter->m_action, action);
+        pendingIter->m_lastSequence = sequence;
+    }
+
+    m_byLastChange.enqueue({ filePath, sequence, timeMs });
+}
+
+QVector<FileChangeInfo> FileChangeCoalescer::TakeReadyChanges(qint64 timeMs, int maxCount)
+{
+    QVector<FileChangeInfo> readyChanges;
+    while (readyChanges.size() < maxCount)
+    {
+        SkipStaleEntries();
+
+        QQueue<QueuedChange>* readyQueue = nullptr;
+        if (!m_byLastChange.isEmpty() && m_byLastChange.head().m_timeMs + m_debounceMs <= timeMs)
+        {
+            readyQueue = &m_byLastChange;
+        }
+        else if (!m_byFirstChange.isEmpty() && m_byFirstChange.head().m_timeMs + m_maxDelayMs <= timeMs)
+        {
+            readyQueue = &m_byFirstChange;
+        }
+        else
+        {
+            break;
+        }
+
+        // the entry left for the file in the other queue is stale from now on, and skipped later
+        const QueuedChange readyChange = readyQueue->dequeue();
+        auto pendingIter = m_pendingChanges.find(readyChange.m_filePath);
+        const FileAction action = pendingIter->m_action;
+        m_pendingChanges.erase(pendingIter);
+
+        if (action != FileAction::FileAction_None)
+        {
+            FileChangeInfo info;
+            info.m_action = action;
+            info.m_filePath = readyChange.m_filePath;
+            readyChanges.push_back(info);
+        }
+    }
+    return readyChanges;
+}
+
+qint64 FileChangeCoalescer::GetNextReadyTimeMs()
+{
+    SkipStaleEntries();
+
+    qint64 nextReadyTimeMs = -1;
+    if (!m_byLastChange.isEmpty())
+    {
+        nextReadyTimeMs = m_byLastChange.head().m_timeMs + m_debounceMs;
+    }
+    if (!m_byFirstChange.isEmpty())
+    {
+        const qint64 maxDelayTimeMs = m_byFirstChange.head().m_timeMs + m_maxDelayMs;
+        nextReadyTimeMs = nextReadyTimeMs < 0 ? maxDelayTimeMs : AZStd::min(nextReadyTimeMs, maxDelayTimeMs);
+    }
+    return nextReadyTimeMs;
+}
+
+int FileChangeCoalescer::GetPendingCount() const
+{
+    return m_pendingChanges.size();
+}
+
+FileAction FileChangeCoalescer::MergeActions(FileAction pendingAction, FileAction newAction)
+{
+    switch (pendingAction)
+    {
+    case FileAction::FileAction_None:
+        // the file didn't exist before the pending changes, since they cancelled out
+    case FileAction::FileAction_Added:
+        return newAction == FileAction::FileAction_Removed ? FileAction::FileAction_None : FileAction::FileAction_Added;
+    case FileAction::FileAction_Modified:
+    case FileAction::FileAction_Removed:
+        // the file existed before the pending changes, so if it exists now it was modified
+        return newAction == FileAction::FileAction_Removed ? FileAction::FileAction_Removed : FileAction::FileAction_Modified;
+    default:
+        return newAction;
+    }
+}
+
+void FileChangeCoalescer::SkipStaleEntries()
+{
+    while (!m_byLastChange.isEmpty())
+    {
+        auto pendingIter = m_pendingChanges.constFind(m_byLastChange.head().m_filePath);
+        if (pendingIter != m_pendingChanges.constEnd() && pendingIter->m_lastSequence == m_byLastChange.head().m_sequence)
+        {
+            break;
+        }
+        m_byLastChange.dequeue();
+    }
+
+    while (!m_byFirstChange.isEmpty())
+    {
+        auto pendingIter = m_pendingChanges.constFind(m_byFirstChange.head().m_filePath);
+        if (pendingIter != m_pendingChanges.constEnd() && pendingIter->m_firstSequence == m_byFirstChange.head().m_sequence)
+        {
+            break;
+        }
+        m_byFirstChange.dequeue();
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "FileWatcherAPI.h"
+
+#include <AzCore/base.h>
+#include <AzCore/std/limits.h>
+
+#include <QHash>
+#include <QQueue>
+#include <QString>
+#include <QVector>
+
+//////////////////////////////////////////////////////////////////////////
+//! FileChangeCoalescer
+/*! Collects the file changes reported by a platform watcher and hands them out once each file
+ *! has settled, so that the many events written by a single save, or by a branch switch touching
+ *! thousands of files, reach the listeners as one net change per file, in batches.
+ *! A file is ready once no change was reported for it for the debounce time, or once its
+ *! first change is older than the max delay, so that a file which is written constantly is still reported.
+ *! Not thread safe, it's meant to be owned by the thread reading the platform events.
+ * */
+class FileChangeCoalescer
+{
+public:
+    static constexpr qint64 DefaultDebounceMs = 100;
+    static constexpr qint64 DefaultMaxDelayMs = 1000;
+
+    explicit FileChangeCoalescer(qint64 debounceMs = DefaultDebounceMs, qint64 maxDelayMs = DefaultMaxDelayMs);
+
+    //! Records a change reported at timeMs, which must not be earlier than the time of the previous change, merged with the change still pending for the same file:
+    //! added then modified is added, added then removed cancels out, removed then added is modified.
+    void AddChange(FileAction action, const QString& filePath, qint64 timeMs);
+
+    //! Returns up to maxCount changes which are ready at timeMs, in the order they became ready, and forgets them.
+    //! Files whose changes cancelled out are forgotten without being returned.
+    QVector<FileChangeInfo> TakeReadyChanges(qint64 timeMs, int maxCount = AZStd::numeric_limits<int>::max());
+
+    //! Returns the time at which the next file is ready, or -1 if no change is pending
+    qint64 GetNextReadyTimeMs();
+
+    int GetPendingCount() const;
+
+    //! Returns the net change of a pending change followed by another one for the same file,
+    //! FileAction_None meaning the changes cancelled out
+    static FileAction MergeActions(FileAction pendingAction, FileAction newAction);
+
+private:
+    struct PendingChange
+    {
+        FileAction m_action = FileAction::FileAction_None;
+        AZ::u64 m_firstSequence = 0; //!< sequence of the change which made the file pending
+        AZ::u64 m_lastSequence = 0; //!< sequence of the latest change
+    };
+
+    // every change queues the file in both queues, and entries whose sequence is no longer the current
+    // one of the file are skipped, which keeps each queue sorted by time without searching them
+    struct QueuedChange
+    {
+        QString m_filePath;
+        AZ::u64 m_sequence = 0;
+        qint64 m_timeMs = 0;
+    };
+
+    //! Drops the entries at the front of the queues which are stale
+    void SkipStaleEntries();
+
+    qint64 m_debounceMs;
+    qint64 m_maxDelayMs;
+    AZ::u64 m_nextSequence = 1;
+    QHash<QString, PendingChange> m_pendingChanges;
+    QQueue<QueuedChange> m_byLastChange;
+    QQueue<QueuedChange> m_byFirstChange;
+};
@@ -37,12 +37,23 @@ void FolderRootWatch::ProcessModifyFileEvent(const QString& file)
     Q_ASSERT(invoked);
 }
 
+void FolderRootWatch::ProcessFileChanges(const QVector<FileChangeInfo>& changes)
+{
+    if (changes.isEmpty())
+    {
+        return;
+    }
+    const bool invoked = QMetaObject::invokeMethod(m_fileWatcher, "AnyFileChanges", Qt::QueuedConnection, Q_ARG(QVector<FileChangeInfo>, changes));
+    Q_ASSERT(invoked);
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// FileWatcher
 FileWatcher::FileWatcher()
     : m_nextHandle(0)
 {
     qRegisterMetaType<FileChangeInfo>("FileChangeInfo");
+    qRegisterMetaType<QVector<FileChangeInfo>>("QVector<FileChangeInfo>");
 }
 
 FileWatcher::~FileWatcher()
@@ -81,6 +92,7 @@ int FileWatcher::AddFolderWatch(FolderWatchBase* pFolderWatch)
 
     pFolderRootWatch->m_fileWatcher = this;
     QObject::connect(this, &FileWatcher::AnyFileChange, pFolderWatch, &FolderWatchBase::OnAnyFileChange);
+    QObject::connect(this, &FileWatcher::AnyFileChanges, pFolderWatch, &FolderWatchBase::OnAnyFileChanges);
 
     if (bCreatedNewRoot)
     {
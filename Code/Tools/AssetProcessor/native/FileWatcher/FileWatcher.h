@@ -40,6 +40,8 @@ public:
     void ProcessDeleteFileEvent(const QString& file);
     void ProcessModifyFileEvent(const QString& file);
     void ProcessRenameFileEvent(const QString& fileOld, const QString& fileNew);
+    //! Sends a batch of changes to the FileWatcher as a single queued call
+    void ProcessFileChanges(const QVector<FileChangeInfo>& changes);
 
 public Q_SLOTS:
     bool Start();
@@ -85,6 +87,7 @@ public:
 
 Q_SIGNALS:
     void AnyFileChange(FileChangeInfo info);
+    void AnyFileChanges(QVector<FileChangeInfo> infos);
 
 private:
     int m_nextHandle;
@@ -11,6 +11,7 @@
 #include <QString>
 #include <QObject>
 #include <QDir>
+#include <QVector>
 
 //////////////////////////////////////////////////////////////////////////
 //! FileAction
@@ -139,7 +140,33 @@ public Q_SLOTS:
         }
     }
 
+    //! Batches come from the watchers which coalesce changes, see FileChangeCoalescer
+    void OnAnyFileChanges(QVector<FileChangeInfo> infos)
+    {
+        QVector<FileChangeInfo> matchingInfos;
+        for (const FileChangeInfo& info : infos)
+        {
+            if ((info.m_action & m_fileAction) && FolderWatchBase::IsSubfolder(info.m_filePath, m_folder))
+            {
+                matchingInfos.push_back(info);
+            }
+        }
+
+        if (!matchingInfos.isEmpty())
+        {
+            OnFileChanges(matchingInfos);
+        }
+    }
+
     virtual void OnFileChange(const FileChangeInfo& info) = 0;
+
+    virtual void OnFileChanges(const QVector<FileChangeInfo>& infos)
+    {
+        for (const FileChangeInfo& info : infos)
+        {
+            OnFileChange(info);
+        }
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -168,6 +195,44 @@ public:
     //on file change call the change callback if passes extension then route
     //to specific file action type callback
     virtual void OnFileChange(const FileChangeInfo& info)
+    {
+        if (EmitFileChange(info))
+        {
+            Q_EMIT filesChanged({ info });
+        }
+    }
+
+    //same as OnFileChange for each change, and then the changes which pass the filters as one batch
+    void OnFileChanges(const QVector<FileChangeInfo>& infos) override
+    {
+        QVector<FileChangeInfo> emittedInfos;
+        emittedInfos.reserve(infos.size());
+        for (const FileChangeInfo& info : infos)
+        {
+            if (EmitFileChange(info))
+            {
+                emittedInfos.push_back(info);
+            }
+        }
+
+        if (!emittedInfos.isEmpty())
+        {
+            Q_EMIT filesChanged(emittedInfos);
+        }
+    }
+
+Q_SIGNALS:
+    void fileChange(FileChangeInfo info);
+    void fileAdded(QString filePath);
+    void fileRemoved(QString filePath);
+    void fileModified(QString filePath);
+    //! Emitted after the per file signals with all the changes which passed the filters,
+    //! so that listeners on another thread can take a batch of changes as a single queued call
+    void filesChanged(QVector<FileChangeInfo> infos);
+
+private:
+    //emits the per file signals if the change passes the filters, and returns whether it did
+    bool EmitFileChange(const FileChangeInfo& info)
     {
         //if they set an extension to watch for only let matching extensions through
         QFileInfo fileInfo(info.m_filePath);
@@ -178,13 +243,13 @@ public:
             QStringRef subRef = info.m_filePath.rightRef(info.m_filePath.length() - m_folder.length());
             if ((subRef.indexOf('/') != -1) || (subRef.indexOf('\\') != -1))
             {
-                return; // filter this out.
+                return false; // filter this out.
             }
 
             // we don't care about subdirs.  IsDir is more expensive so we do it after the above filter.
             if (fileInfo.isDir())
             {
-                return;
+                return false;
             }
         }
 
@@ -209,14 +274,10 @@ public:
             {
                 Q_EMIT fileModified(info.m_filePath);
             }
+            return true;
         }
+        return false;
     }
-
-Q_SIGNALS:
-    void fileChange(FileChangeInfo info);
-    void fileAdded(QString filePath);
-    void fileRemoved(QString filePath);
-    void fileModified(QString filePath);
 };
 
 #endif//FILEWATCHERAPI_H
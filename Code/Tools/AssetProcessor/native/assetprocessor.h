@@ -213,6 +213,8 @@ namespace AssetProcessor
 
         bool m_critical = false;
         int m_priority = -1;
+        // how long the job took to process the last time it ran, 0 if it never ran or the time wasn't recorded
+        AZ::s64 m_estimatedProcessDurationMs = 0;
         // indicates whether we need to check the server first for the outputs of this job 
         // before we start processing locally
         bool m_checkServer = false;
@@ -10,6 +10,11 @@
 
 namespace AssetProcessor
 {
+    AZ::s64 QueueDurationEstimate::PredictProcessingTimeMs(int maxJobs) const
+    {
+        return AZStd::max(m_longestCriticalPathMs, m_totalDurationMs / AZStd::max(maxJobs, 1));
+    }
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -198,6 +203,17 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        // start the jobs which the longest chains of queued work wait on first, so those chains don't end up running on their own
+        // once everything else is done. For jobs nothing waits on, this starts the longest ones first, which packs the short ones
+        // in around them.
+        AZ::s64 criticalPathLeft = leftJob->GetCriticalPathDurationMs();
+        AZ::s64 criticalPathRight = rightJob->GetCriticalPathDurationMs();
+
+        if (criticalPathLeft != criticalPathRight)
+        {
+            return criticalPathLeft > criticalPathRight;
+        }
+
         // Optionally stabilize queue order on the source name.
         // This is used in automated tests, to allow tests to have a stable
         // order that jobs with otherwise equal priority run, so tests process
@@ -240,11 +256,106 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+
+        if (rcJob->GetEstimatedProcessDurationMs() > 0)
+        {
+            m_knownDurationTotalMs += rcJob->GetEstimatedProcessDurationMs();
+            ++m_knownDurationCount;
+        }
+
+        // the critical path of a job is how long it takes, plus the longest critical path of the jobs which wait on it
+        AZ::s64 longestWaitingPathMs = 0;
+        for (RCJob* waitingJob : m_jobsWaitingOnElement.values(rcJob->GetElementID()))
+        {
+            longestWaitingPathMs = AZStd::max(longestWaitingPathMs, waitingJob->GetCriticalPathDurationMs());
+        }
+        rcJob->SetCriticalPathDurationMs(GetEstimatedProcessDurationMs(rcJob) + longestWaitingPathMs);
+
+        for (const JobDependencyInternal& jobDepedencyInternal : rcJob->GetJobDependencies())
+        {
+            if (jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order || jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDepedencyInternal.m_jobDependency;
+                m_jobsWaitingOnElement.insert(QueueElementID(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str()), rcJob);
+            }
+        }
+
+        // and the jobs this one waits on now have a longer chain of work behind them
+        QSet<RCJob*> visiting;
+        PropagateCriticalPath(rcJob, visiting);
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+
+        for (const JobDependencyInternal& jobDepedencyInternal : rcJob->GetJobDependencies())
+        {
+            if (jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order || jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDepedencyInternal.m_jobDependency;
+                m_jobsWaitingOnElement.remove(QueueElementID(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str()), rcJob);
+            }
+        }
+    }
+
+    QueueDurationEstimate RCQueueSortModel::EstimateQueueDuration() const
+    {
+        QueueDurationEstimate estimate;
+        for (const auto& jobEntry : m_currentJobRunKeyToJobEntries)
+        {
+            const RCJob* rcJob = jobEntry.second;
+            ++estimate.m_jobCount;
+            if (rcJob->GetEstimatedProcessDurationMs() > 0)
+            {
+                ++estimate.m_jobsWithKnownDuration;
+            }
+            estimate.m_totalDurationMs += GetEstimatedProcessDurationMs(rcJob);
+            estimate.m_longestCriticalPathMs = AZStd::max(estimate.m_longestCriticalPathMs, rcJob->GetCriticalPathDurationMs());
+        }
+        return estimate;
+    }
+
+    AZ::s64 RCQueueSortModel::GetEstimatedProcessDurationMs(const AssetProcessor::RCJob* rcJob) const
+    {
+        if (rcJob->GetEstimatedProcessDurationMs() > 0)
+        {
+            return rcJob->GetEstimatedProcessDurationMs();
+        }
+        return m_knownDurationCount > 0 ? m_knownDurationTotalMs / m_knownDurationCount : DefaultEstimatedProcessDurationMs;
+    }
+
+    void RCQueueSortModel::PropagateCriticalPath(AssetProcessor::RCJob* rcJob, QSet<AssetProcessor::RCJob*>& visiting)
+    {
+        if (!m_sourceModel)
+        {
+            return;
+        }
+
+        // a cyclic order dependency would otherwise keep lengthening the same paths
+        visiting.insert(rcJob);
+
+        for (const JobDependencyInternal& jobDepedencyInternal : rcJob->GetJobDependencies())
+        {
+            if (jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order || jobDepedencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDepedencyInternal.m_jobDependency;
+                QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+
+                for (RCJob* dependencyJob : m_sourceModel->GetQueuedJobs(elementId))
+                {
+                    const AZ::s64 criticalPathMs = GetEstimatedProcessDurationMs(dependencyJob) + rcJob->GetCriticalPathDurationMs();
+                    if (criticalPathMs > dependencyJob->GetCriticalPathDurationMs() && !visiting.contains(dependencyJob))
+                    {
+                        dependencyJob->SetCriticalPathDurationMs(criticalPathMs);
+                        m_dirtyNeedsResort = true;
+                        PropagateCriticalPath(dependencyJob, visiting);
+                    }
+                }
+            }
+        }
+
+        visiting.remove(rcJob);
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
@@ -10,6 +10,7 @@
 
 #if !defined(Q_MOC_RUN)
 #include <QSortFilterProxyModel>
+#include <QMultiHash>
 #include <QSet>
 #include <QString>
 
@@ -17,6 +18,7 @@
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
+#include "native/resourcecompiler/RCCommon.h"
 #endif
 
 class RCcontrollerUnitTests;
@@ -27,13 +29,27 @@ namespace AssetProcessor
     class RCJobListModel;
     class RCJob;
 
+    //! What the jobs known to the queue are expected to cost, from how long each took the last time it ran
+    struct QueueDurationEstimate
+    {
+        AZ::s64 m_totalDurationMs = 0; // the sum of the estimated durations of every job
+        AZ::s64 m_longestCriticalPathMs = 0; // the longest chain of jobs which have to run one after another
+        int m_jobCount = 0;
+        int m_jobsWithKnownDuration = 0;
+
+        //! The least time it can take to run all the jobs on this many at once: whichever is longer of
+        //! the longest chain and all the work spread evenly.
+        AZ::s64 PredictProcessingTimeMs(int maxJobs) const;
+    };
+
     //! This sort and filtering proxy model attaches to the raw RC job list
     //! And presents it in the optimal order for processing rather than display.
     //! The current desired order is
     //!  * Critical (currently Copy) jobs for currently connected platforms
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
-    //!  * Remaining jobs in currently connected platforms, in priority order
+    //!  * Remaining jobs in currently connected platforms, in priority order, and then
+    //!    longest critical path first (see RCJob::GetCriticalPathDurationMs)
     //!  (The same, repeated, for unconnected platforms).
     class RCQueueSortModel
         : public QSortFilterProxyModel
@@ -50,6 +66,8 @@ namespace AssetProcessor
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
 
+        QueueDurationEstimate EstimateQueueDuration() const;
+
         void SetQueueSortOnDBSourceName()
         {
             m_sortQueueOnDBSourceName = true;
@@ -64,11 +82,25 @@ namespace AssetProcessor
 
 
     protected:
+        //! Used for jobs that never ran before, until jobs with a known duration show up
+        static constexpr AZ::s64 DefaultEstimatedProcessDurationMs = 1000;
+
+        AZ::s64 GetEstimatedProcessDurationMs(const AssetProcessor::RCJob* rcJob) const;
+
+        //! Lengthens the critical path of the queued jobs rcJob waits on, and of the ones they wait on in turn
+        void PropagateCriticalPath(AssetProcessor::RCJob* rcJob, QSet<AssetProcessor::RCJob*>& visiting);
 
         typedef AZStd::unordered_map<AZ::s64, AssetProcessor::RCJob*> JobRunKeyToRCJobMap;
 
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
+        // which jobs have an order dependency on a job, by the element id of the job they depend on
+        QMultiHash<QueueElementID, AssetProcessor::RCJob*> m_jobsWaitingOnElement;
+
+        // running total of the durations that are known, their mean is the estimate for jobs that never ran
+        AZ::s64 m_knownDurationTotalMs = 0;
+        AZ::s64 m_knownDurationCount = 0;
+
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
@@ -83,7 +115,7 @@ namespace AssetProcessor
         void AssetProcessorPlatformDisconnected(const AZStd::string platform) override;
         // -----------
 
-        RCJobListModel* m_sourceModel;
+        RCJobListModel* m_sourceModel = nullptr;
     private Q_SLOTS:
 
         void ProcessPlatformChangeMessage(QString platformName, bool connected);
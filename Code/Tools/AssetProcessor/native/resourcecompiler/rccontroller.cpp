@@ -153,6 +153,10 @@ namespace AssetProcessor
             // if there is no next job, and nothing is in flight, we are done.
             if (IsIdle())
             {
+                if (m_processingTimer.isValid())
+                {
+                    m_actualProcessingTimeMs = m_processingTimer.elapsed();
+                }
                 Q_EMIT BecameIdle();
             }
         }
@@ -168,6 +172,21 @@ namespace AssetProcessor
         m_RCQueueSortModel.SetQueueSortOnDBSourceName();
     }
 
+    const QueueDurationEstimate& RCController::GetQueueDurationEstimate() const
+    {
+        return m_queueDurationEstimate;
+    }
+
+    AZ::s64 RCController::GetPredictedProcessingTimeMs() const
+    {
+        return m_queueDurationEstimate.PredictProcessingTimeMs(aznumeric_cast<int>(m_maxJobs));
+    }
+
+    AZ::s64 RCController::GetActualProcessingTimeMs() const
+    {
+        return m_actualProcessingTimeMs;
+    }
+
     void RCController::JobSubmitted(JobDetails details)
     {
         AssetProcessor::QueueElementID checkFile(details.m_jobEntry.m_databaseSourceName, details.m_jobEntry.m_platformInfo.m_identifier.c_str(), details.m_jobEntry.m_jobKey);
@@ -258,6 +277,10 @@ namespace AssetProcessor
             m_dispatchingPaused = pause;
             if (!pause)
             {
+                // everything the scan found is queued by now, so this is what the whole run is expected to cost
+                m_queueDurationEstimate = m_RCQueueSortModel.EstimateQueueDuration();
+                m_processingTimer.start();
+
                 if ((!m_shuttingDown) && (!m_dispatchingJobs))
                 {
                     DispatchJobs();
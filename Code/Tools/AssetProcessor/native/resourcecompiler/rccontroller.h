@@ -14,6 +14,7 @@
 #include <QObject>
 #include <QProcess>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QList>
 #include "native/utilities/AssetUtilEBusHelper.h"
 
@@ -59,6 +60,12 @@ namespace AssetProcessor
 
         void SetQueueSortOnDBSourceName();
 
+        //! What the queue was expected to cost when dispatching was unpaused, from the job durations recorded in the database
+        const QueueDurationEstimate& GetQueueDurationEstimate() const;
+        AZ::s64 GetPredictedProcessingTimeMs() const;
+        //! How long it actually took from dispatching being unpaused until the queue last went idle
+        AZ::s64 GetActualProcessingTimeMs() const;
+
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -122,6 +129,10 @@ namespace AssetProcessor
         AssetProcessor::RCJobListModel m_RCJobListModel;
         AssetProcessor::RCQueueSortModel m_RCQueueSortModel;
 
+        QueueDurationEstimate m_queueDurationEstimate;
+        QElapsedTimer m_processingTimer;
+        AZ::s64 m_actualProcessingTimeMs = 0;
+
         //! An Asset Compile Group is a set of assets that we're tracking the compilation of
         //! It consists of a whole bunch of assets and is considered to be "complete" when either one of the assets in the group fails
         //! Or all assets in the group have finished.
@@ -264,6 +264,21 @@ namespace AssetProcessor
         return m_jobDetails.m_jobDependencyList;
     }
 
+    AZ::s64 RCJob::GetEstimatedProcessDurationMs() const
+    {
+        return m_jobDetails.m_estimatedProcessDurationMs;
+    }
+
+    AZ::s64 RCJob::GetCriticalPathDurationMs() const
+    {
+        return m_criticalPathDurationMs;
+    }
+
+    void RCJob::SetCriticalPathDurationMs(AZ::s64 durationMs)
+    {
+        m_criticalPathDurationMs = durationMs;
+    }
+
     void RCJob::Start()
     {
         // the following trace can be uncommented if there is a need to deeply inspect job running.
@@ -475,6 +490,14 @@ namespace AssetProcessor
         AssetProcessor::SetThreadLocalJobId(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::JobLogTraceListener jobLogTraceListener(builderParams.m_rcJob->m_jobDetails.m_jobEntry);
 
+        // stored with the job so that the next run can schedule it by how long it takes
+        QElapsedTimer processTimer;
+        processTimer.start();
+
+        // set when the job can be stored in or restored from the build cache
+        QString buildCacheKey;
+        bool restoredFromBuildCache = false;
+
         {
             AssetBuilderSDK::JobCancelListener JobCancelListener(builderParams.m_rcJob->m_jobDetails.m_jobEntry.m_jobRunKey);
             result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed; // failed by default
@@ -570,6 +593,30 @@ namespace AssetProcessor
                             runProcessJob = !operationResult;
                         }
                     }
+                    else if (BuildCacheBus::HasHandlers())
+                    {
+                        // jobs which check the server are left to it, the build cache is for all the other ones
+                        buildCacheKey = QString::fromUtf8(AssetUtilities::GenerateBuildCacheKey(m_jobDetails).c_str());
+                        bool restored = false;
+                        if (buildCacheKey.isEmpty())
+                        {
+                            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job (%s, %s, %s) has no build cache key, the key of a job it depends on is unknown. Processing locally.\n",
+                                builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+                        }
+                        else
+                        {
+                            BuildCacheBus::BroadcastResult(restored, &BuildCacheBusTraits::RetrieveJobResult, buildCacheKey, workFolder, result);
+                        }
+                        if (restored)
+                        {
+                            AZ_TracePrintf(AssetProcessor::DebugChannel, "Restored the products of job (%s, %s, %s) from the build cache entry %s.\n",
+                                builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), buildCacheKey.toUtf8().constData());
+                            restoredFromBuildCache = true;
+                            runProcessJob = false;
+                        }
+                    }
 
                     if(runProcessJob)
                     {
@@ -649,7 +696,19 @@ namespace AssetProcessor
         case AssetBuilderSDK::ProcessJobResult_Success:
             // make sure there's no subid collision inside a job.
             {
-                
+                // jobs with warnings or errors aren't stored, so that they're still reported the next time they run
+                if (!buildCacheKey.isEmpty() && !restoredFromBuildCache && jobLogTraceListener.GetWarningCount() == 0 && jobLogTraceListener.GetErrorCount() == 0)
+                {
+                    bool stored = false;
+                    BuildCacheBus::BroadcastResult(stored, &BuildCacheBusTraits::StoreJobResult, buildCacheKey, QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str()), result);
+                    if (!stored)
+                    {
+                        AZ_TracePrintf(AssetProcessor::DebugChannel, "Job (%s, %s, %s) was not stored in the build cache.\n",
+                            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+                    }
+                }
+
                 if (!CopyCompiledAssets(builderParams, result))
                 {
                     result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
@@ -683,7 +742,10 @@ namespace AssetProcessor
         AssetProcessor::SetThreadLocalJobId(0);
         listener.BusDisconnect();
 
-        JobDiagnosticRequestBus::Broadcast(&JobDiagnosticRequestBus::Events::RecordDiagnosticInfo, builderParams.m_rcJob->GetJobEntry().m_jobRunKey, JobDiagnosticInfo(aznumeric_cast<AZ::u32>(jobLogTraceListener.GetWarningCount()), aznumeric_cast<AZ::u32>(jobLogTraceListener.GetErrorCount())));
+        // restoring products from the build cache says nothing about how long building them takes,
+        // so the duration measured the last time the job was built is kept for scheduling it
+        const AZ::s64 processDurationMs = restoredFromBuildCache ? builderParams.m_rcJob->GetEstimatedProcessDurationMs() : processTimer.elapsed();
+        JobDiagnosticRequestBus::Broadcast(&JobDiagnosticRequestBus::Events::RecordDiagnosticInfo, builderParams.m_rcJob->GetJobEntry().m_jobRunKey, JobDiagnosticInfo(aznumeric_cast<AZ::u32>(jobLogTraceListener.GetWarningCount()), aznumeric_cast<AZ::u32>(jobLogTraceListener.GetErrorCount()), processDurationMs));
     }
 
     bool RCJob::CopyCompiledAssets(BuilderParams& params, AssetBuilderSDK::ProcessJobResponse& response)
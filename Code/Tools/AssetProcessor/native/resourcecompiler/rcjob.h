@@ -200,6 +200,14 @@ namespace AssetProcessor
         int GetPriority() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
+        //! How long the job took the last time it ran, 0 if that isn't known
+        AZ::s64 GetEstimatedProcessDurationMs() const;
+
+        //! The estimated time from starting this job until every queued job that waits on it is done, including this job.
+        //! Maintained by the RCQueueSortModel, which starts the jobs with the longest critical path first.
+        AZ::s64 GetCriticalPathDurationMs() const;
+        void SetCriticalPathDurationMs(AZ::s64 durationMs);
+
     protected:
         //! DoWork ensure that the job is ready for being processing and than makes the actual builder call   
         virtual void DoWork(AssetBuilderSDK::ProcessJobResponse& result, BuilderParams& builderParams, AssetUtilities::QuitListener& listener);
@@ -213,6 +221,8 @@ namespace AssetProcessor
 
         int m_JobEscalation = AssetProcessor::JobEscalation::Default; // Escalation indicates how important the job is and how soon it needs processing, the greater the number the greater the escalation  
 
+        AZ::s64 m_criticalPathDurationMs = 0;
+
         QDateTime m_timeCreated;
         QDateTime m_timeLaunched;
         QDateTime m_timeCompleted;
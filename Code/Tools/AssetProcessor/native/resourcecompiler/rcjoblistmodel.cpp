@@ -366,6 +366,11 @@ namespace AssetProcessor
         return m_finishedJobsNotInCatalog.contains(check);
     }
 
+    QList<RCJob*> RCJobListModel::GetQueuedJobs(const QueueElementID& elementId) const
+    {
+        return m_jobsInQueueLookup.values(elementId);
+    }
+
     void RCJobListModel::PerformHeuristicSearch(QString searchTerm, QString platform, QSet<QueueElementID>& found, AssetProcessor::JobIdEscalationList& escalationList, bool isStatusRequest, int searchRules)
     {
         int escalationValue = 0;
@@ -84,6 +84,8 @@ namespace AssetProcessor
         bool isInFlight(const QueueElementID& check) const;
         bool isInQueue(const QueueElementID& check) const;
         bool isWaitingOnCatalog(const QueueElementID& check) const;
+        //! Returns the jobs matching the element id which have not started yet
+        QList<RCJob*> GetQueuedJobs(const QueueElementID& elementId) const;
 
         void PerformHeuristicSearch(QString searchTerm, QString platform, QSet<QueueElementID>& found, AssetProcessor::JobIdEscalationList& escalationList, bool isStatusRequest, int searchRules = 0);
         void PerformUUIDSearch(AZ::Uuid searchUuid, QString platform, QSet<QueueElementID>& found, AssetProcessor::JobIdEscalationList& escalationList, bool isStatusRequest);
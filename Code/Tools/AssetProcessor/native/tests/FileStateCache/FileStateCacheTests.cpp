@@ -87,6 +87,58 @@ namespace UnitTests
         CheckForFile(testPath, true);
     }
 
+    TEST_F(FileStateCacheTests, QueryHashOfBulkAddedHash_MatchingModTime_ReturnsKnownHash)
+    {
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "contents"));
+
+        QSet<AssetFileInfo> infoSet;
+        AssetFileInfo fileInfo;
+        fileInfo.m_filePath = testPath;
+        fileInfo.m_isDirectory = false;
+        fileInfo.m_fileSize = 0;
+        fileInfo.m_modTime = QFileInfo(testPath).lastModified();
+        infoSet.insert(fileInfo);
+
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        // A hash which can't be the one of the file, to make sure the file doesn't get hashed
+        constexpr AZ::u64 KnownHash = 1234;
+        QVector<FileStateHash> hashSet;
+        hashSet.push_back(FileStateHash(testPath, fileInfo.m_modTime, KnownHash));
+        m_fileStateCache->AddHashSet(hashSet);
+
+        IFileStateRequests::FileHash hash = 0;
+        ASSERT_TRUE(AZ::Interface<IFileStateRequests>::Get()->GetHash(testPath, &hash));
+        EXPECT_EQ(hash, KnownHash);
+    }
+
+    TEST_F(FileStateCacheTests, QueryHashOfBulkAddedHash_OutdatedModTime_HashesFile)
+    {
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "contents"));
+
+        QSet<AssetFileInfo> infoSet;
+        AssetFileInfo fileInfo;
+        fileInfo.m_filePath = testPath;
+        fileInfo.m_isDirectory = false;
+        fileInfo.m_fileSize = 0;
+        fileInfo.m_modTime = QFileInfo(testPath).lastModified();
+        infoSet.insert(fileInfo);
+
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        QVector<FileStateHash> hashSet;
+        hashSet.push_back(FileStateHash(testPath, fileInfo.m_modTime.addSecs(-10), 1234));
+        m_fileStateCache->AddHashSet(hashSet);
+
+        IFileStateRequests::FileHash hash = 0;
+        ASSERT_TRUE(AZ::Interface<IFileStateRequests>::Get()->GetHash(testPath, &hash));
+        EXPECT_EQ(hash, AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true));
+    }
+
     TEST_F(FileStateCacheTests, QueryRemovedFile_ShouldNotExist)
     {
         QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
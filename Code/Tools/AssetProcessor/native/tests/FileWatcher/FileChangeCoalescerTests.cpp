@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <native/FileWatcher/FileChangeCoalescer.h>
+
+#include <QHash>
+
+namespace UnitTests
+{
+    class FileChangeCoalescerTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    protected:
+        static constexpr qint64 DebounceMs = 100;
+        static constexpr qint64 MaxDelayMs = 1000;
+
+        // returns the change reported for each file
+        QHash<QString, FileAction> TakeAllChanges(qint64 timeMs)
+        {
+            QHash<QString, FileAction> changes;
+            for (const FileChangeInfo& change : m_coalescer.TakeReadyChanges(timeMs))
+            {
+                EXPECT_FALSE(changes.contains(change.m_filePath));
+                changes.insert(change.m_filePath, change.m_action);
+            }
+            return changes;
+        }
+
+        FileChangeCoalescer m_coalescer{ DebounceMs, MaxDelayMs };
+    };
+
+    TEST_F(FileChangeCoalescerTest, AddChange_AddedThenModified_ReportsAdded)
+    {
+        m_coalescer.AddChange(FileAction::FileAction_Added, "/project/file.txt", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt", 1);
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt", 2);
+
+        QHash<QString, FileAction> changes = TakeAllChanges(2 + DebounceMs);
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes.value("/project/file.txt"), FileAction::FileAction_Added);
+        EXPECT_EQ(m_coalescer.GetPendingCount(), 0);
+    }
+
+    TEST_F(FileChangeCoalescerTest, AddChange_AddedThenRemoved_ReportsNothing)
+    {
+        m_coalescer.AddChange(FileAction::FileAction_Added, "/project/file.txt", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Removed, "/project/file.txt", 1);
+
+        EXPECT_TRUE(TakeAllChanges(1 + DebounceMs).isEmpty());
+        EXPECT_EQ(m_coalescer.GetPendingCount(), 0);
+        EXPECT_EQ(m_coalescer.GetNextReadyTimeMs(), -1);
+    }
+
+    TEST_F(FileChangeCoalescerTest, AddChange_RemovedThenAdded_ReportsModified)
+    {
+        m_coalescer.AddChange(FileAction::FileAction_Removed, "/project/file.txt", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Added, "/project/file.txt", 1);
+
+        QHash<QString, FileAction> changes = TakeAllChanges(1 + DebounceMs);
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes.value("/project/file.txt"), FileAction::FileAction_Modified);
+    }
+
+    TEST_F(FileChangeCoalescerTest, AddChange_SaveThroughTemporaryFile_ReportsOnlySavedFile)
+    {
+        // what editors do to save a file safely: write a temporary file, then move it over the file
+        m_coalescer.AddChange(FileAction::FileAction_Added, "/project/file.txt.tmp", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt.tmp", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt.tmp", 1);
+        m_coalescer.AddChange(FileAction::FileAction_Removed, "/project/file.txt.tmp", 2);
+        m_coalescer.AddChange(FileAction::FileAction_Added, "/project/file.txt", 2);
+
+        QHash<QString, FileAction> changes = TakeAllChanges(2 + DebounceMs);
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes.value("/project/file.txt"), FileAction::FileAction_Added);
+    }
+
+    TEST_F(FileChangeCoalescerTest, TakeReadyChanges_BeforeDebounce_ReportsNothing)
+    {
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt", 0);
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/file.txt", 50);
+
+        EXPECT_EQ(m_coalescer.GetNextReadyTimeMs(), 50 + DebounceMs);
+        EXPECT_TRUE(m_coalescer.TakeReadyChanges(50 + DebounceMs - 1).isEmpty());
+        EXPECT_EQ(m_coalescer.TakeReadyChanges(50 + DebounceMs).size(), 1);
+    }
+
+    TEST_F(FileChangeCoalescerTest, TakeReadyChanges_FileModifiedConstantly_ReportedAfterMaxDelay)
+    {
+        qint64 timeMs = 0;
+        for (; timeMs < MaxDelayMs; timeMs += DebounceMs / 2)
+        {
+            m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/log.txt", timeMs);
+            EXPECT_TRUE(m_coalescer.TakeReadyChanges(timeMs).isEmpty());
+        }
+
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/log.txt", timeMs);
+        QVector<FileChangeInfo> changes = m_coalescer.TakeReadyChanges(timeMs);
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Modified);
+
+        // changes after the report make the file pending again
+        m_coalescer.AddChange(FileAction::FileAction_Modified, "/project/log.txt", timeMs + 1);
+        EXPECT_EQ(m_coalescer.GetPendingCount(), 1);
+        EXPECT_EQ(m_coalescer.TakeReadyChanges(timeMs + 1 + DebounceMs).size(), 1);
+    }
+
+    // replays the changes of a branch switch touching many files: files are added, written a few times and closed,
+    // modified, removed, or added and removed again, with the changes of the files interleaved
+    TEST_F(FileChangeCoalescerTest, TakeReadyChanges_BulkChurn_ReportsNetChangeOfEachFileInBatches)
+    {
+        constexpr int FileCount = 100000;
+        constexpr int MaxBatchSize = 1000;
+
+        auto getFilePath = [](int fileIndex)
+        {
+            return QString("/project/folder%1/file%2.txt").arg(fileIndex % 100).arg(fileIndex);
+        };
+
+        qint64 timeMs = 0;
+        int eventCount = 0;
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            for (int fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+            {
+                FileAction action = FileAction::FileAction_None;
+                switch (fileIndex % 4)
+                {
+                case 0:
+                    action = pass == 0 ? FileAction::FileAction_Added : FileAction::FileAction_Modified;
+                    break;
+                case 1:
+                    action = FileAction::FileAction_Modified;
+                    break;
+                case 2:
+                    action = pass == 2 ? FileAction::FileAction_Removed : FileAction::FileAction_Modified;
+                    break;
+                case 3:
+                    action = pass == 0 ? FileAction::FileAction_Added : (pass == 1 ? FileAction::FileAction_Modified : FileAction::FileAction_Removed);
+                    break;
+                }
+                m_coalescer.AddChange(action, getFilePath(fileIndex), timeMs);
+
+                // the churn comes faster than the debounce time, so nothing settles until it's over
+                if (++eventCount % 10000 == 0)
+                {
+                    ++timeMs;
+                    EXPECT_TRUE(m_coalescer.TakeReadyChanges(timeMs, MaxBatchSize).isEmpty());
+                }
+            }
+        }
+        ASSERT_LT(timeMs, MaxDelayMs);
+        EXPECT_EQ(m_coalescer.GetPendingCount(), FileCount);
+
+        int batchCount = 0;
+        QHash<QString, FileAction> changes;
+        const qint64 settledTimeMs = timeMs + DebounceMs;
+        for (QVector<FileChangeInfo> batch = m_coalescer.TakeReadyChanges(settledTimeMs, MaxBatchSize); !batch.isEmpty();
+            batch = m_coalescer.TakeReadyChanges(settledTimeMs, MaxBatchSize))
+        {
+            EXPECT_LE(batch.size(), MaxBatchSize);
+            ++batchCount;
+            for (const FileChangeInfo& change : batch)
+            {
+                changes.insert(change.m_filePath, change.m_action);
+            }
+        }
+
+        // the files which were added and removed again cancel out
+        EXPECT_EQ(changes.size(), FileCount / 4 * 3);
+        EXPECT_EQ(batchCount, FileCount / 4 * 3 / MaxBatchSize);
+        EXPECT_EQ(m_coalescer.GetPendingCount(), 0);
+        for (int fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+        {
+            const QString filePath = getFilePath(fileIndex);
+            switch (fileIndex % 4)
+            {
+            case 0:
+                EXPECT_EQ(changes.value(filePath), FileAction::FileAction_Added);
+                break;
+            case 1:
+                EXPECT_EQ(changes.value(filePath), FileAction::FileAction_Modified);
+                break;
+            case 2:
+                EXPECT_EQ(changes.value(filePath), FileAction::FileAction_Removed);
+                break;
+            case 3:
+                EXPECT_FALSE(changes.contains(filePath));
+                break;
+            }
+        }
+    }
+} // namespace UnitTests
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
+
+#include <native/AssetDatabase/AssetDatabase.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+
+namespace AssetProcessor::Benchmarks
+{
+    using AzToolsFramework::AssetDatabase::AssetDatabaseRequests;
+    using AzToolsFramework::AssetDatabase::JobDatabaseEntry;
+    using AzToolsFramework::AssetDatabase::LegacySubIDsEntry;
+    using AzToolsFramework::AssetDatabase::ProductDatabaseEntry;
+    using AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer;
+    using AzToolsFramework::AssetDatabase::ScanFolderDatabaseEntry;
+    using AzToolsFramework::AssetDatabase::SourceDatabaseEntry;
+
+    //! Writes what AssetProcessorManager writes to the database when a job completes: the source, the job, its products
+    //! with their legacy sub ids, and the dependencies of the products. state.range(0) jobs are completed per run, with
+    //! state.range(1) jobs per write batch, 0 meaning no batch at all so that every statement commits on its own.
+    //! The database is kept on disk, since the point is measuring what commits cost.
+    class AssetDatabaseBenchmarkFixture
+        : public ::benchmark::Fixture
+        , public AssetDatabaseRequests::Bus::Handler
+    {
+    public:
+        static constexpr AZ::u32 ProductsPerJob = 3;
+        static constexpr AZ::u32 DependenciesPerProduct = 8;
+
+        void SetUp(const ::benchmark::State& /*state*/) override
+        {
+            AZ::AllocatorInstance<AZ::OSAllocator>::Create();
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+
+            m_tempDir = AZStd::make_unique<QTemporaryDir>();
+            m_databaseLocation = QDir(m_tempDir->path()).absoluteFilePath("assetdb.sqlite").toUtf8().constData();
+            AssetDatabaseRequests::Bus::Handler::BusConnect();
+
+            m_connection = AZStd::make_unique<AssetDatabaseConnection>();
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_connection.reset();
+            AssetDatabaseRequests::Bus::Handler::BusDisconnect();
+            m_tempDir.reset();
+            m_databaseLocation = {};
+
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::OSAllocator>::Destroy();
+        }
+
+        bool GetAssetDatabaseLocation(AZStd::string& location) override
+        {
+            location = m_databaseLocation;
+            return true;
+        }
+
+    protected:
+        void CompleteJob(AZ::s64 scanFolderID, int jobIndex)
+        {
+            SourceDatabaseEntry source(scanFolderID, AZStd::string::format("folder/source%d.txt", jobIndex).c_str(), AZ::Uuid::CreateRandom(), "fingerprint");
+            m_connection->SetSource(source);
+
+            JobDatabaseEntry job(source.m_sourceID, "job key", aznumeric_cast<AZ::u32>(jobIndex), "pc", AZ::Uuid::CreateRandom(), AzToolsFramework::AssetSystem::JobStatus::Completed, aznumeric_cast<AZ::u64>(jobIndex));
+            m_connection->SetJob(job);
+
+            for (AZ::u32 productIndex = 0; productIndex < ProductsPerJob; ++productIndex)
+            {
+                ProductDatabaseEntry product(job.m_jobID, productIndex, AZStd::string::format("pc/folder/source%d_%u.product", jobIndex, productIndex).c_str(), AZ::Data::AssetType::CreateRandom());
+                m_connection->SetProduct(product);
+
+                m_connection->RemoveLegacySubIDsByProductID(product.m_productID);
+                LegacySubIDsEntry legacySubID(product.m_productID, productIndex + 1000);
+                m_connection->CreateOrUpdateLegacySubID(legacySubID);
+
+                m_connection->RemoveProductDependencyByProductId(product.m_productID);
+                ProductDependencyDatabaseEntryContainer dependencies;
+                for (AZ::u32 dependencyIndex = 0; dependencyIndex < DependenciesPerProduct; ++dependencyIndex)
+                {
+                    dependencies.emplace_back(product.m_productID, source.m_sourceGuid, dependencyIndex, 0, "pc", true);
+                }
+                m_connection->SetProductDependencies(dependencies);
+            }
+        }
+
+        AZStd::unique_ptr<QTemporaryDir> m_tempDir;
+        AZStd::string m_databaseLocation;
+        AZStd::unique_ptr<AssetDatabaseConnection> m_connection;
+    };
+
+    BENCHMARK_DEFINE_F(AssetDatabaseBenchmarkFixture, BM_CompleteJobs)(benchmark::State& state)
+    {
+        const int jobCount = aznumeric_cast<int>(state.range(0));
+        const int jobsPerBatch = aznumeric_cast<int>(state.range(1));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_connection->ClearData();
+            ScanFolderDatabaseEntry scanFolder("c:/O3DE/dev", "dev", "rootportkey");
+            m_connection->SetScanFolder(scanFolder);
+            state.ResumeTiming();
+
+            for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                if (jobsPerBatch > 0 && jobIndex % jobsPerBatch == 0)
+                {
+                    m_connection->BeginWriteBatch();
+                }
+
+                CompleteJob(scanFolder.m_scanFolderID, jobIndex);
+
+                if (jobsPerBatch > 0 && (jobIndex % jobsPerBatch == jobsPerBatch - 1 || jobIndex == jobCount - 1))
+                {
+                    m_connection->CommitWriteBatch();
+                }
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(AssetDatabaseBenchmarkFixture, BM_CompleteJobs)
+        ->Args({ 1000, 0 })
+        ->Args({ 1000, 1 })
+        ->Args({ 1000, 100 })
+        ->Unit(benchmark::kMillisecond)
+        ;
+} // namespace AssetProcessor::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -82,6 +82,7 @@ namespace AssetProcessor
             for (AssetProcessor::AssetFileInfo foundFile : fileList)
             {
                 m_files.insert(foundFile.m_filePath);
+                m_fileScanFolderKeys[foundFile.m_filePath] = foundFile.m_scanFolder->GetPortableKey();
             }
         }
         );
@@ -154,4 +155,32 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerOverlappingScanFolders_FilesBelongToHighestPriorityScanFolder)
+    {
+        QDir tempDir(m_tempDir.path());
+        AZStd::vector<AssetBuilderSDK::PlatformInfo> platforms;
+        m_platformConfig.get()->PopulatePlatformsForScanFolder(platforms);
+        // a lower priority scan folder containing all the others, and a higher priority one inside of one of them
+        m_platformConfig.get()->AddScanFolder(ScanFolderInfo(tempDir.absolutePath(), "", "ap4", false, true, platforms, 100));
+        m_platformConfig.get()->AddScanFolder(ScanFolderInfo(tempDir.filePath("subfolder2/aaa"), "", "ap5", false, true, platforms, -1));
+
+        // the scan walks on several threads, scan a few times so that a result depending on the order the threads
+        // found the files in has a chance to show
+        for (int scanIndex = 0; scanIndex < 4; ++scanIndex)
+        {
+            m_files.clear();
+            m_fileScanFolderKeys.clear();
+            m_scanComplete = false;
+            m_assetScanner.get()->StartScan();
+
+            ASSERT_TRUE(BlockUntilScanComplete(5000));
+
+            EXPECT_EQ(m_files.size(), 4);
+            EXPECT_EQ(m_fileScanFolderKeys.value(tempDir.filePath("rootfile.txt")), "ap1");
+            EXPECT_EQ(m_fileScanFolderKeys.value(tempDir.filePath("subfolder1/basefile.txt")), "ap2");
+            EXPECT_EQ(m_fileScanFolderKeys.value(tempDir.filePath("subfolder2/basefile.txt")), "ap3");
+            EXPECT_EQ(m_fileScanFolderKeys.value(tempDir.filePath("subfolder2/aaa/basefile.txt")), "ap5");
+        }
+    }
 }
@@ -10,6 +10,7 @@
 #include <QTemporaryDir>
 #include <QCoreApplication>
 #include <native/utilities/PlatformConfiguration.h>
+#include <QHash>
 #include <QSet>
 #include <QString>
 
@@ -33,6 +34,7 @@ namespace AssetProcessor
         AZStd::unique_ptr<PlatformConfiguration> m_platformConfig;
         AZStd::unique_ptr<AssetScanner_Test> m_assetScanner;
         QSet<QString> m_files;
+        QHash<QString, QString> m_fileScanFolderKeys; // portable key of the scan folder each file was found in
         QSet<QString> m_folders;
         bool m_scanComplete = false;
         AZStd::unique_ptr<QCoreApplication> m_qApp;
@@ -243,3 +243,58 @@ TEST_F(RCcontrollerTest_Simple, DISABLED_SameJobIsCompletedMultipleTimes_Complet
     ASSERT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 4); // Expected that there are 4 errors related to the files not existing on disk.  Error message: GenerateFingerprint was called but no input files were requested for fingerprinting.
     ASSERT_EQ(m_errorAbsorber->m_numErrorsAbsorbed, 0);
 }
+
+TEST_F(RCcontrollerTest, GetNextPendingJob_JobsWithRecordedDurations_StartsLongestCriticalPathFirst)
+{
+    using namespace AssetProcessor;
+
+    RCJobListModel rcJobListModel;
+    RCQueueSortModel rcQueueSortModel;
+    rcQueueSortModel.AttachToModel(&rcJobListModel);
+
+    auto submitJob = [&](const char* sourceName, AZ::u64 jobRunKey, AZ::s64 estimatedDurationMs, const char* orderDependencySourceName) -> RCJob*
+    {
+        AssetProcessor::JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_pathRelativeToWatchFolder = jobDetails.m_jobEntry.m_databaseSourceName = sourceName;
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "Compile Stuff";
+        jobDetails.m_jobEntry.m_jobRunKey = jobRunKey;
+        jobDetails.m_estimatedProcessDurationMs = estimatedDurationMs;
+        if (orderDependencySourceName)
+        {
+            AssetBuilderSDK::JobDependency jobDependency("Compile Stuff", "pc", AssetBuilderSDK::JobDependencyType::Order, AssetBuilderSDK::SourceFileDependency(orderDependencySourceName, AZ::Uuid::CreateNull()));
+            jobDetails.m_jobDependencyList.push_back(JobDependencyInternal(jobDependency));
+        }
+
+        RCJob* job = new RCJob(&rcJobListModel);
+        job->Init(jobDetails);
+        rcQueueSortModel.AddJobIdEntry(job);
+        rcJobListModel.addNewJob(job);
+        return job;
+    };
+
+    // the short job submitted first would start first if durations weren't taken into account, and the job everything
+    // else waits on is the shortest of all, but the 10 seconds of work waiting on it make it the one to start with.
+    RCJob* shortJob = submitJob("short.txt", 1, 100, nullptr);
+    RCJob* longJob = submitJob("long.txt", 2, 5000, nullptr);
+    RCJob* baseJob = submitJob("base.txt", 3, 50, nullptr);
+    RCJob* chainJob = submitJob("chain.txt", 4, 10000, "base.txt");
+
+    EXPECT_EQ(shortJob->GetCriticalPathDurationMs(), 100);
+    EXPECT_EQ(longJob->GetCriticalPathDurationMs(), 5000);
+    EXPECT_EQ(chainJob->GetCriticalPathDurationMs(), 10000);
+    EXPECT_EQ(baseJob->GetCriticalPathDurationMs(), 10050);
+
+    EXPECT_EQ(rcQueueSortModel.GetNextPendingJob(), baseJob);
+
+    QueueDurationEstimate estimate = rcQueueSortModel.EstimateQueueDuration();
+    EXPECT_EQ(estimate.m_jobCount, 4);
+    EXPECT_EQ(estimate.m_jobsWithKnownDuration, 4);
+    EXPECT_EQ(estimate.m_totalDurationMs, 15150);
+    EXPECT_EQ(estimate.m_longestCriticalPathMs, 10050);
+    // on 2 cores the chain is what takes the longest, on 1 the total work does
+    EXPECT_EQ(estimate.PredictProcessingTimeMs(2), 10050);
+    EXPECT_EQ(estimate.PredictProcessingTimeMs(1), 15150);
+
+    rcQueueSortModel.AttachToModel(nullptr);
+}
@@ -14,6 +14,9 @@
 
 DECLARE_AZ_UNIT_TEST_MAIN()
 
+// this is an executable rather than a module AzTestRunner can load, so main runs the benchmarks itself
+AZ_BENCHMARK_HOOK();
+
 int RunUnitTests(int argc, char* argv[], bool& ranUnitTests)
 {
     ranUnitTests = true;
@@ -40,6 +43,12 @@ int main(int argc, char* argv[])
         pauseOnComplete = true;
     }
     
+    // If "--benchmark" is present on the command line, run the benchmarks instead
+    if (AZ::Test::ContainsParameter(argc, argv, "--benchmark"))
+    {
+        return AzRunBenchmarks(argc, argv);
+    }
+
     bool ranUnitTests;
     int result = RunUnitTests(argc, argv, ranUnitTests);
 
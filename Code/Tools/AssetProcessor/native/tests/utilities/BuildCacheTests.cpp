@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include <native/AssetManager/FileStateCache.h>
+#include <native/unittests/UnitTestRunner.h>
+#include <native/utilities/AssetUtilEBusHelper.h>
+#include <native/utilities/BuildCache.h>
+#include <native/utilities/assetUtils.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class BuildCacheTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            m_app.reset(aznew AZ::ComponentApplication());
+            AZ::ComponentApplication::Descriptor desc;
+            desc.m_useExistingAllocator = true;
+            m_systemEntity = m_app->Create(desc);
+
+            // the job responses are stored with the serialize context
+            AssetBuilderSDK::InitializeSerializationContext();
+
+            m_buildCache = AZStd::make_unique<BuildCache>(QDir(m_tempDir.path()).absoluteFilePath("BuildCache"));
+        }
+
+        void TearDown() override
+        {
+            m_buildCache.reset();
+
+            m_systemEntity = nullptr;
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        // Makes a temp folder for a job, with a product for each of the given contents
+        QString CreateJobFolder(const QString& jobName, const QStringList& productContents, AssetBuilderSDK::ProcessJobResponse& response)
+        {
+            QDir jobDir(QDir(m_tempDir.path()).absoluteFilePath(jobName));
+            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+            for (int productIndex = 0; productIndex < productContents.size(); ++productIndex)
+            {
+                // the first product is given as a relative path, the others as absolute paths in the temp folder
+                const QString productName = QString("subfolder/product%1.bin").arg(productIndex);
+                EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.absoluteFilePath(productName), productContents[productIndex]));
+                const QString productPath = productIndex == 0 ? productName : jobDir.absoluteFilePath(productName);
+                response.m_outputProducts.push_back(AssetBuilderSDK::JobProduct(productPath.toUtf8().constData(), AZ::Uuid::CreateRandom(), productIndex));
+            }
+            return jobDir.absolutePath();
+        }
+
+        int CountObjects() const
+        {
+            int objectCount = 0;
+            QDirIterator objectIterator(QDir(m_tempDir.path()).absoluteFilePath("BuildCache/objects"), QDir::Files, QDirIterator::Subdirectories);
+            while (objectIterator.hasNext())
+            {
+                objectIterator.next();
+                ++objectCount;
+            }
+            return objectCount;
+        }
+
+        static QString ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            return file.open(QIODevice::ReadOnly) ? QString::fromUtf8(file.readAll()) : QString();
+        }
+
+        QTemporaryDir m_tempDir;
+        AZStd::unique_ptr<BuildCache> m_buildCache;
+
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+    };
+
+    TEST_F(BuildCacheTest, RetrieveJobResult_StoredJob_RestoresProducts)
+    {
+        AssetBuilderSDK::ProcessJobResponse storedResponse;
+        const QString storedJobFolder = CreateJobFolder("storedJob", { "first product", "second product" }, storedResponse);
+        ASSERT_TRUE(m_buildCache->StoreJobResult("0123456789abcdef", storedJobFolder, storedResponse));
+
+        QDir restoredJobDir(QDir(m_tempDir.path()).absoluteFilePath("restoredJob"));
+        ASSERT_TRUE(restoredJobDir.mkpath("."));
+        AssetBuilderSDK::ProcessJobResponse restoredResponse;
+        ASSERT_TRUE(m_buildCache->RetrieveJobResult("0123456789abcdef", restoredJobDir.absolutePath(), restoredResponse));
+
+        EXPECT_EQ(restoredResponse.m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+        ASSERT_EQ(restoredResponse.m_outputProducts.size(), 2u);
+        for (int productIndex = 0; productIndex < 2; ++productIndex)
+        {
+            const AssetBuilderSDK::JobProduct& product = restoredResponse.m_outputProducts[productIndex];
+            const QString productPath = restoredJobDir.absoluteFilePath(QString("subfolder/product%1.bin").arg(productIndex));
+            EXPECT_EQ(QString::fromUtf8(product.m_productFileName.c_str()), productPath);
+            EXPECT_EQ(product.m_productSubID, aznumeric_cast<AZ::u32>(productIndex));
+            EXPECT_EQ(ReadFile(productPath), productIndex == 0 ? "first product" : "second product");
+        }
+
+        EXPECT_EQ(m_buildCache->GetHitCount(), 1u);
+        EXPECT_EQ(m_buildCache->GetMissCount(), 0u);
+        EXPECT_EQ(m_buildCache->GetStoreCount(), 1u);
+    }
+
+    TEST_F(BuildCacheTest, RetrieveJobResult_UnknownKey_CountsMiss)
+    {
+        AssetBuilderSDK::ProcessJobResponse response;
+        EXPECT_FALSE(m_buildCache->RetrieveJobResult("0123456789abcdef", m_tempDir.path(), response));
+        EXPECT_TRUE(response.m_outputProducts.empty());
+
+        EXPECT_EQ(m_buildCache->GetHitCount(), 0u);
+        EXPECT_EQ(m_buildCache->GetMissCount(), 1u);
+    }
+
+    TEST_F(BuildCacheTest, StoreJobResult_SameProductContents_StoresContentsOnce)
+    {
+        AssetBuilderSDK::ProcessJobResponse firstResponse;
+        const QString firstJobFolder = CreateJobFolder("firstJob", { "shared product", "first product" }, firstResponse);
+        ASSERT_TRUE(m_buildCache->StoreJobResult("1111111111111111", firstJobFolder, firstResponse));
+
+        AssetBuilderSDK::ProcessJobResponse secondResponse;
+        const QString secondJobFolder = CreateJobFolder("secondJob", { "shared product", "second product" }, secondResponse);
+        ASSERT_TRUE(m_buildCache->StoreJobResult("2222222222222222", secondJobFolder, secondResponse));
+
+        EXPECT_EQ(CountObjects(), 3);
+        EXPECT_EQ(m_buildCache->GetStoreCount(), 2u);
+    }
+
+    TEST_F(BuildCacheTest, StoreJobResult_ProductOutsideTempFolder_IsNotStored)
+    {
+        AssetBuilderSDK::ProcessJobResponse response;
+        const QString jobFolder = CreateJobFolder("copyJob", { "product" }, response);
+
+        // copy jobs name files from outside their temp folder
+        const QString copiedFile = QDir(m_tempDir.path()).absoluteFilePath("source.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(copiedFile, "source"));
+        response.m_outputProducts.push_back(AssetBuilderSDK::JobProduct(copiedFile.toUtf8().constData(), AZ::Uuid::CreateRandom(), 1));
+
+        EXPECT_FALSE(m_buildCache->StoreJobResult("0123456789abcdef", jobFolder, response));
+        EXPECT_FALSE(m_buildCache->RetrieveJobResult("0123456789abcdef", jobFolder, response));
+        EXPECT_EQ(m_buildCache->GetStoreCount(), 0u);
+    }
+
+    TEST_F(BuildCacheTest, LinkOrCopyFile_ExistingFile_NewFileHasSameContents)
+    {
+        const QString existingPath = QDir(m_tempDir.path()).absoluteFilePath("existing.txt");
+        const QString newPath = QDir(m_tempDir.path()).absoluteFilePath("new.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(existingPath, "contents"));
+
+        EXPECT_NE(LinkOrCopyFile(existingPath, newPath), LinkResult::Failed);
+        EXPECT_EQ(ReadFile(newPath), "contents");
+
+        // the new file must not exist yet, the same as with QFile::copy
+        EXPECT_EQ(LinkOrCopyFile(existingPath, newPath), LinkResult::Failed);
+    }
+
+    class BuildCacheKeyTest
+        : public BuildCacheTest
+        , public ProcessingJobInfoBus::Handler
+    {
+    protected:
+        void SetUp() override
+        {
+            BuildCacheTest::SetUp();
+            AssetUtilities::SetUseFileHashOverride(true, true);
+            ProcessingJobInfoBus::Handler::BusConnect();
+
+            m_sourcePath = QDir(m_tempDir.path()).absoluteFilePath("source.txt");
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(m_sourcePath, "source"));
+
+            m_jobDetails.m_jobEntry.m_builderGuid = AZ::Uuid::CreateRandom();
+            m_jobDetails.m_jobEntry.m_platformInfo.m_identifier = "pc";
+            m_jobDetails.m_jobEntry.m_jobKey = "key";
+            m_jobDetails.m_jobEntry.m_databaseSourceName = "source.txt";
+            m_jobDetails.m_fingerprintFiles[m_sourcePath.toUtf8().constData()] = "source.txt";
+
+            AssetBuilderSDK::SourceFileDependency dependencySource;
+            dependencySource.m_sourceFileDependencyPath = "dependency.txt";
+            JobDependencyInternal jobDependency(AssetBuilderSDK::JobDependency("key", "pc", AssetBuilderSDK::JobDependencyType::Order, dependencySource));
+            jobDependency.m_builderUuidList.insert(m_dependencyBuilderUuid);
+            m_jobDetails.m_jobDependencyList.push_back(jobDependency);
+        }
+
+        void TearDown() override
+        {
+            ProcessingJobInfoBus::Handler::BusDisconnect();
+            AssetUtilities::SetUseFileHashOverride(false, false);
+            BuildCacheTest::TearDown();
+        }
+
+        // ProcessingJobInfoBus::Handler
+        AZStd::string GetJobBuildCacheKey(const JobIndentifier& jobIndentifier) override
+        {
+            return jobIndentifier.m_builderUuid == m_dependencyBuilderUuid ? m_dependencyKey : AZStd::string();
+        }
+
+        FileStatePassthrough m_fileState;
+        const AZ::Uuid m_dependencyBuilderUuid = AZ::Uuid::CreateRandom();
+        AZStd::string m_dependencyKey = "0123456789abcdef0123456789abcdef01234567";
+        QString m_sourcePath;
+        JobDetails m_jobDetails;
+    };
+
+    TEST_F(BuildCacheKeyTest, GenerateBuildCacheKey_SourceContentsChange_KeyChanges)
+    {
+        const AZStd::string firstKey = AssetUtilities::GenerateBuildCacheKey(m_jobDetails);
+        ASSERT_FALSE(firstKey.empty());
+        EXPECT_EQ(AssetUtilities::GenerateBuildCacheKey(m_jobDetails), firstKey);
+
+        // same size, so only the contents tell the files apart
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(m_sourcePath, "sourc2"));
+        EXPECT_NE(AssetUtilities::GenerateBuildCacheKey(m_jobDetails), firstKey);
+    }
+
+    TEST_F(BuildCacheKeyTest, GenerateBuildCacheKey_DependencyKeyChanges_KeyChanges)
+    {
+        const AZStd::string firstKey = AssetUtilities::GenerateBuildCacheKey(m_jobDetails);
+        m_dependencyKey = "fedcba9876543210fedcba9876543210fedcba98";
+        const AZStd::string secondKey = AssetUtilities::GenerateBuildCacheKey(m_jobDetails);
+
+        ASSERT_FALSE(secondKey.empty());
+        EXPECT_NE(secondKey, firstKey);
+    }
+
+    TEST_F(BuildCacheKeyTest, GenerateBuildCacheKey_DependencyKeyUnknown_ReturnsEmptyKey)
+    {
+        m_dependencyKey.clear();
+        EXPECT_TRUE(AssetUtilities::GenerateBuildCacheKey(m_jobDetails).empty());
+    }
+
+    TEST_F(BuildCacheKeyTest, GenerateBuildCacheKey_FileHashingDisabled_ReturnsEmptyKey)
+    {
+        AssetUtilities::SetUseFileHashOverride(true, false);
+        EXPECT_TRUE(AssetUtilities::GenerateBuildCacheKey(m_jobDetails).empty());
+    }
+} // namespace AssetProcessor
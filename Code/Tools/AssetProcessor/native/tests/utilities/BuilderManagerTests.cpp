@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/connection/connectionManager.h>
+#include <native/utilities/BuilderManager.h>
+
+namespace AssetProcessor
+{
+    //! A builder without a process, which connects as soon as it's started unless it's made to fail
+    class FakeBuilder
+        : public Builder
+    {
+    public:
+        FakeBuilder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid, BuilderStats& stats, AZ::u32 connectionId, bool startSucceeds)
+            : Builder(quitListener, uuid, stats)
+            , m_fakeConnectionId(connectionId)
+            , m_startSucceeds(startSucceeds)
+        {
+        }
+
+    protected:
+        bool Start() override
+        {
+            if (!m_startSucceeds)
+            {
+                return false;
+            }
+
+            SetConnection(m_fakeConnectionId);
+            return true;
+        }
+
+    private:
+        AZ::u32 m_fakeConnectionId = 0;
+        bool m_startSucceeds = true;
+    };
+
+    class BuilderManager_Test
+        : public BuilderManager
+    {
+    public:
+        using BuilderManager::BuilderManager;
+        using BuilderManager::StartWarmBuilders;
+        using BuilderManager::GetBuilderCount;
+
+        //! Number of the created builder whose start fails, counting from 1, 0 for none
+        AZ::u32 m_failingBuilderNumber = 0;
+        AZ::u32 m_createdBuilderCount = 0;
+
+    protected:
+        AZStd::shared_ptr<Builder> CreateBuilder(const AZ::Uuid& builderUuid) override
+        {
+            ++m_createdBuilderCount;
+            return AZStd::make_shared<FakeBuilder>(m_quitListener, builderUuid, m_stats, m_createdBuilderCount, m_createdBuilderCount != m_failingBuilderNumber);
+        }
+    };
+
+    class BuilderManagerTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_connectionManager = AZStd::make_unique<ConnectionManager>();
+        }
+
+        void TearDown() override
+        {
+            m_connectionManager.reset();
+            AssetProcessorTest::TearDown();
+        }
+
+        const AZ::Uuid m_builderBusIdA = AZ::Uuid::CreateString("{4A8F1E2B-61C4-4B5A-9D0E-7C3B2A1F0E91}");
+        const AZ::Uuid m_builderBusIdB = AZ::Uuid::CreateString("{8E2D4C6A-0B1F-4E3D-A5C7-9F8E7D6C5B42}");
+        const AZ::Uuid m_builderBusIdC = AZ::Uuid::CreateString("{1C3E5A7B-9D2F-4A6C-8E0B-3D5F7A9C1E63}");
+        const AZ::Uuid m_builderBusIdD = AZ::Uuid::CreateString("{6B8D0F2A-4C6E-4B8A-9C1E-5A7C9E1B3D84}");
+
+        AZStd::unique_ptr<ConnectionManager> m_connectionManager;
+    };
+
+    TEST_F(BuilderManagerTest, GetBuilder_IdleBuilderAlreadyWarmForTheBuilder_IsPreferred)
+    {
+        BuilderManager_Test builderManager(m_connectionManager.get());
+
+        AZ::Uuid firstBuilderUuid;
+        AZ::Uuid secondBuilderUuid;
+        {
+            BuilderRef firstBuilder = builderManager.GetBuilder(m_builderBusIdA);
+            BuilderRef secondBuilder = builderManager.GetBuilder(m_builderBusIdB);
+            ASSERT_TRUE(firstBuilder && secondBuilder);
+            firstBuilderUuid = firstBuilder->GetUuid();
+            secondBuilderUuid = secondBuilder->GetUuid();
+            EXPECT_NE(firstBuilderUuid, secondBuilderUuid);
+        }
+
+        {
+            BuilderRef builder = builderManager.GetBuilder(m_builderBusIdB);
+            ASSERT_TRUE(builder);
+            EXPECT_EQ(builder->GetUuid(), secondBuilderUuid);
+        }
+
+        {
+            BuilderRef builder = builderManager.GetBuilder(m_builderBusIdA);
+            ASSERT_TRUE(builder);
+            EXPECT_EQ(builder->GetUuid(), firstBuilderUuid);
+        }
+
+        EXPECT_EQ(builderManager.m_createdBuilderCount, 2u);
+    }
+
+    TEST_F(BuilderManagerTest, GetBuilder_NoIdleBuilderWarmForTheBuilder_TakesTheLeastWarmOne)
+    {
+        BuilderManager_Test builderManager(m_connectionManager.get());
+
+        AZ::Uuid firstBuilderUuid;
+        AZ::Uuid secondBuilderUuid;
+        {
+            BuilderRef firstBuilder = builderManager.GetBuilder(m_builderBusIdA);
+            ASSERT_TRUE(firstBuilder);
+            firstBuilderUuid = firstBuilder->GetUuid();
+
+            {
+                BuilderRef secondBuilder = builderManager.GetBuilder(m_builderBusIdB);
+                ASSERT_TRUE(secondBuilder);
+                secondBuilderUuid = secondBuilder->GetUuid();
+            }
+
+            // the first builder is busy, so the second one becomes warm for a second builder
+            BuilderRef secondBuilder = builderManager.GetBuilder(m_builderBusIdC);
+            ASSERT_TRUE(secondBuilder);
+            EXPECT_EQ(secondBuilder->GetUuid(), secondBuilderUuid);
+        }
+
+        BuilderRef builder = builderManager.GetBuilder(m_builderBusIdD);
+        ASSERT_TRUE(builder);
+        EXPECT_EQ(builder->GetUuid(), firstBuilderUuid);
+        EXPECT_EQ(builderManager.m_createdBuilderCount, 2u);
+    }
+
+    TEST_F(BuilderManagerTest, StartWarmBuilders_StopsAtWarmBuilderCount)
+    {
+        constexpr AZ::u32 WarmBuilderCount = 3;
+        BuilderManager_Test builderManager(m_connectionManager.get(), WarmBuilderCount);
+
+        builderManager.StartWarmBuilders();
+        EXPECT_EQ(builderManager.GetBuilderCount(), WarmBuilderCount);
+
+        builderManager.StartWarmBuilders();
+        EXPECT_EQ(builderManager.GetBuilderCount(), WarmBuilderCount);
+        EXPECT_EQ(builderManager.m_createdBuilderCount, WarmBuilderCount);
+    }
+
+    TEST_F(BuilderManagerTest, StartWarmBuilders_BuilderFailsToStart_IsRemovedAndNoMoreAreStarted)
+    {
+        BuilderManager_Test builderManager(m_connectionManager.get(), 3);
+        builderManager.m_failingBuilderNumber = 2;
+
+        builderManager.StartWarmBuilders();
+
+        EXPECT_EQ(m_errorAbsorber->m_numErrorsAbsorbed, 1);
+        EXPECT_EQ(builderManager.m_createdBuilderCount, 2u);
+        EXPECT_EQ(builderManager.GetBuilderCount(), 1u);
+    }
+} // namespace AssetProcessor
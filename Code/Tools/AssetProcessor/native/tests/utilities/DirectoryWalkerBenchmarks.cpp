@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <native/utilities/DirectoryWalker.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace AssetProcessor::Benchmarks
+{
+    //! Builds a synthetic project tree of state.range(0) empty files, 100 per folder, in folders nested two levels deep
+    //! the way asset folders usually are, then walks it the way AssetScannerWorker used to, with QDir on a single thread,
+    //! and with the ParallelDirectoryWalker on state.range(1) threads, 0 meaning one per core.
+    //! The tree is kept between runs since creating hundreds of thousands of files takes far longer than walking them.
+    class DirectoryWalkerBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int FilesPerFolder = 100;
+        static constexpr int FoldersPerFolder = 100;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::OSAllocator>::Create();
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+
+            const int fileCount = aznumeric_cast<int>(state.range(0));
+            if (!s_tree || s_treeFileCount != fileCount)
+            {
+                s_tree = AZStd::make_unique<QTemporaryDir>();
+                s_treeFileCount = fileCount;
+
+                QDir root(s_tree->path());
+                for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+                {
+                    const int folderIndex = fileIndex / FilesPerFolder;
+                    const QString folderPath = QString("folder%1/subfolder%2").arg(folderIndex / FoldersPerFolder).arg(folderIndex % FoldersPerFolder);
+                    if (fileIndex % FilesPerFolder == 0)
+                    {
+                        root.mkpath(folderPath);
+                    }
+
+                    QFile file(root.absoluteFilePath(QString("%1/file%2.txt").arg(folderPath).arg(fileIndex)));
+                    file.open(QFile::WriteOnly);
+                }
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::OSAllocator>::Destroy();
+        }
+
+    protected:
+        // The same walk AssetScannerWorker did before using the ParallelDirectoryWalker
+        static void WalkWithQDir(const QString& path, int& entryCount)
+        {
+            for (const QFileInfo& entry : QDir(path).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files))
+            {
+                ++entryCount;
+                if (entry.isDir())
+                {
+                    WalkWithQDir(entry.absoluteFilePath(), entryCount);
+                }
+            }
+        }
+
+        static AZStd::unique_ptr<QTemporaryDir> s_tree;
+        static int s_treeFileCount;
+    };
+
+    AZStd::unique_ptr<QTemporaryDir> DirectoryWalkerBenchmarkFixture::s_tree;
+    int DirectoryWalkerBenchmarkFixture::s_treeFileCount = 0;
+
+    BENCHMARK_DEFINE_F(DirectoryWalkerBenchmarkFixture, BM_QDirWalk)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            int entryCount = 0;
+            WalkWithQDir(s_tree->path(), entryCount);
+            benchmark::DoNotOptimize(entryCount);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(DirectoryWalkerBenchmarkFixture, BM_ParallelDirectoryWalk)(benchmark::State& state)
+    {
+        ParallelDirectoryWalker walker(aznumeric_cast<int>(state.range(1)));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // counted per thread, the way AssetScannerWorker collects the entries
+            AZStd::vector<int> entryCounts(walker.GetThreadCount(), 0);
+            walker.AddRoot(s_tree->path(), true);
+            walker.Walk([&entryCounts](int threadIndex, int /*rootIndex*/, const QString& /*absolutePath*/, const DirectoryEntry& /*entry*/)
+            {
+                ++entryCounts[threadIndex];
+                return true;
+            });
+            benchmark::DoNotOptimize(entryCounts.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(DirectoryWalkerBenchmarkFixture, BM_QDirWalk)
+        ->Args({ 500000, 1 })
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    BENCHMARK_REGISTER_F(DirectoryWalkerBenchmarkFixture, BM_ParallelDirectoryWalk)
+        ->Args({ 500000, 1 })
+        ->Args({ 500000, 4 })
+        ->Args({ 500000, 0 })
+        ->Unit(benchmark::kMillisecond)
+        ;
+} // namespace AssetProcessor::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/parallel/mutex.h>
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/utilities/DirectoryWalker.h>
+
+#include <QDir>
+#include <QSet>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class DirectoryWalkerTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+
+            QDir tempPath(m_tempDir.path());
+            for (int folderIndex = 0; folderIndex < 8; ++folderIndex)
+            {
+                for (int fileIndex = 0; fileIndex < 4; ++fileIndex)
+                {
+                    QString filePath = tempPath.absoluteFilePath(QString("folder%1/subfolder/file%2.txt").arg(folderIndex).arg(fileIndex));
+                    ASSERT_TRUE(UnitTestUtils::CreateDummyFile(filePath, "contents"));
+                    m_expectedFiles.insert(filePath);
+                }
+                m_expectedFolders.insert(tempPath.absoluteFilePath(QString("folder%1").arg(folderIndex)));
+                m_expectedFolders.insert(tempPath.absoluteFilePath(QString("folder%1/subfolder").arg(folderIndex)));
+            }
+
+            QString rootFilePath = tempPath.absoluteFilePath("root.txt");
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(rootFilePath, "contents"));
+            m_expectedFiles.insert(rootFilePath);
+
+            // hidden entries are left out, the same way QDir does
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath(".hidden/file.txt"), "contents"));
+            ASSERT_TRUE(UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath(".hiddenfile.txt"), "contents"));
+        }
+
+        void Walk(ParallelDirectoryWalker& walker)
+        {
+            walker.Walk([this](int /*threadIndex*/, int /*rootIndex*/, const QString& absolutePath, const DirectoryEntry& entry)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_foundMutex);
+                (entry.m_isDirectory ? m_foundFolders : m_foundFiles).insert(absolutePath);
+                return true;
+            });
+        }
+
+        QTemporaryDir m_tempDir;
+        QSet<QString> m_expectedFiles;
+        QSet<QString> m_expectedFolders;
+
+        AZStd::mutex m_foundMutex;
+        QSet<QString> m_foundFiles;
+        QSet<QString> m_foundFolders;
+    };
+
+    TEST_F(DirectoryWalkerTest, Walk_SeveralThreads_FindsEveryEntry)
+    {
+        ParallelDirectoryWalker walker(4);
+        walker.AddRoot(QDir(m_tempDir.path()).absolutePath(), true);
+        Walk(walker);
+
+        EXPECT_EQ(m_foundFiles, m_expectedFiles);
+        EXPECT_EQ(m_foundFolders, m_expectedFolders);
+    }
+
+    TEST_F(DirectoryWalkerTest, Walk_NonRecursiveRoot_OnlyFindsFilesInRoot)
+    {
+        ParallelDirectoryWalker walker(4);
+        walker.AddRoot(QDir(m_tempDir.path()).absolutePath(), false);
+        Walk(walker);
+
+        ASSERT_EQ(m_foundFiles.size(), 1);
+        EXPECT_TRUE(m_foundFiles.contains(QDir(m_tempDir.path()).absoluteFilePath("root.txt")));
+        EXPECT_TRUE(m_foundFolders.isEmpty());
+    }
+
+    TEST_F(DirectoryWalkerTest, ListDirectory_MatchesQDir)
+    {
+        QDir subfolder(QDir(m_tempDir.path()).absoluteFilePath("folder0/subfolder"));
+
+        AZStd::vector<DirectoryEntry> entries;
+        ASSERT_TRUE(ListDirectory(subfolder.absolutePath(), entries));
+
+        QFileInfoList expectedEntries = subfolder.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+        ASSERT_EQ(entries.size(), aznumeric_cast<size_t>(expectedEntries.size()));
+        for (const DirectoryEntry& entry : entries)
+        {
+            QFileInfo fileInfo(subfolder.absoluteFilePath(entry.m_name));
+            EXPECT_TRUE(expectedEntries.contains(fileInfo));
+            EXPECT_FALSE(entry.m_isDirectory);
+            EXPECT_EQ(entry.m_fileSize, aznumeric_cast<AZ::u64>(fileInfo.size()));
+            EXPECT_EQ(entry.m_modTime, fileInfo.lastModified());
+        }
+    }
+} // namespace AssetProcessor
@@ -22,6 +22,7 @@
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/BuildCache.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
 #include <AzToolsFramework/ToolsFileUtils/ToolsFileUtils.h>
@@ -379,6 +380,7 @@ void ApplicationManagerBase::InitAssetScanner()
     QObject::connect(m_assetScanner, &AssetScanner::FilesFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
     QObject::connect(m_assetScanner, &AssetScanner::FoldersFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
     QObject::connect(m_assetScanner, &AssetScanner::ExcludedFound, [this](QSet<AssetFileInfo> files) { m_fileStateCache->AddInfoSet(files); });
+    QObject::connect(m_assetProcessorManager, &AssetProcessorManager::FileHashesKnown, [this](QVector<FileStateHash> hashes) { m_fileStateCache->AddHashSet(hashes); });
     
     // file table
     QObject::connect(m_assetScanner, &AssetScanner::AssetScanningStatusChanged, m_fileProcessor.get(), &FileProcessor::OnAssetScannerStatusChange);
@@ -443,12 +445,9 @@ void ApplicationManagerBase::InitFileMonitor()
         FolderWatchCallbackEx* newFolderWatch = new FolderWatchCallbackEx(info.ScanPath(), "", info.RecurseSubFolders());
         // hook folder watcher to assess files on add/modify
         // relevant files will be sent to resource compiler
-        QObject::connect(newFolderWatch, &FolderWatchCallbackEx::fileAdded,
-            m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssessAddedFile);
-        QObject::connect(newFolderWatch, &FolderWatchCallbackEx::fileModified,
-            m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssessModifiedFile);
-        QObject::connect(newFolderWatch, &FolderWatchCallbackEx::fileRemoved,
-            m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssessDeletedFile);
+        // the changes are sent in batches, since the manager is on another thread and a branch switch can change thousands of files
+        QObject::connect(newFolderWatch, &FolderWatchCallbackEx::filesChanged,
+            m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssessFileChanges);
 
         QObject::connect(newFolderWatch, &FolderWatchCallbackEx::fileAdded, [this](QString path) { m_fileStateCache->AddFile(path); });
         QObject::connect(newFolderWatch, &FolderWatchCallbackEx::fileModified, [this](QString path) { m_fileStateCache->UpdateFile(path); });
@@ -816,6 +815,7 @@ void ApplicationManagerBase::Destroy()
     DestroyControlRequestHandler();
     DestroyConnectionManager();
     DestroyAssetServerHandler();
+    DestroyBuildCache();
     DestroyRCController();
     DestroyAssetScanner();
     DestroyFileMonitor();
@@ -860,6 +860,21 @@ bool ApplicationManagerBase::Run()
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Warnings Reported: %d.\n", m_warningCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Number of Errors Reported: %d.\n", m_errorCount);
     AZ_Printf(AssetProcessor::ConsoleChannel, "Total Assets Processing Time: %fs\n", allAssetsProcessingTimer.elapsed() / 1000.0f);
+    if (m_rcController && m_rcController->GetQueueDurationEstimate().m_jobCount > 0)
+    {
+        const AssetProcessor::QueueDurationEstimate& estimate = m_rcController->GetQueueDurationEstimate();
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Predicted Job Processing Time: %fs (%d of %d jobs had a recorded duration, longest chain of jobs %fs)\n",
+            m_rcController->GetPredictedProcessingTimeMs() / 1000.0f, estimate.m_jobsWithKnownDuration, estimate.m_jobCount, estimate.m_longestCriticalPathMs / 1000.0f);
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Actual Job Processing Time: %fs\n", m_rcController->GetActualProcessingTimeMs() / 1000.0f);
+    }
+    if (m_builderManager)
+    {
+        m_builderManager->PrintStats();
+    }
+    if (m_buildCache)
+    {
+        m_buildCache->PrintStats();
+    }
     AZ_Printf(AssetProcessor::ConsoleChannel, "Asset Processor Batch Processing Completed.\n");
 
     RemoveOldTempFolders();
@@ -1165,7 +1180,7 @@ void ApplicationManagerBase::CheckForIdle()
 void ApplicationManagerBase::InitBuilderManager()
 {
     AZ_Assert(m_connectionManager != nullptr, "ConnectionManager must be started before the builder manager");
-    m_builderManager = new AssetProcessor::BuilderManager(m_connectionManager);
+    m_builderManager = new AssetProcessor::BuilderManager(m_connectionManager, aznumeric_cast<AZ::u32>(AZStd::max(m_platformConfiguration->GetWarmBuilderCount(), 0)));
 
     QObject::connect(m_connectionManager, &ConnectionManager::ConnectionDisconnected, this, [this](unsigned int connId)
         {
@@ -1234,6 +1249,27 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitBuildCache()
+{
+    const QString buildCacheFolder = m_platformConfiguration->GetBuildCacheFolder();
+    if (!buildCacheFolder.isEmpty())
+    {
+        // modtimes don't carry over to other checkouts, so the keys of the build cache are made of file hashes
+        if (!AssetUtilities::ShouldUseFileHashing())
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "The build cache is disabled, it needs Fingerprinting/UseFileHashing to be enabled.\n");
+            return;
+        }
+        m_buildCache = AZStd::make_unique<AssetProcessor::BuildCache>(buildCacheFolder);
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Build cache enabled at %s\n", buildCacheFolder.toUtf8().constData());
+    }
+}
+
+void ApplicationManagerBase::DestroyBuildCache()
+{
+    m_buildCache.reset();
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1318,6 +1354,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor();
     InitAssetScanner();
     InitAssetServerHandler();
+    InitBuildCache();
     InitRCController();
 
     InitConnectionManager();
@@ -1562,10 +1599,10 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
     if (builderDesc.IsExternalBuilder())
     {
         // We're going to override the createJob function so we can run it externally in AssetBuilder, rather than having it run inside the AP
-        modifiedBuilderDesc.m_createJobFunction = [builderFilePath](const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response)
+        modifiedBuilderDesc.m_createJobFunction = [builderFilePath, builderBusId = builderDesc.m_busId](const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response)
             {
                 AssetProcessor::BuilderRef builderRef;
-                AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder);
+                AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder, builderBusId);
 
                 if (builderRef)
                 {
@@ -1585,12 +1622,12 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
             };
 
         // Also override the processJob function to run externally
-        modifiedBuilderDesc.m_processJobFunction = [builderFilePath](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+        modifiedBuilderDesc.m_processJobFunction = [builderFilePath, builderBusId = builderDesc.m_busId](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
             {
                 AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
                 AssetProcessor::BuilderRef builderRef;
-                AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder);
+                AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder, builderBusId);
 
                 if (builderRef)
                 {
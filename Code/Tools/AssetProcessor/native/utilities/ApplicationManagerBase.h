@@ -33,6 +33,7 @@ namespace AssetProcessor
     class AssetRequestHandler;
     class AssetScanner;
     class AssetServerHandler;
+    class BuildCache;
     class BuilderConfigurationManager;
     class BuilderManager;
     class ExternalModuleAssetBuilderInfo;
@@ -156,6 +157,8 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitBuildCache();
+    void DestroyBuildCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -206,6 +209,7 @@ protected:
     AssetProcessor::AssetRequestHandler* m_assetRequestHandler = nullptr;
     AssetProcessor::BuilderManager* m_builderManager = nullptr;
     AssetProcessor::AssetServerHandler* m_assetServerHandler = nullptr;
+    AZStd::unique_ptr<AssetProcessor::BuildCache> m_buildCache;
     ControlRequestHandler* m_controlRequestHandler = nullptr;
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
@@ -22,6 +22,11 @@ namespace AssetProcessor
     struct BuilderParams;
 }
 
+namespace AssetBuilderSDK
+{
+    struct ProcessJobResponse;
+}
+
 namespace AssetUtilities
 {
     class QuitListener;
@@ -168,6 +173,8 @@ namespace AssetProcessor
         // succeeded or failed. EndCacheFileUpdate is paired with BeginCacheFileUpdate.
         virtual void EndCacheFileUpdate(const char* /*productPath*/, bool /*queueAgainForDeletion*/) {};
         virtual AZ::u32 GetJobFingerprint(const AssetProcessor::JobIndentifier& /*jobIndentifier*/) { return 0; };
+        // Returns the build cache key of a job analyzed this session, or an empty string if it is unknown.
+        virtual AZStd::string GetJobBuildCacheKey(const AssetProcessor::JobIndentifier& /*jobIndentifier*/) { return {}; };
     };
 
     using ProcessingJobInfoBus = AZ::EBus<ProcessingJobInfoBusTraits>;
@@ -248,4 +255,24 @@ namespace AssetProcessor
     };
 
     using AssetServerBus = AZ::EBus<AssetServerBusTraits>;
+
+    // This EBUS is used to restore job results from the local build cache, and to add new ones to it.
+    class BuildCacheBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        typedef AZStd::recursive_mutex MutexType;
+        static const bool LocklessDispatch = true;
+        //! RetrieveJobResult should place the products of the job stored under the cache key in the temp folder,
+        //! and fill the response with their paths in the temp folder.
+        //! This will return true if every product of the job was restored, otherwise return false and leave the response alone.
+        virtual bool RetrieveJobResult(const QString& cacheKey, const QString& tempFolder, AssetBuilderSDK::ProcessJobResponse& response) = 0;
+        //! StoreJobResult should store the products of a successful job, which are in the temp folder, under the cache key.
+        //! This will return true if the job result is in the cache afterwards, otherwise return false.
+        virtual bool StoreJobResult(const QString& cacheKey, const QString& tempFolder, const AssetBuilderSDK::ProcessJobResponse& response) = 0;
+    };
+
+    using BuildCacheBus = AZ::EBus<BuildCacheBusTraits>;
 } // namespace AssetProcessor
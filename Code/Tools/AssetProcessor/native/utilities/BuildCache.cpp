@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/BuildCache.h>
+#include <native/assetprocessor.h>
+
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AssetProcessor_Traits_Platform.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include <xxhash/xxhash.h>
+
+namespace AssetProcessor
+{
+    namespace BuildCacheInternal
+    {
+        // the list of the objects holding the products of a job, one line per product in the order of the response,
+        // made of the object name and the path of the product relative to the temp folder, separated by a tab
+        const char* const ProductListFileName = "products.txt";
+        const char* const EntriesFolderName = "entries";
+        const char* const ObjectsFolderName = "objects";
+
+        // entries and objects are spread over subfolders named after the start of their name, so that no folder gets too big
+        QString GetShardedPath(const QString& root, const char* folderName, const QString& name)
+        {
+            return QString("%1/%2/%3/%4").arg(root, folderName, name.left(2), name);
+        }
+
+        // a name which is unique to this write, so that several jobs or Asset Processors can write to the cache at once
+        QString GetStagingPath(const QString& path)
+        {
+            return QString("%1.%2.tmp").arg(path, AZ::Uuid::CreateRandom().ToString<QString>(false, false));
+        }
+    } // namespace BuildCacheInternal
+
+#if !ASSETPROCESSOR_TRAIT_HAS_NATIVE_LINK_FILE
+    LinkResult LinkOrCopyFile(const QString& existingPath, const QString& newPath)
+    {
+        return QFile::copy(existingPath, newPath) ? LinkResult::Copied : LinkResult::Failed;
+    }
+#endif // !ASSETPROCESSOR_TRAIT_HAS_NATIVE_LINK_FILE
+
+    BuildCache::BuildCache(const QString& cacheFolder)
+        : m_cacheFolder(QDir(cacheFolder).absolutePath())
+    {
+        BuildCacheBus::Handler::BusConnect();
+    }
+
+    BuildCache::~BuildCache()
+    {
+        BuildCacheBus::Handler::BusDisconnect();
+    }
+
+    bool BuildCache::RetrieveJobResult(const QString& cacheKey, const QString& tempFolder, AssetBuilderSDK::ProcessJobResponse& response)
+    {
+        QDir entryDir(GetEntryPath(cacheKey));
+        QFile productList(entryDir.filePath(BuildCacheInternal::ProductListFileName));
+        if (!productList.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            ++m_missCount;
+            return false;
+        }
+
+        AssetBuilderSDK::ProcessJobResponse cachedResponse;
+        const AZStd::string responseFilePath = entryDir.filePath(AssetBuilderSDK::s_processJobResponseFileName).toUtf8().constData();
+        if (!AZ::Utils::LoadObjectFromFileInPlace(responseFilePath, cachedResponse))
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to load the job response of build cache entry %s.\n", cacheKey.toUtf8().constData());
+            ++m_missCount;
+            return false;
+        }
+
+        QDir tempDir(tempFolder);
+        QTextStream productStream(&productList);
+        AZ::u64 restoredBytes = 0;
+        QStringList restoredPaths;
+
+        // the job runs in the same temp folder when it can't be restored, which must not be left with half of the products
+        auto restoreFailed = [this, &restoredPaths]()
+        {
+            for (const QString& restoredPath : restoredPaths)
+            {
+                QFile::remove(restoredPath);
+            }
+            ++m_missCount;
+            return false;
+        };
+
+        for (AssetBuilderSDK::JobProduct& product : cachedResponse.m_outputProducts)
+        {
+            const QStringList productLine = productStream.readLine().split('\t');
+            if (productLine.size() != 2)
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Build cache entry %s doesn't list all its products.\n", cacheKey.toUtf8().constData());
+                return restoreFailed();
+            }
+
+            const QString& objectName = productLine[0];
+            const QString productPath = tempDir.absoluteFilePath(productLine[1]);
+            QFileInfo objectInfo(GetObjectPath(objectName));
+
+            // the size is part of the object name, which catches objects that were truncated or written over in place
+            if (!objectInfo.exists() || QString::number(objectInfo.size(), 16) != objectName.section('-', 1))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Object %s of build cache entry %s is missing or damaged.\n", objectName.toUtf8().constData(), cacheKey.toUtf8().constData());
+                return restoreFailed();
+            }
+
+            QFileInfo(productPath).absoluteDir().mkpath(".");
+            const LinkResult linkResult = LinkOrCopyFile(objectInfo.absoluteFilePath(), productPath);
+            if (linkResult == LinkResult::Failed)
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to restore %s from the build cache.\n", productPath.toUtf8().constData());
+                return restoreFailed();
+            }
+            RecordPlacedFile(linkResult);
+            restoredPaths.push_back(productPath);
+
+            restoredBytes += objectInfo.size();
+            product.m_productFileName = productPath.toUtf8().constData();
+        }
+
+        response = AZStd::move(cachedResponse);
+        m_restoredBytes += restoredBytes;
+        ++m_hitCount;
+        return true;
+    }
+
+    bool BuildCache::StoreJobResult(const QString& cacheKey, const QString& tempFolder, const AssetBuilderSDK::ProcessJobResponse& response)
+    {
+        const QString entryPath = GetEntryPath(cacheKey);
+        if (QDir(entryPath).exists())
+        {
+            // stored by another job with the same inputs, or by another Asset Processor sharing the cache
+            return true;
+        }
+
+        QDir tempDir(tempFolder);
+        AssetBuilderSDK::ProcessJobResponse entryResponse = response;
+        QStringList relativePaths;
+        for (const AssetBuilderSDK::JobProduct& product : entryResponse.m_outputProducts)
+        {
+            // relative products are relative to the temp folder, the same as in RCJob::CopyCompiledAssets
+            const QString relativePath = tempDir.relativeFilePath(tempDir.absoluteFilePath(QString::fromUtf8(product.m_productFileName.c_str())));
+            if (relativePath.startsWith("..") || QDir::isAbsolutePath(relativePath))
+            {
+                return false;
+            }
+            relativePaths.push_back(relativePath);
+        }
+
+        QStringList productLines;
+        for (size_t productIndex = 0; productIndex < entryResponse.m_outputProducts.size(); ++productIndex)
+        {
+            AssetBuilderSDK::JobProduct& product = entryResponse.m_outputProducts[productIndex];
+            const QString& relativePath = relativePaths[aznumeric_cast<int>(productIndex)];
+            const QString productPath = tempDir.absoluteFilePath(relativePath);
+
+            const QString objectName = ComputeObjectName(productPath);
+            if (objectName.isEmpty() || !StoreObject(productPath, objectName))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to store %s in the build cache.\n", productPath.toUtf8().constData());
+                return false;
+            }
+
+            product.m_productFileName = relativePath.toUtf8().constData();
+            productLines.push_back(QString("%1\t%2").arg(objectName, relativePath));
+        }
+
+        // the entry is written next to where it goes and moved in place once complete, so it's never seen half written
+        QDir stagingDir(BuildCacheInternal::GetStagingPath(entryPath));
+        if (!stagingDir.mkpath("."))
+        {
+            return false;
+        }
+
+        bool stored = AZ::Utils::SaveObjectToFile(stagingDir.filePath(AssetBuilderSDK::s_processJobResponseFileName).toUtf8().constData(), AZ::DataStream::StreamType::ST_XML, &entryResponse);
+        if (stored)
+        {
+            QFile productList(stagingDir.filePath(BuildCacheInternal::ProductListFileName));
+            stored = productList.open(QIODevice::WriteOnly | QIODevice::Text);
+            if (stored)
+            {
+                QTextStream productStream(&productList);
+                for (const QString& productLine : productLines)
+                {
+                    productStream << productLine << '\n';
+                }
+                productStream.flush();
+                stored = productStream.status() == QTextStream::Ok;
+            }
+        }
+
+        if (!stored || !QDir().rename(stagingDir.absolutePath(), entryPath))
+        {
+            stagingDir.removeRecursively();
+            // failing to move it in place is fine if someone else stored the same entry meanwhile
+            return QDir(entryPath).exists();
+        }
+
+        ++m_storeCount;
+        return true;
+    }
+
+    AZ::u64 BuildCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    AZ::u64 BuildCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    AZ::u64 BuildCache::GetStoreCount() const
+    {
+        return m_storeCount;
+    }
+
+    void BuildCache::PrintStats() const
+    {
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Build Cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " jobs stored (%s)\n",
+            GetHitCount(), GetMissCount(), GetStoreCount(), m_cacheFolder.toUtf8().constData());
+        AZ_Printf(AssetProcessor::ConsoleChannel, "Build Cache Files: %" PRIu64 " cloned or linked, %" PRIu64 " copied, %" PRIu64 " bytes restored\n",
+            m_linkedFileCount.load(), m_copiedFileCount.load(), m_restoredBytes.load());
+    }
+
+    QString BuildCache::ComputeObjectName(const QString& absolutePath)
+    {
+        QFile file(absolutePath);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return QString();
+        }
+
+        // products are hashed whatever the file hashing setting is, since the objects are found by their contents
+        XXH64_state_t* state = XXH64_createState();
+        XXH64_reset(state, 0);
+
+        AZStd::vector<char> buffer;
+        buffer.resize_no_construct(aznumeric_cast<size_t>(AZStd::min<qint64>(AZStd::max<qint64>(file.size(), 1), 1024 * 1024)));
+        qint64 bytesRead = 0;
+        while ((bytesRead = file.read(buffer.data(), buffer.size())) > 0)
+        {
+            XXH64_update(state, buffer.data(), aznumeric_cast<size_t>(bytesRead));
+        }
+
+        const AZ::u64 hash = XXH64_digest(state);
+        XXH64_freeState(state);
+
+        if (bytesRead < 0)
+        {
+            return QString();
+        }
+
+        return QString("%1-%2").arg(hash, 16, 16, QChar('0')).arg(file.size(), 0, 16);
+    }
+
+    QString BuildCache::GetEntryPath(const QString& cacheKey) const
+    {
+        return BuildCacheInternal::GetShardedPath(m_cacheFolder, BuildCacheInternal::EntriesFolderName, cacheKey);
+    }
+
+    QString BuildCache::GetObjectPath(const QString& objectName) const
+    {
+        return BuildCacheInternal::GetShardedPath(m_cacheFolder, BuildCacheInternal::ObjectsFolderName, objectName);
+    }
+
+    bool BuildCache::StoreObject(const QString& absolutePath, const QString& objectName)
+    {
+        const QString objectPath = GetObjectPath(objectName);
+        if (QFile::exists(objectPath))
+        {
+            return true;
+        }
+
+        QFileInfo(objectPath).absoluteDir().mkpath(".");
+        const QString stagingPath = BuildCacheInternal::GetStagingPath(objectPath);
+        const LinkResult linkResult = LinkOrCopyFile(absolutePath, stagingPath);
+        if (linkResult == LinkResult::Failed)
+        {
+            return false;
+        }
+        RecordPlacedFile(linkResult);
+
+        if (!QFile::rename(stagingPath, objectPath))
+        {
+            QFile::remove(stagingPath);
+            return QFile::exists(objectPath);
+        }
+        return true;
+    }
+
+    void BuildCache::RecordPlacedFile(LinkResult result)
+    {
+        if (result == LinkResult::Copied)
+        {
+            ++m_copiedFileCount;
+        }
+        else
+        {
+            ++m_linkedFileCount;
+        }
+    }
+} // namespace AssetProcessor
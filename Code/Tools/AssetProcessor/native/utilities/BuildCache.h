@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <native/utilities/AssetUtilEBusHelper.h>
+
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! How LinkOrCopyFile placed a file
+    enum class LinkResult
+    {
+        Failed,
+        Cloned, //!< the new file is a copy-on-write clone, which shares the data of the existing one until either is written
+        Linked, //!< the new file is a hardlink to the existing one
+        Copied,
+    };
+
+    //! Creates newPath with the contents of existingPath, without copying them where the filesystem allows it.
+    //! Uses the native APIs of the platform when there is an implementation for it, and copies the file otherwise.
+    //! newPath must not exist yet.
+    LinkResult LinkOrCopyFile(const QString& existingPath, const QString& newPath);
+
+    //! BuildCache is a content addressed cache of job results in a local or network folder.
+    //! Job results are stored under the key made by AssetUtilities::GenerateBuildCacheKey, and are made of the
+    //! process job response and a list of the objects holding its products. Objects are named after the hash
+    //! of their contents, so that products which are the same across jobs, branches or platforms are only stored once.
+    //! Products are restored as clones or hardlinks of the objects where the filesystem supports it.
+    //! The AssetProcessor never writes over a product, it removes the old one first, which keeps the objects intact.
+    class BuildCache
+        : public BuildCacheBus::Handler
+    {
+    public:
+        explicit BuildCache(const QString& cacheFolder);
+        ~BuildCache() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // BuildCacheBus::Handler overrides
+        bool RetrieveJobResult(const QString& cacheKey, const QString& tempFolder, AssetBuilderSDK::ProcessJobResponse& response) override;
+        //! Jobs which copy files from outside their temp folder aren't stored, since there is no telling what those files depend on.
+        bool StoreJobResult(const QString& cacheKey, const QString& tempFolder, const AssetBuilderSDK::ProcessJobResponse& response) override;
+        //////////////////////////////////////////////////////////////////////////
+
+        AZ::u64 GetHitCount() const;
+        AZ::u64 GetMissCount() const;
+        AZ::u64 GetStoreCount() const;
+
+        void PrintStats() const;
+
+        //! Returns the name of the object holding the given file, made of the hash and the size of its contents,
+        //! or an empty string if the file can't be read.
+        static QString ComputeObjectName(const QString& absolutePath);
+
+    protected:
+        QString GetEntryPath(const QString& cacheKey) const;
+        QString GetObjectPath(const QString& objectName) const;
+        //! Places the file in the object store, unless an object with the same contents is there already
+        bool StoreObject(const QString& absolutePath, const QString& objectName);
+        void RecordPlacedFile(LinkResult result);
+
+        QString m_cacheFolder;
+
+        AZStd::atomic<AZ::u64> m_hitCount{ 0 };
+        AZStd::atomic<AZ::u64> m_missCount{ 0 };
+        AZStd::atomic<AZ::u64> m_storeCount{ 0 };
+        AZStd::atomic<AZ::u64> m_restoredBytes{ 0 };
+        AZStd::atomic<AZ::u64> m_linkedFileCount{ 0 };
+        AZStd::atomic<AZ::u64> m_copiedFileCount{ 0 };
+    };
+} // namespace AssetProcessor
@@ -34,6 +34,48 @@ namespace AssetProcessor
 
     static const char* s_buildersFolderName = "Builders";
 
+    void BuilderStats::RecordStart(AZ::s64 startupTimeMs, bool succeeded)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+        ++(succeeded ? m_builderStartCount : m_failedBuilderStartCount);
+        m_totalStartupTimeMs += startupTimeMs;
+    }
+
+    void BuilderStats::RecordJob(const AZStd::string& task, AZ::s64 roundTripTimeUs, AZ::u64 responseSize)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+        TaskStats& taskStats = m_taskStats[task];
+        taskStats.m_fastestRoundTripTimeUs = taskStats.m_jobCount == 0 ? roundTripTimeUs : AZStd::min(taskStats.m_fastestRoundTripTimeUs, roundTripTimeUs);
+        taskStats.m_totalRoundTripTimeUs += roundTripTimeUs;
+        taskStats.m_totalResponseSize += responseSize;
+        ++taskStats.m_jobCount;
+    }
+
+    void BuilderStats::RecordAffinity(bool warm)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+        ++(warm ? m_warmJobCount : m_coldJobCount);
+    }
+
+    void BuilderStats::Print() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+
+        const AZ::u32 startCount = m_builderStartCount + m_failedBuilderStartCount;
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "AssetBuilders started: %u (%u failed), %.2fs spent starting them, %.2fs on average\n",
+            startCount, m_failedBuilderStartCount, m_totalStartupTimeMs / 1000.0f, startCount ? m_totalStartupTimeMs / 1000.0f / startCount : 0.0f);
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "AssetBuilder jobs sent to a builder already warm for their type: %" PRIu64 " of %" PRIu64 "\n",
+            m_warmJobCount, m_warmJobCount + m_coldJobCount);
+
+        for (const auto& taskStatsEntry : m_taskStats)
+        {
+            const TaskStats& taskStats = taskStatsEntry.second;
+            AZ_TracePrintf(AssetProcessor::ConsoleChannel, "AssetBuilder %s jobs: %" PRIu64 ", round trip %.2fms on average, fastest %.2fms, %" PRIu64 " bytes of response on average\n",
+                taskStatsEntry.first.c_str(), taskStats.m_jobCount, taskStats.m_totalRoundTripTimeUs / 1000.0f / taskStats.m_jobCount, taskStats.m_fastestRoundTripTimeUs / 1000.0f,
+                taskStats.m_totalResponseSize / taskStats.m_jobCount);
+        }
+    }
+
     bool Builder::IsConnected() const
     {
         return m_connectionId > 0;
@@ -157,16 +199,22 @@ namespace AssetProcessor
 
         const AZStd::string params = BuildParams("resident", buildersFolder.c_str(), UuidString(), "", "");
 
+        QElapsedTimer startupTimer;
+        startupTimer.start();
+
         m_processWatcher = LaunchProcess(fullExePathString.c_str(), params);
 
         if (!m_processWatcher)
         {
+            m_stats.RecordStart(startupTimer.elapsed(), false);
             return false;
         }
 
         m_tracePrinter = AZStd::make_unique<CommunicatorTracePrinter>(m_processWatcher->GetCommunicator(), "AssetBuilder");
 
-        return WaitForConnection();
+        const bool connected = WaitForConnection();
+        m_stats.RecordStart(startupTimer.elapsed(), connected);
+        return connected;
     }
 
     bool Builder::IsValid() const
@@ -361,7 +409,8 @@ namespace AssetProcessor
 
     //////////////////////////////////////////////////////////////////////////
 
-    BuilderManager::BuilderManager(ConnectionManager* connectionManager)
+    BuilderManager::BuilderManager(ConnectionManager* connectionManager, AZ::u32 warmBuilderCount)
+        : m_warmBuilderCount(warmBuilderCount)
     {
         using namespace AZStd::placeholders;
         connectionManager->RegisterService(AssetBuilderSDK::BuilderHelloRequest::MessageType(), AZStd::bind(&BuilderManager::IncomingBuilderPing, this, _1, _2, _3, _4, _5));
@@ -390,6 +439,11 @@ namespace AssetProcessor
         {
             m_pollingThread.join();
         }
+
+        if (m_warmBuildersThread.joinable())
+        {
+            m_warmBuildersThread.join();
+        }
     }
 
     void BuilderManager::ConnectionLost(AZ::u32 connId)
@@ -483,21 +537,39 @@ namespace AssetProcessor
             return {};
         }
 
-        auto builder = AZStd::make_shared<Builder>(m_quitListener, builderUuid);
+        auto builder = CreateBuilder(builderUuid);
 
         m_builders.insert({ builder->GetUuid(), builder });
 
         return builder;
     }
 
-    BuilderRef BuilderManager::GetBuilder()
+    AZStd::shared_ptr<Builder> BuilderManager::CreateBuilder(const AZ::Uuid& builderUuid)
+    {
+        return AZStd::make_shared<Builder>(m_quitListener, builderUuid, m_stats);
+    }
+
+    BuilderRef BuilderManager::GetBuilder(const AZ::Uuid& builderBusId)
     {
         AZStd::shared_ptr<Builder> newBuilder;
         BuilderRef builderRef;
 
+        if (m_warmBuilderCount > 0 && !m_warmBuildersStarted.exchange(true))
+        {
+            // the first job is when builders are known to be needed, so the rest of the pool starts now instead of one by one as jobs need them
+            m_warmBuildersThread = AZStd::thread([this]()
+                {
+                    StartWarmBuilders();
+                });
+        }
+
         {
             AZStd::unique_lock<AZStd::mutex> lock(m_buildersMutex);
 
+            // a builder which ran jobs for the same builder before has its tools and state loaded already,
+            // failing that take the one warm for the fewest builders, which leaves the others for their builders' jobs
+            AZStd::shared_ptr<Builder> idleBuilder;
+
             for (auto itr = m_builders.begin(); itr != m_builders.end(); )
             {
                 auto& builder = itr->second;
@@ -508,7 +580,17 @@ namespace AssetProcessor
 
                     if (builder->IsValid())
                     {
-                        return BuilderRef(builder);
+                        if (builder->m_warmBuilderBusIds.find(builderBusId) != builder->m_warmBuilderBusIds.end())
+                        {
+                            m_stats.RecordAffinity(true);
+                            return BuilderRef(builder);
+                        }
+
+                        if (!idleBuilder || builder->m_warmBuilderBusIds.size() < idleBuilder->m_warmBuilderBusIds.size())
+                        {
+                            idleBuilder = builder;
+                        }
+                        ++itr;
                     }
                     else
                     {
@@ -521,10 +603,19 @@ namespace AssetProcessor
                 }
             }
 
+            m_stats.RecordAffinity(false);
+
+            if (idleBuilder)
+            {
+                idleBuilder->m_warmBuilderBusIds.insert(builderBusId);
+                return BuilderRef(idleBuilder);
+            }
+
             AZ_TracePrintf("BuilderManager", "Starting new builder for job request\n");
 
             // None found, start up a new one
             newBuilder = AddNewBuilder();
+            newBuilder->m_warmBuilderBusIds.insert(builderBusId);
 
             // Grab a reference so no one else can take it while we're outside the lock
             builderRef = BuilderRef(newBuilder);
@@ -548,6 +639,54 @@ namespace AssetProcessor
         return builderRef;
     }
 
+    void BuilderManager::StartWarmBuilders()
+    {
+        while (!m_quitListener.WasQuitRequested())
+        {
+            AZStd::shared_ptr<Builder> newBuilder;
+            BuilderRef builderRef;
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+
+                if (m_builders.size() >= m_warmBuilderCount)
+                {
+                    return;
+                }
+
+                newBuilder = AddNewBuilder();
+                if (!newBuilder)
+                {
+                    return;
+                }
+
+                // busy while it starts, so that no job waits on it
+                builderRef = BuilderRef(newBuilder);
+            }
+
+            if (!newBuilder->Start())
+            {
+                AZ_Error("BuilderManager", false, "Warm builder failed to start");
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+                builderRef = {};
+                m_builders.erase(newBuilder->GetUuid());
+                return;
+            }
+        }
+    }
+
+    size_t BuilderManager::GetBuilderCount()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+        return m_builders.size();
+    }
+
+    void BuilderManager::PrintStats() const
+    {
+        m_stats.Print();
+    }
+
     void BuilderManager::PumpIdleBuilders()
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
@@ -7,13 +7,16 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <QString>
 #include <QByteArray>
+#include <QElapsedTimer>
 #include <native/utilities/CommunicatorTracePrinter.h>
 #include <native/utilities/assetUtils.h>
 #include <QDir>  // used in the inl file.
@@ -38,8 +41,8 @@ namespace AssetProcessor
 
         virtual ~BuilderManagerBusTraits() = default;
 
-        //! Returns a builder for doing work
-        virtual BuilderRef GetBuilder() = 0;
+        //! Returns a builder for doing work, preferring one which already ran jobs for the builder with this bus id
+        virtual BuilderRef GetBuilder(const AZ::Uuid& builderBusId) = 0;
     };
 
     using BuilderManagerBus = AZ::EBus<BuilderManagerBusTraits>;
@@ -55,6 +58,37 @@ namespace AssetProcessor
         FailedToWriteDebugRequest
     };
 
+    //! Keeps track of what using builder processes costs on top of the work done in them: starting the processes,
+    //! and sending each job over and its response back. The fastest round trip of a task is an upper bound on the
+    //! overhead every job of that task pays.
+    class BuilderStats
+    {
+    public:
+        void RecordStart(AZ::s64 startupTimeMs, bool succeeded);
+        void RecordJob(const AZStd::string& task, AZ::s64 roundTripTimeUs, AZ::u64 responseSize);
+        //! Records whether a job went to a builder which already ran jobs for the same builder type
+        void RecordAffinity(bool warm);
+
+        void Print() const;
+
+    private:
+        struct TaskStats
+        {
+            AZ::u64 m_jobCount = 0;
+            AZ::s64 m_totalRoundTripTimeUs = 0;
+            AZ::s64 m_fastestRoundTripTimeUs = 0;
+            AZ::u64 m_totalResponseSize = 0;
+        };
+
+        mutable AZStd::mutex m_statsMutex;
+        AZStd::unordered_map<AZStd::string, TaskStats> m_taskStats;
+        AZ::u32 m_builderStartCount = 0;
+        AZ::u32 m_failedBuilderStartCount = 0;
+        AZ::s64 m_totalStartupTimeMs = 0;
+        AZ::u64 m_warmJobCount = 0;
+        AZ::u64 m_coldJobCount = 0;
+    };
+
     //! Wrapper for managing a single builder process and sending job requests to it
     class Builder
     {
@@ -62,11 +96,12 @@ namespace AssetProcessor
         friend struct BuilderRef;
 
     public:
-        Builder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid)
+        Builder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid, BuilderStats& stats)
             : m_uuid(uuid),
-            m_quitListener(quitListener)
+            m_quitListener(quitListener),
+            m_stats(stats)
         {}
-        ~Builder() = default;
+        virtual ~Builder() = default;
 
         // Disable copy and move (can't move a semaphore)
         AZ_DISABLE_COPY_MOVE(Builder);
@@ -95,14 +130,16 @@ namespace AssetProcessor
         template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
         BuilderRunJobOutcome RunJob(const TRequest& request, TResponse& response, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener = nullptr, AZStd::string tempFolderPath = AZStd::string()) const;
 
-    private:
+    protected:
 
         //! Starts the builder process and waits for it to connect
-        bool Start();
+        virtual bool Start();
 
         //! Sets the connection id and signals that the builder has connected
         void SetConnection(AZ::u32 connId);
 
+    private:
+
         AZStd::string BuildParams(const char* task, const char* moduleFilePath, const AZStd::string& builderGuid, const AZStd::string& jobDescriptionFile, const AZStd::string& jobResponseFile) const;
         AZStd::unique_ptr<AzFramework::ProcessWatcher> LaunchProcess(const char* fullExePath, const AZStd::string& params) const;
 
@@ -118,6 +155,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Bus ids of the builders this process ran jobs for, whose tools and state are loaded already.  Guarded by the BuilderManager's mutex
+        AZStd::unordered_set<AZ::Uuid> m_warmBuilderBusIds;
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -130,6 +170,8 @@ namespace AssetProcessor
         AZStd::unique_ptr<CommunicatorTracePrinter> m_tracePrinter = nullptr;
 
         const AssetUtilities::QuitListener& m_quitListener;
+
+        BuilderStats& m_stats;
     };
 
     //! Scoped reference to a builder. Destructor returns the builder to the free builders pool
@@ -160,7 +202,8 @@ namespace AssetProcessor
         : public BuilderManagerBus::Handler
     {
     public:
-        explicit BuilderManager(ConnectionManager* connectionManager);
+        //! warmBuilderCount builders are started in the background as soon as the first one is needed
+        BuilderManager(ConnectionManager* connectionManager, AZ::u32 warmBuilderCount = 0);
         ~BuilderManager();
 
         // Disable copy
@@ -169,7 +212,24 @@ namespace AssetProcessor
         void ConnectionLost(AZ::u32 connId);
 
         //BuilderManagerBus
-        BuilderRef GetBuilder() override;
+        BuilderRef GetBuilder(const AZ::Uuid& builderBusId) override;
+
+        //! Prints how many builders were started and what sending jobs to them cost
+        void PrintStats() const;
+
+    protected:
+
+        //! Makes the object for a new builder.  Tests override it to use builders which don't run a process
+        virtual AZStd::shared_ptr<Builder> CreateBuilder(const AZ::Uuid& builderUuid);
+
+        //! Starts builders until there are at least m_warmBuilderCount of them
+        void StartWarmBuilders();
+
+        size_t GetBuilderCount();
+
+        BuilderStats m_stats;
+
+        AssetUtilities::QuitListener m_quitListener;
 
     private:
 
@@ -192,7 +252,9 @@ namespace AssetProcessor
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
-        AssetUtilities::QuitListener m_quitListener;
+        AZ::u32 m_warmBuilderCount = 0;
+        AZStd::atomic_bool m_warmBuildersStarted{ false };
+        AZStd::thread m_warmBuildersThread;
     };
 } // namespace AssetProcessor
 
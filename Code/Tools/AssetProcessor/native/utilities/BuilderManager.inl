@@ -21,6 +21,9 @@ namespace AssetProcessor
         QByteArray data;
         AZStd::binary_semaphore wait;
 
+        QElapsedTimer roundTripTimer;
+        roundTripTimer.start();
+
         unsigned int serial;
         AssetProcessor::ConnectionBus::EventResult(serial, m_connectionId, &AssetProcessor::ConnectionBusTraits::SendRequest, netRequest, [&](AZ::u32 msgType, QByteArray msgData)
         {
@@ -40,6 +43,8 @@ namespace AssetProcessor
 
         AZ_Assert(type == netRequest.GetMessageType(), "Response type does not match");
 
+        m_stats.RecordJob(task, roundTripTimer.nsecsElapsed() / 1000, data.length());
+
         if (!AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.length(), netResponse))
         {
             AZ_Error("Builder", false, "Failed to deserialize processJobs response");
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/DirectoryWalker.h>
+
+#include <AzCore/std/functional.h>
+#include <AssetProcessor_Traits_Platform.h>
+
+#include <QDir>
+#include <QFuture>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentRun>
+
+namespace AssetProcessor
+{
+#if !ASSETPROCESSOR_TRAIT_HAS_NATIVE_LIST_DIRECTORY
+    bool ListDirectory(const QString& absolutePath, AZStd::vector<DirectoryEntry>& entries)
+    {
+        QDir dir(absolutePath);
+        if (!dir.exists())
+        {
+            return false;
+        }
+
+        for (const QFileInfo& fileInfo : dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files))
+        {
+            DirectoryEntry entry;
+            entry.m_name = fileInfo.fileName();
+            entry.m_modTime = fileInfo.lastModified();
+            entry.m_isDirectory = fileInfo.isDir();
+            entry.m_fileSize = entry.m_isDirectory ? 0 : fileInfo.size();
+            entries.push_back(AZStd::move(entry));
+        }
+        return true;
+    }
+#endif // !ASSETPROCESSOR_TRAIT_HAS_NATIVE_LIST_DIRECTORY
+
+    ParallelDirectoryWalker::ParallelDirectoryWalker(int threadCount)
+        : m_threadCount(threadCount > 0 ? threadCount : AZStd::max(QThread::idealThreadCount(), 1))
+    {
+    }
+
+    int ParallelDirectoryWalker::AddRoot(const QString& absolutePath, bool recurse)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        m_pendingDirectories.push_back({ absolutePath, m_rootCount, recurse });
+        return m_rootCount++;
+    }
+
+    int ParallelDirectoryWalker::GetThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    void ParallelDirectoryWalker::Walk(const EntryCallback& callback)
+    {
+        m_cancelled = false;
+
+        // the calling thread walks too, so it only needs a pool for the other ones
+        QThreadPool walkThreadPool;
+        walkThreadPool.setMaxThreadCount(AZStd::max(m_threadCount - 1, 1));
+
+        QVector<QFuture<void>> walkFutures;
+        for (int threadIndex = 1; threadIndex < m_threadCount; ++threadIndex)
+        {
+            walkFutures.push_back(QtConcurrent::run(&walkThreadPool, [this, threadIndex, &callback]()
+            {
+                WalkThread(threadIndex, callback);
+            }));
+        }
+
+        WalkThread(0, callback);
+
+        for (QFuture<void>& walkFuture : walkFutures)
+        {
+            walkFuture.waitForFinished();
+        }
+
+        // a cancelled walk leaves directories behind, they aren't walked by the next one
+        m_pendingDirectories.clear();
+        m_rootCount = 0;
+    }
+
+    void ParallelDirectoryWalker::Cancel()
+    {
+        m_cancelled = true;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        m_pendingCondition.notify_all();
+    }
+
+    void ParallelDirectoryWalker::WalkThread(int threadIndex, const EntryCallback& callback)
+    {
+        AZStd::vector<DirectoryEntry> entries;
+        AZStd::vector<PendingDirectory> subDirectories;
+
+        while (true)
+        {
+            PendingDirectory directory;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_pendingMutex);
+
+                // when there is nothing left to list and no thread is listing a directory, no more directories can show up
+                m_pendingCondition.wait(lock, [this]()
+                {
+                    return !m_pendingDirectories.empty() || m_busyThreadCount == 0 || m_cancelled;
+                });
+
+                if (m_pendingDirectories.empty() || m_cancelled)
+                {
+                    m_pendingCondition.notify_all();
+                    return;
+                }
+
+                // taking the most recently found directory walks depth first, which keeps the queue short
+                directory = AZStd::move(m_pendingDirectories.back());
+                m_pendingDirectories.pop_back();
+                ++m_busyThreadCount;
+            }
+
+            entries.clear();
+            subDirectories.clear();
+            ListDirectory(directory.m_absolutePath, entries);
+
+            const QString directoryPrefix = directory.m_absolutePath.endsWith('/') ? directory.m_absolutePath : directory.m_absolutePath + '/';
+            for (const DirectoryEntry& entry : entries)
+            {
+                if (m_cancelled)
+                {
+                    break;
+                }
+
+                if (entry.m_isDirectory && !directory.m_recurse)
+                {
+                    continue;
+                }
+
+                QString absolutePath = directoryPrefix + entry.m_name;
+                if (callback(threadIndex, directory.m_rootIndex, absolutePath, entry) && entry.m_isDirectory)
+                {
+                    subDirectories.push_back({ AZStd::move(absolutePath), directory.m_rootIndex, true });
+                }
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+                for (PendingDirectory& subDirectory : subDirectories)
+                {
+                    m_pendingDirectories.push_back(AZStd::move(subDirectory));
+                }
+                --m_busyThreadCount;
+            }
+            m_pendingCondition.notify_all();
+        }
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <QDateTime>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! An entry of a directory, as listed by ListDirectory
+    struct DirectoryEntry
+    {
+        QString m_name;
+        QDateTime m_modTime;
+        AZ::u64 m_fileSize = 0;
+        bool m_isDirectory = false;
+    };
+
+    //! Lists the files and directories contained in a directory, leaving out hidden entries, broken links and
+    //! anything that is neither a file nor a directory, the same way QDir does.
+    //! Uses the native APIs of the platform when there is an implementation for it, which avoids the overhead of QDir.
+    //! Returns false if the directory couldn't be opened.
+    bool ListDirectory(const QString& absolutePath, AZStd::vector<DirectoryEntry>& entries);
+
+    //! Walks directory trees on several threads at once, each thread listing different directories.
+    class ParallelDirectoryWalker
+    {
+    public:
+        //! Called on the walking threads for every entry found, with the index of the walking thread, the index of the
+        //! root the entry was found under and the absolute path of the entry.
+        //! Calls are made concurrently, but the thread index can be used to keep data per thread without locking.
+        //! Returns true to walk into the entry when it's a directory.
+        using EntryCallback = AZStd::function<bool(int threadIndex, int rootIndex, const QString& absolutePath, const DirectoryEntry& entry)>;
+
+        //! @param threadCount The number of threads to walk with, 0 to use one per core.
+        explicit ParallelDirectoryWalker(int threadCount = 0);
+
+        //! Adds a directory to walk and returns its root index.
+        //! When recurse is false, only the files directly in the directory are reported.
+        int AddRoot(const QString& absolutePath, bool recurse);
+
+        int GetThreadCount() const;
+
+        //! Walks all the roots, calling back for every entry found. Returns once the walk is finished or cancelled.
+        void Walk(const EntryCallback& callback);
+
+        //! Stops a walk in progress, can be called from any thread.
+        void Cancel();
+
+    private:
+        struct PendingDirectory
+        {
+            QString m_absolutePath;
+            int m_rootIndex = 0;
+            bool m_recurse = true;
+        };
+
+        void WalkThread(int threadIndex, const EntryCallback& callback);
+
+        int m_threadCount = 1;
+        int m_rootCount = 0;
+
+        AZStd::mutex m_pendingMutex;
+        AZStd::condition_variable m_pendingCondition;
+        AZStd::deque<PendingDirectory> m_pendingDirectories;
+        int m_busyThreadCount = 0;
+        AZStd::atomic_bool m_cancelled{ false };
+    };
+} // namespace AssetProcessor
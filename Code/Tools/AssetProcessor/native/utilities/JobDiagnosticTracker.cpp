@@ -13,7 +13,8 @@ namespace AssetProcessor
     bool JobDiagnosticInfo::operator==(const JobDiagnosticInfo& rhs) const
     {
         return m_errorCount == rhs.m_errorCount
-            && m_warningCount == rhs.m_warningCount;
+            && m_warningCount == rhs.m_warningCount
+            && m_processDurationMs == rhs.m_processDurationMs;
     }
 
     bool JobDiagnosticInfo::operator!=(const JobDiagnosticInfo& rhs) const
@@ -16,8 +16,8 @@ namespace AssetProcessor
     struct JobDiagnosticInfo
     {
         JobDiagnosticInfo() = default;
-        JobDiagnosticInfo(AZ::u32 warningCount, AZ::u32 errorCount)
-            : m_warningCount(warningCount), m_errorCount(errorCount)
+        JobDiagnosticInfo(AZ::u32 warningCount, AZ::u32 errorCount, AZ::s64 processDurationMs = 0)
+            : m_warningCount(warningCount), m_errorCount(errorCount), m_processDurationMs(processDurationMs)
         {}
 
         bool operator==(const JobDiagnosticInfo& rhs) const;
@@ -25,6 +25,7 @@ namespace AssetProcessor
 
         AZ::u32 m_warningCount = 0;
         AZ::u32 m_errorCount = 0;
+        AZ::s64 m_processDurationMs = 0; // wall time the job spent in RCJob::DoWork
     };
 
     enum class WarningLevel : AZ::u8
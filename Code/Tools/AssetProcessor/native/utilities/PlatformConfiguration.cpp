@@ -1036,6 +1036,27 @@ namespace AssetProcessor
             m_maxJobs = aznumeric_cast<int>(jobCount);
         }
 
+        jobCount = m_warmBuilderCount;
+        if (settingsRegistry->Get(jobCount, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/warmBuilders"))
+        {
+            m_warmBuilderCount = aznumeric_cast<int>(jobCount);
+        }
+
+        bool buildCacheEnabled = false;
+        settingsRegistry->Get(buildCacheEnabled, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/BuildCache/enabled");
+        if (buildCacheEnabled)
+        {
+            // the cache is kept in the user folder of the project unless it's shared with other checkouts or machines
+            AZ::IO::Path buildCacheFolder;
+            if (!settingsRegistry->Get(buildCacheFolder.Native(), AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/BuildCache/folder")
+                || buildCacheFolder.empty())
+            {
+                settingsRegistry->Get(buildCacheFolder.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath);
+                buildCacheFolder /= "AssetProcessorBuildCache";
+            }
+            m_buildCacheFolder = QString::fromUtf8(buildCacheFolder.c_str());
+        }
+
         if (!skipScanFolders)
         {
             ScanFolderVisitor visitor;
@@ -1532,6 +1553,16 @@ namespace AssetProcessor
         return m_maxJobs;
     }
 
+    int PlatformConfiguration::GetWarmBuilderCount() const
+    {
+        return m_warmBuilderCount;
+    }
+
+    QString PlatformConfiguration::GetBuildCacheFolder() const
+    {
+        return m_buildCacheFolder;
+    }
+
     void PlatformConfiguration::AddGemScanFolders(const AZStd::vector<AzFramework::GemInfo>& gemInfoList)
     {
         int gemOrder = g_gemStartingOrder;
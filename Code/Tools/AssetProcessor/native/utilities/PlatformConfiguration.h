@@ -240,6 +240,12 @@ namespace AssetProcessor
         int GetMinJobs() const;
         int GetMaxJobs() const;
 
+        //! Gets how many builders to start ahead of the jobs that need them, and keep resident
+        int GetWarmBuilderCount() const;
+
+        //! Gets the folder of the build cache, which is empty when the build cache is disabled
+        QString GetBuildCacheFolder() const;
+
         //! Return how many scan folders there are
         int GetScanFolderCount() const;
 
@@ -356,6 +362,8 @@ namespace AssetProcessor
 
         int m_minJobs = 1;
         int m_maxJobs = 3;
+        int m_warmBuilderCount = 0;
+        QString m_buildCacheFolder;
 
         // used only during file read, keeps the total running list of all the enabled platforms from all config files and command lines
         AZStd::vector<AZStd::string> m_tempEnabledPlatforms;
@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Math/Sha1.h>
+#include <AzCore/std/functional.h>
 
 #include "native/utilities/PlatformConfiguration.h"
 #include "native/AssetManager/FileStateCache.h"
@@ -1084,20 +1085,10 @@ namespace AssetUtilities
         return ReadJobLogResult::Success;
     }
 
-    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    // Appends the fingerprints of the job's files to the fingerprint string.
+    // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
+    static void AppendFileFingerprints(const AssetProcessor::JobDetails& jobDetail, AZStd::string& fingerprintString)
     {
-        // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
-        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
-
-        // to avoid resizing and copying repeatedly we will keep track of the largest reserved capacity ever needed for this function, and reserve that much data
-        static size_t s_largestFingerprintCapacitySoFar = 1;
-        AZStd::string fingerprintString;
-        fingerprintString.reserve(s_largestFingerprintCapacitySoFar);
-
-        // in general, we'll build a string which is:
-        // (version):[Array of individual file fingerprints][Array of individual job fingerprints]
-        // with each element of the arrays seperated by colons.
-
         fingerprintString.append(jobDetail.m_extraInformationForFingerprinting);
 
         for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
@@ -1105,7 +1096,12 @@ namespace AssetUtilities
             fingerprintString.append(":");
             fingerprintString.append(GetFileFingerprint(fingerprintFile.first, fingerprintFile.second));
         }
-        // now the other jobs, which this job depends on:
+    }
+
+    // Calls the callback with the identifier of every job the job depends on for its fingerprint.
+    static void EnumerateFingerprintedJobDependencies(
+        const AssetProcessor::JobDetails& jobDetail, const AZStd::function<void(const AssetProcessor::JobIndentifier&)>& callback)
+    {
         for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
         {
             if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
@@ -1118,14 +1114,42 @@ namespace AssetUtilities
 
             for (auto builderIter = jobDependencyInternal.m_builderUuidList.begin(); builderIter != jobDependencyInternal.m_builderUuidList.end(); ++builderIter)
             {
-                AZ::u32 dependentJobFingerprint;
-                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, AssetProcessor::JobIndentifier(jobDesc, *builderIter));
+                callback(AssetProcessor::JobIndentifier(jobDesc, *builderIter));
+            }
+        }
+    }
+
+    // Appends everything a job's fingerprint is made of to the fingerprint string.
+    static void AppendFingerprintString(const AssetProcessor::JobDetails& jobDetail, AZStd::string& fingerprintString)
+    {
+        // in general, we'll build a string which is:
+        // (version):[Array of individual file fingerprints][Array of individual job fingerprints]
+        // with each element of the arrays seperated by colons.
+        AppendFileFingerprints(jobDetail, fingerprintString);
+
+        // now the other jobs, which this job depends on:
+        EnumerateFingerprintedJobDependencies(jobDetail,
+            [&fingerprintString](const AssetProcessor::JobIndentifier& jobIndentifier)
+            {
+                AZ::u32 dependentJobFingerprint = 0;
+                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, jobIndentifier);
                 if (dependentJobFingerprint != 0)
                 {
                     fingerprintString.append(AZStd::string::format(":%u", dependentJobFingerprint));
                 }
-            }
-        }
+            });
+    }
+
+    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
+
+        // to avoid resizing and copying repeatedly we will keep track of the largest reserved capacity ever needed for this function, and reserve that much data
+        static size_t s_largestFingerprintCapacitySoFar = 1;
+        AZStd::string fingerprintString;
+        fingerprintString.reserve(s_largestFingerprintCapacitySoFar);
+
+        AppendFingerprintString(jobDetail, fingerprintString);
         s_largestFingerprintCapacitySoFar = AZStd::GetMax(fingerprintString.capacity(), s_largestFingerprintCapacitySoFar);
 
         if (fingerprintString.empty())
@@ -1142,6 +1166,56 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateBuildCacheKey(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // a modtime only tells whether a file changed on this machine, the build cache is shared between checkouts,
+        // so files have to be identified by their contents.
+        if (!ShouldUseFileHashing())
+        {
+            return {};
+        }
+
+        // the fingerprint only has to tell apart runs of the same job, the build cache is shared by every job,
+        // so the job itself is part of the key too. Its source is named relative to its scan folder,
+        // so that checkouts in different folders share their results.
+        AZStd::string keyString = AZStd::string::format("%s:%s:%s:%s",
+            jobDetail.m_jobEntry.m_builderGuid.ToString<AZStd::string>().c_str(),
+            jobDetail.m_jobEntry.m_platformInfo.m_identifier.c_str(),
+            jobDetail.m_jobEntry.m_jobKey.toUtf8().constData(),
+            jobDetail.m_jobEntry.m_databaseSourceName.toUtf8().constData());
+
+        AppendFileFingerprints(jobDetail, keyString);
+
+        // the jobs this job depends on are identified by their own keys, their 32 bit fingerprints could collide.
+        // Without the key of one of them, the products of this job can't be told apart from the ones of other runs.
+        bool allDependencyKeysFound = true;
+        EnumerateFingerprintedJobDependencies(jobDetail,
+            [&keyString, &allDependencyKeysFound](const AssetProcessor::JobIndentifier& jobIndentifier)
+            {
+                AZStd::string dependencyKey;
+                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependencyKey, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobBuildCacheKey, jobIndentifier);
+                if (dependencyKey.empty())
+                {
+                    allDependencyKeysFound = false;
+                    return;
+                }
+                keyString.append(":");
+                keyString.append(dependencyKey);
+            });
+        if (!allDependencyKeysFound)
+        {
+            return {};
+        }
+
+        // unlike the fingerprint, a collision here would restore the products of another job, so the whole digest is kept
+        AZ::Sha1 sha;
+        sha.ProcessBytes(keyString.data(), keyString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
@@ -1195,6 +1269,17 @@ namespace AssetUtilities
         {
             AZ::IO::SizeType bytesRead;
 
+            // Large files are read in bigger blocks to cut down on the number of reads, small ones fit in the stack buffer
+            char* readBuffer = buffer;
+            AZ::IO::SizeType readBufferSize = FileHashBufferSize;
+            AZStd::vector<char> largeBuffer;
+            if (readStream.GetLength() > FileHashBufferSize)
+            {
+                readBufferSize = AZStd::min(readStream.GetLength(), aznumeric_cast<AZ::IO::SizeType>(LargeFileHashBufferSize));
+                largeBuffer.resize_no_construct(readBufferSize);
+                readBuffer = largeBuffer.data();
+            }
+
             auto* state = XXH64_createState();
 
             if(state == nullptr)
@@ -1218,15 +1303,15 @@ namespace AssetUtilities
                 // The stream's length ends up more accurate in this case, preventing this assert and shut down.
                 // One area this occurs is the navigation mesh file (mnmnavmission0.bai) that's temporarily created when exporting a level,
                 // the navigation system can still be writing to this file when hashing begins, causing the EoF marker to change.
-                AZ::IO::SizeType remainingToRead = AZStd::min(readStream.GetLength() - readStream.GetCurPos(), aznumeric_cast<AZ::IO::SizeType>(AZ_ARRAY_SIZE(buffer)));
-                bytesRead = readStream.Read(remainingToRead, buffer);
+                AZ::IO::SizeType remainingToRead = AZStd::min(readStream.GetLength() - readStream.GetCurPos(), readBufferSize);
+                bytesRead = readStream.Read(remainingToRead, readBuffer);
 
                 if(bytesReadOut)
                 {
                     *bytesReadOut += bytesRead;
                 }
 
-                XXH64_update(state, buffer, bytesRead);
+                XXH64_update(state, readBuffer, bytesRead);
 #ifdef AZ_TESTS_ENABLED
                 // Used by unit tests to force the race condition mentioned above, to verify the crash fix.
                 if(hashMsDelay > 0)
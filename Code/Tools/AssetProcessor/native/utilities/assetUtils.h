@@ -234,11 +234,18 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generates the key the results of a job are stored under in the build cache, from the job and everything its fingerprint is made of.
+    //! Files are identified by their contents, and the jobs it depends on by their own keys, see ProcessingJobInfoBusTraits::GetJobBuildCacheKey.
+    //! Returns an empty string when file hashing is disabled or the key of one of those jobs is unknown, the job can't use the build cache then.
+    AZStd::string GenerateBuildCacheKey(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
     AZ::u64 GetFileHash(const char* filePath, bool force = false, AZ::IO::SizeType* bytesReadOut = nullptr, int hashMsDelay = 0);
     inline constexpr AZ::u64 FileHashBufferSize = 1024 * 64;
+    //! Size of the reads used by GetFileHash for files which don't fit in FileHashBufferSize
+    inline constexpr AZ::u64 LargeFileHashBufferSize = 1024 * 1024;
 
     //! Adjusts a timestamp to fix timezone settings and account for any precision adjustment needed
     AZ::u64 AdjustTimestamp(QDateTime timestamp);
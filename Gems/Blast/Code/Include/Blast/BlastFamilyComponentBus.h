@@ -114,6 +114,12 @@ namespace Blast
         //! Sync positions of meshes of chunks with corresponding actors.
         //! Should only be invoked by BlastSystemComponent.
         virtual void SyncMeshes() = 0;
+
+        //! Create actors resulting from fractures that were not created yet.
+        //! Should only be invoked by BlastSystemComponent.
+        //! @param maxActorCount Maximum number of actors to create.
+        //! @return Number of actors created.
+        virtual uint32_t CreatePendingActors(uint32_t maxActorCount) = 0;
     };
     using BlastFamilyComponentRequestBus = AZ::EBus<BlastFamilyComponentRequests>;
 
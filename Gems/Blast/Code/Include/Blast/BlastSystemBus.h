@@ -32,6 +32,10 @@ namespace Blast
 
         AZ::Data::Asset<Blast::BlastMaterialLibraryAsset> m_materialLibrary = AZ::Data::AssetLoadBehavior::NoLoad;
         uint32_t m_stressSolverIterations = 180;
+        //! Maximum number of actors created by splits on each tick, over all families. Actors over the budget are
+        //! created on the following ticks, until then the split actors stand in for them. Only the children of static
+        //! split actors are created together, even over the budget. 0 means no limit.
+        uint32_t m_maxActorsCreatedPerFrame = 0;
     };
 
     class BlastSystemRequests : public AZ::EBusTraits
@@ -19,6 +19,7 @@ namespace Nv::Blast
 namespace Blast
 {
     class BlastFamily;
+    class ShapePool;
 
     //! Data required to create a BlastActor.
     struct BlastActorDesc
@@ -34,5 +35,6 @@ namespace Blast
         bool m_isStatic = false; //!< Denotes whether actor should be simulated by a static or dynamic rigid body.
         bool m_isLeafChunk = false; //!< Denotes whether this actor represented by a single leaf chunk.
         float m_scale = 1.0f; //!< Uniform scale applied to the actor.
+        ShapePool* m_shapePool = nullptr; //!< If not nullptr, shapes are taken from and returned to this pool.
     };
 } // namespace Blast
@@ -30,6 +30,11 @@ namespace Blast
         delete actor;
     }
 
+    void BlastActorFactoryImpl::ReplaceChunks(BlastActor& actor, const AZStd::vector<uint32_t>& chunkIndices)
+    {
+        static_cast<BlastActorImpl&>(actor).ReplaceChunks(chunkIndices);
+    }
+
     AZStd::vector<uint32_t> BlastActorFactoryImpl::CalculateVisibleChunks(
         const BlastFamily& blastFamily, const Nv::Blast::TkActor& tkActor) const
     {
@@ -27,6 +27,9 @@ namespace Blast
         //! Destroys an existing actor.
         virtual void DestroyActor(BlastActor* actor) = 0;
 
+        //! Replaces the chunks of a dynamic actor, along with the shapes of its body.
+        virtual void ReplaceChunks(BlastActor& actor, const AZStd::vector<uint32_t>& chunkIndices) = 0;
+
         //! Calculate chunks that are going to simulate this actor. See more at BlastActorDesc::m_chunkIndices.
         virtual AZStd::vector<uint32_t> CalculateVisibleChunks(
             const BlastFamily& blastFamily, const Nv::Blast::TkActor& tkActor) const = 0;
@@ -51,6 +54,7 @@ namespace Blast
     public:
         BlastActor* CreateActor(const BlastActorDesc& desc) override;
         void DestroyActor(BlastActor* actor) override;
+        void ReplaceChunks(BlastActor& actor, const AZStd::vector<uint32_t>& chunkIndices) override;
 
         AZStd::vector<uint32_t> CalculateVisibleChunks(
             const BlastFamily& blastFamily, const Nv::Blast::TkActor& tkActor) const override;
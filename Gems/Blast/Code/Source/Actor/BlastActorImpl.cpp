@@ -7,12 +7,14 @@
  */
 
 #include <Actor/BlastActorImpl.h>
+#include <Actor/ShapePool.h>
 #include <Actor/ShapesProvider.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Math/Transform.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
@@ -32,6 +34,7 @@ namespace Blast
     BlastActorImpl::BlastActorImpl(const BlastActorDesc& desc)
         : m_family(*desc.m_family)
         , m_tkActor(*desc.m_tkActor)
+        , m_shapePool(desc.m_shapePool)
         , m_entity(desc.m_entity)
         , m_chunkIndices(desc.m_chunkIndices)
         , m_isLeafChunk(desc.m_isLeafChunk)
@@ -50,7 +53,23 @@ namespace Blast
 
     BlastActorImpl::~BlastActorImpl()
     {
-        m_tkActor.userData = nullptr;
+        // The TkActor might already be reused by one of the children this actor split into.
+        if (m_tkActor.userData == this)
+        {
+            m_tkActor.userData = nullptr;
+        }
+
+        if (m_shapePool)
+        {
+            // Destroying the entity releases its rigid body, which detaches the shapes so they can be reused.
+            m_entity.reset();
+            m_shapesProvider.reset();
+
+            for (size_t i = 0; i < m_chunkShapes.size(); ++i)
+            {
+                m_shapePool->Release(m_chunkIndices[i], AZStd::move(m_chunkShapes[i]));
+            }
+        }
     }
 
     void BlastActorImpl::Spawn()
@@ -85,6 +104,42 @@ namespace Blast
         }
     }
 
+    void BlastActorImpl::ReplaceChunks(const AZStd::vector<uint32_t>& chunkIndices)
+    {
+        auto* rigidBody = azrtti_cast<AzPhysics::RigidBody*>(GetSimulatedBody());
+        AZ_Assert(rigidBody, "Only the chunks of actors with a dynamic rigid body can be replaced.");
+        if (!rigidBody)
+        {
+            return;
+        }
+
+        // Shapes of chunks the actor keeps go through the pool as well, so they don't need to be told apart.
+        for (size_t i = 0; i < m_chunkShapes.size(); ++i)
+        {
+            for (const auto& shape : m_chunkShapes[i])
+            {
+                rigidBody->RemoveShape(shape);
+            }
+            if (m_shapePool)
+            {
+                m_shapePool->Release(m_chunkIndices[i], AZStd::move(m_chunkShapes[i]));
+            }
+        }
+        m_chunkShapes.clear();
+        m_shapesProvider->ClearShapes();
+
+        m_chunkIndices = chunkIndices;
+        AddShapes(m_chunkIndices, m_family.GetPxAsset(), m_physicsMaterialId);
+        for (const auto& chunkShapes : m_chunkShapes)
+        {
+            for (const auto& shape : chunkShapes)
+            {
+                rigidBody->AddShape(shape);
+            }
+        }
+        rigidBody->UpdateMassProperties();
+    }
+
     void BlastActorImpl::AddShapes(
         const AZStd::vector<uint32_t>& chunkIndices, const Nv::Blast::ExtPxAsset& asset,
         const Physics::MaterialId& material)
@@ -101,14 +156,30 @@ namespace Blast
             return;
         }
 
-        for (uint32_t chunkId : chunkIndices)
+        m_chunkShapes.resize(chunkIndices.size());
+        for (size_t chunkListIndex = 0; chunkListIndex < chunkIndices.size(); ++chunkListIndex)
         {
+            const uint32_t chunkId = chunkIndices[chunkListIndex];
             AZ_Assert(chunkId < chunkCount, "Out of bounds access to the BlastPxActor's PxChunks.");
             if (chunkId >= chunkCount)
             {
                 continue;
             }
 
+            auto& chunkShapes = m_chunkShapes[chunkListIndex];
+            if (m_shapePool)
+            {
+                chunkShapes = m_shapePool->Acquire(chunkId);
+                if (!chunkShapes.empty())
+                {
+                    for (const auto& shape : chunkShapes)
+                    {
+                        m_shapesProvider->AddShape(shape);
+                    }
+                    continue;
+                }
+            }
+
             const Nv::Blast::ExtPxChunk& chunk = pxChunks[chunkId];
             for (uint32_t i = 0; i < chunk.subchunkCount; i++)
             {
@@ -134,6 +205,7 @@ namespace Blast
                 AZ_Assert(shape, "Failed to create Shape for BlastActor");
 
                 m_shapesProvider->AddShape(shape);
+                chunkShapes.push_back(shape);
             }
         }
     }
@@ -19,6 +19,8 @@ namespace Nv::Blast
 
 namespace Blast
 {
+    class ShapePool;
+
     //! Provides the glue between Blast actors and the PhysX actors they manipulate.
     class BlastActorImpl : public BlastActor
     {
@@ -30,6 +32,10 @@ namespace Blast
 
         void Spawn();
 
+        //! Replaces the chunks of the actor and the shapes of its body, which must be a dynamic rigid body.
+        //! The shapes of the chunks it doesn't have anymore go back to the shape pool.
+        void ReplaceChunks(const AZStd::vector<uint32_t>& chunkIndices);
+
         void Damage(const NvBlastDamageProgram& program, NvBlastExtProgramParams* programParams) override;
 
         const BlastFamily& GetFamily() const override;
@@ -52,6 +58,7 @@ namespace Blast
             const AZ::Transform& transform, Physics::MaterialId material);
 
         //! Static function to add shapes, based on a list of indices that references chunks in a Blast asset.
+        //! Shapes are taken from the family's shape pool when available.
         //! @param chunkIndices The indices of chunks in the asset parameter that will instantiate shapes.
         //! @param asset The Blast asset that stores chunk data based on indices.
         //! @param material The PhysX material to use to create shapes.
@@ -62,6 +69,8 @@ namespace Blast
         const BlastFamily& m_family;
         Nv::Blast::TkActor& m_tkActor;
         AZStd::unique_ptr<ShapesProvider> m_shapesProvider;
+        ShapePool* m_shapePool = nullptr;
+        AZStd::vector<AZStd::vector<AZStd::shared_ptr<Physics::Shape>>> m_chunkShapes; //!< Shapes of each chunk.
 
         AZStd::shared_ptr<AZ::Entity> m_entity;
         AZStd::vector<uint32_t> m_chunkIndices;
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Actor/ShapePool.h>
+
+#include <AzFramework/Physics/Shape.h>
+
+namespace Blast
+{
+    void ShapePool::Reserve(size_t chunkCount)
+    {
+        m_chunkShapes.reserve(chunkCount);
+    }
+
+    ShapePool::ShapeList ShapePool::Acquire(uint32_t chunkIndex)
+    {
+        auto it = m_chunkShapes.find(chunkIndex);
+        if (it == m_chunkShapes.end())
+        {
+            return {};
+        }
+
+        ShapeList shapes = AZStd::move(it->second);
+        m_chunkShapes.erase(it);
+        return shapes;
+    }
+
+    void ShapePool::Release(uint32_t chunkIndex, ShapeList&& shapes)
+    {
+        if (shapes.empty())
+        {
+            return;
+        }
+
+        // A chunk only belongs to one actor at a time, so there cannot be shapes for it already.
+        AZ_Assert(
+            m_chunkShapes.find(chunkIndex) == m_chunkShapes.end(), "Shapes for chunk %u were already in the pool.",
+            chunkIndex);
+        m_chunkShapes[chunkIndex] = AZStd::move(shapes);
+    }
+
+    void ShapePool::Clear()
+    {
+        m_chunkShapes.clear();
+    }
+
+    size_t ShapePool::GetShapeCount() const
+    {
+        size_t shapeCount = 0;
+        for (const auto& chunkShapes : m_chunkShapes)
+        {
+            shapeCount += chunkShapes.second.size();
+        }
+        return shapeCount;
+    }
+} // namespace Blast
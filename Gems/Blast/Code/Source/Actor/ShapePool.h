@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Physics
+{
+    class Shape;
+} // namespace Physics
+
+namespace Blast
+{
+    //! Keeps the shapes of destroyed actors, indexed by the chunk they were created for, so actors created later
+    //! with the same chunks can reuse them instead of creating new PhysX shapes.
+    //! When an actor splits, its children are made of the chunks it had, so most shapes get reused.
+    //! @note Shapes must be detached from their rigid body before being released into the pool.
+    //! All shapes in a pool must be created with the same collider configuration and scale, which is the case
+    //! for the actors of a single family.
+    class ShapePool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ShapePool, AZ::SystemAllocator, 0);
+
+        using ShapeList = AZStd::vector<AZStd::shared_ptr<Physics::Shape>>;
+
+        //! Reserves space for the shapes of every chunk of the asset.
+        void Reserve(size_t chunkCount);
+
+        //! Takes out the shapes of the chunk from the pool.
+        //! @return The shapes for the chunk, or an empty list if the pool doesn't have them.
+        ShapeList Acquire(uint32_t chunkIndex);
+
+        //! Gives the shapes of the chunk back to the pool.
+        void Release(uint32_t chunkIndex, ShapeList&& shapes);
+
+        //! Releases all the shapes in the pool.
+        void Clear();
+
+        size_t GetShapeCount() const;
+
+    private:
+        AZStd::unordered_map<uint32_t, ShapeList> m_chunkShapes;
+    };
+} // namespace Blast
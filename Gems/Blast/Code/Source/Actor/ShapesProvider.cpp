@@ -37,6 +37,11 @@ namespace Blast
         m_shapes.push_back(shape);
     }
 
+    void ShapesProvider::ClearShapes()
+    {
+        m_shapes.clear();
+    }
+
     AzPhysics::RigidBodyConfiguration ShapesProvider::GetRigidBodyConfiguration()
     {
         return m_configuration;
@@ -22,6 +22,7 @@ namespace Blast
         ~ShapesProvider();
 
         void AddShape(AZStd::shared_ptr<Physics::Shape> shape);
+        void ClearShapes();
 
         // This class is not supposed to provide shape configurations, only shapes themselves.
         AzPhysics::ShapeColliderPairList GetShapeConfigurations() override;
@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/vector.h>
+
 namespace Blast
 {
     class BlastActor;
@@ -27,5 +29,13 @@ namespace Blast
         /// @param family Corresponding BlastFamily that will destroy the actor.
         /// @param actor The actor to be destroyed.
         virtual void OnActorDestroyed(const BlastFamily& family, const BlastActor& actor) = 0;
+
+        /// Called after an actor got different chunks, which happens to split actors standing in for the children
+        /// that are not created yet.
+        /// @param family Corresponding BlastFamily that changed the actor.
+        /// @param actor The actor, with its new chunks.
+        /// @param previousChunkIndices The chunks the actor had before.
+        virtual void OnActorChunksChanged(
+            const BlastFamily& family, const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices) = 0;
     };
 } // namespace Blast
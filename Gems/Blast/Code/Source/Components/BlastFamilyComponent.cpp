@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
@@ -312,81 +313,91 @@ namespace Blast
         return GetEntityId();
     }
 
+    BlastActor* BlastFamilyComponent::PrepareDamage()
+    {
+        // Children of splits waiting to be created would miss the damage.
+        m_family->CreatePendingActors(AZStd::numeric_limits<uint32_t>::max());
+
+        // Damage sent to an actor that got split goes to the whole family, which finds its children at the position.
+        const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
+        if (!entityIdPtr || *entityIdPtr == GetEntityId())
+        {
+            return nullptr;
+        }
+        return m_family->GetActorTracker().GetActorById(*entityIdPtr);
+    }
+
     void BlastFamilyComponent::RadialDamage(
         const AZ::Vector3& position, const float minRadius, const float maxRadius, const float damage)
     {
-        if (const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
-            !entityIdPtr || *entityIdPtr == GetEntityId())
+        if (auto* actor = PrepareDamage())
         {
-            m_damageManager->Damage(DamageManager::RadialDamage{}, damage, position, minRadius, maxRadius);
+            m_damageManager->Damage(DamageManager::RadialDamage{}, *actor, damage, position, minRadius, maxRadius);
         }
-        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr); actor != nullptr)
+        else
         {
-            m_damageManager->Damage(DamageManager::RadialDamage{}, *actor, damage, position, minRadius, maxRadius);
+            m_damageManager->Damage(DamageManager::RadialDamage{}, damage, position, minRadius, maxRadius);
         }
     }
 
     void BlastFamilyComponent::CapsuleDamage(
         const AZ::Vector3& position0, const AZ::Vector3& position1, float minRadius, float maxRadius, float damage)
     {
-        if (const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
-            !entityIdPtr || *entityIdPtr == GetEntityId())
-        {
-            m_damageManager->Damage(DamageManager::CapsuleDamage{}, damage, position0, position1, minRadius, maxRadius);
-        }
-        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr); actor != nullptr)
+        if (auto* actor = PrepareDamage())
         {
             m_damageManager->Damage(
                 DamageManager::CapsuleDamage{}, *actor, damage, position0, position1, minRadius, maxRadius);
         }
+        else
+        {
+            m_damageManager->Damage(DamageManager::CapsuleDamage{}, damage, position0, position1, minRadius, maxRadius);
+        }
     }
 
     void BlastFamilyComponent::ShearDamage(
         const AZ::Vector3& position, const AZ::Vector3& normal, float minRadius, float maxRadius, float damage)
     {
-        if (const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
-            !entityIdPtr || *entityIdPtr == GetEntityId())
-        {
-            m_damageManager->Damage(DamageManager::ShearDamage{}, damage, position, minRadius, maxRadius, normal);
-        }
-        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr); actor != nullptr)
+        if (auto* actor = PrepareDamage())
         {
             m_damageManager->Damage(
                 DamageManager::ShearDamage{}, *actor, damage, position, minRadius, maxRadius, normal);
         }
+        else
+        {
+            m_damageManager->Damage(DamageManager::ShearDamage{}, damage, position, minRadius, maxRadius, normal);
+        }
     }
 
     void BlastFamilyComponent::TriangleDamage(
         const AZ::Vector3& position0, const AZ::Vector3& position1, const AZ::Vector3& position2, float damage)
     {
-        if (const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
-            !entityIdPtr || *entityIdPtr == GetEntityId())
+        if (auto* actor = PrepareDamage())
         {
-            m_damageManager->Damage(DamageManager::TriangleDamage{}, damage, position0, position1, position2);
+            m_damageManager->Damage(DamageManager::TriangleDamage{}, *actor, damage, position0, position1, position2);
         }
-        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr); actor != nullptr)
+        else
         {
-            m_damageManager->Damage(DamageManager::TriangleDamage{}, *actor, damage, position0, position1, position2);
+            m_damageManager->Damage(DamageManager::TriangleDamage{}, damage, position0, position1, position2);
         }
     }
 
     void BlastFamilyComponent::ImpactSpreadDamage(
         const AZ::Vector3& position, float minRadius, float maxRadius, float damage)
     {
-        if (const auto* entityIdPtr = BlastFamilyDamageRequestBus::GetCurrentBusId();
-            !entityIdPtr || *entityIdPtr == GetEntityId())
-        {
-            m_damageManager->Damage(DamageManager::ImpactSpreadDamage{}, damage, position, minRadius, maxRadius);
-        }
-        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr); actor != nullptr)
+        if (auto* actor = PrepareDamage())
         {
             m_damageManager->Damage(
                 DamageManager::ImpactSpreadDamage{}, *actor, damage, position, minRadius, maxRadius);
         }
+        else
+        {
+            m_damageManager->Damage(DamageManager::ImpactSpreadDamage{}, damage, position, minRadius, maxRadius);
+        }
     }
 
     void BlastFamilyComponent::StressDamage(const AZ::Vector3& position, const AZ::Vector3& force)
     {
+        PrepareDamage();
         if (const auto* closestActor = m_family->GetActorTracker().FindClosestActor(position))
         {
             StressDamage(*closestActor, position, force);
@@ -406,9 +417,9 @@ namespace Blast
         {
             Despawn();
         }
-        else
+        else if (auto* actor = m_family->GetActorTracker().GetActorById(*entityIdPtr))
         {
-            m_family->DestroyActor(m_family->GetActorTracker().GetActorById(*entityIdPtr));
+            m_family->DestroyActor(actor);
         }
     }
 
@@ -497,10 +508,11 @@ namespace Blast
 
         if (m_solver)
         {
-            for (auto actor : m_family->GetActorTracker().GetActors())
+            // Adds the forces acting on the TkActor, from the body that currently represents it.
+            auto addForces = [this](const BlastActor& bodyActor, const Nv::Blast::TkActor& tkActor)
             {
-                auto worldBody = actor->GetSimulatedBody();
-                if (actor->IsStatic())
+                auto worldBody = bodyActor.GetSimulatedBody();
+                if (bodyActor.IsStatic())
                 {
                     AZ::Vector3 gravity = AzPhysics::DefaultGravity;
                     if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
@@ -509,20 +521,38 @@ namespace Blast
                     }
                     auto localGravity =
                         worldBody->GetTransform().GetRotation().GetInverseFull().TransformVector(gravity);
-                    m_solver->addGravityForce(*actor->GetTkActor().getActorLL(), Convert(localGravity));
+                    m_solver->addGravityForce(*tkActor.getActorLL(), Convert(localGravity));
                 }
                 else
                 {
-                    auto* rigidBody = static_cast<AzPhysics::RigidBody*>(worldBody);
+                    auto* rigidBody = static_cast<const AzPhysics::RigidBody*>(worldBody);
+                    // Sleeping bodies don't rotate, so they add no stress.
+                    if (!rigidBody->IsAwake())
+                    {
+                        return;
+                    }
+
                     auto localCenterMass = rigidBody->GetCenterOfMassLocal();
                     auto localAngularVelocity =
                         worldBody->GetTransform().GetRotation().GetInverseFull().TransformVector(
                             rigidBody->GetAngularVelocity());
                     m_solver->addAngularVelocity(
-                        *actor->GetTkActor().getActorLL(), Convert(localCenterMass), Convert(localAngularVelocity));
+                        *tkActor.getActorLL(), Convert(localCenterMass), Convert(localAngularVelocity));
                 }
+            };
+
+            for (auto actor : m_family->GetActorTracker().GetActors())
+            {
+                addForces(*actor, actor->GetTkActor());
             }
 
+            // Children of splits waiting to be created move with the body of the actor that got split.
+            m_family->EnumeratePendingActors(
+                [&addForces](const BlastActor& splitActor, Nv::Blast::TkActor& tkActor)
+                {
+                    addForces(splitActor, tkActor);
+                });
+
             m_solver->update();
 
             if (m_solver->getOverstressedBondCount() > 0)
@@ -586,6 +616,16 @@ namespace Blast
         }
     }
 
+    void BlastFamilyComponent::OnActorChunksChanged(
+        [[maybe_unused]] const BlastFamily& family, const BlastActor& actor,
+        const AZStd::vector<uint32_t>& previousChunkIndices)
+    {
+        if (m_actorRenderManager)
+        {
+            m_actorRenderManager->OnActorChunksChanged(actor, previousChunkIndices);
+        }
+    }
+
     // Update positions of entities with render meshes corresponding to their right dynamic bodies.
     void BlastFamilyComponent::SyncMeshes()
     {
@@ -596,4 +636,16 @@ namespace Blast
             m_actorRenderManager->SyncMeshes();
         }
     }
+
+    uint32_t BlastFamilyComponent::CreatePendingActors(uint32_t maxActorCount)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        if (!m_family)
+        {
+            return 0;
+        }
+
+        return m_family->CreatePendingActors(maxActorCount);
+    }
 } // namespace Blast
@@ -87,12 +87,19 @@ namespace Blast
         void FillDebugRenderBuffer(DebugRenderBuffer& debugRenderBuffer, DebugRenderMode debugRenderMode) override;
         void ApplyStressDamage() override;
         void SyncMeshes() override;
+        uint32_t CreatePendingActors(uint32_t maxActorCount) override;
 
     private:
         // BlastListener interface implementation. These methods trigger notifications on
         // BlastFamilyComponentNotificationBus.
         void OnActorCreated(const BlastFamily& family, const BlastActor& actor) override;
         void OnActorDestroyed(const BlastFamily& family, const BlastActor& actor) override;
+        void OnActorChunksChanged(
+            const BlastFamily& family, const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices) override;
+
+        // Creates the pending actors so they can be damaged, and returns the actor the current damage request is
+        // sent to, or nullptr if it is for the whole family.
+        BlastActor* PrepareDamage();
 
         // Dispatched when two shapes start colliding.
         void OnCollisionBegin(const AzPhysics::CollisionEvent& collisionEvent);
@@ -17,6 +17,8 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <Blast/BlastActorData.h>
 #include <Blast/BlastDebug.h>
 #include <Blast/BlastFamilyComponentBus.h>
@@ -65,7 +67,8 @@ namespace Blast
             serialize->Class<BlastGlobalConfiguration>()
                 ->Field("BlastMaterialLibrary", &BlastGlobalConfiguration::m_materialLibrary)
                 ->Field("StressSolverIterations", &BlastGlobalConfiguration::m_stressSolverIterations)
-                ->Version(1);
+                ->Field("MaxActorsCreatedPerFrame", &BlastGlobalConfiguration::m_maxActorsCreatedPerFrame)
+                ->Version(2);
 
             if (AZ::EditContext* ec = serialize->GetEditContext())
             {
@@ -82,7 +85,13 @@ namespace Blast
                         "Stress solver iterations",
                         "Number of iterations stress solver on each family runs for each tick.")
                     ->Attribute(AZ::Edit::Attributes::Min, 0)
-                    ->Attribute(AZ::Edit::Attributes::Max, 50000);
+                    ->Attribute(AZ::Edit::Attributes::Max, 50000)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BlastGlobalConfiguration::m_maxActorsCreatedPerFrame,
+                        "Max actors created per frame",
+                        "Maximum number of actors created by fractures on each tick, the rest are created on the "
+                        "following ticks. 0 means no limit.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0);
             }
         }
     }
@@ -234,6 +243,21 @@ namespace Blast
             group.m_extGroupTaskManager->wait();
         }
 
+        // Create the actors resulting from fractures, within the budget for this tick.
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "BlastSystemComponent::OnTick::CreatePendingActors");
+            uint32_t actorBudget = m_configuration.m_maxActorsCreatedPerFrame > 0
+                ? m_configuration.m_maxActorsCreatedPerFrame
+                : AZStd::numeric_limits<uint32_t>::max();
+            BlastFamilyComponentRequestBus::EnumerateHandlers(
+                [&actorBudget](BlastFamilyComponentRequests* handler)
+                {
+                    // Families can go over the budget, as they create the children of a static split together.
+                    actorBudget -= AZStd::min(handler->CreatePendingActors(actorBudget), actorBudget);
+                    return actorBudget > 0;
+                });
+        }
+
         // Clean up damage descriptions and program params now that groups have run.
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "BlastSystemComponent::OnTick::Cleanup");
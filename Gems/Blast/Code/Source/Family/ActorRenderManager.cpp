@@ -58,6 +58,38 @@ namespace Blast
         }
     }
 
+    void ActorRenderManager::OnActorChunksChanged(
+        const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        const AZStd::vector<uint32_t>& chunkIndices = actor.GetChunkIndices();
+        AZStd::vector<bool> isChunkKept(m_chunkCount, false);
+        for (uint32_t chunkId : chunkIndices)
+        {
+            isChunkKept[chunkId] = true;
+        }
+
+        for (uint32_t chunkId : previousChunkIndices)
+        {
+            if (!isChunkKept[chunkId] && m_chunkActors[chunkId] == &actor)
+            {
+                m_meshFeatureProcessor->ReleaseMesh(m_chunkMeshHandles[chunkId]);
+                m_chunkActors[chunkId] = nullptr;
+            }
+        }
+
+        for (uint32_t chunkId : chunkIndices)
+        {
+            if (m_chunkActors[chunkId] != &actor)
+            {
+                m_chunkActors[chunkId] = &actor;
+                m_chunkMeshHandles[chunkId] = m_meshFeatureProcessor->AcquireMesh(
+                    AZ::Render::MeshHandleDescriptor{ m_meshData->GetMeshAsset(chunkId) }, m_materialMap);
+            }
+        }
+    }
+
     void ActorRenderManager::SyncMeshes()
     {
         // It is more natural to have chunk entities be transform children of rigid body entity,
@@ -36,6 +36,9 @@ namespace Blast
         // Callback that makes meshes corresponding to the actor invisible.
         void OnActorDestroyed(const BlastActor& actor);
 
+        // Callback that hides the meshes of the chunks the actor doesn't have anymore, and shows the ones of its new chunks.
+        void OnActorChunksChanged(const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices);
+
         // Update positions of entities with render meshes corresponding to their right dynamic bodies.
         void SyncMeshes();
 
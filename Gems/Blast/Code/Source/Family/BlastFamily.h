@@ -11,6 +11,7 @@
 #include <Actor/EntityProvider.h>
 #include <Asset/BlastAsset.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/functional.h>
 #include <Blast/BlastActor.h>
 #include <Blast/BlastDebug.h>
 #include <Blast/BlastMaterial.h>
@@ -69,6 +70,22 @@ namespace Blast
         virtual void HandleEvents(const Nv::Blast::TkEvent* events, uint32_t eventCount) = 0;
         virtual void DestroyActor(BlastActor* blastActor) = 0;
 
+        //! Actors created by splits are queued and created with CreatePendingActors, so their entities and physics
+        //! bodies can be spread over several frames. Until then the split actor keeps its body, which stands in for
+        //! its children. When only some children of a dynamic split fit in the budget, the split actor gives up their
+        //! chunks and keeps those of the children that are left, and it is destroyed with the creation of its last
+        //! child. The poses and velocities the children start with are taken from that body when they are created.
+        //! @param maxActorCount Maximum number of actors to create. The children of a static split are created
+        //! together, so they can go over it when the split is the first one pending.
+        //! @return Number of actors created.
+        virtual uint32_t CreatePendingActors(uint32_t maxActorCount) = 0;
+        virtual uint32_t GetPendingActorCount() const = 0;
+
+        //! Calls the function for every actor waiting to be created, together with the split actor whose body stands
+        //! in for it. The split actor is not in the actor tracker anymore and its TkActor must not be used.
+        virtual void EnumeratePendingActors(
+            const AZStd::function<void(const BlastActor& splitActor, Nv::Blast::TkActor& tkActor)>& callback) const = 0;
+
         virtual ActorTracker& GetActorTracker() = 0;
         virtual const Nv::Blast::TkFamily* GetTkFamily() const = 0;
         virtual Nv::Blast::TkFamily* GetTkFamily() = 0;
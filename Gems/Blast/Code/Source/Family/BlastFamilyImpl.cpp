@@ -10,6 +10,7 @@
 #include <Family/BlastFamilyImpl.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
 #include <Blast/BlastSystemBus.h>
 #include <Family/ActorTracker.h>
 #include <Family/BlastFamily.h>
@@ -27,6 +28,9 @@
 
 namespace Blast
 {
+    // Splits into fewer actors than this are not worth spreading over jobs.
+    static const size_t MinActorsForParallelChunkCalculation = 16;
+
     AZStd::unique_ptr<BlastFamily> BlastFamily::Create(const BlastFamilyDesc& desc)
     {
         return AZStd::make_unique<BlastFamilyImpl>(desc);
@@ -98,10 +102,12 @@ namespace Blast
         }
 
         m_initialTransform = transform;
+        m_shapePool.Reserve(GetPxAsset().getChunkCount());
 
         m_tkFamily->addListener(*this);
 
-        CreateActors(CalculateInitialActors(transform));
+        AZStd::vector<BlastActorDesc> initialActors = CalculateInitialActors(transform);
+        CreateActors(initialActors);
 
         m_isSpawned = true;
         return true;
@@ -112,6 +118,13 @@ namespace Blast
         // Intentional copy here as we will use this set to delete actors from ActorTracker itself
         AZStd::unordered_set<BlastActor*> toDelete = m_actorTracker.GetActors();
         DestroyActors(toDelete);
+        for (PendingSplit& pendingSplit : m_pendingSplits)
+        {
+            DestroySplitActor(pendingSplit.m_splitActor);
+        }
+        m_pendingSplits.clear();
+        m_pendingActorCount = 0;
+        m_shapePool.Clear();
 
         if (m_tkFamily)
         {
@@ -124,9 +137,6 @@ namespace Blast
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
 
-        AZStd::vector<BlastActorDesc> newActors;
-        AZStd::unordered_set<BlastActor*> actorsToDelete;
-
         for (uint32_t i = 0; i < eventCount; ++i)
         {
             const Nv::Blast::TkEvent& event = events[i];
@@ -134,21 +144,16 @@ namespace Blast
             {
             case Nv::Blast::TkEvent::Split:
                 {
-                    HandleSplitEvent(event.getPayload<Nv::Blast::TkSplitEvent>(), newActors, actorsToDelete);
+                    HandleSplitEvent(event.getPayload<Nv::Blast::TkSplitEvent>());
                     break;
                 }
             default:
                 break;
             }
         }
-
-        DestroyActors(actorsToDelete);
-        CreateActors(AZStd::move(newActors));
     }
 
-    void BlastFamilyImpl::HandleSplitEvent(
-        const Nv::Blast::TkSplitEvent* splitEvent, AZStd::vector<BlastActorDesc>& newActors,
-        AZStd::unordered_set<BlastActor*>& actorsToDelete)
+    void BlastFamilyImpl::HandleSplitEvent(const Nv::Blast::TkSplitEvent* splitEvent)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
 
@@ -158,75 +163,93 @@ namespace Blast
             return;
         }
 
-        const uint32_t newActorsCount = splitEvent->numChildren;
+        // Entities and physics bodies of the children are created later, in CreatePendingActors.
+        // Their poses and velocities are set then, from the body of the split actor.
+        AZStd::vector<BlastActorDesc> childDescs;
+        childDescs.reserve(splitEvent->numChildren);
+        for (uint32_t childIndex = 0; childIndex < splitEvent->numChildren; ++childIndex)
+        {
+            Nv::Blast::TkActor* tkActor = splitEvent->children[childIndex];
+            if (!tkActor)
+            {
+                AZ_Assert(false, "Split event generated with null TkActor");
+                continue;
+            }
+
+            // Children which split again before they got created are told apart from created actors by this.
+            tkActor->userData = nullptr;
+            childDescs.push_back(CalculateActorDesc(m_initialTransform, tkActor));
+        }
+        CalculateActorChunks(childDescs);
 
-        BlastActor* parentActor = nullptr;
-        AzPhysics::SimulatedBody* parentBody = nullptr;
-        AZ_Assert(splitEvent->parentData.userData, "Parent actor in split event must have user data.");
-        if (!splitEvent->parentData.userData)
+        const uint32_t childCount = aznumeric_cast<uint32_t>(childDescs.size());
+        if (splitEvent->parentData.userData)
         {
+            // The split actor keeps its body until the children are created, but its TkActor is gone,
+            // so it must not be found for damage anymore.
+            BlastActor* splitActor = reinterpret_cast<BlastActor*>(splitEvent->parentData.userData);
+            m_actorTracker.RemoveActor(splitActor);
+
+            m_pendingSplits.push_back({ splitActor, AZStd::move(childDescs) });
+            m_pendingActorCount += childCount;
             return;
         }
 
-        parentActor = reinterpret_cast<BlastActor*>(splitEvent->parentData.userData);
-        AZ_Assert(parentActor, "TkActor had a null user data instead of a BlastActor.");
-        if (!parentActor)
+        // A child still waiting to be created got split, its own children take its place.
+        size_t pendingChildIndex = 0;
+        PendingSplit* pendingSplit = FindPendingSplit(splitEvent->parentData.index, pendingChildIndex);
+        AZ_Assert(pendingSplit, "Parent actor in split event must have user data or be waiting to be created.");
+        if (!pendingSplit)
         {
             return;
         }
-        parentBody = parentActor->GetSimulatedBody();
-
-        const bool parentStatic = parentActor->IsStatic();
 
-        // Fill in actor create infos for newly created actors, based on the parent's velocity & center of mass
-        for (uint32_t childIndex = 0; childIndex < newActorsCount; ++childIndex)
+        pendingSplit->m_childDescs.erase(pendingSplit->m_childDescs.begin() + pendingChildIndex);
+        for (BlastActorDesc& childDesc : childDescs)
         {
-            if (childIndex >= splitEvent->numChildren)
-            {
-                AZ_Assert(false, "Out of bounds access to split event's children.");
-                continue;
-            }
-
-            if (!splitEvent->children[childIndex])
-            {
-                AZ_Assert(false, "Split event generated with null TkActor");
-                continue;
-            }
+            pendingSplit->m_childDescs.push_back(AZStd::move(childDesc));
+        }
+        m_pendingActorCount = m_pendingActorCount - 1 + childCount;
+    }
 
-            AZ::Transform parentTransform;
-            if (parentBody)
-            {
-                parentTransform = parentBody->GetTransform();
-                parentTransform.MultiplyByUniformScale(m_initialTransform.GetUniformScale());
-            }
-            else
+    BlastFamilyImpl::PendingSplit* BlastFamilyImpl::FindPendingSplit(uint32_t tkActorIndex, size_t& childIndex)
+    {
+        for (PendingSplit& pendingSplit : m_pendingSplits)
+        {
+            for (size_t i = 0; i < pendingSplit.m_childDescs.size(); ++i)
             {
-                parentTransform = m_initialTransform;
+                if (pendingSplit.m_childDescs[i].m_tkActor->getIndex() == tkActorIndex)
+                {
+                    childIndex = i;
+                    return &pendingSplit;
+                }
             }
-
-            newActors.push_back(
-                CalculateActorDesc(parentBody, parentStatic, parentTransform, splitEvent->children[childIndex]));
         }
-
-        actorsToDelete.insert(parentActor);
+        return nullptr;
     }
 
-    BlastActorDesc BlastFamilyImpl::CalculateActorDesc(
-        AzPhysics::SimulatedBody* parentBody, bool parentStatic, AZ::Transform parentTransform, Nv::Blast::TkActor* tkActor)
+    void BlastFamilyImpl::ApplyParentState(
+        BlastActorDesc& actorDesc, const AzPhysics::SimulatedBody* parentBody, bool parentStatic) const
     {
-        auto actorDesc = CalculateActorDesc(parentTransform, tkActor);
+        AZ::Transform parentTransform = m_initialTransform;
+        if (parentBody)
+        {
+            parentTransform = parentBody->GetTransform();
+            parentTransform.MultiplyByUniformScale(m_initialTransform.GetUniformScale());
+        }
 
-        actorDesc.m_bodyConfiguration.m_initialAngularVelocity = !parentStatic
-            ? static_cast<AzPhysics::RigidBody*>(parentBody)->GetAngularVelocity()
-            : AZ::Vector3::CreateZero();
-        actorDesc.m_parentCenterOfMass = parentTransform.TransformPoint(
-            !parentStatic ? static_cast<AzPhysics::RigidBody*>(parentBody)->GetCenterOfMassLocal()
-                          : AZ::Vector3::CreateZero());
-        actorDesc.m_parentLinearVelocity = !parentStatic
-            ? static_cast<AzPhysics::RigidBody*>(parentBody)->GetLinearVelocity()
-            : AZ::Vector3::CreateZero();
+        const AzPhysics::RigidBody* parentRigidBody =
+            parentBody && !parentStatic ? static_cast<const AzPhysics::RigidBody*>(parentBody) : nullptr;
 
-        return actorDesc;
+        actorDesc.m_bodyConfiguration.m_position = parentTransform.GetTranslation();
+        actorDesc.m_bodyConfiguration.m_orientation = parentTransform.GetRotation();
+        actorDesc.m_bodyConfiguration.m_initialAngularVelocity =
+            parentRigidBody ? parentRigidBody->GetAngularVelocity() : AZ::Vector3::CreateZero();
+        actorDesc.m_parentCenterOfMass = parentTransform.TransformPoint(
+            parentRigidBody ? parentRigidBody->GetCenterOfMassLocal() : AZ::Vector3::CreateZero());
+        actorDesc.m_parentLinearVelocity =
+            parentRigidBody ? parentRigidBody->GetLinearVelocity() : AZ::Vector3::CreateZero();
+        actorDesc.m_scale = parentTransform.GetUniformScale();
     }
 
     BlastActorDesc BlastFamilyImpl::CalculateActorDesc(const AZ::Transform& transform, Nv::Blast::TkActor* tkActor)
@@ -242,30 +265,164 @@ namespace Blast
         actorDesc.m_family = this;
         actorDesc.m_tkActor = tkActor;
         actorDesc.m_physicsMaterialId = m_physicsMaterialId;
-        actorDesc.m_chunkIndices = m_actorFactory->CalculateVisibleChunks(*this, *actorDesc.m_tkActor);
-        actorDesc.m_isStatic = m_actorFactory->CalculateIsStatic(*this, *actorDesc.m_tkActor, actorDesc.m_chunkIndices);
-        actorDesc.m_isLeafChunk = m_actorFactory->CalculateIsLeafChunk(*actorDesc.m_tkActor, actorDesc.m_chunkIndices);
-        actorDesc.m_entity = m_entityProvider->CreateEntity(m_actorFactory->CalculateComponents(actorDesc.m_isStatic));
         actorDesc.m_parentCenterOfMass = transform.GetTranslation();
         actorDesc.m_parentLinearVelocity = AZ::Vector3::CreateZero();
         actorDesc.m_bodyConfiguration = configuration;
         actorDesc.m_scale = transform.GetUniformScale();
+        actorDesc.m_shapePool = &m_shapePool;
 
         return actorDesc;
     }
 
-    void BlastFamilyImpl::CreateActors(const AZStd::vector<BlastActorDesc>& actorDescs)
+    void BlastFamilyImpl::CalculateActorChunks(AZStd::vector<BlastActorDesc>& actorDescs) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        // The factory only reads the TkActors and the asset, so the actors can be processed concurrently.
+        auto calculateChunks = [this](BlastActorDesc& actorDesc)
+        {
+            actorDesc.m_chunkIndices = m_actorFactory->CalculateVisibleChunks(*this, *actorDesc.m_tkActor);
+            actorDesc.m_isStatic =
+                m_actorFactory->CalculateIsStatic(*this, *actorDesc.m_tkActor, actorDesc.m_chunkIndices);
+            actorDesc.m_isLeafChunk =
+                m_actorFactory->CalculateIsLeafChunk(*actorDesc.m_tkActor, actorDesc.m_chunkIndices);
+        };
+
+        if (actorDescs.size() < MinActorsForParallelChunkCalculation)
+        {
+            for (BlastActorDesc& actorDesc : actorDescs)
+            {
+                calculateChunks(actorDesc);
+            }
+            return;
+        }
+
+        AZ::parallel_for(size_t(0), actorDescs.size(),
+            [&actorDescs, &calculateChunks](int actorIndex)
+            {
+                calculateChunks(actorDescs[actorIndex]);
+            });
+    }
+
+    void BlastFamilyImpl::CreateActors(AZStd::vector<BlastActorDesc>& actorDescs)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
 
         for (auto& actorDesc : actorDescs)
         {
-            BlastActor* actor = m_actorFactory->CreateActor(actorDesc);
-            m_actorTracker.AddActor(actor);
-            DispatchActorCreated(*actor);
+            CreateActor(actorDesc);
         }
     }
 
+    void BlastFamilyImpl::CreateActor(BlastActorDesc& actorDesc)
+    {
+        actorDesc.m_entity = m_entityProvider->CreateEntity(m_actorFactory->CalculateComponents(actorDesc.m_isStatic));
+
+        BlastActor* actor = m_actorFactory->CreateActor(actorDesc);
+        m_actorTracker.AddActor(actor);
+        DispatchActorCreated(*actor);
+    }
+
+    uint32_t BlastFamilyImpl::CreatePendingActors(uint32_t maxActorCount)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        uint32_t createdActorCount = 0;
+        while (createdActorCount < maxActorCount && !m_pendingSplits.empty())
+        {
+            const uint32_t childCount = aznumeric_cast<uint32_t>(m_pendingSplits.front().m_childDescs.size());
+            const uint32_t remainingBudget = maxActorCount - createdActorCount;
+            if (childCount > remainingBudget)
+            {
+                // The split actor stands in for the children that are left, which static bodies can't do, as their
+                // shapes can't be removed. Those splits are created together, even over the budget.
+                if (!m_pendingSplits.front().m_splitActor->IsStatic())
+                {
+                    CreateSplitChildren(m_pendingSplits.front(), remainingBudget);
+                    m_pendingActorCount -= remainingBudget;
+                    createdActorCount += remainingBudget;
+                    break;
+                }
+                if (createdActorCount > 0)
+                {
+                    break;
+                }
+            }
+
+            PendingSplit pendingSplit = AZStd::move(m_pendingSplits.front());
+            m_pendingSplits.pop_front();
+            m_pendingActorCount -= childCount;
+
+            CreateSplitChildren(pendingSplit);
+            createdActorCount += childCount;
+        }
+        return createdActorCount;
+    }
+
+    uint32_t BlastFamilyImpl::GetPendingActorCount() const
+    {
+        return m_pendingActorCount;
+    }
+
+    void BlastFamilyImpl::EnumeratePendingActors(
+        const AZStd::function<void(const BlastActor& splitActor, Nv::Blast::TkActor& tkActor)>& callback) const
+    {
+        for (const PendingSplit& pendingSplit : m_pendingSplits)
+        {
+            for (const BlastActorDesc& childDesc : pendingSplit.m_childDescs)
+            {
+                callback(*pendingSplit.m_splitActor, *childDesc.m_tkActor);
+            }
+        }
+    }
+
+    void BlastFamilyImpl::CreateSplitChildren(PendingSplit& pendingSplit)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        // The children start where the split actor is now, not where it was when it got split.
+        const AzPhysics::SimulatedBody* splitBody = pendingSplit.m_splitActor->GetSimulatedBody();
+        const bool splitStatic = pendingSplit.m_splitActor->IsStatic();
+        for (BlastActorDesc& childDesc : pendingSplit.m_childDescs)
+        {
+            ApplyParentState(childDesc, splitBody, splitStatic);
+        }
+
+        // Destroying the split actor first returns its shapes to the pool for the children.
+        DestroySplitActor(pendingSplit.m_splitActor);
+        CreateActors(pendingSplit.m_childDescs);
+    }
+
+    void BlastFamilyImpl::CreateSplitChildren(PendingSplit& pendingSplit, uint32_t childCount)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        BlastActor* splitActor = pendingSplit.m_splitActor;
+        AZStd::vector<BlastActorDesc> childDescs(
+            AZStd::make_move_iterator(pendingSplit.m_childDescs.begin()),
+            AZStd::make_move_iterator(pendingSplit.m_childDescs.begin() + childCount));
+        pendingSplit.m_childDescs.erase(pendingSplit.m_childDescs.begin(), pendingSplit.m_childDescs.begin() + childCount);
+
+        for (BlastActorDesc& childDesc : childDescs)
+        {
+            ApplyParentState(childDesc, splitActor->GetSimulatedBody(), false);
+        }
+
+        // The split actor keeps only the chunks of the children that are left, so it doesn't overlap the ones
+        // created now. This returns the shapes of their chunks to the pool, before the children take them out.
+        AZStd::vector<uint32_t> remainingChunkIndices;
+        for (const BlastActorDesc& childDesc : pendingSplit.m_childDescs)
+        {
+            remainingChunkIndices.insert(
+                remainingChunkIndices.end(), childDesc.m_chunkIndices.begin(), childDesc.m_chunkIndices.end());
+        }
+        const AZStd::vector<uint32_t> previousChunkIndices = splitActor->GetChunkIndices();
+        m_actorFactory->ReplaceChunks(*splitActor, remainingChunkIndices);
+        DispatchActorChunksChanged(*splitActor, previousChunkIndices);
+
+        CreateActors(childDescs);
+    }
+
     void BlastFamilyImpl::DestroyActors(const AZStd::unordered_set<BlastActor*>& actors)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
@@ -278,6 +435,13 @@ namespace Blast
         }
     }
 
+    void BlastFamilyImpl::DestroySplitActor(BlastActor* splitActor)
+    {
+        // Split actors got removed from the actor tracker already.
+        DispatchActorDestroyed(*splitActor);
+        m_actorFactory->DestroyActor(splitActor);
+    }
+
     void BlastFamilyImpl::DestroyActor(BlastActor* blastActor)
     {
         if (m_actorTracker.GetActors().find(blastActor) == m_actorTracker.GetActors().end())
@@ -306,6 +470,14 @@ namespace Blast
         m_listener->OnActorDestroyed(*this, actor);
     }
 
+    void BlastFamilyImpl::DispatchActorChunksChanged(
+        const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        m_listener->OnActorChunksChanged(*this, actor, previousChunkIndices);
+    }
+
     AZStd::vector<BlastActorDesc> BlastFamilyImpl::CalculateInitialActors(const AZ::Transform& transform)
     {
         // Get current active TkActors
@@ -322,6 +494,7 @@ namespace Blast
         {
             initialActors.push_back(CalculateActorDesc(transform, tkActor));
         }
+        CalculateActorChunks(initialActors);
         return AZStd::move(initialActors);
     }
 
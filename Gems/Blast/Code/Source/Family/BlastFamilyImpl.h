@@ -7,8 +7,10 @@
  */
 #pragma once
 
+#include <Actor/ShapePool.h>
 #include <Asset/BlastAsset.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <Blast/BlastActor.h>
 #include <Blast/BlastDebug.h>
@@ -40,6 +42,11 @@ namespace Blast
         void HandleEvents(const Nv::Blast::TkEvent* events, uint32_t eventCount) override;
         void DestroyActor(BlastActor* blastActor) override;
 
+        uint32_t CreatePendingActors(uint32_t maxActorCount) override;
+        uint32_t GetPendingActorCount() const override;
+        void EnumeratePendingActors(
+            const AZStd::function<void(const BlastActor& splitActor, Nv::Blast::TkActor& tkActor)>& callback) const override;
+
         ActorTracker& GetActorTracker() override;
         const Nv::Blast::TkFamily* GetTkFamily() const override;
         Nv::Blast::TkFamily* GetTkFamily() override;
@@ -52,26 +59,42 @@ namespace Blast
         void receive(const Nv::Blast::TkEvent* events, uint32_t eventCount) override;
 
     private:
-        void CreateActors(const AZStd::vector<BlastActorDesc>& tkActors);
+        //! Children of a split actor waiting to be created.
+        struct PendingSplit
+        {
+            BlastActor* m_splitActor = nullptr; //!< Not tracked anymore, destroyed once the last child is created.
+            AZStd::vector<BlastActorDesc> m_childDescs;
+        };
+
+        void CreateActors(AZStd::vector<BlastActorDesc>& actorDescs);
+        void CreateActor(BlastActorDesc& actorDesc);
+        void CreateSplitChildren(PendingSplit& pendingSplit);
+        // Creates the first children of a split, the split actor stands in for the rest of them.
+        void CreateSplitChildren(PendingSplit& pendingSplit, uint32_t childCount);
         void DestroyActors(const AZStd::unordered_set<BlastActor*>& actors);
+        void DestroySplitActor(BlastActor* splitActor);
 
         void DispatchActorCreated(const BlastActor& actor);
         void DispatchActorDestroyed(const BlastActor& actor);
+        void DispatchActorChunksChanged(const BlastActor& actor, const AZStd::vector<uint32_t>& previousChunkIndices);
 
         AZStd::vector<BlastActorDesc> CalculateInitialActors(const AZ::Transform& transform);
 
-        void HandleSplitEvent(
-            const Nv::Blast::TkSplitEvent* splitEvent, AZStd::vector<BlastActorDesc>& newActors,
-            AZStd::unordered_set<BlastActor*>& actorsToDelete);
+        void HandleSplitEvent(const Nv::Blast::TkSplitEvent* splitEvent);
+
+        // Finds the pending split with a child of the given TkActor index.
+        PendingSplit* FindPendingSplit(uint32_t tkActorIndex, size_t& childIndex);
 
-        // Calculates actor description for an actor that has a parent.
-        BlastActorDesc CalculateActorDesc(
-            AzPhysics::SimulatedBody* parentBody, bool parentStatic, AZ::Transform parentTransform,
-            Nv::Blast::TkActor* tkActor);
+        // Sets the pose and velocities of an actor description from the current state of its parent.
+        void ApplyParentState(
+            BlastActorDesc& actorDesc, const AzPhysics::SimulatedBody* parentBody, bool parentStatic) const;
 
         // Calculates actor description for an actor that does not have a parent.
         BlastActorDesc CalculateActorDesc(const AZ::Transform& transform, Nv::Blast::TkActor* tkActor);
 
+        // Calculates the chunks of the actor descriptions, on the job system when there are many of them.
+        void CalculateActorChunks(AZStd::vector<BlastActorDesc>& actorDescs) const;
+
         void FillDebugRenderHealthGraph(
             DebugRenderBuffer& debugRenderBuffer, DebugRenderMode mode, Nv::Blast::TkActor& actor);
         void FillDebugRenderAccelerator(DebugRenderBuffer& debugRenderBuffer, DebugRenderMode mode);
@@ -79,6 +102,9 @@ namespace Blast
 
         const BlastAsset& m_asset;
         ActorTracker m_actorTracker;
+        ShapePool m_shapePool;
+        AZStd::deque<PendingSplit> m_pendingSplits; //!< Splits waiting for their children to be created, oldest first.
+        uint32_t m_pendingActorCount = 0;
         physx::unique_ptr<Nv::Blast::TkFamily> m_tkFamily;
         AZStd::shared_ptr<BlastActorFactory> m_actorFactory;
         AZStd::shared_ptr<EntityProvider> m_entityProvider;
@@ -113,6 +113,22 @@ namespace Blast
             actorRenderManager->SyncMeshes();
         }
 
+        // ActorRenderManager::OnActorChunksChanged
+        {
+            EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_)).Times(1).WillOnce(Return(true));
+            EXPECT_CALL(
+                *m_mockMeshFeatureProcessor, AcquireMesh(_, testing::A<const AZ::Render::MaterialAssignmentMap&>()))
+                .Times(0);
+
+            const AZStd::vector<uint32_t> previousChunkIndices = m_actorFactory->m_mockActors[0]->m_chunkIndices;
+            m_actorFactory->m_mockActors[0]->m_chunkIndices = {1};
+            actorRenderManager->OnActorChunksChanged(*m_actorFactory->m_mockActors[0], previousChunkIndices);
+            EXPECT_EQ(actorRenderManager->m_chunkActors[0], nullptr);
+            EXPECT_EQ(
+                actorRenderManager->m_chunkActors[1], static_cast<BlastActor*>(m_actorFactory->m_mockActors[0]));
+            testing::Mock::VerifyAndClearExpectations(m_mockMeshFeatureProcessor.get());
+        }
+
         // ActorRenderManager::OnActorDestroyed
         {
             EXPECT_CALL(*m_mockMeshFeatureProcessor, ReleaseMesh(_))
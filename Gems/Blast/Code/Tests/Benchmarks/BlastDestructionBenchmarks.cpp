@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Mocks/BlastMocks.h>
+
+#include <NvBlastTkEvent.h>
+
+namespace Blast::Benchmarks
+{
+    using testing::_;
+    using testing::NiceMock;
+    using testing::Return;
+    using testing::ReturnRef;
+
+    //! Everything needed to spawn a family and split its initial actor into children actors, faking the physics.
+    struct Destruction
+    {
+        AZ_CLASS_ALLOCATOR(Destruction, AZ::SystemAllocator, 0);
+
+        explicit Destruction(uint32_t numChildren)
+            : m_actorFactory(AZStd::make_shared<NiceMock<FakeActorFactory>>(numChildren + 1))
+            , m_entityProvider(EntityProvider::Create())
+            , m_pxAsset(NvBlastActorDesc{1, nullptr, 1, nullptr})
+            , m_asset(&m_pxAsset)
+            , m_blastMaterial(BlastMaterialConfiguration())
+        {
+            for (uint32_t i = 1; i <= numChildren; ++i)
+            {
+                m_children.push_back(m_actorFactory->m_mockActors[i]->m_tkActor.get());
+            }
+
+            Nv::Blast::TkActor* initialTkActor = m_actorFactory->m_mockActors[0]->m_tkActor.get();
+            ON_CALL(m_pxAsset, getTkAsset()).WillByDefault(ReturnRef(m_tkAsset));
+            ON_CALL(m_tkFramework, createActor(_)).WillByDefault(Return(initialTkActor));
+            ON_CALL(*m_actorFactory->m_mockActors[0]->m_tkActor, getFamily()).WillByDefault(ReturnRef(m_tkFamily));
+            ON_CALL(m_tkFamily, getActorCount()).WillByDefault(Return(1));
+            ON_CALL(m_tkFamily, getActors(_, _, _))
+                .WillByDefault(testing::Invoke(
+                    [initialTkActor](auto buffer, auto actorCount, auto indexStart)
+                    {
+                        buffer[indexStart] = initialTkActor;
+                        return actorCount;
+                    }));
+            ON_CALL(*m_actorFactory, CalculateComponents(_)).WillByDefault(Return(AZStd::vector<AZ::Uuid>()));
+        }
+
+        void Spawn(NiceMock<MockBlastSystemBusHandler>& systemHandler)
+        {
+            ON_CALL(systemHandler, GetTkFramework()).WillByDefault(Return(&m_tkFramework));
+
+            BlastFamilyDesc familyDesc
+                {m_asset,
+                 &m_listener,
+                 nullptr,
+                 Physics::MaterialId(),
+                 m_blastMaterial,
+                 m_actorFactory,
+                 m_entityProvider,
+                 m_actorConfiguration};
+            m_family = BlastFamily::Create(familyDesc);
+            m_family->Spawn(AZ::Transform::CreateIdentity());
+        }
+
+        void Split()
+        {
+            Nv::Blast::TkSplitEvent splitEvent;
+            splitEvent.children = m_children.data();
+            splitEvent.numChildren = aznumeric_cast<uint32_t>(m_children.size());
+            splitEvent.parentData = {&m_tkFamily, reinterpret_cast<void*>(m_actorFactory->m_mockActors[0]), 0};
+
+            Nv::Blast::TkEvent tkEvent;
+            tkEvent.type = Nv::Blast::TkEvent::Split;
+            tkEvent.payload = reinterpret_cast<void*>(&splitEvent);
+
+            m_family->HandleEvents(&tkEvent, 1);
+        }
+
+        AZStd::shared_ptr<NiceMock<FakeActorFactory>> m_actorFactory;
+        AZStd::shared_ptr<EntityProvider> m_entityProvider;
+        NiceMock<FakeExtPxAsset> m_pxAsset;
+        BlastAsset m_asset;
+        BlastMaterial m_blastMaterial;
+        NiceMock<MockTkFramework> m_tkFramework;
+        NiceMock<MockTkFamily> m_tkFamily;
+        NiceMock<MockTkAsset> m_tkAsset;
+        NiceMock<MockBlastListener> m_listener;
+        BlastActorConfiguration m_actorConfiguration;
+        AZStd::vector<Nv::Blast::TkActor*> m_children;
+        AZStd::unique_ptr<BlastFamily> m_family;
+    };
+
+    //! Splits a destructible object into state.range(0) actors and creates them, the way BlastSystemComponent does
+    //! on tick, at most state.range(1) of them per frame (0 means no limit). Reports the worst frame, which is what
+    //! shows as a hitch, next to the average time of a whole destruction. The actor factory is faked, so the times only cover the family's own work: handling the split,
+    //! calculating the chunks of the children and creating their entities. Creating the rigid bodies and shapes is
+    //! not measured, so the times are no measure of the hitch a destruction causes in a level.
+    class BlastDestructionBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (AZ::u32 i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobManagerDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            m_systemHandler = AZStd::make_unique<NiceMock<MockBlastSystemBusHandler>>();
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_systemHandler.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::unique_ptr<NiceMock<MockBlastSystemBusHandler>> m_systemHandler;
+    };
+
+    BENCHMARK_DEFINE_F(BlastDestructionBenchmarkFixture, BM_BlastDestruction)(benchmark::State& state)
+    {
+        using FrameDuration = AZStd::chrono::duration<double, AZStd::chrono::milliseconds::period>;
+
+        const uint32_t numChildren = aznumeric_cast<uint32_t>(state.range(0));
+        const uint32_t actorsPerFrame = state.range(1) > 0
+            ? aznumeric_cast<uint32_t>(state.range(1))
+            : AZStd::numeric_limits<uint32_t>::max();
+
+        double worstFrameMs = 0.0;
+        size_t numFrames = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            auto destruction = AZStd::make_unique<Destruction>(numChildren);
+            destruction->Spawn(*m_systemHandler);
+            state.ResumeTiming();
+
+            bool split = false;
+            do
+            {
+                const auto frameStart = AZStd::chrono::system_clock::now();
+                if (!split)
+                {
+                    destruction->Split();
+                    split = true;
+                }
+                destruction->m_family->CreatePendingActors(actorsPerFrame);
+                const auto frameEnd = AZStd::chrono::system_clock::now();
+
+                worstFrameMs = AZStd::max(worstFrameMs, FrameDuration(frameEnd - frameStart).count());
+                ++numFrames;
+            } while (destruction->m_family->GetPendingActorCount() > 0);
+
+            state.PauseTiming();
+            destruction.reset();
+            state.ResumeTiming();
+        }
+
+        state.counters["WorstFrameMs"] = worstFrameMs;
+        state.counters["FramesPerDestruction"] =
+            benchmark::Counter(aznumeric_cast<double>(numFrames), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(BlastDestructionBenchmarkFixture, BM_BlastDestruction)
+        ->Args({ 256, 0 })
+        ->Args({ 256, 16 })
+        ->Args({ 256, 64 })
+        ->Args({ 1024, 0 })
+        ->Args({ 1024, 16 })
+        ->Args({ 1024, 64 })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+} // namespace Blast::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -9,6 +9,7 @@
 #include <gmock/gmock.h>
 
 #include <Actor/BlastActorImpl.h>
+#include <Actor/ShapePool.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <Mocks/BlastMocks.h>
 #include <NvBlastExtPxAsset.h>
@@ -105,4 +106,54 @@ namespace Blast
 
         m_blastActor.reset(aznew TestableBlastActor(actorDesc));
     }
+
+    TEST_F(BlastActorTest, ReusesPooledShapes_GivenSameChunks_SUITE_sandbox)
+    {
+        // Initialize mock asset
+        Nv::Blast::ExtPxChunk chunk{0, 1, false};
+        Nv::Blast::ExtPxSubchunk subchunk{
+            physx::PxTransform(0, 0, 0),
+            physx::PxConvexMeshGeometry(nullptr),
+        };
+        m_mockFamily->m_pxAsset.m_chunks.push_back(chunk);
+        m_mockFamily->m_pxAsset.m_subchunks.push_back(subchunk);
+
+        ShapePool shapePool;
+        AZStd::shared_ptr<MockShape> mockShape = AZStd::make_shared<MockShape>();
+        auto rigidBody = AZStd::make_unique<FakeRigidBody>();
+
+        // The shape is only created for the first actor, the second one takes it from the pool.
+        EXPECT_CALL(*m_mockPhysicsSystemRequestsHandler, CreateShape(_, _)).Times(1).WillOnce(Return(mockShape));
+        EXPECT_CALL(*m_mockRigidBodyRequestBusHandler, GetRigidBody())
+            .Times(2)
+            .WillRepeatedly(Return(rigidBody.get()));
+
+        for (int i = 0; i < 2; ++i)
+        {
+            AZStd::vector<uint32_t> chunkIndices;
+            chunkIndices.push_back(0);
+
+            AzPhysics::RigidBodyConfiguration configuration;
+            auto entity = AZStd::make_shared<AZ::Entity>();
+            m_mockRigidBodyRequestBusHandler->Connect(entity->GetId());
+            auto actorDesc = BlastActorDesc
+                {m_mockFamily.get(),
+                 m_mockTkActor.get(),
+                 Physics::MaterialId(),
+                 AZ::Vector3::CreateZero(),
+                 AZ::Vector3::CreateZero(),
+                 configuration,
+                 chunkIndices,
+                 entity,
+                 false,
+                 false};
+            actorDesc.m_shapePool = &shapePool;
+
+            m_blastActor.reset(aznew TestableBlastActor(actorDesc));
+            EXPECT_EQ(shapePool.GetShapeCount(), 0u);
+
+            m_blastActor.reset();
+            EXPECT_EQ(shapePool.GetShapeCount(), 1u);
+        }
+    }
 } // namespace Blast
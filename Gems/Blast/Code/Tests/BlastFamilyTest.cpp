@@ -9,6 +9,7 @@
 #include <gmock/gmock.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/SystemBus.h>
@@ -55,6 +56,78 @@ namespace Blast
             m_systemHandler = nullptr;
         }
 
+        //! Replaces the fake actors and entities, for tests which need more than the default number of them.
+        void RecreateFakes(uint32_t actorCount)
+        {
+            m_fakeActorFactory = AZStd::make_shared<FakeActorFactory>(actorCount);
+            m_fakeEntityProvider = AZStd::make_shared<FakeEntityProvider>(actorCount);
+        }
+
+        //! Creates a family and spawns its initial actor, which is the first fake actor.
+        AZStd::unique_ptr<BlastFamily> CreateAndSpawnFamily()
+        {
+            EXPECT_CALL(*m_systemHandler, GetTkFramework()).WillRepeatedly(Return(m_mockTkFramework.get()));
+            EXPECT_CALL(*m_mockPxAsset, getTkAsset()).WillRepeatedly(testing::ReturnRef(*m_mockTkAsset.get()));
+            EXPECT_CALL(*m_mockTkFramework, createActor(_))
+                .Times(1)
+                .WillOnce(Return(&m_fakeActorFactory->m_mockActors[0]->GetTkActor()));
+            EXPECT_CALL(*m_fakeActorFactory->m_mockActors[0]->m_tkActor, getFamily())
+                .WillRepeatedly(ReturnRef(*m_mockTkFamily.get()));
+            EXPECT_CALL(*m_fakeActorFactory, CalculateComponents(_)).WillRepeatedly(Return(AZStd::vector<AZ::Uuid>()));
+            EXPECT_CALL(*m_fakeActorFactory, CalculateVisibleChunks(_, _)).Times(testing::AnyNumber());
+            EXPECT_CALL(*m_fakeActorFactory, CalculateIsStatic(_, _, _)).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_fakeActorFactory, CalculateIsLeafChunk(_, _)).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mockTkFamily, getActorCount()).Times(1).WillOnce(Return(1));
+            EXPECT_CALL(*m_mockTkFamily, getActors(_, _, _))
+                .Times(1)
+                .WillOnce(testing::Invoke(
+                    [this](auto buffer, auto actorCount, auto indexStart)
+                    {
+                        buffer[indexStart] = m_fakeActorFactory->m_mockActors[0]->m_tkActor.get();
+                        return actorCount;
+                    }));
+            EXPECT_CALL(*m_mockTkFamily, addListener(_)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, Ref(*m_fakeActorFactory->m_mockActors[0]))).Times(1);
+
+            BlastFamilyDesc familyDesc
+                {*m_asset,
+                 m_mockListener.get(),
+                 nullptr,
+                 Physics::MaterialId(),
+                 *m_blastMaterial,
+                 m_fakeActorFactory,
+                 m_fakeEntityProvider,
+                 m_actorConfiguration};
+
+            AZStd::unique_ptr<BlastFamily> blastFamily = BlastFamily::Create(familyDesc);
+            blastFamily->Spawn(AZ::Transform::CreateIdentity());
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+            return blastFamily;
+        }
+
+        //! Sends a split event for the actor with the given TkActor index into the fake actors with the given indices.
+        //! @param splitActor The split actor, nullptr for an actor which is not created yet.
+        void SplitActor(
+            BlastFamily& blastFamily, BlastActor* splitActor, uint32_t tkActorIndex,
+            const AZStd::vector<uint32_t>& childIndices)
+        {
+            AZStd::vector<Nv::Blast::TkActor*> children;
+            for (uint32_t childIndex : childIndices)
+            {
+                children.push_back(m_fakeActorFactory->m_mockActors[childIndex]->m_tkActor.get());
+            }
+
+            Nv::Blast::TkSplitEvent splitEvent;
+            splitEvent.children = children.data();
+            splitEvent.numChildren = aznumeric_cast<uint32_t>(children.size());
+            splitEvent.parentData = {m_mockTkFamily.get(), splitActor, tkActorIndex};
+            Nv::Blast::TkEvent tkEvent;
+            tkEvent.type = Nv::Blast::TkEvent::Split;
+            tkEvent.payload = reinterpret_cast<void*>(&splitEvent);
+
+            blastFamily.HandleEvents(&tkEvent, 1);
+        }
+
         AZStd::shared_ptr<FakeActorFactory> m_fakeActorFactory;
         AZStd::shared_ptr<FakeEntityProvider> m_fakeEntityProvider;
         AZStd::unique_ptr<FakeExtPxAsset> m_mockPxAsset;
@@ -66,6 +139,7 @@ namespace Blast
         AZStd::unique_ptr<MockTkFamily> m_mockTkFamily;
         AZStd::unique_ptr<MockTkAsset> m_mockTkAsset;
         AZStd::unique_ptr<MockBlastListener> m_mockListener;
+        BlastActorConfiguration m_actorConfiguration;
     };
 
     TEST_F(BlastFamilyTest, FamilySpawnsAndDespawns_SUITE_sandbox)
@@ -159,6 +233,135 @@ namespace Blast
             EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(2);
 
             blastFamily->HandleEvents(&tkEvent, 1);
+
+            // Actors from splits are created when the budget allows it.
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 2u);
+            EXPECT_EQ(blastFamily->CreatePendingActors(AZStd::numeric_limits<uint32_t>::max()), 2u);
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 0u);
+        }
+
+        // BlastFamily::~BlastFamily
+        {
+            EXPECT_CALL(*m_mockTkFamily, removeListener(_)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(2);
+
+            blastFamily.reset();
+        }
+    }
+
+    TEST_F(BlastFamilyTest, PendingActorsAreCreatedWithinBudget_SUITE_sandbox)
+    {
+        RecreateFakes(7);
+        AZStd::unique_ptr<BlastFamily> blastFamily = CreateAndSpawnFamily();
+
+        // Split the initial actor in two, and both of them in two again
+        {
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(2);
+
+            SplitActor(*blastFamily, m_fakeActorFactory->m_mockActors[0], 0, {1, 2});
+            EXPECT_EQ(blastFamily->CreatePendingActors(AZStd::numeric_limits<uint32_t>::max()), 2u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+        }
+
+        {
+            // Each actor is made of the chunk with its own index.
+            EXPECT_CALL(*m_fakeActorFactory, CalculateVisibleChunks(_, _))
+                .WillRepeatedly(testing::Invoke(
+                    [this]([[maybe_unused]] const BlastFamily& family, const Nv::Blast::TkActor& tkActor)
+                    {
+                        for (uint32_t i = 0; i < m_fakeActorFactory->m_mockActors.size(); ++i)
+                        {
+                            if (m_fakeActorFactory->m_mockActors[i]->m_tkActor.get() == &tkActor)
+                            {
+                                return AZStd::vector<uint32_t>{i};
+                            }
+                        }
+                        return AZStd::vector<uint32_t>{};
+                    }));
+
+            SplitActor(*blastFamily, m_fakeActorFactory->m_mockActors[1], 1, {3, 4});
+            SplitActor(*blastFamily, m_fakeActorFactory->m_mockActors[2], 2, {5, 6});
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 4u);
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 0u);
+
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, Ref(*m_fakeActorFactory->m_mockActors[1]))).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(2);
+            EXPECT_EQ(blastFamily->CreatePendingActors(2), 2u);
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 2u);
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 2u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+
+            // The split actor gives the chunks of its first child away, and stands in for the second one.
+            EXPECT_CALL(*m_mockListener, OnActorChunksChanged(_, Ref(*m_fakeActorFactory->m_mockActors[2]), _)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, Ref(*m_fakeActorFactory->m_mockActors[5]))).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(0);
+            EXPECT_EQ(blastFamily->CreatePendingActors(1), 1u);
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 1u);
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 3u);
+            EXPECT_EQ(m_fakeActorFactory->m_mockActors[2]->m_chunkIndices, AZStd::vector<uint32_t>{6});
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+
+            // It is destroyed when its last child is created.
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, Ref(*m_fakeActorFactory->m_mockActors[2]))).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, Ref(*m_fakeActorFactory->m_mockActors[6]))).Times(1);
+            EXPECT_EQ(blastFamily->CreatePendingActors(1), 1u);
+            EXPECT_EQ(blastFamily->CreatePendingActors(1), 0u);
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 0u);
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 4u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+        }
+
+        // BlastFamily::~BlastFamily
+        {
+            EXPECT_CALL(*m_mockTkFamily, removeListener(_)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(4);
+
+            blastFamily.reset();
+        }
+    }
+
+    TEST_F(BlastFamilyTest, SplitActorStaysUntilChildrenAreCreated_ChildrenStartFromItsCurrentPose_SUITE_sandbox)
+    {
+        AZStd::unique_ptr<BlastFamily> blastFamily = CreateAndSpawnFamily();
+        FakeBlastActor* splitActor = m_fakeActorFactory->m_mockActors[0];
+
+        // The split actor is not tracked anymore, but keeps its body until the children get created.
+        {
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(0);
+
+            SplitActor(*blastFamily, splitActor, 0, {1, 2});
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 0u);
+
+            size_t numPendingActors = 0;
+            blastFamily->EnumeratePendingActors(
+                [splitActor, &numPendingActors](const BlastActor& actor, [[maybe_unused]] Nv::Blast::TkActor& tkActor)
+                {
+                    EXPECT_EQ(&actor, splitActor);
+                    ++numPendingActors;
+                });
+            EXPECT_EQ(numPendingActors, 2u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+        }
+
+        // The split actor moved before its children got created.
+        const AZ::Vector3 position(1.0f, 2.0f, 3.0f);
+        splitActor->GetSimulatedBody()->SetTransform(AZ::Transform::CreateTranslation(position));
+
+        {
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, Ref(*splitActor))).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(2);
+
+            EXPECT_EQ(blastFamily->CreatePendingActors(AZStd::numeric_limits<uint32_t>::max()), 2u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+        }
+
+        // The initial actor and both children.
+        ASSERT_EQ(m_fakeActorFactory->m_createdActorDescs.size(), 3u);
+        for (size_t i = 1; i < m_fakeActorFactory->m_createdActorDescs.size(); ++i)
+        {
+            EXPECT_TRUE(m_fakeActorFactory->m_createdActorDescs[i].m_bodyConfiguration.m_position.IsClose(position));
+            EXPECT_TRUE(m_fakeActorFactory->m_createdActorDescs[i].m_parentCenterOfMass.IsClose(position));
         }
 
         // BlastFamily::~BlastFamily
@@ -169,4 +372,53 @@ namespace Blast
             blastFamily.reset();
         }
     }
+
+    TEST_F(BlastFamilyTest, PendingActorSplitsAgain_ItsChildrenTakeItsPlace_SUITE_sandbox)
+    {
+        RecreateFakes(5);
+        AZStd::unique_ptr<BlastFamily> blastFamily = CreateAndSpawnFamily();
+
+        const uint32_t pendingTkActorIndex = 7;
+        EXPECT_CALL(*m_fakeActorFactory->m_mockActors[1]->m_tkActor, getIndex())
+            .WillRepeatedly(Return(pendingTkActorIndex));
+        EXPECT_CALL(*m_fakeActorFactory->m_mockActors[2]->m_tkActor, getIndex())
+            .WillRepeatedly(Return(pendingTkActorIndex + 1));
+
+        {
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, Ref(*m_fakeActorFactory->m_mockActors[0]))).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(3);
+
+            SplitActor(*blastFamily, m_fakeActorFactory->m_mockActors[0], 0, {1, 2});
+            // The first child has no BlastActor yet, which is why there's no user data.
+            SplitActor(*blastFamily, nullptr, pendingTkActorIndex, {3, 4});
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 3u);
+
+            EXPECT_EQ(blastFamily->CreatePendingActors(AZStd::numeric_limits<uint32_t>::max()), 3u);
+            EXPECT_EQ(blastFamily->GetPendingActorCount(), 0u);
+            EXPECT_EQ(blastFamily->GetActorTracker().GetActors().size(), 3u);
+            testing::Mock::VerifyAndClearExpectations(m_mockListener.get());
+        }
+
+        // BlastFamily::~BlastFamily
+        {
+            EXPECT_CALL(*m_mockTkFamily, removeListener(_)).Times(1);
+            EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, _)).Times(3);
+
+            blastFamily.reset();
+        }
+    }
+
+    TEST_F(BlastFamilyTest, DespawnWithPendingActors_SplitActorIsDestroyed_SUITE_sandbox)
+    {
+        AZStd::unique_ptr<BlastFamily> blastFamily = CreateAndSpawnFamily();
+
+        SplitActor(*blastFamily, m_fakeActorFactory->m_mockActors[0], 0, {1, 2});
+
+        EXPECT_CALL(*m_mockTkFamily, removeListener(_)).Times(1);
+        EXPECT_CALL(*m_mockListener, OnActorCreated(_, _)).Times(0);
+        EXPECT_CALL(*m_mockListener, OnActorDestroyed(_, Ref(*m_fakeActorFactory->m_mockActors[0]))).Times(1);
+
+        blastFamily->Despawn();
+        EXPECT_EQ(blastFamily->GetPendingActorCount(), 0u);
+    }
 } // namespace Blast
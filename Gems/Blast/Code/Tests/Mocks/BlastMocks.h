@@ -244,6 +244,7 @@ namespace Blast
     public:
         MOCK_METHOD2(OnActorCreated, void(const BlastFamily&, const BlastActor&));
         MOCK_METHOD2(OnActorDestroyed, void(const BlastFamily&, const BlastActor&));
+        MOCK_METHOD3(OnActorChunksChanged, void(const BlastFamily&, const BlastActor&, const AZStd::vector<uint32_t>&));
     };
 
     class FakeBlastActor : public BlastActor
@@ -546,14 +547,21 @@ namespace Blast
             m_mockActors.clear();
         }
 
-        BlastActor* CreateActor([[maybe_unused]] const BlastActorDesc& desc) override
+        BlastActor* CreateActor(const BlastActorDesc& desc) override
         {
+            m_createdActorDescs.push_back(desc);
             return m_mockActors[m_index++];
         }
 
         void DestroyActor([[maybe_unused]] BlastActor* actor) override {}
 
+        void ReplaceChunks(BlastActor& actor, const AZStd::vector<uint32_t>& chunkIndices) override
+        {
+            static_cast<FakeBlastActor&>(actor).m_chunkIndices = chunkIndices;
+        }
+
         std::vector<FakeBlastActor*> m_mockActors;
+        AZStd::vector<BlastActorDesc> m_createdActorDescs;
         int m_index;
     };
 
@@ -733,6 +741,11 @@ namespace Blast
         MOCK_METHOD1(RegisterListener, void(BlastListener&));
         MOCK_METHOD1(UnregisterListener, void(BlastListener&));
         MOCK_METHOD1(DestroyActor, void(BlastActor*));
+        MOCK_METHOD1(CreatePendingActors, uint32_t(uint32_t));
+        MOCK_CONST_METHOD0(GetPendingActorCount, uint32_t());
+        MOCK_CONST_METHOD1(
+            EnumeratePendingActors,
+            void(const AZStd::function<void(const BlastActor& splitActor, Nv::Blast::TkActor& tkActor)>&));
         MOCK_METHOD0(GetActorTracker, ActorTracker&());
         MOCK_METHOD3(FillDebugRender, void(DebugRenderBuffer&, DebugRenderMode, float));
 
@@ -16,6 +16,7 @@
 #include "ActorManager.h"
 #include "ActorUpdateScheduler.h"
 #include "AnimGraphInstance.h"
+#include "AnimGraphManager.h"
 #include "Attachment.h"
 #include "AttachmentNode.h"
 #include "AttachmentSkin.h"
@@ -184,6 +185,11 @@ namespace EMotionFX
                 attachmentActorInstance->SetSelfAttachment(nullptr);
                 attachmentActorInstance->DecreaseNumAttachmentRefs();
                 GetActorManager().UpdateActorInstanceStatus(attachmentActorInstance);
+
+                attachmentActorInstance->SetParentWorldSpaceTransform(Transform::CreateIdentity());
+
+                // the former attachment got updated through us, so it has to be scheduled as a root from now on
+                GetActorManager().GetScheduler()->RecursiveInsertActorInstance(attachmentActorInstance);
             }
             mAttachments[i]->Destroy();
         }
@@ -214,6 +220,15 @@ namespace EMotionFX
         return aznew ActorInstance(actor, entity, threadIndex);
     }
 
+    void ActorInstance::Delete()
+    {
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+        if (!scheduler || !scheduler->DeferDeleteActorInstance(this))
+        {
+            BaseObject::Delete();
+        }
+    }
+
     // update the transformation data
     void ActorInstance::UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions)
     {
@@ -267,6 +282,12 @@ namespace EMotionFX
             return;
         } // if the recorder is in playback mode and we recorded this actor instance
 
+        // remember the pose we displayed so far, as we want to interpolate from it towards the newly sampled pose
+        if (GetPoseInterpolationEnabled() && updateJointTransforms && sampleMotions)
+        {
+            m_poseInterpolation->m_fromPose = *mTransformData->GetCurrentPose();
+        }
+
         // check if we are an attachment
         Attachment* attachment = GetSelfAttachment();
 
@@ -280,7 +301,15 @@ namespace EMotionFX
                 UpdateWorldTransform();
                 if (updateJointTransforms && sampleMotions)
                 {
-                    mAnimGraphInstance->Output(mTransformData->GetCurrentPose());
+                    // the ragdoll feeds back into the pose, so instances with a ragdoll can't share their output
+                    if (mAnimGraphInstance->GetSharedEvaluationEnabled() && !m_ragdollInstance)
+                    {
+                        GetAnimGraphManager().GetSharedEvaluation().Output(mAnimGraphInstance, mTransformData->GetCurrentPose());
+                    }
+                    else
+                    {
+                        mAnimGraphInstance->Output(mTransformData->GetCurrentPose());
+                    }
 
                     if (m_ragdollInstance)
                     {
@@ -308,6 +337,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (GetPoseInterpolationEnabled())
+            {
+                ApplyPoseInterpolation(timePassedInSeconds, sampleMotions);
+            }
+
             mTransformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
@@ -346,6 +380,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (GetPoseInterpolationEnabled())
+            {
+                ApplyPoseInterpolation(timePassedInSeconds, sampleMotions);
+            }
+
             mSelfAttachment->UpdateJointTransforms(*mTransformData->GetCurrentPose());
             mTransformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
@@ -1937,6 +1976,68 @@ namespace EMotionFX
         return mMotionSamplingRate;
     }
 
+    void ActorInstance::SetPoseInterpolationEnabled(bool enabled)
+    {
+        if (enabled == GetPoseInterpolationEnabled())
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            // the poses are kept when disabling, so that actor instances moving between update-rate LOD bands don't reallocate them
+            const Pose* currentPose = mTransformData->GetCurrentPose();
+            if (!m_poseInterpolation)
+            {
+                m_poseInterpolation = AZStd::make_unique<PoseInterpolationData>();
+                m_poseInterpolation->m_fromPose.LinkToActorInstance(this);
+                m_poseInterpolation->m_toPose.LinkToActorInstance(this);
+            }
+            m_poseInterpolation->m_fromPose.InitFromPose(currentPose);
+            m_poseInterpolation->m_toPose.InitFromPose(currentPose);
+            m_poseInterpolation->m_timeSinceSample = 0.0f;
+            m_poseInterpolation->m_interpolationTime = 0.0f;
+            m_poseInterpolation->m_interpolationDuration = 0.0f;
+        }
+
+        m_poseInterpolation->m_enabled = enabled;
+    }
+
+    bool ActorInstance::GetPoseInterpolationEnabled() const
+    {
+        return m_poseInterpolation && m_poseInterpolation->m_enabled;
+    }
+
+    void ActorInstance::ApplyPoseInterpolation(float timePassedInSeconds, bool sampledMotions)
+    {
+        PoseInterpolationData& interpolation = *m_poseInterpolation;
+        Pose* currentPose = mTransformData->GetCurrentPose();
+
+        interpolation.m_timeSinceSample += timePassedInSeconds;
+        if (sampledMotions)
+        {
+            // interpolate towards the new sample over the same amount of time that passed between the last two samples
+            interpolation.m_toPose = *currentPose;
+            interpolation.m_interpolationDuration = interpolation.m_timeSinceSample;
+            interpolation.m_interpolationTime = timePassedInSeconds;
+            interpolation.m_timeSinceSample = 0.0f;
+        }
+        else
+        {
+            interpolation.m_interpolationTime += timePassedInSeconds;
+        }
+
+        float weight = 1.0f;
+        if (interpolation.m_interpolationDuration > AZ::Constants::FloatEpsilon)
+        {
+            weight = AZ::GetMin(interpolation.m_interpolationTime / interpolation.m_interpolationDuration, 1.0f);
+        }
+
+        *currentPose = interpolation.m_fromPose;
+        currentPose->Blend(&interpolation.m_toPose, weight);
+        currentPose->InvalidateAllModelSpaceTransforms();
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         mNumAttachmentRefs += numToIncreaseWith;
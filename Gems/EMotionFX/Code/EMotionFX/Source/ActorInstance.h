@@ -68,6 +68,12 @@ namespace EMotionFX
 
         static ActorInstance* Create(Actor* actor, AZ::Entity* entity = nullptr, uint32 threadIndex = 0);
 
+        /**
+         * Delete the actor instance from memory, which Destroy does once the last reference got released.
+         * An actor instance destroyed while the scheduler executes is deleted by the scheduler once the execute finished.
+         */
+        void Delete() override;
+
         /**
          * Get a pointer to the actor from which this is an instance.
          * @result A pointer to the actor from which this is an instance.
@@ -879,6 +885,16 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Enable or disable pose interpolation between motion samples.
+         * When enabled, frames in which motions are not sampled (see SetMotionSamplingRate() and the update-rate LOD of the ActorUpdateScheduler)
+         * interpolate between the last two sampled poses, instead of keeping the last sampled pose. This introduces a latency of one sample interval.
+         * Enabling this the first time allocates two additional poses, which are kept and reused when it gets disabled and enabled again.
+         * @param enabled True to enable pose interpolation, false to disable it.
+         */
+        void SetPoseInterpolationEnabled(bool enabled);
+        bool GetPoseInterpolationEnabled() const;
+
         MCORE_INLINE uint32 GetNumNodes() const         { return mActor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -886,6 +902,19 @@ namespace EMotionFX
         void SetVisualizeScale(float factor);
 
     private:
+        /**
+         * The data used to interpolate poses between motion samples.
+         */
+        struct PoseInterpolationData
+        {
+            Pose    m_fromPose;                     /**< The pose we displayed at the moment the last sample got taken. */
+            Pose    m_toPose;                       /**< The last sampled pose. */
+            float   m_timeSinceSample = 0.0f;       /**< The time passed since the last sample. */
+            float   m_interpolationTime = 0.0f;     /**< The time passed since we started interpolating towards the last sampled pose. */
+            float   m_interpolationDuration = 0.0f; /**< The time it takes to interpolate towards the last sampled pose, which equals the last sample interval. */
+            bool    m_enabled = false;              /**< False while pose interpolation is disabled, in which case the poses are only kept for reuse. */
+        };
+
         TransformData*          mTransformData;         /**< The transformation data for this instance. */
         MCore::AABB             mAABB;                  /**< The axis aligned bounding box. */
         MCore::AABB             mStaticAABB;            /**< A static pre-calculated bounding box, which we can move along with the position of the actor instance, and use for visibility checks. */
@@ -907,6 +936,7 @@ namespace EMotionFX
         MotionSystem*           mMotionSystem;          /**< The motion system, that handles all motion playback and blending etc. */
         AnimGraphInstance*      mAnimGraphInstance;     /**< A pointer to the anim graph instance, which can be nullptr when there is no anim graph instance. */
         AZStd::unique_ptr<RagdollInstance> m_ragdollInstance;
+        AZStd::unique_ptr<PoseInterpolationData> m_poseInterpolation; /**< The pose interpolation data, or nullptr in case pose interpolation never got enabled. */
         MCore::Mutex            mLock;                  /**< The multithread lock. */
         void*                   mCustomData;            /**< A pointer to custom data for this actor. This could be a pointer to your engine or game object for example. */
         AZ::Entity*             m_entity;               /**< The entity to which the actor instance belongs to. */
@@ -1033,5 +1063,13 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /*
+         * Interpolate the current pose between the last two sampled poses.
+         * This function should only be called from within UpdateTransformations() after the motions got sampled (or not) and only when pose interpolation is enabled.
+         * @param timePassedInSeconds The time passed, in seconds, since the last update.
+         * @param sampledMotions True in case the current pose got sampled in this update.
+         */
+        void ApplyPoseInterpolation(float timePassedInSeconds, bool sampledMotions);
     };
 }   // namespace EMotionFX
@@ -15,6 +15,7 @@
 #include <MCore/Source/StringConversions.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/AnimGraphManager.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 
 namespace EMotionFX
@@ -313,10 +314,19 @@ namespace EMotionFX
         LockActors();
         LockActorInstances();
 
+        // poses can only be shared between anim graph instances within the same frame
+        GetAnimGraphManager().GetSharedEvaluation().BeginFrame();
+
+        // the simulated object nodes that solve in the batch stage register their chains while the scheduler executes
+        m_simulatedObjectSolverStage.BeginFrame();
+
         // execute the schedule
         // this makes all the callback OnUpdate calls etc
         mScheduler->Execute(timePassedInSeconds);
 
+        // solve the simulated object chains of all actor instances at once, before the mesh deformers run
+        m_simulatedObjectSolverStage.Execute();
+
         UnlockActorInstances();
         UnlockActors();
     }
@@ -381,6 +391,7 @@ namespace EMotionFX
 
         // remove it from the schedule
         mScheduler->RemoveActorInstance(instance);
+        m_simulatedObjectSolverStage.RemoveActorInstance(instance);
 
         UnlockActorInstances();
     }
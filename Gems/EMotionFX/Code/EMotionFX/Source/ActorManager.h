@@ -15,6 +15,7 @@
 #include "MemoryCategories.h"
 #include <MCore/Source/MultiThreadManager.h>
 #include <MCore/Source/Array.h>
+#include <EMotionFX/Source/SimulatedObjectSolverStage.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 
 
@@ -230,6 +231,12 @@ namespace EMotionFX
          */
         void SetScheduler(ActorUpdateScheduler* scheduler, bool delExisting = true);
 
+        /**
+         * Get the simulated object solver stage, which solves the simulated object chains of all actor instances after the scheduler executed.
+         * @result The simulated object solver stage.
+         */
+        MCORE_INLINE SimulatedObjectSolverStage& GetSimulatedObjectSolverStage()  { return m_simulatedObjectSolverStage; }
+
         /**
          * Update the actor instance status for a given actor instance.
          * This checks if the actor instance is still a root actor instance or not and it makes sure that it is
@@ -259,6 +266,7 @@ namespace EMotionFX
         AZStd::vector<AZStd::shared_ptr<Actor>> m_actors;       /**< The registered actors. */
         MCore::Array<ActorInstance*>    mRootActorInstances;    /**< Root actor instances (roots of all attachment chains). */
         ActorUpdateScheduler*           mScheduler;             /**< The update scheduler to use. */
+        SimulatedObjectSolverStage      m_simulatedObjectSolverStage; /**< Solves the deferred simulated object chains of all actor instances. */
         MCore::MutexRecursive           mActorLock;             /**< The multithread lock for touching the actors array. */
         MCore::MutexRecursive           mActorInstanceLock;     /**< The multithread lock for touching the actor instances array. */
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorInstance.h"
+#include <MCore/Source/FastMath.h>
+
+
+namespace EMotionFX
+{
+    void ActorUpdateScheduler::SetUpdateRateLodSettings(const UpdateRateLodSettings& settings)
+    {
+        AZ_Warning("EMotionFX", settings.m_bands.size() <= s_maxUpdateRateLodBands,
+            "Only %d update-rate LOD bands are supported, ignoring the remaining %d bands.",
+            s_maxUpdateRateLodBands, static_cast<int>(settings.m_bands.size()) - static_cast<int>(s_maxUpdateRateLodBands));
+
+        m_updateRateLodSettings = settings;
+        if (m_updateRateLodSettings.m_bands.size() > s_maxUpdateRateLodBands)
+        {
+            m_updateRateLodSettings.m_bands.resize(s_maxUpdateRateLodBands);
+        }
+
+        for (UpdateRateLodBand& band : m_updateRateLodSettings.m_bands)
+        {
+            band.m_updateInterval = AZStd::max<uint32>(band.m_updateInterval, 1);
+        }
+    }
+
+
+    // calculate the band index for a given actor instance
+    uint32 ActorUpdateScheduler::CalcUpdateRateLodBand(const ActorInstance* actorInstance) const
+    {
+        const size_t numBands = m_updateRateLodSettings.m_bands.size();
+        if (!m_updateRateLodSettings.m_enabled || numBands == 0)
+        {
+            return 0;
+        }
+
+        // attachments follow their root, so that they stay in sync with the actor instance they are attached to
+        const ActorInstance* rootActorInstance = actorInstance;
+        while (rootActorInstance->GetAttachedTo())
+        {
+            rootActorInstance = rootActorInstance->GetAttachedTo();
+        }
+
+        const float distance = rootActorInstance->GetWorldSpaceTransform().mPosition.GetDistance(m_updateRateLodReferencePoint);
+        if (m_updateRateLodSettings.m_metric == UpdateRateLodMetric::Distance)
+        {
+            for (size_t i = 0; i < numBands; ++i)
+            {
+                if (distance <= m_updateRateLodSettings.m_bands[i].m_threshold)
+                {
+                    return static_cast<uint32>(i);
+                }
+            }
+        }
+        else
+        {
+            // the projected radius of the bounds, relative to half of the vertical screen size
+            const float radius = rootActorInstance->GetAABB().CalcRadius();
+            const float halfScreenHeight = AZStd::max(distance, AZ::Constants::FloatEpsilon) * MCore::Math::Tan(m_updateRateLodSettings.m_verticalFov * 0.5f);
+            const float screenSize = radius / AZStd::max(halfScreenHeight, AZ::Constants::FloatEpsilon);
+            for (size_t i = 0; i < numBands; ++i)
+            {
+                if (screenSize >= m_updateRateLodSettings.m_bands[i].m_threshold)
+                {
+                    return static_cast<uint32>(i);
+                }
+            }
+        }
+
+        return static_cast<uint32>(numBands - 1);
+    }
+
+
+    uint32 ActorUpdateScheduler::GetNumUpdateRateLodBandActorInstances(uint32 bandIndex) const
+    {
+        if (bandIndex >= s_maxUpdateRateLodBands)
+        {
+            AZ_Assert(false, "Update-rate LOD band index %d is out of range, only %d bands are supported.", bandIndex, s_maxUpdateRateLodBands);
+            return 0;
+        }
+
+        return m_numUpdateRateLodBand[bandIndex].GetValue();
+    }
+
+
+    void ActorUpdateScheduler::BeginFrame()
+    {
+        mNumUpdated.SetValue(0);
+        mNumVisible.SetValue(0);
+        mNumSampled.SetValue(0);
+        m_numUpdateRateLodSkipped.SetValue(0);
+        for (MCore::AtomicUInt32& numInBand : m_numUpdateRateLodBand)
+        {
+            numInBand.SetValue(0);
+        }
+
+        m_frameNumber++;
+    }
+
+
+    bool ActorUpdateScheduler::CheckShouldSampleMotions(ActorInstance* actorInstance, float timePassedInSeconds, bool isVisible)
+    {
+        // check if the update-rate LOD allows us to sample in this frame
+        bool lodAllowsSampling = true;
+        if (m_updateRateLodSettings.m_enabled && !m_updateRateLodSettings.m_bands.empty())
+        {
+            const uint32 band = CalcUpdateRateLodBand(actorInstance);
+            const uint32 updateInterval = m_updateRateLodSettings.m_bands[band].m_updateInterval;
+            m_numUpdateRateLodBand[band].Increment();
+
+            if (updateInterval > 1)
+            {
+                // stagger the updates across frames, using the root id so that attachments sample together with their parents
+                const ActorInstance* rootActorInstance = actorInstance;
+                while (rootActorInstance->GetAttachedTo())
+                {
+                    rootActorInstance = rootActorInstance->GetAttachedTo();
+                }
+
+                lodAllowsSampling = ((m_frameNumber + rootActorInstance->GetID()) % updateInterval) == 0;
+                if (!lodAllowsSampling)
+                {
+                    m_numUpdateRateLodSkipped.Increment();
+                }
+            }
+
+            actorInstance->SetPoseInterpolationEnabled(m_updateRateLodSettings.m_interpolatePoses && updateInterval > 1);
+        }
+        else if (actorInstance->GetPoseInterpolationEnabled())
+        {
+            actorInstance->SetPoseInterpolationEnabled(false);
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (lodAllowsSampling && actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                mNumSampled.Increment();
+            }
+        }
+
+        return sampleMotions;
+    }
+}   // namespace EMotionFX
@@ -11,6 +11,9 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <MCore/Source/MultiThreadManager.h>
 
 
 namespace EMotionFX
@@ -28,6 +31,40 @@ namespace EMotionFX
         : public BaseObject
     {
     public:
+        /**
+         * The metric used to sort actor instances into update-rate LOD bands.
+         */
+        enum class UpdateRateLodMetric : AZ::u8
+        {
+            Distance,       /**< Use the distance between the root actor instance and the reference point. */
+            ScreenSize      /**< Use the projected size of the root actor instance bounds, relative to the vertical screen size. */
+        };
+
+        /**
+         * An update-rate LOD band.
+         * Actor instances falling into a band only sample their motions or anim graphs every given number of frames.
+         */
+        struct EMFX_API UpdateRateLodBand
+        {
+            float   m_threshold = 0.0f;         /**< The maximum distance (Distance metric) or the minimum screen size (ScreenSize metric) for an actor instance to fall into this band. */
+            uint32  m_updateInterval = 1;       /**< Sample every N frames. A value of 1 means every frame. */
+        };
+
+        /**
+         * The update-rate LOD settings.
+         * Bands are expected to be sorted from the most detailed to the least detailed one. Actor instances that do not fall into any band will use the last one.
+         */
+        struct EMFX_API UpdateRateLodSettings
+        {
+            AZStd::vector<UpdateRateLodBand>    m_bands;
+            UpdateRateLodMetric                 m_metric = UpdateRateLodMetric::Distance;
+            float                               m_verticalFov = 1.0472f;    /**< The vertical field of view in radians, used by the screen size metric. */
+            bool                                m_enabled = false;
+            bool                                m_interpolatePoses = true;  /**< Interpolate between the last two sampled poses in frames where sampling got skipped. */
+        };
+
+        static constexpr uint32 s_maxUpdateRateLodBands = 8;
+
         /**
          * Get the name of this class, or a description.
          * @result The string containing the name of the scheduler.
@@ -80,14 +117,73 @@ namespace EMotionFX
          */
         virtual uint32 RemoveActorInstance(ActorInstance* actorInstance, uint32 startStep = 0) = 0;
 
+        /**
+         * Take over deleting an actor instance that got destroyed while the schedule is being executed, so that it is not deleted while it is being updated.
+         * @param actorInstance The actor instance to delete.
+         * @result True in case the scheduler deletes the actor instance once the execute finished, false in case it can be deleted right away.
+         */
+        virtual bool DeferDeleteActorInstance(ActorInstance* actorInstance)     { AZ_UNUSED(actorInstance); return false; }
+
         uint32 GetNumUpdatedActorInstances() const                  { return mNumUpdated.GetValue(); }
         uint32 GetNumVisibleActorInstances() const                  { return mNumVisible.GetValue(); }
         uint32 GetNumSampledActorInstances() const                  { return mNumSampled.GetValue(); }
 
+        /**
+         * Set the update-rate LOD settings.
+         * Far away or small actor instances will sample their motions at a lower frequency. Updates are staggered across frames
+         * so that actor instances within the same band do not all sample in the same frame.
+         * @param settings The update-rate LOD settings. At most s_maxUpdateRateLodBands bands are used.
+         */
+        void SetUpdateRateLodSettings(const UpdateRateLodSettings& settings);
+        const UpdateRateLodSettings& GetUpdateRateLodSettings() const       { return m_updateRateLodSettings; }
+
+        /**
+         * Set the point, usually the camera position, that the distance and screen size of the actor instances are measured from.
+         * @param referencePoint The reference point in world space.
+         */
+        void SetUpdateRateLodReferencePoint(const AZ::Vector3& referencePoint) { m_updateRateLodReferencePoint = referencePoint; }
+        const AZ::Vector3& GetUpdateRateLodReferencePoint() const           { return m_updateRateLodReferencePoint; }
+
+        /**
+         * Calculate the update-rate LOD band for the given actor instance. Attachments use the band of their root actor instance.
+         * @param actorInstance The actor instance to calculate the band for.
+         * @result The band index, or 0 in case update-rate LOD is disabled.
+         */
+        uint32 CalcUpdateRateLodBand(const ActorInstance* actorInstance) const;
+
+        /**
+         * Get the number of actor instances that fell into the given update-rate LOD band during the last update.
+         * @param bandIndex The band index, which must be smaller than s_maxUpdateRateLodBands.
+         * @result The number of actor instances in the band, or 0 in case the band index is out of range.
+         */
+        uint32 GetNumUpdateRateLodBandActorInstances(uint32 bandIndex) const;
+        uint32 GetNumUpdateRateLodSkippedActorInstances() const             { return m_numUpdateRateLodSkipped.GetValue(); }
+
     protected:
         MCore::AtomicUInt32 mNumUpdated;
         MCore::AtomicUInt32 mNumVisible;
         MCore::AtomicUInt32 mNumSampled;
+        MCore::AtomicUInt32 m_numUpdateRateLodBand[s_maxUpdateRateLodBands];
+        MCore::AtomicUInt32 m_numUpdateRateLodSkipped;
+        UpdateRateLodSettings m_updateRateLodSettings;
+        AZ::Vector3 m_updateRateLodReferencePoint = AZ::Vector3::CreateZero();
+        AZ::u32 m_frameNumber = 0;
+
+        /**
+         * Reset the per frame statistics and advance the frame number used for staggering the update-rate LOD.
+         * This is called at the start of each Execute().
+         */
+        void BeginFrame();
+
+        /**
+         * Advance the motion sampling timer of the actor instance and decide if its motions or anim graph should be sampled this frame.
+         * This takes both the motion sampling rate of the actor instance and the update-rate LOD into account.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last update.
+         * @param isVisible True in case the actor instance is visible.
+         * @result True in case the motions should be sampled, false if not.
+         */
+        bool CheckShouldSampleMotions(ActorInstance* actorInstance, float timePassedInSeconds, bool isVisible);
 
         /**
          * The constructor.
@@ -47,6 +47,7 @@ namespace EMotionFX
         mVisualizeScale         = 1.0f;
         m_autoReleaseAllPoses   = true;
         m_autoReleaseAllRefDatas= true;
+        m_sharedEvaluationEnabled = false;
 
 #if defined(EMFX_DEVELOPMENT_BUILD)
         mIsOwnedByRuntime       = false;
@@ -12,6 +12,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <EMotionFX/Source/AnimGraphEventBuffer.h>
 #include <EMotionFX/Source/AnimGraphObject.h>
+#include <EMotionFX/Source/AnimGraphSharedEvaluation.h>
 #include <EMotionFX/Source/AnimGraphSnapshot.h>
 #include <EMotionFX/Source/BaseObject.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
@@ -294,6 +295,15 @@ namespace EMotionFX
 
         void SetAutoReleaseRefDatas(bool automaticallyFreeRefDatas);
         void SetAutoReleasePoses(bool automaticallyFreePoses);
+
+        /**
+         * Enable or disable shared output evaluation, where instances in the exact same state share a single output pose.
+         * This is meant for crowds of actor instances that use the same anim graph. See AnimGraphSharedEvaluation for details.
+         * @param enabled Set to true to allow sharing the output pose with other anim graph instances.
+         */
+        void SetSharedEvaluationEnabled(bool enabled)                                   { m_sharedEvaluationEnabled = enabled; }
+        bool GetSharedEvaluationEnabled() const                                         { return m_sharedEvaluationEnabled; }
+        AnimGraphSharedEvaluation::GroupKey& GetSharedEvaluationKey()                   { return m_sharedEvaluationKey; }
         void ReleaseRefDatas();
         void ReleasePoses();
 
@@ -319,6 +329,8 @@ namespace EMotionFX
 
         bool                                                m_autoReleaseAllPoses;
         bool                                                m_autoReleaseAllRefDatas;
+        bool                                                m_sharedEvaluationEnabled;
+        AnimGraphSharedEvaluation::GroupKey                 m_sharedEvaluationKey;  /**< The shared evaluation group key of the last output, kept to reuse its buffer. */
         
         AZStd::vector<AnimGraphInstance*>                   m_followerGraphs;
         AZStd::vector<AnimGraphInstance*>                   m_leaderGraphs;
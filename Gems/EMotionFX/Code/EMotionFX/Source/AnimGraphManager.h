@@ -14,6 +14,7 @@
 #include <MCore/Source/Array.h>
 #include "AnimGraphObject.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include "AnimGraphSharedEvaluation.h"
 
 
 namespace EMotionFX
@@ -41,6 +42,7 @@ namespace EMotionFX
         void Init();
 
         MCORE_INLINE BlendSpaceManager* GetBlendSpaceManager() const { return mBlendSpaceManager; }
+        MCORE_INLINE AnimGraphSharedEvaluation& GetSharedEvaluation() { return m_sharedEvaluation; }
 
         // anim graph helper functions
         void AddAnimGraph(AnimGraph* setup);
@@ -77,6 +79,7 @@ namespace EMotionFX
         AZStd::vector<AnimGraph*>           mAnimGraphs;
         AZStd::vector<AnimGraphInstance*>   mAnimGraphInstances;
         BlendSpaceManager*                  mBlendSpaceManager;
+        AnimGraphSharedEvaluation           m_sharedEvaluation;
         mutable MCore::MutexRecursive       mAnimGraphLock;
         mutable MCore::MutexRecursive       mAnimGraphInstanceLock;
 
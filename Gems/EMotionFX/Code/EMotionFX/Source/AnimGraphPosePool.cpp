@@ -9,6 +9,9 @@
 // include required headers
 #include "AnimGraphPosePool.h"
 #include "AnimGraphPose.h"
+#include "Actor.h"
+#include "ActorInstance.h"
+#include "MorphSetupInstance.h"
 
 
 namespace EMotionFX
@@ -20,8 +23,11 @@ namespace EMotionFX
         mFreePoses.SetMemoryCategory(EMFX_MEMCATEGORY_ANIMGRAPH_POSEPOOL);
         mPoses.Reserve(12);
         mFreePoses.Reserve(12);
-        Resize(8);
         mMaxUsed = 0;
+        mNumReservedTransforms = 0;
+        mNumReservedMorphWeights = 0;
+        mNumAllocations = 0;
+        Resize(8);
     }
 
 
@@ -64,7 +70,7 @@ namespace EMotionFX
         {
             for (int32 i = 0; i < difference; ++i)
             {
-                AnimGraphPose* newPose = new AnimGraphPose();
+                AnimGraphPose* newPose = CreatePose();
                 mPoses.Add(newPose);
                 mFreePoses.Add(newPose);
             }
@@ -72,31 +78,85 @@ namespace EMotionFX
     }
 
 
+    // reserve poses for a given actor instance
+    void AnimGraphPosePool::Reserve(const ActorInstance* actorInstance, uint32 numPoses)
+    {
+        UpdateLayout(actorInstance);
+
+        if (numPoses > mPoses.GetLength())
+        {
+            Resize(numPoses);
+        }
+
+        // make sure all poses, including the ones in use, use the current layout
+        const uint32 numTotalPoses = mPoses.GetLength();
+        for (uint32 i = 0; i < numTotalPoses; ++i)
+        {
+            ReserveBuffers(mPoses[i]);
+        }
+    }
+
+
     // request a pose
     AnimGraphPose* AnimGraphPosePool::RequestPose(const ActorInstance* actorInstance)
     {
-        // if we have no free poses left, allocate a new one
+        UpdateLayout(actorInstance);
+
+        AnimGraphPose* pose;
         if (mFreePoses.GetLength() == 0)
         {
-            AnimGraphPose* newPose = new AnimGraphPose();
-            newPose->LinkToActorInstance(actorInstance);
-            mPoses.Add(newPose);
-            mMaxUsed = MCore::Max<uint32>(mMaxUsed, GetNumUsedPoses());
-            newPose->SetIsInUse(true);
-            return newPose;
+            // if we have no free poses left, allocate a new one
+            pose = CreatePose();
+            mPoses.Add(pose);
+        }
+        else
+        {
+            // request the last free pose
+            pose = mFreePoses[mFreePoses.GetLength() - 1];
+            mFreePoses.RemoveLast(); // remove it from the list of free poses
+            ReserveBuffers(pose);
         }
 
-        // request the last free pose
-        AnimGraphPose* pose = mFreePoses[mFreePoses.GetLength() - 1];
-        //if (pose->GetActorInstance() != actorInstance)
+        // the buffers are big enough already, so this won't allocate
         pose->LinkToActorInstance(actorInstance);
-        mFreePoses.RemoveLast(); // remove it from the list of free poses
         mMaxUsed = MCore::Max<uint32>(mMaxUsed, GetNumUsedPoses());
         pose->SetIsInUse(true);
         return pose;
     }
 
 
+    // grow the layout of the pose buffers in case the actor instance doesn't fit
+    void AnimGraphPosePool::UpdateLayout(const ActorInstance* actorInstance)
+    {
+        const uint32 numTransforms = actorInstance->GetActor()->GetNumNodes();
+        const uint32 numMorphWeights = actorInstance->GetMorphSetupInstance()->GetNumMorphTargets();
+        mNumReservedTransforms = MCore::Max<uint32>(mNumReservedTransforms, numTransforms);
+        mNumReservedMorphWeights = MCore::Max<uint32>(mNumReservedMorphWeights, numMorphWeights);
+    }
+
+
+    // create a new pose, using the current layout
+    AnimGraphPose* AnimGraphPosePool::CreatePose()
+    {
+        AnimGraphPose* newPose = new AnimGraphPose();
+        mNumAllocations++;
+        ReserveBuffers(newPose);
+        return newPose;
+    }
+
+
+    // make sure the pose buffers use the current layout
+    void AnimGraphPosePool::ReserveBuffers(AnimGraphPose* pose)
+    {
+        Pose& posePose = pose->GetPose();
+        if (posePose.GetNumReservedTransforms() < mNumReservedTransforms || posePose.GetNumReservedMorphWeights() < mNumReservedMorphWeights)
+        {
+            posePose.Reserve(mNumReservedTransforms, mNumReservedMorphWeights);
+            mNumAllocations++;
+        }
+    }
+
+
     // free the pose again
     void AnimGraphPosePool::FreePose(AnimGraphPose* pose)
     {
@@ -22,9 +22,10 @@ namespace EMotionFX
 
 
     /**
-     *
-     *
-     *
+     * The per thread pool of anim graph poses, used as a pose arena during anim graph evaluation.
+     * All poses inside the pool share a fixed buffer layout, which is sized for the biggest skeleton and morph setup the pool has seen so far.
+     * This way handing out a pose for another actor never reallocates the pose buffers, and once the pool contains enough poses for the
+     * anim graphs that get evaluated on this thread, requesting and freeing poses does not allocate any memory anymore.
      */
     class EMFX_API AnimGraphPosePool
     {
@@ -41,15 +42,37 @@ namespace EMotionFX
 
         void FreeAllPoses();
 
+        /**
+         * Make sure the pool contains at least the given number of poses, with the buffer layout sized for the given actor instance.
+         * Call this up front to avoid any allocations during the first anim graph evaluations.
+         * @param actorInstance The actor instance to size the pose buffers for.
+         * @param numPoses The minimum number of poses the pool should contain.
+         */
+        void Reserve(const ActorInstance* actorInstance, uint32 numPoses);
+
         MCORE_INLINE uint32 GetNumFreePoses() const             { return mFreePoses.GetLength(); }
         MCORE_INLINE uint32 GetNumPoses() const                 { return mPoses.GetLength(); }
         MCORE_INLINE uint32 GetNumUsedPoses() const             { return (mPoses.GetLength() - mFreePoses.GetLength()); }
         MCORE_INLINE uint32 GetNumMaxUsedPoses() const          { return mMaxUsed; }
         MCORE_INLINE void ResetMaxUsedPoses()                   { mMaxUsed = 0; }
 
+        MCORE_INLINE uint32 GetNumReservedTransforms() const    { return mNumReservedTransforms; }
+        MCORE_INLINE uint32 GetNumReservedMorphWeights() const  { return mNumReservedMorphWeights; }
+
+        // The number of allocations made by the pool, which are newly created poses and pose buffer (re)allocations.
+        MCORE_INLINE uint32 GetNumAllocations() const           { return mNumAllocations; }
+        MCORE_INLINE void ResetNumAllocations()                 { mNumAllocations = 0; }
+
     private:
         MCore::Array<AnimGraphPose*>   mPoses;
         MCore::Array<AnimGraphPose*>   mFreePoses;
         uint32                         mMaxUsed;
+        uint32                         mNumReservedTransforms;
+        uint32                         mNumReservedMorphWeights;
+        uint32                         mNumAllocations;
+
+        void UpdateLayout(const ActorInstance* actorInstance);
+        AnimGraphPose* CreatePose();
+        void ReserveBuffers(AnimGraphPose* pose);
     };
 }   // namespace EMotionFX
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/hash.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphNode.h>
+#include <EMotionFX/Source/AnimGraphNodeData.h>
+#include <EMotionFX/Source/AnimGraphSharedEvaluation.h>
+#include <MCore/Source/AttributeBool.h>
+#include <MCore/Source/AttributeColor.h>
+#include <MCore/Source/AttributeFloat.h>
+#include <MCore/Source/AttributeInt32.h>
+#include <MCore/Source/AttributeQuaternion.h>
+#include <MCore/Source/AttributeVector2.h>
+#include <MCore/Source/AttributeVector3.h>
+#include <MCore/Source/AttributeVector4.h>
+
+
+namespace EMotionFX
+{
+    namespace
+    {
+        template<typename T>
+        void AppendKeyValue(AnimGraphSharedEvaluation::GroupKey& key, const T& value)
+        {
+            static_assert(AZStd::is_arithmetic_v<T> || AZStd::is_pointer_v<T>, "Only append values without padding, so that equal states have equal bytes.");
+            const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(&value);
+            key.m_data.insert(key.m_data.end(), bytes, bytes + sizeof(T));
+        }
+
+        void AppendKeyFloats(AnimGraphSharedEvaluation::GroupKey& key, const float* values, size_t numValues)
+        {
+            const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(values);
+            key.m_data.insert(key.m_data.end(), bytes, bytes + numValues * sizeof(float));
+        }
+
+        void AppendParameterValue(AnimGraphSharedEvaluation::GroupKey& key, const MCore::Attribute* attribute)
+        {
+            const uint32 type = attribute->GetType();
+            AppendKeyValue(key, type);
+            switch (type)
+            {
+                case MCore::AttributeFloat::TYPE_ID:
+                {
+                    AppendKeyValue(key, static_cast<const MCore::AttributeFloat*>(attribute)->GetValue());
+                    break;
+                }
+                case MCore::AttributeBool::TYPE_ID:
+                {
+                    AppendKeyValue(key, static_cast<const MCore::AttributeBool*>(attribute)->GetValue());
+                    break;
+                }
+                case MCore::AttributeInt32::TYPE_ID:
+                {
+                    AppendKeyValue(key, static_cast<const MCore::AttributeInt32*>(attribute)->GetValue());
+                    break;
+                }
+                case MCore::AttributeVector2::TYPE_ID:
+                {
+                    const AZ::Vector2& value = static_cast<const MCore::AttributeVector2*>(attribute)->GetValue();
+                    const float values[2] = { value.GetX(), value.GetY() };
+                    AppendKeyFloats(key, values, 2);
+                    break;
+                }
+                case MCore::AttributeVector3::TYPE_ID:
+                {
+                    const AZ::Vector3& value = static_cast<const MCore::AttributeVector3*>(attribute)->GetValue();
+                    const float values[3] = { value.GetX(), value.GetY(), value.GetZ() };
+                    AppendKeyFloats(key, values, 3);
+                    break;
+                }
+                case MCore::AttributeVector4::TYPE_ID:
+                {
+                    const AZ::Vector4& value = static_cast<const MCore::AttributeVector4*>(attribute)->GetValue();
+                    const float values[4] = { value.GetX(), value.GetY(), value.GetZ(), value.GetW() };
+                    AppendKeyFloats(key, values, 4);
+                    break;
+                }
+                case MCore::AttributeQuaternion::TYPE_ID:
+                {
+                    const AZ::Quaternion& value = static_cast<const MCore::AttributeQuaternion*>(attribute)->GetValue();
+                    const float values[4] = { value.GetX(), value.GetY(), value.GetZ(), value.GetW() };
+                    AppendKeyFloats(key, values, 4);
+                    break;
+                }
+                case MCore::AttributeColor::TYPE_ID:
+                {
+                    const MCore::RGBAColor& value = static_cast<const MCore::AttributeColor*>(attribute)->GetValue();
+                    const float values[4] = { value.r, value.g, value.b, value.a };
+                    AppendKeyFloats(key, values, 4);
+                    break;
+                }
+                default:
+                {
+                    // Other parameter types (like strings) are rare, so the conversion is fine here.
+                    AZStd::string valueString;
+                    attribute->ConvertToString(valueString);
+                    AppendKeyValue(key, valueString.size());
+                    key.m_data.insert(key.m_data.end(), valueString.begin(), valueString.end());
+                }
+            }
+        }
+    } // namespace
+
+
+    void AnimGraphSharedEvaluation::CalcGroupKey(AnimGraphInstance* animGraphInstance, GroupKey& outKey)
+    {
+        const ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
+        const AnimGraph* animGraph = animGraphInstance->GetAnimGraph();
+
+        outKey.m_data.clear();
+        AppendKeyValue(outKey, animGraph);
+        AppendKeyValue(outKey, animGraphInstance->GetMotionSet());
+        AppendKeyValue(outKey, actorInstance->GetActor());
+        AppendKeyValue(outKey, actorInstance->GetLODLevel());
+        AppendKeyValue(outKey, actorInstance->GetNumEnabledNodes());
+        AppendKeyValue(outKey, animGraphInstance->GetRetargetingEnabled());
+
+        // The parameter values, which drive the blend weights.
+        const uint32 numParameters = static_cast<uint32>(animGraph->GetNumValueParameters());
+        for (uint32 i = 0; i < numParameters; ++i)
+        {
+            AppendParameterValue(outKey, animGraphInstance->GetParameterValue(i));
+        }
+
+        // The timing and weights of all nodes, which contain the active states, transitions and synced motion phases.
+        const size_t numUniqueDatas = animGraphInstance->GetNumUniqueObjectDatas();
+        for (size_t i = 0; i < numUniqueDatas; ++i)
+        {
+            const AnimGraphObjectData* uniqueData = animGraphInstance->GetUniqueObjectData(i);
+            if (!uniqueData || !azrtti_istypeof<AnimGraphNode>(uniqueData->GetObject()))
+            {
+                continue;
+            }
+
+            const AnimGraphNodeData* nodeData = static_cast<const AnimGraphNodeData*>(uniqueData);
+            const float values[6] =
+            {
+                nodeData->GetCurrentPlayTime(),
+                nodeData->GetDuration(),
+                nodeData->GetPlaySpeed(),
+                nodeData->GetPreSyncTime(),
+                nodeData->GetGlobalWeight(),
+                nodeData->GetLocalWeight()
+            };
+            AppendKeyValue(outKey, i);
+            AppendKeyFloats(outKey, values, 6);
+            AppendKeyValue(outKey, nodeData->GetSyncIndex());
+            AppendKeyValue(outKey, nodeData->GetIsMirrorMotion());
+        }
+
+        outKey.m_hash = AZStd::hash_range(outKey.m_data.begin(), outKey.m_data.end());
+    }
+
+
+    AnimGraphSharedEvaluation::GroupKey AnimGraphSharedEvaluation::CalcGroupKey(AnimGraphInstance* animGraphInstance)
+    {
+        GroupKey key;
+        CalcGroupKey(animGraphInstance, key);
+        return key;
+    }
+
+
+    void AnimGraphSharedEvaluation::BeginFrame()
+    {
+        MCore::LockGuard lock(m_mutex);
+        m_groupsByKey.clear();
+        m_numUsedGroups = 0;
+    }
+
+
+    bool AnimGraphSharedEvaluation::Output(AnimGraphInstance* animGraphInstance, Pose* outputPose)
+    {
+        // Networked instances collect their snapshot during the output, so they always have to be evaluated themselves.
+        if (animGraphInstance->IsNetworkEnabled())
+        {
+            animGraphInstance->Output(outputPose);
+            m_numEvaluatedOutputs++;
+            return false;
+        }
+
+        // The key buffer is owned by the anim graph instance, so it only gets allocated once.
+        GroupKey& key = animGraphInstance->GetSharedEvaluationKey();
+        CalcGroupKey(animGraphInstance, key);
+
+        Group* group = nullptr;
+        bool isLeader = false;
+        bool isReady = false;
+        {
+            MCore::LockGuard lock(m_mutex);
+            const auto iterator = m_groupsByKey.find(&key);
+            if (iterator == m_groupsByKey.end())
+            {
+                group = AcquireGroup();
+                group->m_key = key;
+                m_groupsByKey.emplace(&group->m_key, group);
+                isLeader = true;
+            }
+            else
+            {
+                group = iterator->second;
+                isReady = group->m_isReady;
+            }
+        }
+
+        // Copy the pose from the group. The group pose doesn't change anymore once it is ready, so we don't need to hold the lock.
+        if (isReady)
+        {
+            outputPose->InitFromPose(&group->m_pose);
+            m_numSharedOutputs++;
+            return true;
+        }
+
+        // Either we are the first of the group, or the first one is still being evaluated on another thread.
+        animGraphInstance->Output(outputPose);
+        m_numEvaluatedOutputs++;
+
+        if (isLeader)
+        {
+            group->m_pose.LinkToActorInstance(animGraphInstance->GetActorInstance());
+            group->m_pose.InitFromPose(outputPose);
+
+            MCore::LockGuard lock(m_mutex);
+            group->m_isReady = true;
+        }
+
+        return false;
+    }
+
+
+    AnimGraphSharedEvaluation::Group* AnimGraphSharedEvaluation::AcquireGroup()
+    {
+        if (m_numUsedGroups == m_groups.size())
+        {
+            m_groups.emplace_back(AZStd::make_unique<Group>());
+        }
+
+        Group* group = m_groups[m_numUsedGroups++].get();
+        group->m_isReady = false;
+        return group;
+    }
+
+
+    size_t AnimGraphSharedEvaluation::GetNumGroups() const
+    {
+        MCore::LockGuard lock(m_mutex);
+        return m_numUsedGroups;
+    }
+
+
+    float AnimGraphSharedEvaluation::GetGroupHitRate() const
+    {
+        const size_t numShared = m_numSharedOutputs.load();
+        const size_t numTotal = numShared + m_numEvaluatedOutputs.load();
+        return (numTotal > 0) ? static_cast<float>(numShared) / static_cast<float>(numTotal) : 0.0f;
+    }
+
+
+    void AnimGraphSharedEvaluation::ResetCounters()
+    {
+        m_numSharedOutputs = 0;
+        m_numEvaluatedOutputs = 0;
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Pose.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class AnimGraphInstance;
+
+
+    /**
+     * Shared output evaluation for anim graph instances that are in the exact same state, like idle crowds or marching units.
+     * Anim graph instances opt in using AnimGraphInstance::SetSharedEvaluationEnabled(). Each of them still gets updated individually,
+     * which keeps their node timers, state machines, events and motion extraction (and therefore their root/world transforms) their own.
+     * After the update, the instances are grouped by anim graph, motion set, actor, LOD, parameter values and the timing and weight state of all their nodes.
+     * The groups are looked up by the hash of that state, but the full state is compared as well, so a hash collision never shares the pose of another state.
+     * Only the first instance of each group calculates the output pose of the anim graph, which is the expensive part, and the other instances in
+     * the group copy that pose.
+     * Anim graphs that use random values in their output, or nodes that depend on the world transform of the actor instance (like look-at or IK
+     * towards a world space goal parameter that differs per instance), should not opt in.
+     * Groups are rebuilt every frame by ActorManager::UpdateActorInstances(). This class is thread safe.
+     */
+    class EMFX_API AnimGraphSharedEvaluation
+    {
+    public:
+        /**
+         * The full state that decides the group of an anim graph instance, flattened into bytes.
+         */
+        struct EMFX_API GroupKey
+        {
+            AZStd::vector<AZ::u8>   m_data;
+            size_t                  m_hash = 0;
+
+            bool operator==(const GroupKey& other) const    { return m_hash == other.m_hash && m_data == other.m_data; }
+            bool operator!=(const GroupKey& other) const    { return !(*this == other); }
+        };
+
+        AnimGraphSharedEvaluation() = default;
+        ~AnimGraphSharedEvaluation() = default;
+
+        /**
+         * Start a new frame, which clears all groups. Poses from the previous frame can't be shared anymore.
+         */
+        void BeginFrame();
+
+        /**
+         * Calculate the output pose of the given anim graph instance, or copy it from an instance in the same group that got evaluated already this frame.
+         * The anim graph instance has to be updated already.
+         * @param animGraphInstance The anim graph instance to output.
+         * @param outputPose The pose to store the output in.
+         * @result True in case the pose got shared from another anim graph instance, false in case it got calculated.
+         */
+        bool Output(AnimGraphInstance* animGraphInstance, Pose* outputPose);
+
+        /**
+         * Calculate the key of the group an anim graph instance belongs to, for its current state.
+         * @param animGraphInstance The anim graph instance to calculate the group key for.
+         * @param outKey The group key, its buffer gets reused. Anim graph instances with the same key output the same pose.
+         */
+        static void CalcGroupKey(AnimGraphInstance* animGraphInstance, GroupKey& outKey);
+        static GroupKey CalcGroupKey(AnimGraphInstance* animGraphInstance);
+
+        size_t GetNumGroups() const;
+        size_t GetNumSharedOutputs() const                  { return m_numSharedOutputs.load(); }
+        size_t GetNumEvaluatedOutputs() const               { return m_numEvaluatedOutputs.load(); }
+        float GetGroupHitRate() const;
+        void ResetCounters();
+
+    private:
+        struct Group
+        {
+            GroupKey m_key;
+            Pose m_pose;
+            bool m_isReady = false;
+        };
+
+        struct GroupKeyHasher
+        {
+            size_t operator()(const GroupKey* key) const                        { return key->m_hash; }
+        };
+
+        struct GroupKeyEqual
+        {
+            bool operator()(const GroupKey* keyA, const GroupKey* keyB) const   { return *keyA == *keyB; }
+        };
+
+        Group* AcquireGroup();
+
+        AZStd::unordered_map<const GroupKey*, Group*, GroupKeyHasher, GroupKeyEqual> m_groupsByKey; /**< Points to the keys stored in the groups. */
+        AZStd::vector<AZStd::unique_ptr<Group>> m_groups;               /**< The group pool, reused every frame, so the group poses don't get reallocated. */
+        size_t                                  m_numUsedGroups = 0;
+        AZStd::atomic<size_t>                   m_numSharedOutputs{ 0 };
+        AZStd::atomic<size_t>                   m_numEvaluatedOutputs{ 0 };
+        mutable MCore::Mutex                    m_mutex;
+    };
+}   // namespace EMotionFX
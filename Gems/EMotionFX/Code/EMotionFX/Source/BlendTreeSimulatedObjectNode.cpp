@@ -10,6 +10,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/functional.h>
 #include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/Attachment.h>
 #include <EMotionFX/Source/BlendTreeSimulatedObjectNode.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
@@ -275,15 +276,48 @@ namespace EMotionFX
             attachment->UpdateJointTransforms(outputPose->GetPose());
         }
 
+        // Let the solver stage solve the simulations together with those of all other actor instances, on the final pose.
+        // With shared evaluation, only one anim graph instance of a group outputs this node, so the other ones would never get solved. Solve inline instead.
+        const bool useBatchStage = m_solveInBatchStage && !animGraphInstance->GetSharedEvaluationEnabled();
+        AZ_WarningOnce("EMotionFX", !m_solveInBatchStage || useBatchStage,
+            "Simulated object node '%s' can't solve in the batch stage for anim graph instances that use shared evaluation. Solving inline instead.", GetName());
+
+        bool isSolvedInBatchStage = false;
+        if (useBatchStage && !uniqueData->m_simulations.empty())
+        {
+            const float stiffnessFactor = GetStiffnessFactor(animGraphInstance);
+            const float gravityFactor = GetGravityFactor(animGraphInstance);
+            const float dampingFactor = GetDampingFactor(animGraphInstance);
+
+            uniqueData->m_batchChains.clear();
+            for (Simulation* sim : uniqueData->m_simulations)
+            {
+                SimulatedObjectSolverStage::Chain chain;
+                chain.m_solver = &sim->m_solver;
+                chain.m_stiffnessFactor = stiffnessFactor;
+                chain.m_gravityFactor = gravityFactor;
+                chain.m_dampingFactor = dampingFactor;
+                chain.m_timePassedInSeconds = uniqueData->m_timePassedInSeconds;
+                chain.m_collisionEnabled = m_collisionDetection;
+                uniqueData->m_batchChains.emplace_back(chain);
+            }
+
+            SimulatedObjectSolverStage& solverStage = GetActorManager().GetSimulatedObjectSolverStage();
+            isSolvedInBatchStage = solverStage.AddChains(animGraphInstance->GetActorInstance(), uniqueData->m_batchChains.data(), uniqueData->m_batchChains.size());
+        }
+
         // Perform the solver update, and modify the output pose.
-        for (Simulation* sim : uniqueData->m_simulations)
+        if (!isSolvedInBatchStage)
         {
-            SpringSolver& solver = sim->m_solver;
-            solver.SetStiffnessFactor(GetStiffnessFactor(animGraphInstance));
-            solver.SetGravityFactor(GetGravityFactor(animGraphInstance));
-            solver.SetDampingFactor(GetDampingFactor(animGraphInstance));
-            solver.SetCollisionEnabled(m_collisionDetection);
-            solver.Update(inputPose->GetPose(), outputPose->GetPose(), uniqueData->m_timePassedInSeconds);
+            for (Simulation* sim : uniqueData->m_simulations)
+            {
+                SpringSolver& solver = sim->m_solver;
+                solver.SetStiffnessFactor(GetStiffnessFactor(animGraphInstance));
+                solver.SetGravityFactor(GetGravityFactor(animGraphInstance));
+                solver.SetDampingFactor(GetDampingFactor(animGraphInstance));
+                solver.SetCollisionEnabled(m_collisionDetection);
+                solver.Update(inputPose->GetPose(), outputPose->GetPose(), uniqueData->m_timePassedInSeconds);
+            }
         }
 
         // Debug draw.
@@ -381,13 +415,14 @@ namespace EMotionFX
         }
 
         serializeContext->Class<BlendTreeSimulatedObjectNode, AnimGraphNode>()
-            ->Version(2, VersionConverter)
+            ->Version(3, VersionConverter)
             ->Field("simulatedObjectNames", &BlendTreeSimulatedObjectNode::m_simulatedObjectNames)
             ->Field("stiffnessFactor", &BlendTreeSimulatedObjectNode::m_stiffnessFactor)
             ->Field("gravityFactor", &BlendTreeSimulatedObjectNode::m_gravityFactor)
             ->Field("dampingFactor", &BlendTreeSimulatedObjectNode::m_dampingFactor)
             ->Field("numIterations", &BlendTreeSimulatedObjectNode::m_numIterations)
-            ->Field("collisionDetection", &BlendTreeSimulatedObjectNode::m_collisionDetection);
+            ->Field("collisionDetection", &BlendTreeSimulatedObjectNode::m_collisionDetection)
+            ->Field("solveInBatchStage", &BlendTreeSimulatedObjectNode::m_solveInBatchStage);
 
         AZ::EditContext* editContext = serializeContext->GetEditContext();
         if (!editContext)
@@ -421,6 +456,7 @@ namespace EMotionFX
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeSimulatedObjectNode::OnNumIterationsChanged)
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 10)
-            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeSimulatedObjectNode::m_collisionDetection, "Enable collisions", "Enable collision detection with its colliders?");
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeSimulatedObjectNode::m_collisionDetection, "Enable collisions", "Enable collision detection with its colliders?")
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeSimulatedObjectNode::m_solveInBatchStage, "Solve in batch stage", "Solve the simulation after all characters got updated, in parallel with the simulated objects of other characters. Only enable this when no other node modifies the pose after this node.");
     }
 } // namespace EMotionFX
@@ -12,6 +12,7 @@
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <EMotionFX/Source/SpringSolver.h>
 #include <EMotionFX/Source/SimulatedObjectBus.h>
+#include <EMotionFX/Source/SimulatedObjectSolverStage.h>
 
 namespace EMotionFX
 {
@@ -67,6 +68,7 @@ namespace EMotionFX
 
         public:
             AZStd::vector<Simulation*> m_simulations;
+            AZStd::vector<SimulatedObjectSolverStage::Chain> m_batchChains;
             float m_timePassedInSeconds = 0.0f;
         };
 
@@ -91,6 +93,15 @@ namespace EMotionFX
         void OnSimulatedObjectChanged() override;
         void SetSimulatedObjectNames(const AZStd::vector<AZStd::string>& simObjectNames);
 
+        /**
+         * Solve the simulations in the simulated object solver stage, after all actor instances got updated, instead of during the output of this node.
+         * The node then passes its input pose through, and the simulation is applied to the final pose of the actor instance.
+         * This should only be enabled when no other node modifies the pose after this node. Anim graph instances that use shared evaluation always solve inline.
+         * @param solveInBatchStage Set to true to solve in the batch stage.
+         */
+        void SetSolveInBatchStage(bool solveInBatchStage)      { m_solveInBatchStage = solveInBatchStage; }
+        bool GetSolveInBatchStage() const                       { return m_solveInBatchStage; }
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -114,5 +125,6 @@ namespace EMotionFX
         float m_gravityFactor = 1.0f;
         float m_dampingFactor = 1.0f;
         bool m_collisionDetection = true;
+        bool m_solveInBatchStage = false;
     };
 } // namespace EMotionFX
@@ -8,6 +8,7 @@
 
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "DualQuatSkinDeformer.h"
 #include "Mesh.h"
@@ -69,6 +70,7 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_packedInfluences = m_packedInfluences;
 
         // return the result
         return result;
@@ -89,6 +91,8 @@ namespace EMotionFX
             boneInfo.mDualQuat.FromRotationTranslation(skinTransform.mRotation, skinTransform.mPosition);
         }
 
+        const bool usePackedInfluences = m_packedInfluences.GetIsValid() && m_packedInfluences.GetNumVertices() == numVertices;
+
         AZ::JobCompletion jobCompletion;
 
         // Split up the skinned vertices into batches.
@@ -100,9 +104,16 @@ namespace EMotionFX
 
             // Create a job for every batch and skin them simultaneously.
             AZ::JobContext* jobContext = nullptr;
-            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, usePackedInfluences]()
                 {
-                    SkinRange(mMesh, startVertex, endVertex, m_bones);
+                    if (usePackedInfluences)
+                    {
+                        SkinRangePacked(mMesh, startVertex, endVertex, m_bones, m_packedInfluences);
+                    }
+                    else
+                    {
+                        SkinRange(mMesh, startVertex, endVertex, m_bones);
+                    }
                 }, /*isAutoDelete=*/true, jobContext);
 
             job->SetDependent(&jobCompletion);
@@ -293,6 +304,74 @@ namespace EMotionFX
         }
     }
 
+    void DualQuatSkinDeformer::SkinRangePacked(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const PackedSkinInfluences& packedInfluences)
+    {
+        AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+        using AZ::Simd::Vec1;
+        using AZ::Simd::Vec4;
+
+        const AZ::u32 numSlots = packedInfluences.GetNumInfluencesPerVertex();
+        for (AZ::u32 v = startVertex; v < endVertex; ++v)
+        {
+            const AZ::u16* boneIndices = packedInfluences.GetBoneIndices(v);
+            const AZ::u16* weights = packedInfluences.GetWeights(v);
+
+            // no skinning influences, keep the values
+            if (weights[0] == 0)
+            {
+                continue;
+            }
+
+            // blend the real and dual parts with SIMD, the influences are sorted on weight so the pivot quat used for the
+            // hemisphere check is the most important one, and we can stop at the first empty slot
+            const MCore::DualQuaternion& pivotQuat = boneInfos[boneIndices[0]].mDualQuat;
+            const Vec4::FloatType pivotReal = pivotQuat.mReal.GetSimdValue();
+            Vec4::FloatType weight = Vec4::Splat(PackedSkinInfluences::DequantizeWeight(weights[0]));
+            Vec4::FloatType real = Vec4::Mul(pivotReal, weight);
+            Vec4::FloatType dual = Vec4::Mul(pivotQuat.mDual.GetSimdValue(), weight);
+            for (AZ::u32 i = 1; i < numSlots && weights[i] != 0; ++i)
+            {
+                // invert the dual quat by negating the weight in case it is in the other hemisphere
+                const MCore::DualQuaternion& influenceQuat = boneInfos[boneIndices[i]].mDualQuat;
+                const Vec4::FloatType influenceReal = influenceQuat.mReal.GetSimdValue();
+                float influenceWeight = PackedSkinInfluences::DequantizeWeight(weights[i]);
+                if (Vec1::SelectFirst(Vec4::Dot(influenceReal, pivotReal)) < 0.0f)
+                {
+                    influenceWeight = -influenceWeight;
+                }
+
+                weight = Vec4::Splat(influenceWeight);
+                real = Vec4::Madd(influenceReal, weight, real);
+                dual = Vec4::Madd(influenceQuat.mDual.GetSimdValue(), weight, dual);
+            }
+
+            // normalize, the same way MCore::DualQuaternion::Normalize does
+            const Vec4::FloatType invLength = Vec4::Splat(1.0f / sqrtf(Vec1::SelectFirst(Vec4::Dot(real, real))));
+            real = Vec4::Mul(real, invLength);
+            dual = Vec4::Mul(dual, invLength);
+            dual = Vec4::Madd(real, Vec4::Splat(-Vec1::SelectFirst(Vec4::Dot(real, dual))), dual);
+            const MCore::DualQuaternion skinQuat(AZ::Quaternion(real), AZ::Quaternion(dual));
+
+            positions[v] = skinQuat.TransformPoint(positions[v]);
+            normals[v] = skinQuat.TransformVector(normals[v]);
+
+            if (tangents)
+            {
+                const AZ::Vector3 newTangent = skinQuat.TransformVector(tangents[v].GetAsVector3());
+                tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangents[v].GetW());
+            }
+
+            if (bitangents)
+            {
+                bitangents[v] = skinQuat.TransformVector(bitangents[v]);
+            }
+        }
+    }
+
     // initialize the mesh deformer
     void DualQuatSkinDeformer::Reinitialize(Actor* actor, Node* node, uint32 lodLevel)
     {
@@ -340,5 +419,8 @@ namespace EMotionFX
                 }
             }
         }
+
+        // pack the influences per vertex, now that the bone numbers are known
+        m_packedInfluences.Init(mMesh, skinningLayer);
     }
 } // namespace EMotionFX
@@ -14,6 +14,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "PackedSkinInfluences.h"
 
 namespace EMotionFX
 {
@@ -126,6 +127,7 @@ namespace EMotionFX
                 : mNodeNr(MCORE_INVALIDINDEX32) {}
         };
         AZStd::vector<BoneInfo> m_bones; /**< The array of bone information used for pre-calculation. */
+        PackedSkinInfluences m_packedInfluences; /**< The skin influences packed per vertex, invalid in case a vertex has too many influences. */
 
         /**
          * Skin a part of the mesh.
@@ -136,6 +138,16 @@ namespace EMotionFX
          */
         static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
 
+        /**
+         * Skin a part of the mesh using the skin influences packed per vertex.
+         * @param mesh The mesh to be skinned.
+         * @param startVertex The start vertex index to start skinning.
+         * @param endVertex The end vertex index for the range to be skinned.
+         * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         * @param packedInfluences The packed skin influences of the mesh.
+         */
+        static void SkinRangePacked(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const PackedSkinInfluences& packedInfluences);
+
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
 
@@ -0,0 +1,1442 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/ThreadData.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/FastMath.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr float s_maxQuantizedValue = 65535.0f;
+
+        // The maximum difference between any of the values and the reference value.
+        float CalcMaxDeviation(const AZStd::vector<AZ::Vector3>& values, const AZ::Vector3& reference)
+        {
+            float maxDeviation = 0.0f;
+            for (const AZ::Vector3& value : values)
+            {
+                maxDeviation = AZStd::max(maxDeviation, (value - reference).GetAbs().GetMaxElement());
+            }
+            return maxDeviation;
+        }
+
+        // The maximum angle in degrees between any of the rotations and the reference rotation.
+        float CalcMaxDeviation(const AZStd::vector<AZ::Quaternion>& values, const AZ::Quaternion& reference)
+        {
+            float minAbsDot = 1.0f;
+            for (const AZ::Quaternion& value : values)
+            {
+                minAbsDot = AZStd::min(minAbsDot, AZ::GetAbs(value.Dot(reference)));
+            }
+            return MCore::Math::RadiansToDegrees(2.0f * MCore::Math::ACos(AZ::GetClamp(minAbsDot, 0.0f, 1.0f)));
+        }
+
+        float CalcMaxDeviation(const AZStd::vector<float>& values, float reference)
+        {
+            float maxDeviation = 0.0f;
+            for (float value : values)
+            {
+                maxDeviation = AZStd::max(maxDeviation, AZ::GetAbs(value - reference));
+            }
+            return maxDeviation;
+        }
+
+        bool IsInIgnoreList(const AZStd::vector<size_t>& ignoreList, size_t index)
+        {
+            return AZStd::find(ignoreList.begin(), ignoreList.end(), index) != ignoreList.end();
+        }
+
+        // The keys of a block of eight lanes are stored in lane order 0 4 1 5 2 6 3 7. Loading a block as four 32-bit integers
+        // then puts lanes 0-3 in the low and lanes 4-7 in the high 16 bits, which lets us widen them without any shuffles.
+        AZ_FORCE_INLINE size_t CalcKeyOffsetInRow(AZ::u32 lane)
+        {
+            return (lane & ~7u) + ((lane & 3u) << 1) + ((lane >> 2) & 1u);
+        }
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::Int32Type LoadKeyBlock(const AZ::u16* keys)
+        {
+            alignas(16) int32_t values[4];
+            memcpy(values, keys, sizeof(values));
+            return AZ::Simd::Vec4::LoadAligned(values);
+        }
+
+        // The keys of lanes 0-3 of a block.
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType ExtractLowKeys(AZ::Simd::Vec4::Int32ArgType block)
+        {
+            using AZ::Simd::Vec4;
+            return Vec4::ConvertToFloat(Vec4::And(block, Vec4::Splat(0x0000FFFF)));
+        }
+
+        // The keys of lanes 4-7 of a block. There is no vector shift, so flip the sign bit and mask out the low half instead.
+        // That leaves (key - 32768) * 65536 as a signed integer, which converts to float exactly.
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType ExtractHighKeys(AZ::Simd::Vec4::Int32ArgType block)
+        {
+            using AZ::Simd::Vec4;
+            const Vec4::Int32Type biased = Vec4::And(Vec4::Xor(block, Vec4::Splat(AZStd::numeric_limits<int32_t>::min())), Vec4::Splat(static_cast<int32_t>(0xFFFF0000)));
+            return Vec4::Madd(Vec4::ConvertToFloat(biased), Vec4::Splat(1.0f / 65536.0f), Vec4::Splat(32768.0f));
+        }
+    } // namespace
+
+    void CompressedMotionData::SourceTracks::Resize(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_positions.resize(numJoints);
+        m_rotations.resize(numJoints);
+#ifndef EMFX_SCALE_DISABLED
+        m_scales.resize(numJoints);
+#endif
+        m_morphs.resize(numMorphs);
+        m_floats.resize(numFloats);
+    }
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, fast pose sampling)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+
+        // Sample all animated tracks at the uniform sample times.
+        SourceTracks tracks;
+        tracks.Resize(motionData->GetNumJoints(), motionData->GetNumMorphs(), motionData->GetNumFloats());
+        for (size_t i = 0; i < motionData->GetNumJoints(); ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { tracks.m_positions[i].resize(numSamples); }
+            if (rotAnimated) { tracks.m_rotations[i].resize(numSamples); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { tracks.m_scales[i].resize(numSamples); }
+            )
+
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(s * sampleSpacing, i);
+                if (posAnimated) tracks.m_positions[i][s] = transform.mPosition;
+                if (rotAnimated) tracks.m_rotations[i][s] = transform.mRotation.GetNormalized();
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated) tracks.m_scales[i][s] = transform.mScale;
+                )
+            }
+        }
+
+        for (size_t i = 0; i < motionData->GetNumMorphs(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                tracks.m_morphs[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    tracks.m_morphs[i][s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < motionData->GetNumFloats(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                tracks.m_floats[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    tracks.m_floats[i][s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        Compress(tracks, numSamples);
+
+        if (updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // Turn all tracks that stay within the error bounds into static values, which removes their lanes from the key rows.
+        // Ignored joints keep all their tracks, as these are usually root joints where small errors are very visible.
+        SourceTracks tracks = Decompress();
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            if (IsInIgnoreList(settings.m_jointIgnoreList, i))
+            {
+                continue;
+            }
+
+            AZStd::vector<AZ::Vector3>& positions = tracks.m_positions[i];
+            if (!positions.empty() && CalcMaxDeviation(positions, positions[0]) <= settings.m_maxPosError)
+            {
+                SetJointStaticPosition(i, positions[0]);
+                positions.clear();
+            }
+
+            AZStd::vector<AZ::Quaternion>& rotations = tracks.m_rotations[i];
+            if (!rotations.empty() && CalcMaxDeviation(rotations, rotations[0]) <= settings.m_maxRotError)
+            {
+                SetJointStaticRotation(i, rotations[0]);
+                rotations.clear();
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            AZStd::vector<AZ::Vector3>& scales = tracks.m_scales[i];
+            if (!scales.empty() && CalcMaxDeviation(scales, scales[0]) <= settings.m_maxScaleError)
+            {
+                SetJointStaticScale(i, scales[0]);
+                scales.clear();
+            }
+#endif
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            AZStd::vector<float>& values = tracks.m_morphs[i];
+            if (!values.empty() && !IsInIgnoreList(settings.m_morphIgnoreList, i) && CalcMaxDeviation(values, values[0]) <= settings.m_maxMorphError)
+            {
+                SetMorphStaticValue(i, values[0]);
+                values.clear();
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            AZStd::vector<float>& values = tracks.m_floats[i];
+            if (!values.empty() && !IsInIgnoreList(settings.m_floatIgnoreList, i) && CalcMaxDeviation(values, values[0]) <= settings.m_maxFloatError)
+            {
+                SetFloatStaticValue(i, values[0]);
+                values.clear();
+            }
+        }
+
+        Compress(tracks, m_numSamples);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // COMPRESSION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CompressedMotionData::AssignLanes()
+    {
+        // Attributes that are marked as animated (anything other than InvalidIndex32) get their lanes assigned in order, so that
+        // the lanes of a joint are next to each other and the key rows follow the order of the joint data.
+        m_numLanes = 0;
+        for (JointLanes& jointLanes : m_jointLanes)
+        {
+            if (jointLanes.m_position != InvalidIndex32) { jointLanes.m_position = m_numLanes; m_numLanes += s_numLanesPerAttribute; }
+            if (jointLanes.m_rotation != InvalidIndex32) { jointLanes.m_rotation = m_numLanes; m_numLanes += s_numLanesPerAttribute; }
+            EMFX_SCALECODE
+            (
+                if (jointLanes.m_scale != InvalidIndex32) { jointLanes.m_scale = m_numLanes; m_numLanes += s_numLanesPerAttribute; }
+            )
+        }
+
+        for (AZ::u32& lane : m_morphLanes)
+        {
+            if (lane != InvalidIndex32) { lane = m_numLanes++; }
+        }
+
+        for (AZ::u32& lane : m_floatLanes)
+        {
+            if (lane != InvalidIndex32) { lane = m_numLanes++; }
+        }
+
+        // Pad the rows to whole blocks, so that every row can be decoded a block at a time.
+        m_numLanes = ((m_numLanes + s_numLanesPerBlock - 1) / s_numLanesPerBlock) * s_numLanesPerBlock;
+
+        m_laneMins.assign(m_numLanes, 0.0f);
+        m_laneScales.assign(m_numLanes, 0.0f);
+        m_keys.assign(m_numSamples * m_numLanes, 0);
+    }
+
+    void CompressedMotionData::CompressLane(AZ::u32 lane, const AZStd::vector<float>& values)
+    {
+        AZ_Assert(values.size() == m_numSamples, "Expected %zu samples, but got %zu.", m_numSamples, values.size());
+
+        float minValue = AZStd::numeric_limits<float>::max();
+        float maxValue = -AZStd::numeric_limits<float>::max();
+        for (float value : values)
+        {
+            minValue = AZStd::min(minValue, value);
+            maxValue = AZStd::max(maxValue, value);
+        }
+
+        const float range = maxValue - minValue;
+        const float invScale = (range > 0.0f) ? s_maxQuantizedValue / range : 0.0f;
+        m_laneMins[lane] = minValue;
+        m_laneScales[lane] = (range > 0.0f) ? range / s_maxQuantizedValue : 0.0f;
+
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float quantized = AZ::GetClamp((values[s] - minValue) * invScale + 0.5f, 0.0f, s_maxQuantizedValue);
+            m_keys[s * m_numLanes + CalcKeyOffsetInRow(lane)] = static_cast<AZ::u16>(quantized);
+        }
+    }
+
+    void CompressedMotionData::Compress(const SourceTracks& tracks, size_t numSamples)
+    {
+        const size_t numJoints = tracks.m_positions.size();
+        m_numSamples = numSamples;
+        m_jointLanes.clear();
+        m_jointLanes.resize(numJoints);
+        m_morphLanes.assign(tracks.m_morphs.size(), InvalidIndex32);
+        m_floatLanes.assign(tracks.m_floats.size(), InvalidIndex32);
+
+        // Mark the animated attributes, so that they get their lanes assigned.
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!tracks.m_positions[i].empty()) { m_jointLanes[i].m_position = 0; }
+            if (!tracks.m_rotations[i].empty()) { m_jointLanes[i].m_rotation = 0; }
+            EMFX_SCALECODE
+            (
+                if (!tracks.m_scales[i].empty()) { m_jointLanes[i].m_scale = 0; }
+            )
+        }
+        for (size_t i = 0; i < tracks.m_morphs.size(); ++i)
+        {
+            if (!tracks.m_morphs[i].empty()) { m_morphLanes[i] = 0; }
+        }
+        for (size_t i = 0; i < tracks.m_floats.size(); ++i)
+        {
+            if (!tracks.m_floats[i].empty()) { m_floatLanes[i] = 0; }
+        }
+        AssignLanes();
+
+        // Quantize all lanes.
+        AZStd::vector<float> laneValues(m_numSamples);
+        const auto compressVector3Track = [this, &laneValues](AZ::u32 firstLane, const AZStd::vector<AZ::Vector3>& values)
+        {
+            for (AZ::u32 component = 0; component < 3; ++component)
+            {
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    laneValues[s] = values[s].GetElement(component);
+                }
+                CompressLane(firstLane + component, laneValues);
+            }
+        };
+
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const JointLanes& jointLanes = m_jointLanes[i];
+            if (jointLanes.m_position != InvalidIndex32)
+            {
+                compressVector3Track(jointLanes.m_position, tracks.m_positions[i]);
+            }
+
+            if (jointLanes.m_rotation != InvalidIndex32)
+            {
+                // Keep the rotations in the same hemisphere as the previous sample, so that interpolating the lanes doesn't take the long way around.
+                AZStd::vector<AZ::Quaternion> rotations = tracks.m_rotations[i];
+                for (size_t s = 1; s < m_numSamples; ++s)
+                {
+                    if (rotations[s].Dot(rotations[s - 1]) < 0.0f)
+                    {
+                        rotations[s] = -rotations[s];
+                    }
+                }
+
+                for (AZ::u32 component = 0; component < 4; ++component)
+                {
+                    for (size_t s = 0; s < m_numSamples; ++s)
+                    {
+                        laneValues[s] = rotations[s].GetElement(component);
+                    }
+                    CompressLane(jointLanes.m_rotation + component, laneValues);
+                }
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (jointLanes.m_scale != InvalidIndex32)
+            {
+                compressVector3Track(jointLanes.m_scale, tracks.m_scales[i]);
+            }
+#endif
+        }
+
+        for (size_t i = 0; i < m_morphLanes.size(); ++i)
+        {
+            if (m_morphLanes[i] != InvalidIndex32)
+            {
+                CompressLane(m_morphLanes[i], tracks.m_morphs[i]);
+            }
+        }
+
+        for (size_t i = 0; i < m_floatLanes.size(); ++i)
+        {
+            if (m_floatLanes[i] != InvalidIndex32)
+            {
+                CompressLane(m_floatLanes[i], tracks.m_floats[i]);
+            }
+        }
+    }
+
+    CompressedMotionData::SourceTracks CompressedMotionData::Decompress() const
+    {
+        SourceTracks tracks;
+        tracks.Resize(m_jointLanes.size(), m_morphLanes.size(), m_floatLanes.size());
+
+        for (size_t i = 0; i < m_jointLanes.size(); ++i)
+        {
+            const JointLanes& jointLanes = m_jointLanes[i];
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                if (jointLanes.m_position != InvalidIndex32)
+                {
+                    tracks.m_positions[i].emplace_back(AZ::Vector4(DecompressLanes(s, jointLanes.m_position)).GetAsVector3());
+                }
+                if (jointLanes.m_rotation != InvalidIndex32)
+                {
+                    tracks.m_rotations[i].emplace_back(AZ::Quaternion(DecompressLanes(s, jointLanes.m_rotation)).GetNormalized());
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (jointLanes.m_scale != InvalidIndex32)
+                {
+                    tracks.m_scales[i].emplace_back(AZ::Vector4(DecompressLanes(s, jointLanes.m_scale)).GetAsVector3());
+                }
+#endif
+            }
+        }
+
+        for (size_t i = 0; i < m_morphLanes.size(); ++i)
+        {
+            for (size_t s = 0; m_morphLanes[i] != InvalidIndex32 && s < m_numSamples; ++s)
+            {
+                tracks.m_morphs[i].emplace_back(DecompressLane(s, m_morphLanes[i]));
+            }
+        }
+
+        for (size_t i = 0; i < m_floatLanes.size(); ++i)
+        {
+            for (size_t s = 0; m_floatLanes[i] != InvalidIndex32 && s < m_numSamples; ++s)
+            {
+                tracks.m_floats[i].emplace_back(DecompressLane(s, m_floatLanes[i]));
+            }
+        }
+
+        return tracks;
+    }
+
+    float CompressedMotionData::DecompressLane(size_t sampleIndex, AZ::u32 lane) const
+    {
+        return m_laneMins[lane] + static_cast<float>(m_keys[sampleIndex * m_numLanes + CalcKeyOffsetInRow(lane)]) * m_laneScales[lane];
+    }
+
+    AZ::Simd::Vec4::FloatType CompressedMotionData::DecompressLanes(size_t sampleIndex, AZ::u32 firstLane) const
+    {
+        using namespace AZ::Simd;
+        AZ_Assert(firstLane % s_numLanesPerAttribute == 0, "Expected the first lane of an attribute.");
+        const Vec4::Int32Type block = LoadKeyBlock(&m_keys[sampleIndex * m_numLanes + (firstLane & ~(s_numLanesPerBlock - 1))]);
+        const Vec4::FloatType quantized = (firstLane & s_numLanesPerAttribute) ? ExtractHighKeys(block) : ExtractLowKeys(block);
+        return Vec4::Madd(quantized, Vec4::LoadUnaligned(&m_laneScales[firstLane]), Vec4::LoadUnaligned(&m_laneMins[firstLane]));
+    }
+
+    void CompressedMotionData::DecodeRows(size_t indexA, size_t indexB, float t, float* outLanes) const
+    {
+        using namespace AZ::Simd;
+        const AZ::u16* keysA = &m_keys[indexA * m_numLanes];
+        const AZ::u16* keysB = &m_keys[indexB * m_numLanes];
+        const float* laneMins = m_laneMins.data();
+        const float* laneScales = m_laneScales.data();
+        const Vec4::FloatType weight = Vec4::Splat(t);
+
+        // Interpolate the quantized keys first, dequantizing is linear, so the interpolated value only has to be dequantized once.
+        for (AZ::u32 lane = 0; lane < m_numLanes; lane += s_numLanesPerBlock)
+        {
+            const Vec4::Int32Type blockA = LoadKeyBlock(keysA + lane);
+            const Vec4::Int32Type blockB = LoadKeyBlock(keysB + lane);
+
+            const Vec4::FloatType lowA = ExtractLowKeys(blockA);
+            const Vec4::FloatType low = Vec4::Madd(Vec4::Sub(ExtractLowKeys(blockB), lowA), weight, lowA);
+            Vec4::StoreUnaligned(outLanes + lane, Vec4::Madd(low, Vec4::LoadUnaligned(laneScales + lane), Vec4::LoadUnaligned(laneMins + lane)));
+
+            const Vec4::FloatType highA = ExtractHighKeys(blockA);
+            const Vec4::FloatType high = Vec4::Madd(Vec4::Sub(ExtractHighKeys(blockB), highA), weight, highA);
+            Vec4::StoreUnaligned(outLanes + lane + 4, Vec4::Madd(high, Vec4::LoadUnaligned(laneScales + lane + 4), Vec4::LoadUnaligned(laneMins + lane + 4)));
+        }
+    }
+
+    Transform CompressedMotionData::GetDecodedJointTransform(const float* decodedLanes, size_t jointDataIndex) const
+    {
+        const JointLanes& jointLanes = m_jointLanes[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.mPosition = (jointLanes.m_position != InvalidIndex32) ? AZ::Vector3::CreateFromFloat3(decodedLanes + jointLanes.m_position) : staticTransform.mPosition;
+        result.mRotation = (jointLanes.m_rotation != InvalidIndex32) ? AZ::Quaternion::CreateFromFloat4(decodedLanes + jointLanes.m_rotation).GetNormalized() : staticTransform.mRotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.mScale = (jointLanes.m_scale != InvalidIndex32) ? AZ::Vector3::CreateFromFloat3(decodedLanes + jointLanes.m_scale) : staticTransform.mScale;
+#endif
+        return result;
+    }
+
+    AZ::Simd::Vec4::FloatType CompressedMotionData::SampleLanes(size_t indexA, size_t indexB, float t, AZ::u32 firstLane) const
+    {
+        using namespace AZ::Simd;
+        const Vec4::FloatType valueA = DecompressLanes(indexA, firstLane);
+        const Vec4::FloatType valueB = DecompressLanes(indexB, firstLane);
+        return Vec4::Madd(Vec4::Sub(valueB, valueA), Vec4::Splat(t), valueA);
+    }
+
+    float CompressedMotionData::SampleLane(size_t indexA, size_t indexB, float t, AZ::u32 lane) const
+    {
+        return AZ::Lerp(DecompressLane(indexA, lane), DecompressLane(indexB, lane), t);
+    }
+
+    Transform CompressedMotionData::InterpolateJointTransform(size_t indexA, size_t indexB, float t, size_t jointDataIndex) const
+    {
+        const JointLanes& jointLanes = m_jointLanes[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.mPosition = (jointLanes.m_position != InvalidIndex32) ? AZ::Vector4(SampleLanes(indexA, indexB, t, jointLanes.m_position)).GetAsVector3() : staticTransform.mPosition;
+        result.mRotation = (jointLanes.m_rotation != InvalidIndex32) ? AZ::Quaternion(SampleLanes(indexA, indexB, t, jointLanes.m_rotation)).GetNormalized() : staticTransform.mRotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.mScale = (jointLanes.m_scale != InvalidIndex32) ? AZ::Vector4(SampleLanes(indexA, indexB, t, jointLanes.m_scale)).GetAsVector3() : staticTransform.mScale;
+#endif
+        return result;
+    }
+
+    size_t CompressedMotionData::CalcKeyDataSizeInBytes() const
+    {
+        return m_keys.size() * sizeof(AZ::u16) + (m_laneMins.size() + m_laneScales.size()) * sizeof(float);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SAMPLING
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Transform CompressedMotionData::SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZ::u32 jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex32)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex32 && !inPlace)
+        {
+            result = InterpolateJointTransform(indexA, indexB, t, jointDataIndex);
+        }
+        else if (settings.m_inputPose && !inPlace)
+        {
+            result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+        }
+        else
+        {
+            result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.mAxis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).mSourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.mFlags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        // All joints read from the same two key rows.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        // Decode both key rows in one linear pass, into the scratch buffer of the thread that updates the actor instance.
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        AZStd::vector<float>& decodedLanes = GetEMotionFX().GetThreadData(actorInstance->GetThreadIndex())->GetMotionSampleBuffer();
+        if (decodedLanes.size() < m_numLanes)
+        {
+            decodedLanes.resize(m_numLanes);
+        }
+        if (!m_keys.empty())
+        {
+            DecodeRows(indexA, indexB, t, decodedLanes.data());
+        }
+
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                result = GetDecodedJointTransform(decodedLanes.data(), jointDataIndex);
+            }
+            else if (m_additive && jointDataIndex == InvalidIndex32)
+            {
+                result = Transform::CreateIdentity();
+            }
+            else if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+            }
+            else
+            {
+                result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const AZ::u32 lane = m_morphLanes[realIndex];
+                outputPose->SetMorphWeight(i, (lane != InvalidIndex32) ? decodedLanes[lane] : m_staticMorphData[realIndex].m_staticValue);
+            }
+            else if (settings.m_inputPose)
+            {
+                outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+            }
+            else
+            {
+                outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const AZ::u32 lane = m_morphLanes[morphDataIndex];
+        if (lane == InvalidIndex32)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleLane(indexA, indexB, t, lane);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const AZ::u32 lane = m_floatLanes[floatDataIndex];
+        if (lane == InvalidIndex32)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleLane(indexA, indexB, t, lane);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return InterpolateJointTransform(indexA, indexB, t, jointDataIndex);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 lane = m_jointLanes[jointDataIndex].m_position;
+        if (lane == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mPosition;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return AZ::Vector4(SampleLanes(indexA, indexB, t, lane)).GetAsVector3();
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 lane = m_jointLanes[jointDataIndex].m_rotation;
+        if (lane == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mRotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return AZ::Quaternion(SampleLanes(indexA, indexB, t, lane)).GetNormalized();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 lane = m_jointLanes[jointDataIndex].m_scale;
+        if (lane == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mScale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return AZ::Vector4(SampleLanes(indexA, indexB, t, lane)).GetAsVector3();
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DATA MANAGEMENT
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.Resize(numJoints, numMorphs, numFloats);
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointLanes.size(), "Expected the size of the jointLanes vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointLanes.emplace_back(); // A new joint isn't animated, so it doesn't need any lanes.
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphLanes.size(), "Expected the size of the morphLanes vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphLanes.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatLanes.size(), "Expected the size of the floatLanes vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatLanes.emplace_back(InvalidIndex32);
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_positions.erase(tracks.m_positions.begin() + jointDataIndex);
+        tracks.m_rotations.erase(tracks.m_rotations.begin() + jointDataIndex);
+        EMFX_SCALECODE
+        (
+            tracks.m_scales.erase(tracks.m_scales.begin() + jointDataIndex);
+        )
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_morphs.erase(tracks.m_morphs.begin() + morphDataIndex);
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_floats.erase(tracks.m_floats.begin() + floatDataIndex);
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointLanes.clear();
+        m_jointLanes.shrink_to_fit();
+        m_morphLanes.clear();
+        m_morphLanes.shrink_to_fit();
+        m_floatLanes.clear();
+        m_floatLanes.shrink_to_fit();
+        m_laneMins.clear();
+        m_laneMins.shrink_to_fit();
+        m_laneScales.clear();
+        m_laneScales.shrink_to_fit();
+        m_keys.clear();
+        m_keys.shrink_to_fit();
+        m_numLanes = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        SourceTracks tracks = Decompress();
+        for (size_t i = 0; i < m_jointLanes.size(); ++i)
+        {
+            tracks.m_positions[i].clear();
+            tracks.m_rotations[i].clear();
+            EMFX_SCALECODE
+            (
+                tracks.m_scales[i].clear();
+            )
+        }
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        SourceTracks tracks = Decompress();
+        for (AZStd::vector<float>& values : tracks.m_morphs)
+        {
+            values.clear();
+        }
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        SourceTracks tracks = Decompress();
+        for (AZStd::vector<float>& values : tracks.m_floats)
+        {
+            values.clear();
+        }
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_positions[jointDataIndex].clear();
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_rotations[jointDataIndex].clear();
+        Compress(tracks, m_numSamples);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_scales[jointDataIndex].clear();
+        Compress(tracks, m_numSamples);
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_positions[jointDataIndex].clear();
+        tracks.m_rotations[jointDataIndex].clear();
+        EMFX_SCALECODE
+        (
+            tracks.m_scales[jointDataIndex].clear();
+        )
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_morphs[morphDataIndex].clear();
+        Compress(tracks, m_numSamples);
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        SourceTracks tracks = Decompress();
+        tracks.m_floats[floatDataIndex].clear();
+        Compress(tracks, m_numSamples);
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointLanes[jointDataIndex].m_position != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointLanes[jointDataIndex].m_rotation != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointLanes[jointDataIndex].m_scale != InvalidIndex32;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex);
+#else
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex);
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphLanes[morphDataIndex] != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatLanes[floatDataIndex] != InvalidIndex32;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range of the position lanes scales all decompressed positions.
+        for (const JointLanes& jointLanes : m_jointLanes)
+        {
+            if (jointLanes.m_position != InvalidIndex32)
+            {
+                for (AZ::u32 lane = jointLanes.m_position; lane < jointLanes.m_position + 3; ++lane)
+                {
+                    m_laneMins[lane] *= scaleFactor;
+                    m_laneScales[lane] *= scaleFactor;
+                }
+            }
+        }
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    AZ::u32 CompressedMotionData::GetNumLanes() const
+    {
+        return m_numLanes;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        m_sampleSpacing = (m_sampleRate > AZ::Constants::FloatEpsilon) ? 1.0f / m_sampleRate : 0.0f;
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numLanes = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // float[m_numLanes]                (the lane minimum values)
+        // float[m_numLanes]                (the lane scales)
+        // u16[m_numSamples * m_numLanes]   (the key rows, in blocks of eight lanes stored in lane order 0 4 1 5 2 6 3 7)
+    };
+
+    enum File_CompressedMotionData_Flags : AZ::u8
+    {
+        IsAnimated = 1 << 0,
+        IsPositionAnimated = 1 << 1,
+        IsRotationAnimated = 1 << 2,
+        IsScaleAnimated = 1 << 3
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u8                          m_flags = 0; // The flags (see File_CompressedMotionData_Flags).
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        AZ::u8 m_flags = 0;         // The flags (see File_CompressedMotionData_Flags).
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += CalcKeyDataSizeInBytes();
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numLanes = m_numLanes;
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numLanes, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            #ifndef EMFX_SCALE_DISABLED
+                const AZ::PackedVector3f poseScale(GetJointStaticScale(i));
+                const AZ::PackedVector3f bindPoseScale(GetJointBindPoseScale(i));
+            #else
+                const AZ::PackedVector3f poseScale(1.0f, 1.0f, 1.0f);
+                const AZ::PackedVector3f bindPoseScale(1.0f, 1.0f, 1.0f);
+            #endif
+
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_staticScale, poseScale);
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, bindPoseScale);
+
+            if (IsJointAnimated(i)) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsAnimated; }
+            if (IsJointPositionAnimated(i)) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsPositionAnimated; }
+            if (IsJointRotationAnimated(i)) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsRotationAnimated; }
+            EMFX_SCALECODE
+            (
+                if (IsJointScaleAnimated(i)) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsScaleAnimated; }
+            )
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", IsJointPositionAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", IsJointRotationAnimated(i) ? "Yes" : "No");
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the morph and float channels.
+        const auto saveFloatChannel = [stream, targetEndianType](const AZStd::string& name, float staticValue, bool isAnimated)
+        {
+            if (name.empty())
+            {
+                MCore::LogError("Cannot save a morph or float channel with an empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_flags = isAnimated ? File_CompressedMotionData_Flags::IsAnimated : 0;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(name, stream, targetEndianType);
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!saveFloatChannel(GetMorphName(i), GetMorphStaticValue(i), IsMorphAnimated(i)))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!saveFloatChannel(GetFloatName(i), GetFloatStaticValue(i), IsFloatAnimated(i)))
+            {
+                return false;
+            }
+        }
+
+        return SaveKeys(stream, saveSettings);
+    }
+
+    bool CompressedMotionData::SaveKeys(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        if (m_numLanes == 0)
+        {
+            return true;
+        }
+
+        // Convert copies of the data, so we can write it in one go.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        AZStd::vector<float> laneRanges;
+        laneRanges.reserve(m_numLanes * 2);
+        laneRanges.insert(laneRanges.end(), m_laneMins.begin(), m_laneMins.end());
+        laneRanges.insert(laneRanges.end(), m_laneScales.begin(), m_laneScales.end());
+        for (float& value : laneRanges)
+        {
+            ExporterLib::ConvertFloat(&value, targetEndianType);
+        }
+        if (stream->Write(laneRanges.data(), laneRanges.size() * sizeof(float)) == 0)
+        {
+            return false;
+        }
+
+        if (m_keys.empty())
+        {
+            return true;
+        }
+
+        AZStd::vector<AZ::u16> keys = m_keys;
+        for (AZ::u16& key : keys)
+        {
+            ExporterLib::ConvertUnsignedShort(&key, targetEndianType);
+        }
+        return stream->Write(keys.data(), keys.size() * sizeof(AZ::u16)) != 0;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numLanes, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumLanes   = %d", info.m_numLanes);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        SetSampleRate(info.m_sampleRate);
+        m_numSamples = info.m_numSamples;
+        UpdateDuration();
+
+        // Read all joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.mX, jointInfo.m_staticPos.mY, jointInfo.m_staticPos.mZ);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.mX, jointInfo.m_staticScale.mY, jointInfo.m_staticScale.mZ);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.mX, jointInfo.m_staticRot.mY, jointInfo.m_staticRot.mZ, jointInfo.m_staticRot.mW);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.mX, jointInfo.m_bindPosePos.mY, jointInfo.m_bindPosePos.mZ);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.mX, jointInfo.m_bindPoseScale.mY, jointInfo.m_bindPoseScale.mZ);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.mX, jointInfo.m_bindPoseRot.mY, jointInfo.m_bindPoseRot.mZ, jointInfo.m_bindPoseRot.mW);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+            SetJointName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+
+            // Mark the animated attributes, the lanes get assigned once we read everything.
+            JointLanes& jointLanes = m_jointLanes[i];
+            if (jointInfo.m_flags & File_CompressedMotionData_Flags::IsPositionAnimated) { jointLanes.m_position = 0; }
+            if (jointInfo.m_flags & File_CompressedMotionData_Flags::IsRotationAnimated) { jointLanes.m_rotation = 0; }
+            EMFX_SCALECODE
+            (
+                if (jointInfo.m_flags & File_CompressedMotionData_Flags::IsScaleAnimated) { jointLanes.m_scale = 0; }
+            )
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, GetJointName(i).c_str());
+            }
+        }
+
+        // Read the morph and float channels.
+        const auto readFloatChannel = [stream, sourceEndianType](AZStd::string& name, float& staticValue, AZ::u32& lane)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            staticValue = floatInfo.m_staticValue;
+            lane = (floatInfo.m_flags & File_CompressedMotionData_Flags::IsAnimated) ? 0 : InvalidIndex32;
+            return true;
+        };
+
+        AZStd::string name;
+        float staticValue = 0.0f;
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!readFloatChannel(name, staticValue, m_morphLanes[i]))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!readFloatChannel(name, staticValue, m_floatLanes[i]))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        AssignLanes();
+        if (m_numLanes != info.m_numLanes)
+        {
+            AZ_Error("EMotionFX", false, "The number of lanes (%d) doesn't match the animated tracks (%d lanes).", info.m_numLanes, m_numLanes);
+            return false;
+        }
+
+        if (m_numLanes == 0)
+        {
+            return true;
+        }
+
+        // Read the lane ranges and key rows in one go.
+        if (stream->Read(m_laneMins.data(), m_numLanes * sizeof(float)) == 0 ||
+            stream->Read(m_laneScales.data(), m_numLanes * sizeof(float)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertFloat(m_laneMins.data(), sourceEndianType, m_numLanes);
+        MCore::Endian::ConvertFloat(m_laneScales.data(), sourceEndianType, m_numLanes);
+
+        if (!m_keys.empty())
+        {
+            if (stream->Read(m_keys.data(), m_keys.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_keys.data(), sourceEndianType, static_cast<AZ::u32>(m_keys.size()));
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
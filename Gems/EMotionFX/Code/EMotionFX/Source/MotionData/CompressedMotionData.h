@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    // Uniformly sampled motion data, where the keys of all animated tracks are stored interleaved per sample (one key row per sample time),
+    // and every track component (lane) is quantized to 16 bits using the value range of that lane.
+    // Sampling a pose decodes the two contiguous key rows it interpolates between in one linear SIMD pass, eight lanes at a time,
+    // and then scatters the decoded lanes into the pose.
+    // Positions, rotations and scales each take four lanes, morphs and floats take a single lane.
+    // Tracks that stay within the error bounds of the optimize settings are turned into static values and are not stored in the key rows.
+    // The data can't be modified per sample. Edits like removing joints or clearing tracks decompress and recompress the key rows.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{5E3B0F8C-6A51-4C3B-9B57-2A3D3C9E4F71}", MotionData)
+
+        static constexpr AZ::u32 s_numLanesPerAttribute = 4;
+        static constexpr AZ::u32 s_numLanesPerBlock = 8; // The key rows are padded to a multiple of this, so they can be decoded a block at a time.
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        AZ::u32 GetNumLanes() const;
+        size_t CalcKeyDataSizeInBytes() const; // The memory used by the key rows and the lane ranges.
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        // The first lane of each attribute inside a key row, or InvalidIndex32 when the attribute isn't animated.
+        struct EMFX_API JointLanes
+        {
+            AZ::u32 m_position = InvalidIndex32;
+            AZ::u32 m_rotation = InvalidIndex32;
+#ifndef EMFX_SCALE_DISABLED
+            AZ::u32 m_scale = InvalidIndex32;
+#endif
+        };
+
+        // Uncompressed samples, used to (re)build the key rows. Empty vectors represent tracks that are not animated.
+        struct EMFX_API SourceTracks
+        {
+            AZStd::vector<AZStd::vector<AZ::Vector3>> m_positions;
+            AZStd::vector<AZStd::vector<AZ::Quaternion>> m_rotations;
+#ifndef EMFX_SCALE_DISABLED
+            AZStd::vector<AZStd::vector<AZ::Vector3>> m_scales;
+#endif
+            AZStd::vector<AZStd::vector<float>> m_morphs;
+            AZStd::vector<AZStd::vector<float>> m_floats;
+
+            void Resize(size_t numJoints, size_t numMorphs, size_t numFloats);
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void AssignLanes();
+        void Compress(const SourceTracks& tracks, size_t numSamples);
+        SourceTracks Decompress() const;
+        void CompressLane(AZ::u32 lane, const AZStd::vector<float>& values);
+        float DecompressLane(size_t sampleIndex, AZ::u32 lane) const;
+        AZ::Simd::Vec4::FloatType DecompressLanes(size_t sampleIndex, AZ::u32 firstLane) const;
+        AZ::Simd::Vec4::FloatType SampleLanes(size_t indexA, size_t indexB, float t, AZ::u32 firstLane) const;
+        float SampleLane(size_t indexA, size_t indexB, float t, AZ::u32 lane) const;
+        Transform InterpolateJointTransform(size_t indexA, size_t indexB, float t, size_t jointDataIndex) const;
+        void DecodeRows(size_t indexA, size_t indexB, float t, float* outLanes) const; // Interpolates and dequantizes all m_numLanes lanes.
+        Transform GetDecodedJointTransform(const float* decodedLanes, size_t jointDataIndex) const;
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        bool SaveKeys(MCore::Stream* stream, const SaveSettings& saveSettings) const;
+
+        AZStd::vector<JointLanes> m_jointLanes;
+        AZStd::vector<AZ::u32> m_morphLanes;
+        AZStd::vector<AZ::u32> m_floatLanes;
+        AZStd::vector<float> m_laneMins;        // The minimum value of each lane.
+        AZStd::vector<float> m_laneScales;      // The value range of each lane divided by the maximum quantized value.
+        AZStd::vector<AZ::u16> m_keys;          // m_numSamples rows of m_numLanes quantized values. The keys of each block of eight lanes are stored in lane order 0 4 1 5 2 6 3 7.
+        AZ::u32 m_numLanes = 0;                 // Always a multiple of s_numLanesPerBlock.
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -10,7 +10,6 @@
 #include "MultiThreadScheduler.h"
 #include "ActorManager.h"
 #include "ActorInstance.h"
-#include "AnimGraphInstance.h"
 #include "Attachment.h"
 #include "EMotionFXManager.h"
 #include <EMotionFX/Source/Allocators.h>
@@ -30,9 +29,8 @@ namespace EMotionFX
     MultiThreadScheduler::MultiThreadScheduler()
         : ActorUpdateScheduler()
     {
-        mSteps.SetMemoryCategory(EMFX_MEMCATEGORY_UPDATESCHEDULERS);
-        mCleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
-        mSteps.Reserve(1000);
+        m_rootActorInstances.reserve(1024);
+        m_executeRootActorInstances.reserve(1024);
     }
 
 
@@ -53,88 +51,71 @@ namespace EMotionFX
     void MultiThreadScheduler::Clear()
     {
         Lock();
-        mSteps.Clear();
+        m_rootActorInstances.clear();
+        m_isScheduleDirty = true;
         Unlock();
     }
 
 
-    // add the actor instance dependencies to the schedule step
-    void MultiThreadScheduler::AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep)
-    {
-        MCORE_UNUSED(outStep);
-        MCORE_UNUSED(instance);
-    }
-
-
-    // check if there is a matching dependency for a given actor
-    bool MultiThreadScheduler::CheckIfHasMatchingDependency(ActorInstance* instance, ScheduleStep* step) const
-    {
-        MCORE_UNUSED(instance);
-        MCORE_UNUSED(step);
-        return false;
-    }
-
-
     // log it, for debugging purposes
     void MultiThreadScheduler::Print()
     {
-        // for all steps
-        const uint32 numSteps = mSteps.GetLength();
-        for (uint32 i = 0; i < numSteps; ++i)
+        MCore::LockGuardRecursive guard(mMutex);
+
+        const size_t numRootActorInstances = m_rootActorInstances.size();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
         {
-            AZ_Printf("EMotionFX", "STEP %.3d - %d", i, mSteps[i].mActorInstances.size());
+            const ActorInstance* actorInstance = m_rootActorInstances[i];
+            AZ_Printf("EMotionFX", "ROOT %.3zu - ID=%d, Joints=%d, Attachments=%d", i, actorInstance->GetID(), CalcActorInstanceCost(actorInstance), actorInstance->GetNumAttachments());
         }
 
         AZ_Printf("EMotionFX", "---------");
     }
 
 
-    void MultiThreadScheduler::RemoveEmptySteps()
+    // calculate the number of joints to update for the actor instance and all of its attachments
+    uint32 MultiThreadScheduler::CalcActorInstanceCost(const ActorInstance* actorInstance)
     {
-        // process all steps
-        for (uint32 s = 0; s < mSteps.GetLength(); )
+        uint32 cost = actorInstance->GetNumEnabledNodes();
+
+        const uint32 numAttachments = actorInstance->GetNumAttachments();
+        for (uint32 i = 0; i < numAttachments; ++i)
         {
-            // if the step isn't empty
-            if (mSteps[s].mActorInstances.size() > 0)
+            const ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment && attachment->GetIsEnabled())
             {
-                s++;
-            }
-            else // otherwise remove it
-            {
-                mSteps.Remove(s);
+                cost += CalcActorInstanceCost(attachment);
             }
         }
+
+        return cost;
     }
 
 
     // execute the schedule
     void MultiThreadScheduler::Execute(float timePassedInSeconds)
     {
-        MCore::LockGuardRecursive guard(mMutex);
-
-        uint32 numSteps = mSteps.GetLength();
-        if (numSteps == 0)
+        // pick up the changes to the schedule, the updates themselves run unlocked so that other threads can insert and remove
+        // actor instances meanwhile, which only affects the next execute
         {
-            return;
-        }
+            MCore::LockGuardRecursive guard(mMutex);
+            if (m_isScheduleDirty)
+            {
+                m_executeRootActorInstances = m_rootActorInstances;
+                m_isScheduleDirty = false;
+            }
 
-        // check if we need to cleanup the schedule
-        mCleanTimer += timePassedInSeconds;
-        if (mCleanTimer >= 1.0f)
-        {
-            mCleanTimer = 0.0f;
-            RemoveEmptySteps();
-            numSteps = mSteps.GetLength();
-        }
+            if (m_executeRootActorInstances.empty())
+            {
+                return;
+            }
 
-        //-----------------------------------------------------------
+            m_isExecuting = true;
+        }
 
         // propagate root actor instance visibility to their attachments
-        const ActorManager& actorManager = GetActorManager();
-        const uint32 numRootActorInstances = actorManager.GetNumRootActorInstances();
-        for (uint32 i = 0; i < numRootActorInstances; ++i)
+        for (ActorInstance* rootInstance : m_executeRootActorInstances)
         {
-            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
             if (rootInstance->GetIsEnabled() == false)
             {
                 continue;
@@ -144,210 +125,179 @@ namespace EMotionFX
         }
 
         // reset stats
-        mNumUpdated.SetValue(0);
-        mNumVisible.SetValue(0);
-        mNumSampled.SetValue(0);
-
-        for (uint32 s = 0; s < numSteps; ++s)
+        BeginFrame();
+
+        // group the root actor instances into batches of similar cost
+        m_batches.clear();
+        uint32 batchCost = 0;
+        size_t batchBegin = 0;
+        const size_t numRootActorInstances = m_executeRootActorInstances.size();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
         {
-            const ScheduleStep& currentStep = mSteps[s];
-
-            // skip empty steps
-            const size_t numStepEntries = currentStep.mActorInstances.size();
-            if (numStepEntries == 0)
+            const ActorInstance* rootInstance = m_executeRootActorInstances[i];
+            if (rootInstance->GetIsEnabled())
             {
-                continue;
+                batchCost += CalcActorInstanceCost(rootInstance);
             }
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;           
-            for (uint32 c = 0; c < numStepEntries; ++c)
+            if (batchCost >= m_maxJointsPerBatch)
             {
-                ActorInstance* actorInstance = currentStep.mActorInstances[c];
-                if (actorInstance->GetIsEnabled() == false)
-                {
-                    continue;
-                }
+                m_batches.push_back({ batchBegin, i + 1 });
+                batchBegin = i + 1;
+                batchCost = 0;
+            }
+        }
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
-                {
-                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+        if (batchBegin < numRootActorInstances)
+        {
+            m_batches.push_back({ batchBegin, numRootActorInstances });
+        }
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+        // process the batches in parallel, where each job keeps picking the next batch that is not being processed yet
+        const AZ::u32 numWorkerThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        const AZ::u32 maxNumParallelJobs = (m_maxNumParallelJobs > 0) ? m_maxNumParallelJobs : numWorkerThreads;
+        const size_t numJobs = AZStd::min<size_t>(maxNumParallelJobs, m_batches.size());
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        mNumVisible.Increment();
-                    }
+        AZStd::atomic<size_t> nextBatchIndex{ 0 };
+        AZ::JobCompletion jobCompletion;
+        for (size_t j = 0; j < numJobs; ++j)
+        {
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, &nextBatchIndex, &jobCompletion]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+                const size_t numBatches = m_batches.size();
+                for (size_t batchIndex = nextBatchIndex++; batchIndex < numBatches; batchIndex = nextBatchIndex++)
+                {
+                    const Batch& batch = m_batches[batchIndex];
+                    for (size_t i = batch.m_begin; i < batch.m_end; ++i)
                     {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
+                        ExecuteActorInstance(m_executeRootActorInstances[i], timePassedInSeconds, &jobCompletion);
                     }
+                }
+            }, true, jobContext);
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-                }, true, jobContext);
-
-                job->SetDependent(&jobCompletion);               
-                job->Start();
-
-                mNumUpdated.Increment();
-            }
-
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
-    }
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
 
+        jobCompletion.StartAndWaitForCompletion();
 
-    // find the next free spot in the schedule
-    bool MultiThreadScheduler::FindNextFreeItem(ActorInstance* actorInstance, uint32 startStep, uint32* outStepNr)
-    {
-        // try out all steps
-        const uint32 numSteps = mSteps.GetLength();
-        for (uint32 s = startStep; s < numSteps; ++s)
+        // delete the actor instances that got destroyed while they could still be updated
+        AZStd::vector<ActorInstance*> deferredDeletes;
         {
-            // if there is a conflicting dependency, skip this step
-            if (CheckIfHasMatchingDependency(actorInstance, &mSteps[s]))
-            {
-                continue;
-            }
-
-            // we found a free spot!
-            *outStepNr = s;
-            return true;
+            MCore::LockGuardRecursive guard(mMutex);
+            m_isExecuting = false;
+            deferredDeletes.swap(m_deferredDeletes);
         }
 
-        *outStepNr = numSteps;
-        return false;
-    }
-
-    bool MultiThreadScheduler::HasActorInstanceInSteps(const ActorInstance* actorInstance) const
-    {
-        const uint32 numSteps = mSteps.GetLength();
-        for (uint32 s = 0; s < numSteps; ++s)
+        for (ActorInstance* actorInstance : deferredDeletes)
         {
-            const ScheduleStep& step = mSteps[s];
-            if (AZStd::find(step.mActorInstances.begin(), step.mActorInstances.end(), actorInstance) != step.mActorInstances.end())
-            {
-                return true;
-            }
+            actorInstance->Delete();
         }
-
-        return false;
     }
 
-    void MultiThreadScheduler::RecursiveInsertActorInstance(ActorInstance* instance, uint32 startStep)
-    {
-        MCore::LockGuardRecursive guard(mMutex);
-        AZ_Assert(!HasActorInstanceInSteps(instance), "Expected the actor instance not being part of another step already.");
 
-        // find the first free location that doesn't conflict
-        uint32 outStep = startStep;
-        if (!FindNextFreeItem(instance, startStep, &outStep))
+    // update the actor instance and kick off the jobs for its attachments
+    void MultiThreadScheduler::ExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, AZ::Job* jobCompletion)
+    {
+        if (actorInstance->GetIsEnabled() == false)
         {
-            mSteps.Reserve(10);
-            mSteps.AddEmpty();
-            outStep = mSteps.GetLength() - 1;
+            return;
         }
 
-        // pre-allocate step size
-        if (mSteps[outStep].mActorInstances.size() % 10 == 0)
-        {
-            mSteps[outStep].mActorInstances.reserve(mSteps[outStep].mActorInstances.size() + 10);
-        }
+        const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+        actorInstance->SetThreadIndex(threadIndex);
 
-        if (mSteps[outStep].mDependencies.GetLength() % 5 == 0)
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
         {
-            mSteps[outStep].mDependencies.Reserve(mSteps[outStep].mDependencies.GetLength() + 5);
+            mNumVisible.Increment();
         }
 
-        // add the actor instance and its dependencies
-        mSteps[ outStep ].mActorInstances.reserve(GetEMotionFX().GetNumThreads());
-        mSteps[ outStep ].mActorInstances.emplace_back(instance);
-        AddDependenciesToStep(instance, &mSteps[outStep]);
+        // check if we want to sample motions, taking the update-rate LOD into account
+        const bool sampleMotions = CheckShouldSampleMotions(actorInstance, timePassedInSeconds, isVisible);
 
-        // recursively add all attachments too
-        const uint32 numAttachments = instance->GetNumAttachments();
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+        mNumUpdated.Increment();
+
+        // the attachments only depend on the actor instance they are attached to, so they can be updated now
+        // the job completion is still waiting on the job we are running in, so it is safe to add dependents to it
+        const uint32 numAttachments = actorInstance->GetNumAttachments();
         for (uint32 i = 0; i < numAttachments; ++i)
         {
-            ActorInstance* attachment = instance->GetAttachment(i)->GetAttachmentActorInstance();
-            if (attachment)
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment && attachment->GetIsEnabled())
             {
-                RecursiveInsertActorInstance(attachment, outStep + 1);
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, attachment, timePassedInSeconds, jobCompletion]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::AttachmentUpdateJob");
+                    ExecuteActorInstance(attachment, timePassedInSeconds, jobCompletion);
+                }, true, jobContext);
+
+                job->SetDependentStarted(jobCompletion);
+                job->Start();
             }
         }
     }
 
 
-    // remove the actor instance from the schedule (excluding attachments)
-    uint32 MultiThreadScheduler::RemoveActorInstance(ActorInstance* actorInstance, uint32 startStep)
+    void MultiThreadScheduler::RecursiveInsertActorInstance(ActorInstance* instance, uint32 startStep)
     {
+        AZ_UNUSED(startStep);
         MCore::LockGuardRecursive guard(mMutex);
 
-        // for all scheduler steps, starting from the specified start step number
-        const uint32 numSteps = mSteps.GetLength();
-        for (uint32 s = startStep; s < numSteps; ++s)
+        // attachments are updated right after the actor instance they are attached to
+        if (instance->GetAttachedTo())
         {
-            ScheduleStep& step = mSteps[s];
+            return;
+        }
 
-            // Remove all occurrences of the actor instance.
-            const size_t numActorInstancesPreRemove = step.mActorInstances.size();
-            step.mActorInstances.erase(AZStd::remove(step.mActorInstances.begin(), step.mActorInstances.end(), actorInstance), step.mActorInstances.end());
+        AZ_Assert(AZStd::find(m_rootActorInstances.begin(), m_rootActorInstances.end(), instance) == m_rootActorInstances.end(),
+            "Expected the actor instance not being part of the schedule already.");
+        m_rootActorInstances.emplace_back(instance);
+        m_isScheduleDirty = true;
+    }
 
-            // try to see if there is anything to remove in this step
-            // and if so, reconstruct the dependencies of this step
-            if (step.mActorInstances.size() < numActorInstancesPreRemove)
-            {
-                // clear the dependencies (but don't delete the memory)
-                step.mDependencies.Clear(false);
 
-                // calculate the new dependencies for this step
-                for (ActorInstance* stepActorInstance : step.mActorInstances)
-                {
-                    AddDependenciesToStep(stepActorInstance, &step);
-                }
+    // remove the actor instance from the schedule
+    uint32 MultiThreadScheduler::RemoveActorInstance(ActorInstance* actorInstance, uint32 startStep)
+    {
+        AZ_UNUSED(startStep);
+        MCore::LockGuardRecursive guard(mMutex);
 
-                // assume that there is only one of the same actor instance in the whole schedule
-                RemoveEmptySteps();
-                return s;
-            }
+        const auto iterator = AZStd::find(m_rootActorInstances.begin(), m_rootActorInstances.end(), actorInstance);
+        if (iterator != m_rootActorInstances.end())
+        {
+            m_rootActorInstances.erase(iterator);
+            m_isScheduleDirty = true;
         }
 
         return 0;
     }
 
 
-    // remove the actor instance (including all of its attachments)
-    void MultiThreadScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, uint32 startStep)
+    // keep the actor instance alive until the execute finished, in case it is being updated
+    bool MultiThreadScheduler::DeferDeleteActorInstance(ActorInstance* actorInstance)
     {
         MCore::LockGuardRecursive guard(mMutex);
-
-        // remove the actual actor instance
-        const uint32 step = RemoveActorInstance(actorInstance, startStep);
-
-        // recursively remove all attachments as well
-        const uint32 numAttachments = actorInstance->GetNumAttachments();
-        for (uint32 i = 0; i < numAttachments; ++i)
+        if (!m_isExecuting)
         {
-            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
-            if (attachment)
-            {
-                RecursiveRemoveActorInstance(attachment, step);
-            }
+            return false;
         }
+
+        m_deferredDeletes.emplace_back(actorInstance);
+        return true;
+    }
+
+
+    // remove the actor instance, its attachments are not part of the schedule
+    void MultiThreadScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, uint32 startStep)
+    {
+        RemoveActorInstance(actorInstance, startStep);
     }
 
 
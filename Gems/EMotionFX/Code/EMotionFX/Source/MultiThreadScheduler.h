@@ -12,8 +12,14 @@
 #include "EMotionFXConfig.h"
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
+#include <AzCore/std/parallel/atomic.h>
 #include <MCore/Source/MultiThreadManager.h>
 
+namespace AZ
+{
+    class Job;
+}
+
 namespace EMotionFX
 {
     // forward declarations
@@ -25,6 +31,8 @@ namespace EMotionFX
      * The multi processor scheduler.
      * This class can manage the actor instances in such a way that multiple actor instances can be processed at the same time
      * without getting any conflicts with shared memory.
+     * Root actor instances are independent from each other and are grouped into batches of similar cost, which are processed by a number of parallel jobs.
+     * Attachments only depend on the actor instance they are attached to, and are started as soon as their parent got updated.
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
@@ -43,24 +51,9 @@ namespace EMotionFX
         };
 
         /**
-         * A scheduler step.
-         * This contains an array of actor instances.
-         * Each actor instance will be executed in another thread.
-         * The step will never contain more actor instances than the number of CPUs it is setup to use.
+         * The default maximum number of joints that get batched together into one job.
          */
-        struct EMFX_API ScheduleStep
-        {
-            MCore::Array<Actor::Dependency>     mDependencies;      /**< The dependencies of this scheduler step. No actor instances with the same dependencies are allowed to be added to this step. */
-            AZStd::vector<ActorInstance*>       mActorInstances;    /**< The actor instances used inside this step. Each array entry will execute in another thread. */
-
-            /**
-             * The constructor.
-             */
-            ScheduleStep()
-            {
-                mDependencies.SetMemoryCategory(EMFX_MEMCATEGORY_UPDATESCHEDULERS);
-            }
-        };
+        static constexpr uint32 s_defaultMaxJointsPerBatch = 256;
 
         /**
          * The constructor.
@@ -82,6 +75,8 @@ namespace EMotionFX
 
         /**
          * The main method which will execute all callbacks, which on their turn will check for visibilty, perform updates and render.
+         * The schedule is only locked while the changes to it are picked up, so actor instances can be inserted and removed from other threads during the execute.
+         * Those changes apply from the next execute on, and actor instances destroyed during the execute are deleted once all updates finished.
          * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
          */
         void Execute(float timePassedInSeconds) override;
@@ -98,44 +93,77 @@ namespace EMotionFX
         void Clear() override;
 
         /**
-         * Remove all empty scheduler steps.
-         */
-        void RemoveEmptySteps();
-
-        /**
-         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * Insert an actor instance into the schedule. Attachments are not part of the schedule themselves, they are updated right after the
+         * actor instance they are attached to.
          * @param actorInstance The actor instance to insert.
-         * @param startStep An offset in the schedule where to start trying to insert the actor instances.
+         * @param startStep Unused, as this scheduler does not use schedule steps.
          */
         void RecursiveInsertActorInstance(ActorInstance* actorInstance, uint32 startStep = 0) override;
 
         /**
-         * Recursively remove an actor instance and its attachments from the schedule.
+         * Remove an actor instance from the schedule. Its attachments are updated through the actor instance, so they will not be updated anymore either.
          * @param actorInstance The actor instance to remove.
-         * @param startStep An offset in the schedule where to start trying to remove from.
+         * @param startStep Unused, as this scheduler does not use schedule steps.
          */
         void RecursiveRemoveActorInstance(ActorInstance* actorInstance, uint32 startStep = 0) override;
 
         /**
-         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * Remove a single actor instance from the schedule.
          * @param actorInstance The actor instance to remove.
-         * @param startStep An offset in the schedule where to start trying to remove from.
-         * @result Returns the offset in the schedule where the actor instance was removed.
+         * @param startStep Unused, as this scheduler does not use schedule steps.
+         * @result Always returns 0, as this scheduler does not use schedule steps.
          */
         uint32 RemoveActorInstance(ActorInstance* actorInstance, uint32 startStep = 0) override;
 
+        /**
+         * Defer deleting an actor instance that got destroyed while the schedule is being executed, until all updates finished.
+         * @param actorInstance The actor instance to delete.
+         * @result True in case the actor instance will be deleted once the execute finished, false in case no execute is running.
+         */
+        bool DeferDeleteActorInstance(ActorInstance* actorInstance) override;
+
         void Lock();
         void Unlock();
 
-        const ScheduleStep& GetScheduleStep(uint32 index) const { return mSteps[index]; }
-        uint32 GetNumScheduleSteps() const { return mSteps.GetLength(); }
+        /**
+         * Set the maximum number of joints that get batched together into one job. Root actor instances will be added to a batch until
+         * the total number of enabled joints of the actor instances and their attachments reaches this value.
+         * A value of 1 means every actor instance will be processed in its own job.
+         * @param maxJointsPerBatch The maximum number of joints per batch.
+         */
+        void SetMaxJointsPerBatch(uint32 maxJointsPerBatch)     { m_maxJointsPerBatch = AZStd::max<uint32>(maxJointsPerBatch, 1); }
+        uint32 GetMaxJointsPerBatch() const                     { return m_maxJointsPerBatch; }
+
+        /**
+         * Set the maximum number of jobs that process the batches in parallel.
+         * @param maxNumParallelJobs The maximum number of parallel jobs. A value of 0 means to use one job per worker thread.
+         */
+        void SetMaxNumParallelJobs(uint32 maxNumParallelJobs)   { m_maxNumParallelJobs = maxNumParallelJobs; }
+        uint32 GetMaxNumParallelJobs() const                    { return m_maxNumParallelJobs; }
+
+        size_t GetNumRootActorInstances() const                 { return m_rootActorInstances.size(); }
+        ActorInstance* GetRootActorInstance(size_t index) const { return m_rootActorInstances[index]; }
+        size_t GetNumBatches() const                            { return m_batches.size(); }
 
     protected:
-        MCore::Array< ScheduleStep >    mSteps;         /**< An array of update steps, that together form the schedule. */
-        float                           mCleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
-        MCore::MutexRecursive           mMutex;
+        /**
+         * A range of root actor instances that get updated by the same job.
+         */
+        struct Batch
+        {
+            size_t  m_begin;
+            size_t  m_end;
+        };
 
-        bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
+        AZStd::vector<ActorInstance*>   m_rootActorInstances;           /**< The actor instances inside the schedule, modified under lock. */
+        AZStd::vector<ActorInstance*>   m_executeRootActorInstances;    /**< The actor instances to execute, synced with m_rootActorInstances when the schedule is dirty. */
+        AZStd::vector<Batch>            m_batches;                      /**< The batches for the current execute. */
+        bool                            m_isScheduleDirty = false;      /**< True in case the schedule got modified since the last execute, modified under lock. */
+        bool                            m_isExecuting = false;          /**< True while the actor instances are being updated, modified under lock. */
+        AZStd::vector<ActorInstance*>   m_deferredDeletes;              /**< The actor instances destroyed during the execute, deleted once it finished, modified under lock. */
+        uint32                          m_maxJointsPerBatch = s_defaultMaxJointsPerBatch;
+        uint32                          m_maxNumParallelJobs = 0;
+        MCore::MutexRecursive           mMutex;
 
         /**
          * The constructor.
@@ -148,31 +176,18 @@ namespace EMotionFX
         virtual ~MultiThreadScheduler();
 
         /**
-         * Check if a given update step has any similar dependencies than the specified actor instance.
-         * If this is the case, the specified actor instance can't be inserted inside the same scheduler step, as
-         * it would conflict with the other actor instances inside it.
-         * @param instance The acotr instance to test.
-         * @param step The scheduler step to test.
-         * @result Returns true when there are matching dependencies, otherwise false is returned.
-         */
-        bool CheckIfHasMatchingDependency(ActorInstance* instance, ScheduleStep* step) const;
-
-        /**
-         * Find the next free spot in the schedule where we can insert a given actor instance.
-         * @param actorInstance The actor instance we are trying to insert.
-         * @param startStep The step offset in the scheduler, to start searching from.
-         * @param outStepNr This will contain the step number in which we can insert the actor instance.
-         * @result Returns false when there is no step where we can insert in. A new step will have to be added.
+         * Update the given actor instance and start jobs for its attachments, which only depend on the actor instance itself.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last update.
+         * @param jobCompletion The completion of the current execute, the attachment jobs will be added to it.
          */
-        bool FindNextFreeItem(ActorInstance* actorInstance, uint32 startStep, uint32* outStepNr);
+        void ExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, AZ::Job* jobCompletion);
 
         /**
-         * Add the dependencies of a given actor instance to a specified scheduler step.
-         * This will also prevent any duplicated dependencies. So dependencies that are already inside the step
-         * will not be added again.
-         * @param instance The actor instance to add the dependencies from.
-         * @param outStep The scheduler step to add the dependencies to.
+         * Calculate the cost of updating an actor instance, including its attachments, which is used to batch the actor instances.
+         * @param actorInstance The actor instance to calculate the cost for.
+         * @result The number of enabled joints of the actor instance and all of its attachments.
          */
-        void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+        static uint32 CalcActorInstanceCost(const ActorInstance* actorInstance);
     };
 }   // namespace EMotionFX
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/PackedSkinInfluences.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+
+
+namespace EMotionFX
+{
+    bool PackedSkinInfluences::Init(Mesh* mesh, SkinningInfoVertexAttributeLayer* layer)
+    {
+        Clear();
+
+        if (!mesh || !layer)
+        {
+            return false;
+        }
+
+        const uint32 numVertices = mesh->GetNumVertices();
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!orgVerts)
+        {
+            return false;
+        }
+
+        // find the number of slots we need per vertex
+        size_t maxNumInfluences = 0;
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            maxNumInfluences = AZStd::max(maxNumInfluences, layer->GetNumInfluences(orgVerts[v]));
+        }
+
+        if (maxNumInfluences > s_maxInfluencesPerVertex)
+        {
+            return false;
+        }
+
+        const uint32 numInfluencesPerVertex = (maxNumInfluences <= 4) ? 4 : s_maxInfluencesPerVertex;
+        m_boneIndices.resize(numVertices * numInfluencesPerVertex, 0);
+        m_weights.resize(numVertices * numInfluencesPerVertex, 0);
+
+        AZStd::pair<float, AZ::u16> influences[s_maxInfluencesPerVertex];
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const uint32 orgVertex = orgVerts[v];
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            if (numInfluences == 0)
+            {
+                continue;
+            }
+
+            float totalWeight = 0.0f;
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                influences[i] = { influence->GetWeight(), influence->GetBoneNr() };
+                totalWeight += influence->GetWeight();
+            }
+
+            // sort on weight, so that the most important influences come first and empty slots are at the end
+            AZStd::sort(influences, influences + numInfluences, [](const AZStd::pair<float, AZ::u16>& a, const AZStd::pair<float, AZ::u16>& b)
+                {
+                    return a.first > b.first;
+                });
+
+            // quantize the weights and add the rounding error to the biggest weight, so that the quantized weights add up to the same total weight
+            AZ::u16* boneIndices = &m_boneIndices[v * numInfluencesPerVertex];
+            AZ::u16* weights = &m_weights[v * numInfluencesPerVertex];
+            AZ::s32 quantizedTotal = 0;
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const AZ::s32 quantized = AZStd::clamp(static_cast<AZ::s32>(influences[i].first * 65535.0f + 0.5f), 0, 65535);
+                boneIndices[i] = influences[i].second;
+                weights[i] = static_cast<AZ::u16>(quantized);
+                quantizedTotal += quantized;
+            }
+
+            const AZ::s32 expectedTotal = AZStd::clamp(static_cast<AZ::s32>(totalWeight * 65535.0f + 0.5f), 0, 65535);
+            weights[0] = static_cast<AZ::u16>(AZStd::clamp(static_cast<AZ::s32>(weights[0]) + (expectedTotal - quantizedTotal), 0, 65535));
+        }
+
+        m_numVertices = numVertices;
+        m_numInfluencesPerVertex = numInfluencesPerVertex;
+        return true;
+    }
+
+
+    void PackedSkinInfluences::Clear()
+    {
+        m_boneIndices.clear();
+        m_weights.clear();
+        m_numVertices = 0;
+        m_numInfluencesPerVertex = 0;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include "EMotionFXConfig.h"
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Mesh;
+    class SkinningInfoVertexAttributeLayer;
+
+
+    /**
+     * Skin influences packed per (render) vertex, used by the CPU skinning deformers.
+     * Each vertex has a fixed number of influence slots (4 or 8), sorted by weight from high to low, where unused slots have a weight of zero.
+     * Bone indices and quantized weights are stored in two separate streams, so that the skinning loops do not have to go through the
+     * original vertex numbers and the skinning info vertex attribute layer anymore.
+     * The bone numbers inside the influences are expected to be initialized already by the deformer owning this object.
+     */
+    class EMFX_API PackedSkinInfluences
+    {
+    public:
+        static constexpr uint32 s_maxInfluencesPerVertex = 8;
+
+        /**
+         * Build the packed influences from the skinning info of the mesh.
+         * @param mesh The mesh to build the influences for.
+         * @param layer The skinning info layer of the mesh.
+         * @result True in case the influences got packed, false in case a vertex uses more than s_maxInfluencesPerVertex influences.
+         *         The deformer has to fall back to the skinning info layer in that case.
+         */
+        bool Init(Mesh* mesh, SkinningInfoVertexAttributeLayer* layer);
+
+        void Clear();
+
+        bool GetIsValid() const                                         { return m_numInfluencesPerVertex > 0; }
+        uint32 GetNumInfluencesPerVertex() const                        { return m_numInfluencesPerVertex; }
+        uint32 GetNumVertices() const                                   { return m_numVertices; }
+
+        MCORE_INLINE const AZ::u16* GetBoneIndices(uint32 vertex) const { return &m_boneIndices[vertex * m_numInfluencesPerVertex]; }
+        MCORE_INLINE const AZ::u16* GetWeights(uint32 vertex) const     { return &m_weights[vertex * m_numInfluencesPerVertex]; }
+
+        static MCORE_INLINE float DequantizeWeight(AZ::u16 weight)      { return static_cast<float>(weight) * (1.0f / 65535.0f); }
+
+    private:
+        AZStd::vector<AZ::u16>  m_boneIndices;              /**< The local bone index for every influence slot. */
+        AZStd::vector<AZ::u16>  m_weights;                  /**< The weights for every influence slot, quantized to 16 bits, where 65535 represents a weight of one. */
+        uint32                  m_numVertices = 0;
+        uint32                  m_numInfluencesPerVertex = 0;
+    };
+} // namespace EMotionFX
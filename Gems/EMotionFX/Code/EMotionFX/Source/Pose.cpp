@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/std/algorithm.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionInstance.h>
@@ -66,10 +67,12 @@ namespace EMotionFX
         mFlags.ResizeFast(numTransforms);
         mMorphWeights.ResizeFast(actorInstance->GetMorphSetupInstance()->GetNumMorphTargets());
 
-        for (const auto& poseDataItem : m_poseDatas)
+        for (const AZStd::unique_ptr<PoseData>& poseData : m_poseDatas)
         {
-            PoseData* poseData = poseDataItem.second.get();
-            poseData->LinkToActorInstance(actorInstance);
+            if (poseData)
+            {
+                poseData->LinkToActorInstance(actorInstance);
+            }
         }
 
         ClearFlags(initialFlags);
@@ -101,10 +104,12 @@ namespace EMotionFX
         MorphSetup* morphSetup = mActor->GetMorphSetup(0);
         mMorphWeights.ResizeFast((morphSetup) ? morphSetup->GetNumMorphTargets() : 0);
 
-        for (const auto& poseDataItem : m_poseDatas)
+        for (const AZStd::unique_ptr<PoseData>& poseData : m_poseDatas)
         {
-            PoseData* poseData = poseDataItem.second.get();
-            poseData->LinkToActor(actor);
+            if (poseData)
+            {
+                poseData->LinkToActor(actor);
+            }
         }
 
         if (clearAllFlags)
@@ -131,6 +136,27 @@ namespace EMotionFX
     }
 
 
+    void Pose::Reserve(uint32 numTransforms, uint32 numMorphWeights)
+    {
+        mLocalSpaceTransforms.Reserve(numTransforms);
+        mModelSpaceTransforms.Reserve(numTransforms);
+        mFlags.Reserve(numTransforms);
+        mMorphWeights.Reserve(numMorphWeights);
+    }
+
+
+    uint32 Pose::GetNumReservedTransforms() const
+    {
+        return mLocalSpaceTransforms.GetMaxLength();
+    }
+
+
+    uint32 Pose::GetNumReservedMorphWeights() const
+    {
+        return mMorphWeights.GetMaxLength();
+    }
+
+
     void Pose::Clear(bool clearMem)
     {
         mLocalSpaceTransforms.Clear(clearMem);
@@ -699,29 +725,26 @@ namespace EMotionFX
         mFlags.MemCopyContentsFrom(sourcePose->mFlags);
         mMorphWeights.MemCopyContentsFrom(sourcePose->mMorphWeights);
 
-        // Deactivate pose datas from the current pose that are not in the source that we copy from.
-        // This is needed in order to prevent leftover pose datas and to avoid de-/allocations.
-        for (auto& poseDataItem : m_poseDatas)
+        // Deactivate pose datas from the current pose that are not in the source that we copy from, and make sure the current pose has
+        // all the pose datas from the source pose and copy them over. Unused pose datas stay alive to avoid de-/allocations.
+        const AZStd::vector<AZStd::unique_ptr<PoseData> >& sourcePoseDatas = sourcePose->GetPoseDatas();
+        const size_t numSlots = AZStd::max(m_poseDatas.size(), sourcePoseDatas.size());
+        for (size_t i = 0; i < numSlots; ++i)
         {
-            const AZ::TypeId& typeId = poseDataItem.first;
-            if (!sourcePose->HasPoseData(typeId))
+            const PoseData* sourcePoseData = (i < sourcePoseDatas.size()) ? sourcePoseDatas[i].get() : nullptr;
+            PoseData* poseData = (i < m_poseDatas.size()) ? m_poseDatas[i].get() : nullptr;
+            if (!sourcePoseData)
             {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->SetIsUsed(false);
+                if (poseData)
+                {
+                    poseData->SetIsUsed(false);
+                }
+                continue;
             }
-        }
-
-        // Make sure the current pose has all the pose datas from the source pose, and copy them over.
-        const auto& sourcePoseDatas = sourcePose->GetPoseDatas();
-        for (const auto& sourcePoseDataItem : sourcePoseDatas)
-        {
-            const AZ::TypeId& sourceTypeId = sourcePoseDataItem.first;
-            const PoseData* sourcePoseData = sourcePoseDataItem.second.get();
 
-            PoseData* poseData = GetPoseDataByType(sourceTypeId);
             if (!poseData)
             {
-                poseData = PoseDataFactory::Create(this, sourceTypeId);
+                poseData = PoseDataFactory::Create(this, sourcePoseData->RTTI_GetType());
                 AddPoseData(poseData);
             }
 
@@ -900,10 +923,12 @@ namespace EMotionFX
                 mMorphWeights[i] = MCore::LinearInterpolate<float>(mMorphWeights[i], destPose->mMorphWeights[i], weight);
             }
 
-            for (const auto& poseDataItem : m_poseDatas)
+            for (const AZStd::unique_ptr<PoseData>& poseData : m_poseDatas)
             {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
+                if (poseData)
+                {
+                    poseData->Blend(destPose, weight);
+                }
             }
         }
         else
@@ -924,10 +949,12 @@ namespace EMotionFX
                 mMorphWeights[i] = MCore::LinearInterpolate<float>(mMorphWeights[i], destPose->mMorphWeights[i], weight);
             }
 
-            for (const auto& poseDataItem : m_poseDatas)
+            for (const AZStd::unique_ptr<PoseData>& poseData : m_poseDatas)
             {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
+                if (poseData)
+                {
+                    poseData->Blend(destPose, weight);
+                }
             }
         }
 
@@ -1227,15 +1254,15 @@ namespace EMotionFX
 
     bool Pose::HasPoseData(const AZ::TypeId& typeId) const
     {
-        return m_poseDatas.find(typeId) != m_poseDatas.end();
+        return GetPoseDataByType(typeId) != nullptr;
     }
 
     PoseData* Pose::GetPoseDataByType(const AZ::TypeId& typeId) const
     {
-        const auto iterator = m_poseDatas.find(typeId);
-        if (iterator != m_poseDatas.end())
+        const size_t typeIndex = PoseDataFactory::FindTypeIndex(typeId);
+        if (typeIndex < m_poseDatas.size())
         {
-            return iterator->second.get();
+            return m_poseDatas[typeIndex].get();
         }
 
         return nullptr;
@@ -1243,7 +1270,21 @@ namespace EMotionFX
 
     void Pose::AddPoseData(PoseData* poseData)
     {
-        m_poseDatas.emplace(poseData->RTTI_GetType(), poseData);
+        const size_t typeIndex = PoseDataFactory::FindTypeIndex(poseData->RTTI_GetType());
+        AZ_Assert(typeIndex != InvalidIndex, "Pose data type '%s' is not registered in the pose data factory.", poseData->RTTI_GetTypeName());
+        if (typeIndex == InvalidIndex)
+        {
+            delete poseData;
+            return;
+        }
+
+        // Size the slots once for all registered types, so adding further pose datas doesn't reallocate.
+        if (m_poseDatas.empty())
+        {
+            m_poseDatas.resize(PoseDataFactory::GetNumTypes());
+        }
+
+        m_poseDatas[typeIndex].reset(poseData);
     }
 
     void Pose::ClearPoseDatas()
@@ -1251,7 +1292,15 @@ namespace EMotionFX
         m_poseDatas.clear();
     }
 
-    const AZStd::unordered_map<AZ::TypeId, AZStd::unique_ptr<PoseData> >& Pose::GetPoseDatas() const
+    size_t Pose::GetNumPoseDatas() const
+    {
+        return AZStd::count_if(m_poseDatas.begin(), m_poseDatas.end(), [](const AZStd::unique_ptr<PoseData>& poseData)
+            {
+                return poseData != nullptr;
+            });
+    }
+
+    const AZStd::vector<AZStd::unique_ptr<PoseData> >& Pose::GetPoseDatas() const
     {
         return m_poseDatas;
     }
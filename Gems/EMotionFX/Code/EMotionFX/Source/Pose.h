@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <MCore/Source/AlignedArray.h>
 #include <EMotionFX/Source/PoseData.h>
 #include <EMotionFX/Source/Transform.h>
@@ -55,6 +55,16 @@ namespace EMotionFX
         void LinkToActor(const Actor* actor, uint8 initialFlags = 0, bool clearAllFlags = true);
         void SetNumTransforms(uint32 numTransforms);
 
+        /**
+         * Pre-allocate the transform, flag and morph weight buffers, without changing the number of transforms or morph weights.
+         * Linking the pose to an actor (instance) that fits inside the reserved sizes will not allocate any memory.
+         * @param numTransforms The number of transforms to reserve memory for.
+         * @param numMorphWeights The number of morph weights to reserve memory for.
+         */
+        void Reserve(uint32 numTransforms, uint32 numMorphWeights);
+        uint32 GetNumReservedTransforms() const;
+        uint32 GetNumReservedMorphWeights() const;
+
         void ApplyMorphWeightsToActorInstance();
         void ZeroMorphWeights();
 
@@ -178,7 +188,14 @@ namespace EMotionFX
 
         void AddPoseData(PoseData* poseData);
         void ClearPoseDatas();
-        const AZStd::unordered_map<AZ::TypeId, AZStd::unique_ptr<PoseData> >& GetPoseDatas() const;
+        size_t GetNumPoseDatas() const;
+
+        /**
+         * Get the pose data slots, indexed by the type index from the PoseDataFactory.
+         * Slots for pose data types that have not been added to this pose contain a nullptr.
+         * @result The pose data slots.
+         */
+        const AZStd::vector<AZStd::unique_ptr<PoseData> >& GetPoseDatas() const;
 
         /**
          * Guaranteed retrieval of a fully prepared and ready to use pose data of the given type.
@@ -196,7 +213,7 @@ namespace EMotionFX
         mutable MCore::AlignedArray<Transform, 16>  mLocalSpaceTransforms;
         mutable MCore::AlignedArray<Transform, 16>  mModelSpaceTransforms;
         mutable MCore::AlignedArray<uint8, 16>      mFlags;
-        AZStd::unordered_map<AZ::TypeId, AZStd::unique_ptr<PoseData> > m_poseDatas;
+        AZStd::vector<AZStd::unique_ptr<PoseData> > m_poseDatas;     /**< The pose datas, indexed by the PoseDataFactory type index. */
         MCore::AlignedArray<float, 16>              mMorphWeights;      /**< The morph target weights. */
         const ActorInstance*                        mActorInstance;
         const Actor*                                mActor;
@@ -36,11 +36,38 @@ namespace EMotionFX
 
     const AZStd::unordered_set<AZ::TypeId>& PoseDataFactory::GetTypeIds()
     {
-        static AZStd::unordered_set<AZ::TypeId> typeIds =
+        static AZStd::unordered_set<AZ::TypeId> typeIds(GetOrderedTypeIds().begin(), GetOrderedTypeIds().end());
+        return typeIds;
+    }
+
+    const AZStd::vector<AZ::TypeId>& PoseDataFactory::GetOrderedTypeIds()
+    {
+        static AZStd::vector<AZ::TypeId> typeIds =
         {
             azrtti_typeid<PoseDataRagdoll>()
         };
 
         return typeIds;
     }
+
+    size_t PoseDataFactory::GetNumTypes()
+    {
+        return GetOrderedTypeIds().size();
+    }
+
+    size_t PoseDataFactory::FindTypeIndex(const AZ::TypeId& type)
+    {
+        // There are only a handful of pose data types, so a linear search is cheaper than hashing the type id.
+        const AZStd::vector<AZ::TypeId>& typeIds = GetOrderedTypeIds();
+        const size_t numTypes = typeIds.size();
+        for (size_t i = 0; i < numTypes; ++i)
+        {
+            if (typeIds[i] == type)
+            {
+                return i;
+            }
+        }
+
+        return InvalidIndex;
+    }
 } // namespace EMotionFX
@@ -10,6 +10,7 @@
 
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
 namespace AZ
@@ -27,5 +28,10 @@ namespace EMotionFX
     public:
         static PoseData* Create(Pose* pose, const AZ::TypeId& type);
         static const AZStd::unordered_set<AZ::TypeId>& GetTypeIds();
+
+        // Pose datas are stored in a flat array inside the pose, where each registered type has a fixed slot.
+        static const AZStd::vector<AZ::TypeId>& GetOrderedTypeIds();
+        static size_t GetNumTypes();
+        static size_t FindTypeIndex(const AZ::TypeId& type); // Returns InvalidIndex for types that are not registered.
     };
 } // namespace EMotionFX
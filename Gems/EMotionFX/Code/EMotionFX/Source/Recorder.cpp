@@ -7,8 +7,10 @@
  */
 
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/clocks.h>
 #include "Recorder.h"
 #include "RecorderBus.h"
+#include "RecorderRingBuffer.h"
 #include "ActorInstance.h"
 #include "TransformData.h"
 #include "AnimGraphManager.h"
@@ -36,6 +38,29 @@ namespace EMotionFX
     AZ_CLASS_ALLOCATOR_IMPL(Recorder::ActorInstanceData, RecorderAllocator, 0)
     AZ_CLASS_ALLOCATOR_IMPL(Recorder::RecordSettings, RecorderAllocator, 0)
 
+    namespace
+    {
+        // decode the frame of the given actor instance from a ring buffer recording, where the oldest frame is at time zero
+        const RecorderRingBuffer::ActorFrame* DecodeRingBufferActorFrame(RecorderRingBuffer& ringBuffer, float timeInSeconds, const ActorInstance* actorInstance)
+        {
+            // the tolerance makes sure that rebasing the time doesn't round it down to the previous frame
+            const RecorderRingBuffer::Frame* frame = ringBuffer.DecodeFrameAtTime(ringBuffer.GetStartTime() + timeInSeconds + AZ::Constants::Tolerance);
+            if (!frame)
+            {
+                return nullptr;
+            }
+
+            for (const RecorderRingBuffer::ActorFrame& actorFrame : frame->m_actorFrames)
+            {
+                if (actorFrame.m_actorInstance == actorInstance)
+                {
+                    return &actorFrame;
+                }
+            }
+            return nullptr;
+        }
+    } // namespace
+
 
     void Recorder::TransformTracks::Reflect(AZ::ReflectContext* context)
     {
@@ -78,7 +103,7 @@ namespace EMotionFX
         }
 
         serializeContext->Class<Recorder::RecordSettings>()
-            ->Version(1)
+            ->Version(2)
             ->Field("fps", &Recorder::RecordSettings::mFPS)
             ->Field("recordTransforms", &Recorder::RecordSettings::mRecordTransforms)
             ->Field("recordNodeHistory", &Recorder::RecordSettings::mRecordNodeHistory)
@@ -88,6 +113,12 @@ namespace EMotionFX
             ->Field("recordScale", &Recorder::RecordSettings::mRecordScale)
             ->Field("recordMorphs", &Recorder::RecordSettings::mRecordMorphs)
             ->Field("interpolate", &Recorder::RecordSettings::mInterpolate)
+            ->Field("useRingBuffer", &Recorder::RecordSettings::mUseRingBuffer)
+            ->Field("ringBufferMaxBytes", &Recorder::RecordSettings::mRingBufferMaxBytes)
+            ->Field("ringBufferSegmentFrames", &Recorder::RecordSettings::mRingBufferSegmentFrames)
+            ->Field("ringBufferMaxSpilledSegments", &Recorder::RecordSettings::mRingBufferMaxSpilledSegments)
+            ->Field("ringBufferPositionPrecision", &Recorder::RecordSettings::mRingBufferPositionPrecision)
+            ->Field("ringBufferSpillFolder", &Recorder::RecordSettings::mRingBufferSpillFolder)
             ;
     }
 
@@ -100,6 +131,10 @@ namespace EMotionFX
         mRecordTime     = 0.0f;
         mLastRecordTime = 0.0f;
         mCurrentPlayTime = 0.0f;
+        m_lastFrameRecordDuration = 0.0f;
+        m_maxFrameRecordDuration = 0.0f;
+        m_totalFrameRecordDuration = 0.0f;
+        m_numRecordedFrames = 0;
 
         mObjects.SetMemoryCategory(EMFX_MEMCATEGORY_RECORDER);
         EMotionFX::ActorInstanceNotificationBus::Handler::BusConnect();
@@ -200,6 +235,11 @@ namespace EMotionFX
         mCurrentPlayTime = 0.0f;
         mRecordSettings.m_actorInstances.clear();
         m_timeDeltas.clear();
+        m_ringBuffer.reset();
+        m_lastFrameRecordDuration = 0.0f;
+        m_maxFrameRecordDuration = 0.0f;
+        m_totalFrameRecordDuration = 0.0f;
+        m_numRecordedFrames = 0;
 
         // delete all actor instance datas
         for (const ActorInstanceData* actorInstanceData : m_actorInstanceDatas)
@@ -240,10 +280,26 @@ namespace EMotionFX
             }
         }
 
+        // the ring buffer only stores transforms and morphs, as the other data can't be bounded in memory
+        if (mRecordSettings.mUseRingBuffer)
+        {
+            AZ_Warning("EMotionFX", !mRecordSettings.mRecordAnimGraphStates && !mRecordSettings.mRecordNodeHistory && !mRecordSettings.mRecordEvents,
+                "Anim graph states, node history and events are not recorded when using the recorder ring buffer.");
+            mRecordSettings.mRecordAnimGraphStates = false;
+            mRecordSettings.mRecordNodeHistory = false;
+            mRecordSettings.mRecordEvents = false;
+        }
+
         // prepare for recording
         // this resizes arrays and allocates buffers upfront
         PrepareForRecording();
 
+        if (mRecordSettings.mUseRingBuffer)
+        {
+            m_ringBuffer = AZStd::make_unique<RecorderRingBuffer>();
+            m_ringBuffer->Init(mRecordSettings, mRecordSettings.m_actorInstances, m_sessionUuid.ToString<AZStd::string>(false, false));
+        }
+
         // record the initial frame
         RecordCurrentFrame(0.0f);
 
@@ -296,6 +352,12 @@ namespace EMotionFX
             Lock();
         }
 
+        // ring buffer recordings stay encoded, and only get decoded when played back or saved
+        if (mIsRecording && m_ringBuffer)
+        {
+            FinishRingBufferRecording();
+        }
+
         mIsRecording = false;
         FinalizeAllNodeHistoryItems();
 
@@ -405,6 +467,11 @@ namespace EMotionFX
     // save to a file
     bool Recorder::SaveToFile(const char* outFile)
     {
+        if (m_ringBuffer && !mIsRecording)
+        {
+            ExtractRingBufferRecording();
+        }
+
         // The template types used by the recorder result in an extremely
         // verbose serialized object stream. Use the binary format to attempt
         // to optimize the file size.
@@ -418,9 +485,36 @@ namespace EMotionFX
     }
 
 
-    // record the current frame
+    // record the current frame, and keep track of how long that took
     void Recorder::RecordCurrentFrame(float timeDelta)
     {
+        const AZStd::chrono::high_resolution_clock::time_point startTime = AZStd::chrono::high_resolution_clock::now();
+
+        RecordCurrentFrameData(timeDelta);
+
+        m_lastFrameRecordDuration = AZStd::chrono::duration<float>(AZStd::chrono::high_resolution_clock::now() - startTime).count();
+        m_maxFrameRecordDuration = AZStd::max(m_maxFrameRecordDuration, m_lastFrameRecordDuration);
+        m_totalFrameRecordDuration += m_lastFrameRecordDuration;
+        m_numRecordedFrames++;
+    }
+
+
+    float Recorder::GetAvgFrameRecordDuration() const
+    {
+        return (m_numRecordedFrames > 0) ? m_totalFrameRecordDuration / static_cast<float>(m_numRecordedFrames) : 0.0f;
+    }
+
+
+    // record the data of the current frame
+    void Recorder::RecordCurrentFrameData(float timeDelta)
+    {
+        if (m_ringBuffer)
+        {
+            m_ringBuffer->RecordFrame(mRecordTime, timeDelta);
+            mLastRecordTime = mRecordTime;
+            return;
+        }
+
         m_timeDeltas.emplace_back(timeDelta);
 
         // record the current transforms
@@ -466,6 +560,84 @@ namespace EMotionFX
     }
 
 
+    // rebase the ring buffer recording so that the oldest frame is at time zero, without decoding any frames
+    void Recorder::FinishRingBufferRecording()
+    {
+        m_ringBuffer->GetTimeDeltas(m_timeDeltas);
+        if (!m_timeDeltas.empty())
+        {
+            m_timeDeltas[0] = 0.0f;
+        }
+
+        mRecordTime = m_ringBuffer->GetEndTime() - m_ringBuffer->GetStartTime();
+        mLastRecordTime = mRecordTime;
+
+        // keep the ring buffer, playback decodes from it until the recording is extracted or cleared
+    }
+
+
+    // convert the frames in the ring buffer into the regular key tracks, with the oldest frame at time zero
+    void Recorder::ExtractRingBufferRecording()
+    {
+        if (!m_ringBuffer)
+        {
+            return;
+        }
+
+        const float startTime = m_ringBuffer->GetStartTime();
+        m_timeDeltas.clear();
+
+        m_ringBuffer->DecodeFrames([this, startTime](const RecorderRingBuffer::Frame& frame)
+        {
+            mRecordTime = frame.m_recordTime - startTime;
+            m_timeDeltas.emplace_back(m_timeDeltas.empty() ? 0.0f : frame.m_timeDelta);
+
+            for (const RecorderRingBuffer::ActorFrame& actorFrame : frame.m_actorFrames)
+            {
+                const uint32 index = FindActorInstanceDataIndex(actorFrame.m_actorInstance);
+                if (!actorFrame.m_actorInstance || index == MCORE_INVALIDINDEX32)
+                {
+                    continue;
+                }
+
+                ActorInstanceData& actorInstanceData = *m_actorInstanceDatas[index];
+                const Transform& localTransform = actorFrame.m_localTransform;
+            #ifndef EMFX_SCALE_DISABLED
+                AddTransformKey(actorInstanceData.mActorLocalTransform, localTransform.mPosition, localTransform.mRotation, localTransform.mScale);
+            #else
+                AddTransformKey(actorInstanceData.mActorLocalTransform, localTransform.mPosition, localTransform.mRotation, AZ::Vector3(1.0f, 1.0f, 1.0f));
+            #endif
+
+                const size_t numJoints = AZStd::min(actorFrame.m_jointTransforms.size(), actorInstanceData.m_transformTracks.size());
+                for (size_t j = 0; j < numJoints; ++j)
+                {
+                    const Transform& jointTransform = actorFrame.m_jointTransforms[j];
+                #ifndef EMFX_SCALE_DISABLED
+                    AddTransformKey(actorInstanceData.m_transformTracks[j], jointTransform.mPosition, jointTransform.mRotation, jointTransform.mScale);
+                #else
+                    AddTransformKey(actorInstanceData.m_transformTracks[j], jointTransform.mPosition, jointTransform.mRotation, AZ::Vector3(1.0f, 1.0f, 1.0f));
+                #endif
+                }
+
+                const uint32 numMorphs = AZStd::min(static_cast<uint32>(actorFrame.m_morphWeights.size()), actorInstanceData.mMorphTracks.GetLength());
+                for (uint32 m = 0; m < numMorphs; ++m)
+                {
+                    actorInstanceData.mMorphTracks[m].AddKey(mRecordTime, actorFrame.m_morphWeights[m]);
+                }
+            }
+        });
+
+        mLastRecordTime = mRecordTime;
+
+        MCore::LogInfo("Recorder ring buffer: %zu frames in %zu segments (%zu spilled, %zu dropped), %zu bytes in memory, recording took %.3f ms per frame on average (%.3f ms max).",
+            m_ringBuffer->GetNumFrames(), m_ringBuffer->GetNumSegments(), m_ringBuffer->GetNumSpilledSegments(), m_ringBuffer->GetNumDroppedSegments(),
+            m_ringBuffer->GetNumMemoryBytes(), GetAvgFrameRecordDuration() * 1000.0f, m_maxFrameRecordDuration * 1000.0f);
+
+        // the key tracks hold the recording from now on
+        m_ringBuffer.reset();
+    }
+
+
     // record the morph weights
     void Recorder::RecordMorphs()
     {
@@ -771,6 +943,20 @@ namespace EMotionFX
         const auto iterator = AZStd::find(recordedActorInstances.begin(), recordedActorInstances.end(), actorInstance);
         if (iterator != recordedActorInstances.end())
         {
+            if (m_ringBuffer)
+            {
+                const RecorderRingBuffer::ActorFrame* actorFrame = DecodeRingBufferActorFrame(*m_ringBuffer, timeInSeconds, actorInstance);
+                const uint32 numMorphs = actorFrame ? static_cast<uint32>(actorFrame->m_morphWeights.size()) : 0;
+                if (numMorphs > 0 && numMorphs == actorInstance->GetMorphSetupInstance()->GetNumMorphTargets())
+                {
+                    for (uint32 i = 0; i < numMorphs; ++i)
+                    {
+                        actorInstance->GetMorphSetupInstance()->GetMorphTarget(i)->SetWeight(actorFrame->m_morphWeights[i]);
+                    }
+                }
+                return;
+            }
+
             const size_t index = iterator - recordedActorInstances.begin();
             const ActorInstanceData& actorInstanceData = *m_actorInstanceDatas[index];
             const uint32 numMorphs = actorInstanceData.mMorphTracks.GetLength();
@@ -791,6 +977,25 @@ namespace EMotionFX
         const ActorInstanceData& actorInstanceData = *m_actorInstanceDatas[actorInstanceIndex];
         ActorInstance* actorInstance = actorInstanceData.mActorInstance;
 
+        // ring buffer recordings are played back without interpolation
+        if (m_ringBuffer)
+        {
+            const RecorderRingBuffer::ActorFrame* actorFrame = DecodeRingBufferActorFrame(*m_ringBuffer, timeInSeconds, actorInstance);
+            if (actorFrame)
+            {
+                actorInstance->SetLocalSpacePosition(actorFrame->m_localTransform.mPosition);
+                actorInstance->SetLocalSpaceRotation(actorFrame->m_localTransform.mRotation);
+                EMFX_SCALECODE
+                (
+                    if (mRecordSettings.mRecordScale)
+                    {
+                        actorInstance->SetLocalSpaceScale(actorFrame->m_localTransform.mScale);
+                    }
+                )
+            }
+            return;
+        }
+
         // sample and apply
         const TransformTracks& track = actorInstanceData.mActorLocalTransform;
         actorInstance->SetLocalSpacePosition(track.mPositions.GetValueAtTime(timeInSeconds, nullptr, nullptr, mRecordSettings.mInterpolate));
@@ -813,6 +1018,33 @@ namespace EMotionFX
         // for all nodes in the actor instance
         Transform outTransform;
         const uint32 numNodes = actorInstance->GetNumNodes();
+
+        // ring buffer recordings are played back without interpolation
+        if (m_ringBuffer)
+        {
+            const RecorderRingBuffer::ActorFrame* actorFrame = DecodeRingBufferActorFrame(*m_ringBuffer, timeInSeconds, actorInstance);
+            if (!actorFrame)
+            {
+                return;
+            }
+
+            const uint32 numJoints = AZStd::min(numNodes, static_cast<uint32>(actorFrame->m_jointTransforms.size()));
+            for (uint32 n = 0; n < numJoints; ++n)
+            {
+                outTransform = transformData->GetCurrentPose()->GetLocalSpaceTransform(n);
+                outTransform.mPosition = actorFrame->m_jointTransforms[n].mPosition;
+                outTransform.mRotation = actorFrame->m_jointTransforms[n].mRotation;
+                EMFX_SCALECODE
+                (
+                    if (mRecordSettings.mRecordScale)
+                    {
+                        outTransform.mScale = actorFrame->m_jointTransforms[n].mScale;
+                    }
+                )
+                transformData->GetCurrentPose()->SetLocalSpaceTransform(n, outTransform);
+            }
+            return;
+        }
         for (uint32 n = 0; n < numNodes; ++n)
         {
             outTransform = transformData->GetCurrentPose()->GetLocalSpaceTransform(n);
@@ -1395,6 +1627,11 @@ namespace EMotionFX
     {
         Lock();
 
+        if (m_ringBuffer)
+        {
+            m_ringBuffer->RemoveActorInstance(actorInstance);
+        }
+
         // Remove the actor instance from the record settings.
         AZStd::vector<ActorInstance*>& recordedActorInstances = mRecordSettings.m_actorInstances;
         recordedActorInstances.erase(AZStd::remove_if(recordedActorInstances.begin(), recordedActorInstances.end(),
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include "BaseObject.h"
 #include <MCore/Source/Attribute.h>
 #include "MCore/Source/Color.h"
@@ -41,6 +42,7 @@ namespace EMotionFX
     class AnimGraphNode;
     class AnimGraph;
     class Motion;
+    class RecorderRingBuffer;
 
     class EMFX_API Recorder
         : public BaseObject
@@ -72,6 +74,12 @@ namespace EMotionFX
             bool mRecordEvents; /**< Record events (default=false). */
             bool mRecordMorphs; /**< Record morph target weight animation (default=true). */
             bool mInterpolate; /**< Interpolate playback? (default=false) */
+            bool mUseRingBuffer; /**< Record transforms and morphs into a bounded ring buffer of delta encoded segments, keeping only the most recent frames (default=false). Anim graph states, node history and events are not recorded in this mode, and playback is not interpolated. */
+            uint32 mRingBufferMaxBytes; /**< The memory budget of the ring buffer. Older segments get spilled to disk or dropped (default=16mb). */
+            uint32 mRingBufferSegmentFrames; /**< The number of frames per ring buffer segment, which is the granularity at which data gets spilled or dropped (default=64). */
+            uint32 mRingBufferMaxSpilledSegments; /**< The maximum number of segments to keep on disk, or 0 for no limit (default=1024). */
+            float mRingBufferPositionPrecision; /**< The quantization step size of positions and scales in the ring buffer (default=0.0001). */
+            AZStd::string mRingBufferSpillFolder; /**< The folder to spill old ring buffer segments to, or empty to drop them (default=empty). */
 
             RecordSettings()
             {
@@ -86,6 +94,11 @@ namespace EMotionFX
                 mRecordScale                = true;
                 mRecordMorphs               = true;
                 mInterpolate                = false;
+                mUseRingBuffer              = false;
+                mRingBufferMaxBytes         = 16 * 1024 * 1024; // 16 megabytes
+                mRingBufferSegmentFrames    = 64;
+                mRingBufferMaxSpilledSegments = 1024;
+                mRingBufferPositionPrecision = 0.0001f;
             }
 
             static void Reflect(AZ::ReflectContext* context);
@@ -310,6 +323,12 @@ namespace EMotionFX
         void Update(float timeDelta);
         void StopRecording(bool lock = true);
         void OptimizeRecording();
+
+        /**
+         * Decode a stopped ring buffer recording into the regular key tracks and release the ring buffer.
+         * Ring buffer recordings are played back straight from the ring buffer, this is only needed to save or edit them. SaveToFile() calls this automatically.
+         */
+        void ExtractRingBufferRecording();
         bool SaveToFile(const char* outFile);
         static Recorder* LoadFromFile(const char* filename);
 
@@ -333,6 +352,12 @@ namespace EMotionFX
         MCORE_INLINE const RecordSettings& GetRecordSettings() const                            { return mRecordSettings; }
         const AZ::Uuid& GetSessionUuid() const                                                  { return m_sessionUuid; }
         const AZStd::vector<float>& GetTimeDeltas()                                             { return m_timeDeltas; }
+        const RecorderRingBuffer* GetRingBuffer() const                                         { return m_ringBuffer.get(); }
+
+        // The time it took to record frames, in seconds, which is the per frame overhead of the recorder.
+        float GetLastFrameRecordDuration() const                                                { return m_lastFrameRecordDuration; }
+        float GetMaxFrameRecordDuration() const                                                 { return m_maxFrameRecordDuration; }
+        float GetAvgFrameRecordDuration() const;
 
         MCORE_INLINE size_t GetNumActorInstanceDatas() const                                    { return m_actorInstanceDatas.size(); }
         MCORE_INLINE ActorInstanceData& GetActorInstanceData(uint32 index)                      { return *m_actorInstanceDatas[index]; }
@@ -364,6 +389,11 @@ namespace EMotionFX
         AZStd::vector<AnimGraphNode*>           mActiveNodes;       /**< A temp array to store active animgraph nodes in. */
         MCore::Mutex                            mLock;
         AZ::TypeId                              m_sessionUuid;
+        AZStd::unique_ptr<RecorderRingBuffer>   m_ringBuffer;       /**< The ring buffer, only used when recording with RecordSettings::mUseRingBuffer enabled. */
+        float                                   m_lastFrameRecordDuration;
+        float                                   m_maxFrameRecordDuration;
+        float                                   m_totalFrameRecordDuration;
+        uint32                                  m_numRecordedFrames;
         float                                   mRecordTime;
         float                                   mLastRecordTime;
         float                                   mCurrentPlayTime;
@@ -374,6 +404,8 @@ namespace EMotionFX
         void PrepareForRecording();
         void RecordMorphs();
         void RecordCurrentFrame(float timeDelta);
+        void RecordCurrentFrameData(float timeDelta);
+        void FinishRingBufferRecording();
         void RecordCurrentTransforms();
         bool RecordCurrentAnimGraphStates();
         void RecordMainLocalTransforms();
@@ -0,0 +1,668 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/RecorderRingBuffer.h>
+#include <EMotionFX/Source/TransformData.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(RecorderRingBuffer, RecorderAllocator, 0)
+
+    namespace
+    {
+        // Rotation and morph weight components are quantized to this many steps per unit.
+        const float s_unitQuantizationSteps = 32767.0f;
+
+        int32 Quantize(float value, float stepsPerUnit)
+        {
+            const float steps = AZ::GetClamp(value * stepsPerUnit, -2147483520.0f, 2147483520.0f);
+            return static_cast<int32>(steps >= 0.0f ? steps + 0.5f : steps - 0.5f);
+        }
+
+        float Dequantize(int32 value, float unitsPerStep)
+        {
+            return static_cast<float>(value) * unitsPerStep;
+        }
+    } // namespace
+
+
+    RecorderRingBuffer::RecorderRingBuffer()
+        : m_numPendingWrites(AZStd::make_shared<AZStd::atomic<uint32>>(0))
+    {
+    }
+
+
+    RecorderRingBuffer::~RecorderRingBuffer()
+    {
+        Clear();
+    }
+
+
+    void RecorderRingBuffer::Init(const Recorder::RecordSettings& settings, const AZStd::vector<ActorInstance*>& actorInstances, const AZStd::string& spillFilePrefix)
+    {
+        Clear();
+
+        m_spillFolder = settings.mRingBufferSpillFolder;
+        m_spillFilePrefix = spillFilePrefix;
+        m_maxMemoryBytes = settings.mRingBufferMaxBytes;
+        m_maxSpilledSegments = settings.mRingBufferMaxSpilledSegments;
+        m_segmentNumFrames = AZStd::max<uint32>(settings.mRingBufferSegmentFrames, 1);
+        m_positionPrecision = AZStd::max(settings.mRingBufferPositionPrecision, AZ::Constants::FloatEpsilon);
+    #ifndef EMFX_SCALE_DISABLED
+        m_recordScale = settings.mRecordScale;
+    #else
+        m_recordScale = false;
+    #endif
+
+        // Build the value layout, which is the same for all frames.
+        const size_t numValuesPerTransform = m_recordScale ? 10 : 7;
+        size_t numValues = 0;
+        m_slots.resize(actorInstances.size());
+        m_decodedFrame.m_actorFrames.resize(actorInstances.size());
+        for (size_t i = 0; i < actorInstances.size(); ++i)
+        {
+            ActorInstance* actorInstance = actorInstances[i];
+            Slot& slot = m_slots[i];
+            slot.m_actorInstance = actorInstance;
+            slot.m_numJoints = settings.mRecordTransforms ? actorInstance->GetNumNodes() : 0;
+            slot.m_numMorphs = (settings.mRecordMorphs && actorInstance->GetMorphSetupInstance()) ? actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() : 0;
+            slot.m_valueOffset = numValues;
+            numValues += (slot.m_numJoints + 1) * numValuesPerTransform + slot.m_numMorphs;
+
+            ActorFrame& actorFrame = m_decodedFrame.m_actorFrames[i];
+            actorFrame.m_jointTransforms.resize(slot.m_numJoints, Transform::CreateIdentity());
+            actorFrame.m_morphWeights.resize(slot.m_numMorphs, 0.0f);
+        }
+
+        m_previousValues.resize(numValues, 0);
+        m_decoder.m_previousValues.resize(numValues, 0);
+    }
+
+
+    void RecorderRingBuffer::Clear()
+    {
+        for (Segment& segment : m_segments)
+        {
+            if (segment.m_spillState)
+            {
+                DeleteSpilledSegment(segment);
+            }
+        }
+
+        m_segments.clear();
+        m_currentSegment = Segment();
+        m_slots.clear();
+        m_previousValues.clear();
+        m_decodedFrame.m_actorFrames.clear();
+        m_decoder = Decoder();
+        m_numMemoryBytes = 0;
+        m_numSpilledSegments = 0;
+        m_numDroppedSegments = 0;
+        m_lastSegmentNumBytes = 0;
+    }
+
+
+    void RecorderRingBuffer::RemoveActorInstance(ActorInstance* actorInstance)
+    {
+        for (Slot& slot : m_slots)
+        {
+            if (slot.m_actorInstance == actorInstance)
+            {
+                slot.m_actorInstance = nullptr;
+            }
+        }
+    }
+
+
+    void RecorderRingBuffer::RecordFrame(float recordTime, float timeDelta)
+    {
+        Segment& segment = m_currentSegment;
+        if (segment.m_frameTimes.empty())
+        {
+            // The first frame of a segment is stored relative to zero, so that each segment can be decoded on its own.
+            AZStd::fill(m_previousValues.begin(), m_previousValues.end(), 0);
+            segment.m_id = m_nextSegmentId++;
+            segment.m_data.reserve(m_lastSegmentNumBytes + m_lastSegmentNumBytes / 8);
+            segment.m_frameTimes.reserve(m_segmentNumFrames);
+            segment.m_frameTimeDeltas.reserve(m_segmentNumFrames);
+        }
+
+        segment.m_frameTimes.emplace_back(recordTime);
+        segment.m_frameTimeDeltas.emplace_back(timeDelta);
+
+        const size_t numValuesPerTransform = m_recordScale ? 10 : 7;
+        for (const Slot& slot : m_slots)
+        {
+            int32* previousValues = &m_previousValues[slot.m_valueOffset];
+            const size_t numValues = (slot.m_numJoints + 1) * numValuesPerTransform + slot.m_numMorphs;
+
+            // Removed actor instances repeat their last values, which only takes a single byte per value.
+            const ActorInstance* actorInstance = slot.m_actorInstance;
+            if (!actorInstance)
+            {
+                for (size_t i = 0; i < numValues; ++i)
+                {
+                    WriteValue(previousValues[i], previousValues[i]);
+                }
+                continue;
+            }
+
+            EncodeTransform(actorInstance->GetLocalSpaceTransform(), previousValues);
+            previousValues += numValuesPerTransform;
+
+            const Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+            for (uint32 j = 0; j < slot.m_numJoints; ++j)
+            {
+                EncodeTransform(pose->GetLocalSpaceTransform(j), previousValues);
+                previousValues += numValuesPerTransform;
+            }
+
+            const MorphSetupInstance* morphSetupInstance = actorInstance->GetMorphSetupInstance();
+            for (uint32 m = 0; m < slot.m_numMorphs; ++m)
+            {
+                WriteValue(Quantize(morphSetupInstance->GetMorphTarget(m)->GetWeight(), s_unitQuantizationSteps), previousValues[m]);
+            }
+        }
+
+        if (segment.m_frameTimes.size() >= m_segmentNumFrames)
+        {
+            CloseCurrentSegment();
+        }
+    }
+
+
+    void RecorderRingBuffer::EncodeTransform(const Transform& transform, int32* previousValues)
+    {
+        const float positionSteps = 1.0f / m_positionPrecision;
+        WriteValue(Quantize(transform.mPosition.GetX(), positionSteps), previousValues[0]);
+        WriteValue(Quantize(transform.mPosition.GetY(), positionSteps), previousValues[1]);
+        WriteValue(Quantize(transform.mPosition.GetZ(), positionSteps), previousValues[2]);
+
+        // Keep the rotations in the hemisphere with a positive w, so that the deltas between frames stay small.
+        AZ::Quaternion rotation = transform.mRotation.GetNormalized();
+        if (rotation.GetW() < 0.0f)
+        {
+            rotation = -rotation;
+        }
+        WriteValue(Quantize(rotation.GetX(), s_unitQuantizationSteps), previousValues[3]);
+        WriteValue(Quantize(rotation.GetY(), s_unitQuantizationSteps), previousValues[4]);
+        WriteValue(Quantize(rotation.GetZ(), s_unitQuantizationSteps), previousValues[5]);
+        WriteValue(Quantize(rotation.GetW(), s_unitQuantizationSteps), previousValues[6]);
+
+        EMFX_SCALECODE
+        (
+            if (m_recordScale)
+            {
+                WriteValue(Quantize(transform.mScale.GetX(), positionSteps), previousValues[7]);
+                WriteValue(Quantize(transform.mScale.GetY(), positionSteps), previousValues[8]);
+                WriteValue(Quantize(transform.mScale.GetZ(), positionSteps), previousValues[9]);
+            }
+        )
+    }
+
+
+    bool RecorderRingBuffer::DecodeTransform(const AZ::u8*& data, const AZ::u8* dataEnd, int32* previousValues, Transform& outTransform) const
+    {
+        const size_t numValuesPerTransform = m_recordScale ? 10 : 7;
+        for (size_t i = 0; i < numValuesPerTransform; ++i)
+        {
+            if (!ReadValue(data, dataEnd, previousValues[i]))
+            {
+                return false;
+            }
+        }
+
+        outTransform.mPosition.Set(
+            Dequantize(previousValues[0], m_positionPrecision),
+            Dequantize(previousValues[1], m_positionPrecision),
+            Dequantize(previousValues[2], m_positionPrecision));
+
+        const float unitsPerStep = 1.0f / s_unitQuantizationSteps;
+        const float x = Dequantize(previousValues[3], unitsPerStep);
+        const float y = Dequantize(previousValues[4], unitsPerStep);
+        const float z = Dequantize(previousValues[5], unitsPerStep);
+        const float w = Dequantize(previousValues[6], unitsPerStep);
+        outTransform.mRotation = AZ::Quaternion(x, y, z, w).GetNormalized();
+
+        EMFX_SCALECODE
+        (
+            if (m_recordScale)
+            {
+                outTransform.mScale.Set(
+                    Dequantize(previousValues[7], m_positionPrecision),
+                    Dequantize(previousValues[8], m_positionPrecision),
+                    Dequantize(previousValues[9], m_positionPrecision));
+            }
+        )
+        return true;
+    }
+
+
+    // Write the difference to the previous value as a zig-zag encoded variable length integer.
+    void RecorderRingBuffer::WriteValue(int32 value, int32& previousValue)
+    {
+        const int32 delta = static_cast<int32>(static_cast<uint32>(value) - static_cast<uint32>(previousValue));
+        previousValue = value;
+
+        uint32 zigZag = (static_cast<uint32>(delta) << 1) ^ static_cast<uint32>(delta >> 31);
+        AZStd::vector<AZ::u8>& data = m_currentSegment.m_data;
+        while (zigZag >= 0x80)
+        {
+            data.emplace_back(static_cast<AZ::u8>(zigZag | 0x80));
+            zigZag >>= 7;
+        }
+        data.emplace_back(static_cast<AZ::u8>(zigZag));
+    }
+
+
+    // Read a value written by WriteValue, which takes at most five bytes. Returns false when the data ends before the value does.
+    bool RecorderRingBuffer::ReadValue(const AZ::u8*& data, const AZ::u8* dataEnd, int32& previousValue)
+    {
+        uint32 zigZag = 0;
+        for (uint32 shift = 0; shift < 35; shift += 7)
+        {
+            if (data >= dataEnd)
+            {
+                return false;
+            }
+
+            const AZ::u8 byte = *data++;
+            zigZag |= static_cast<uint32>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                const int32 delta = static_cast<int32>(zigZag >> 1) ^ -static_cast<int32>(zigZag & 1);
+                previousValue = static_cast<int32>(static_cast<uint32>(previousValue) + static_cast<uint32>(delta));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    void RecorderRingBuffer::CloseCurrentSegment()
+    {
+        if (m_currentSegment.m_frameTimes.empty())
+        {
+            return;
+        }
+
+        m_currentSegment.m_numBytes = m_currentSegment.m_data.size();
+        m_lastSegmentNumBytes = m_currentSegment.m_numBytes;
+        m_numMemoryBytes += m_currentSegment.m_numBytes;
+        m_segments.emplace_back(AZStd::move(m_currentSegment));
+        m_currentSegment = Segment();
+
+        EnforceBudget();
+    }
+
+
+    void RecorderRingBuffer::EnforceBudget()
+    {
+        // Spill or drop the oldest segments that are still in memory, until we are within the memory budget again.
+        // This never waits for the disk: when the spill writes can't keep up, the segments get dropped instead, which leaves a gap in the recording.
+        while (m_numMemoryBytes > m_maxMemoryBytes && m_numSpilledSegments < m_segments.size())
+        {
+            Segment& segment = m_segments[m_numSpilledSegments];
+            m_numMemoryBytes -= segment.m_numBytes;
+            if (!m_spillFolder.empty() && m_numPendingWrites->load() < s_maxNumPendingWrites)
+            {
+                SpillSegment(segment);
+                m_numSpilledSegments++;
+            }
+            else
+            {
+                AZ_WarningOnce("EMotionFX", m_spillFolder.empty(), "Recorder ring buffer spill writes can't keep up, dropping segments instead.");
+                m_segments.erase(m_segments.begin() + m_numSpilledSegments);
+                m_numDroppedSegments++;
+            }
+        }
+
+        // Remove the oldest spilled segments in case we exceed the disk budget.
+        while (m_maxSpilledSegments > 0 && m_numSpilledSegments > m_maxSpilledSegments)
+        {
+            DeleteSpilledSegment(m_segments.front());
+            m_segments.pop_front();
+            m_numSpilledSegments--;
+            m_numDroppedSegments++;
+        }
+    }
+
+
+    void RecorderRingBuffer::SpillSegment(Segment& segment)
+    {
+        segment.m_spillFilename = AZStd::string::format("%s/%s_%06u.emfxsegment", m_spillFolder.c_str(), m_spillFilePrefix.c_str(), segment.m_id);
+
+        // Move the data into the spill state, so that the memory gets released once the write finished.
+        AZStd::shared_ptr<SpillState> spillState = AZStd::make_shared<SpillState>();
+        spillState->m_data = AZStd::move(segment.m_data);
+        segment.m_data = AZStd::vector<AZ::u8>();
+        segment.m_spillState = spillState;
+
+        // The job only holds shared state, so the ring buffer can be cleared or destroyed while it runs.
+        const AZStd::string filename = segment.m_spillFilename;
+        AZStd::shared_ptr<AZStd::atomic<uint32>> numPendingWrites = m_numPendingWrites;
+        const auto writeFunction = [spillState, filename, numPendingWrites]()
+        {
+            if (!spillState->m_isCancelled.load())
+            {
+                AZ::IO::SystemFile file;
+                if (file.Open(filename.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    spillState->m_isSuccess = (file.Write(spillState->m_data.data(), spillState->m_data.size()) == spillState->m_data.size());
+                    file.Close();
+                }
+                AZ_Warning("EMotionFX", spillState->m_isSuccess.load(), "Failed to spill recorder segment to '%s'.", filename.c_str());
+            }
+            spillState->m_data = AZStd::vector<AZ::u8>();
+
+            // The segment got dropped while we were writing it, so nobody else deletes the file anymore.
+            spillState->m_isWritten = true;
+            if (spillState->m_isCancelled.load())
+            {
+                AZ::IO::SystemFile::Delete(filename.c_str());
+            }
+
+            (*numPendingWrites)--;
+            spillState->m_writtenEvent.release();
+        };
+
+        (*m_numPendingWrites)++;
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(writeFunction, /*isAutoDelete=*/true, jobContext);
+            job->Start();
+        }
+        else
+        {
+            writeFunction();
+        }
+    }
+
+
+    void RecorderRingBuffer::DeleteSpilledSegment(Segment& segment)
+    {
+        // In case the write is still in progress, the job deletes the file once it is done.
+        SpillState& spillState = *segment.m_spillState;
+        spillState.m_isCancelled = true;
+        if (spillState.m_isWritten.load())
+        {
+            AZ::IO::SystemFile::Delete(segment.m_spillFilename.c_str());
+        }
+    }
+
+
+    void RecorderRingBuffer::WaitForPendingWrites() const
+    {
+        for (const Segment& segment : m_segments)
+        {
+            if (segment.m_spillState && !segment.m_spillState->m_isWritten.load())
+            {
+                segment.m_spillState->m_writtenEvent.acquire();
+                segment.m_spillState->m_writtenEvent.release();
+            }
+        }
+    }
+
+
+    bool RecorderRingBuffer::LoadSpilledSegment(const Segment& segment, AZStd::vector<AZ::u8>& outData) const
+    {
+        // Only wait for the write of this segment, in case it is still in progress.
+        SpillState& spillState = *segment.m_spillState;
+        if (!spillState.m_isWritten.load())
+        {
+            spillState.m_writtenEvent.acquire();
+            spillState.m_writtenEvent.release();
+        }
+
+        // Validate the file before reading anything, so that a truncated or replaced file can't be decoded.
+        const char* filename = segment.m_spillFilename.c_str();
+        if (!spillState.m_isSuccess.load() || AZ::IO::SystemFile::Length(filename) != segment.m_numBytes)
+        {
+            AZ_Warning("EMotionFX", false, "Recorder segment '%s' is missing or does not have the expected size of %zu bytes.", filename, segment.m_numBytes);
+            return false;
+        }
+
+        outData.resize(segment.m_numBytes);
+        AZ::IO::IStreamer* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        if (streamer)
+        {
+            AZStd::binary_semaphore completionEvent;
+            AZ::IO::FileRequestPtr request = streamer->Read(filename, outData.data(), outData.size(), outData.size());
+            streamer->SetRequestCompleteCallback(request, [&completionEvent]([[maybe_unused]] AZ::IO::FileRequestHandle completedRequest)
+                {
+                    completionEvent.release();
+                });
+            streamer->QueueRequest(request);
+            completionEvent.acquire();
+
+            if (streamer->GetRequestStatus(request) != AZ::IO::IStreamerTypes::RequestStatus::Completed)
+            {
+                return false;
+            }
+        }
+        else if (AZ::IO::SystemFile::Read(filename, outData.data(), outData.size()) != outData.size())
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+
+    const RecorderRingBuffer::Segment* RecorderRingBuffer::FindSegment(float recordTime) const
+    {
+        const bool hasCurrentSegment = !m_currentSegment.m_frameTimes.empty();
+        if (hasCurrentSegment && (m_segments.empty() || m_currentSegment.m_frameTimes.front() <= recordTime))
+        {
+            return &m_currentSegment;
+        }
+
+        if (m_segments.empty())
+        {
+            return nullptr;
+        }
+
+        // Find the last segment that starts at or before the given time, or the oldest one for earlier times.
+        const auto iterator = AZStd::upper_bound(m_segments.begin(), m_segments.end(), recordTime,
+            [](float time, const Segment& segment)
+            {
+                return time < segment.m_frameTimes.front();
+            });
+        return (iterator == m_segments.begin()) ? &m_segments.front() : &*(iterator - 1);
+    }
+
+
+    bool RecorderRingBuffer::DecodeFrame(const AZ::u8*& data, const AZ::u8* dataEnd, const Segment& segment, size_t frameIndex, int32* previousValues)
+    {
+        m_decodedFrame.m_recordTime = segment.m_frameTimes[frameIndex];
+        m_decodedFrame.m_timeDelta = segment.m_frameTimeDeltas[frameIndex];
+
+        const size_t numValuesPerTransform = m_recordScale ? 10 : 7;
+        for (size_t s = 0; s < m_slots.size(); ++s)
+        {
+            const Slot& slot = m_slots[s];
+            ActorFrame& actorFrame = m_decodedFrame.m_actorFrames[s];
+            actorFrame.m_actorInstance = slot.m_actorInstance;
+
+            int32* slotValues = &previousValues[slot.m_valueOffset];
+            if (!DecodeTransform(data, dataEnd, slotValues, actorFrame.m_localTransform))
+            {
+                return false;
+            }
+            slotValues += numValuesPerTransform;
+
+            for (uint32 j = 0; j < slot.m_numJoints; ++j)
+            {
+                if (!DecodeTransform(data, dataEnd, slotValues, actorFrame.m_jointTransforms[j]))
+                {
+                    return false;
+                }
+                slotValues += numValuesPerTransform;
+            }
+
+            for (uint32 m = 0; m < slot.m_numMorphs; ++m)
+            {
+                if (!ReadValue(data, dataEnd, slotValues[m]))
+                {
+                    return false;
+                }
+                actorFrame.m_morphWeights[m] = Dequantize(slotValues[m], 1.0f / s_unitQuantizationSteps);
+            }
+        }
+
+        return true;
+    }
+
+
+    const RecorderRingBuffer::Frame* RecorderRingBuffer::DecodeFrameAtTime(float recordTime)
+    {
+        const Segment* segment = FindSegment(recordTime);
+        if (!segment)
+        {
+            return nullptr;
+        }
+
+        const AZStd::vector<float>& frameTimes = segment->m_frameTimes;
+        const size_t numFramesUpToTime = AZStd::upper_bound(frameTimes.begin(), frameTimes.end(), recordTime) - frameTimes.begin();
+        const size_t frameIndex = (numFramesUpToTime > 0) ? numFramesUpToTime - 1 : 0;
+
+        // Restart at the beginning of the segment when switching segments, when going back in time or when the segment got spilled in the meantime.
+        Decoder& decoder = m_decoder;
+        const bool isSpilled = (segment->m_spillState != nullptr);
+        if (decoder.m_segmentId != segment->m_id || decoder.m_isSpilled != isSpilled || decoder.m_numDecodedFrames > frameIndex + 1)
+        {
+            decoder.m_segmentId = s_invalidSegmentId;
+            if (segment->m_spillState && !LoadSpilledSegment(*segment, decoder.m_spilledData))
+            {
+                return nullptr;
+            }
+
+            AZStd::fill(decoder.m_previousValues.begin(), decoder.m_previousValues.end(), 0);
+            decoder.m_segmentId = segment->m_id;
+            decoder.m_isSpilled = isSpilled;
+            decoder.m_offset = 0;
+            decoder.m_numDecodedFrames = 0;
+        }
+
+        const AZStd::vector<AZ::u8>& data = isSpilled ? decoder.m_spilledData : segment->m_data;
+        const AZ::u8* dataEnd = data.data() + data.size();
+        while (decoder.m_numDecodedFrames <= frameIndex)
+        {
+            const AZ::u8* frameData = data.data() + decoder.m_offset;
+            if (!DecodeFrame(frameData, dataEnd, *segment, decoder.m_numDecodedFrames, decoder.m_previousValues.data()))
+            {
+                AZ_Warning("EMotionFX", false, "Recorder segment %u is shorter than expected.", segment->m_id);
+                decoder.m_segmentId = s_invalidSegmentId;
+                return nullptr;
+            }
+
+            decoder.m_offset = frameData - data.data();
+            decoder.m_numDecodedFrames++;
+        }
+
+        return &m_decodedFrame;
+    }
+
+
+    bool RecorderRingBuffer::DecodeFrames(const FrameCallback& callback)
+    {
+        // This overwrites the decoded frame, so the lazy decoder has to start over.
+        m_decoder.m_segmentId = s_invalidSegmentId;
+
+        AZStd::vector<AZ::u8> spilledData;
+        AZStd::vector<int32> previousValues(m_previousValues.size(), 0);
+        const auto decodeSegment = [this, &callback, &spilledData, &previousValues](const Segment& segment)
+        {
+            if (segment.m_spillState && !LoadSpilledSegment(segment, spilledData))
+            {
+                AZ_Warning("EMotionFX", false, "Skipping recorder segment '%s', as it could not be loaded.", segment.m_spillFilename.c_str());
+                return false;
+            }
+
+            const AZStd::vector<AZ::u8>& data = segment.m_spillState ? spilledData : segment.m_data;
+            const AZ::u8* frameData = data.data();
+            const AZ::u8* dataEnd = data.data() + data.size();
+            AZStd::fill(previousValues.begin(), previousValues.end(), 0);
+            for (size_t f = 0; f < segment.m_frameTimes.size(); ++f)
+            {
+                if (!DecodeFrame(frameData, dataEnd, segment, f, previousValues.data()))
+                {
+                    AZ_Warning("EMotionFX", false, "Recorder segment %u is shorter than expected.", segment.m_id);
+                    return false;
+                }
+                callback(m_decodedFrame);
+            }
+            return true;
+        };
+
+        bool success = true;
+        for (const Segment& segment : m_segments)
+        {
+            success &= decodeSegment(segment);
+        }
+        success &= decodeSegment(m_currentSegment);
+        return success;
+    }
+
+
+    void RecorderRingBuffer::GetTimeDeltas(AZStd::vector<float>& outTimeDeltas) const
+    {
+        outTimeDeltas.clear();
+        outTimeDeltas.reserve(GetNumFrames());
+        for (const Segment& segment : m_segments)
+        {
+            outTimeDeltas.insert(outTimeDeltas.end(), segment.m_frameTimeDeltas.begin(), segment.m_frameTimeDeltas.end());
+        }
+        outTimeDeltas.insert(outTimeDeltas.end(), m_currentSegment.m_frameTimeDeltas.begin(), m_currentSegment.m_frameTimeDeltas.end());
+    }
+
+
+    size_t RecorderRingBuffer::GetNumFrames() const
+    {
+        size_t numFrames = m_currentSegment.m_frameTimes.size();
+        for (const Segment& segment : m_segments)
+        {
+            numFrames += segment.m_frameTimes.size();
+        }
+        return numFrames;
+    }
+
+
+    float RecorderRingBuffer::GetStartTime() const
+    {
+        if (!m_segments.empty())
+        {
+            return m_segments.front().m_frameTimes.front();
+        }
+        return m_currentSegment.m_frameTimes.empty() ? 0.0f : m_currentSegment.m_frameTimes.front();
+    }
+
+
+    float RecorderRingBuffer::GetEndTime() const
+    {
+        if (!m_currentSegment.m_frameTimes.empty())
+        {
+            return m_currentSegment.m_frameTimes.back();
+        }
+        return m_segments.empty() ? 0.0f : m_segments.back().m_frameTimes.back();
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Recorder.h>
+#include <EMotionFX/Source/Transform.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * A bounded memory recording buffer, used by the recorder when RecordSettings::mUseRingBuffer is enabled.
+     * Frames are stored in segments of a fixed number of frames. Transforms and morph weights are quantized to integers, and each frame
+     * stores the differences to the previous frame as variable length integers, so that joints that don't move only take a single byte per value.
+     * The first frame of every segment stores absolute values, so that segments can be decoded, spilled and dropped independently.
+     * Once the encoded segments use more memory than the budget, the oldest segments are written to disk asynchronously on a job, or dropped
+     * in case no spill folder has been set or the spill writes can't keep up. The recording thread never waits for spill writes.
+     * Frames are decoded lazily, one segment at a time, when they are played back. Spilled segments are loaded back from disk when needed.
+     */
+    class EMFX_API RecorderRingBuffer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        struct EMFX_API ActorFrame
+        {
+            ActorInstance*              m_actorInstance = nullptr;  /**< The recorded actor instance, or nullptr in case it got removed from the recording. */
+            Transform                   m_localTransform;           /**< The local space transform of the actor instance itself. */
+            AZStd::vector<Transform>    m_jointTransforms;          /**< The local space joint transforms, empty when transforms aren't recorded. */
+            AZStd::vector<float>        m_morphWeights;             /**< The morph target weights, empty when morphs aren't recorded. */
+        };
+
+        struct EMFX_API Frame
+        {
+            float                       m_recordTime = 0.0f;
+            float                       m_timeDelta = 0.0f;
+            AZStd::vector<ActorFrame>   m_actorFrames;              /**< The actor frames, in the order of the actor instances passed to Init(). */
+        };
+
+        using FrameCallback = AZStd::function<void(const Frame& frame)>;
+
+        RecorderRingBuffer();
+        ~RecorderRingBuffer();
+
+        /**
+         * Initialize the buffer layout for the given actor instances. This clears all recorded data.
+         * @param settings The record settings, which contain the ring buffer settings.
+         * @param actorInstances The actor instances that will be recorded.
+         * @param spillFilePrefix The prefix for the file names of spilled segments, which should be unique per recording session.
+         */
+        void Init(const Recorder::RecordSettings& settings, const AZStd::vector<ActorInstance*>& actorInstances, const AZStd::string& spillFilePrefix);
+
+        /**
+         * Clear all recorded data, including the spilled segment files. Spill writes that are still in progress delete their file once done.
+         */
+        void Clear();
+
+        /**
+         * Encode the current state of all actor instances as a new frame.
+         * @param recordTime The recording time of the frame.
+         * @param timeDelta The time passed since the last recorded frame.
+         */
+        void RecordFrame(float recordTime, float timeDelta);
+
+        /**
+         * Stop recording data for the given actor instance, for example because it is about to get destroyed.
+         * Its values will be repeated in the rest of the recording and decoded frames will report the actor instance as nullptr.
+         * @param actorInstance The actor instance to remove.
+         */
+        void RemoveActorInstance(ActorInstance* actorInstance);
+
+        /**
+         * Decode the frame that was recorded at or last before the given time.
+         * Playing forward only decodes the new frames of the current segment, jumping to another segment decodes it from its start.
+         * @param recordTime The recording time to decode the frame for. Times before the oldest frame return the oldest frame.
+         * @result The decoded frame, which stays valid until the next decode call, or nullptr in case there are no frames or the segment could not be loaded.
+         */
+        const Frame* DecodeFrameAtTime(float recordTime);
+
+        /**
+         * Decode all frames that are still in the ring buffer, from the oldest to the newest frame.
+         * Spilled segments are loaded back from disk one at a time.
+         * @param callback The function that gets called for every decoded frame.
+         * @result True in case all segments could be decoded, false in case some spilled segments could not be loaded back and were skipped.
+         */
+        bool DecodeFrames(const FrameCallback& callback);
+
+        /**
+         * Get the time deltas of all frames, from the oldest to the newest frame. This does not need to decode any segments.
+         * @param outTimeDeltas The time deltas, one for each frame.
+         */
+        void GetTimeDeltas(AZStd::vector<float>& outTimeDeltas) const;
+
+        /**
+         * Block until all spill writes that are in progress have finished. The ring buffer itself only waits when loading a segment that is still being written.
+         */
+        void WaitForPendingWrites() const;
+
+        size_t GetNumMemoryBytes() const                                    { return m_numMemoryBytes + m_currentSegment.m_data.size(); }
+        size_t GetNumSegments() const                                       { return m_segments.size() + (m_currentSegment.m_frameTimes.empty() ? 0 : 1); }
+        size_t GetNumSpilledSegments() const                                { return m_numSpilledSegments; }
+        size_t GetNumDroppedSegments() const                                { return m_numDroppedSegments; }
+        uint32 GetNumPendingWrites() const                                  { return m_numPendingWrites->load(); }
+        size_t GetNumFrames() const;
+        float GetStartTime() const;
+        float GetEndTime() const;
+
+        static constexpr uint32 s_maxNumPendingWrites = 4;                  /**< The number of spill writes that can be in progress, before segments get dropped instead. */
+
+    private:
+        static constexpr uint32 s_invalidSegmentId = 0xffffffff;
+
+        // The state of a spill write, shared with the job that writes it, so that the ring buffer never has to wait for the job.
+        struct SpillState
+        {
+            AZStd::vector<AZ::u8>   m_data;                 /**< The data to write, released by the job once written. */
+            AZStd::binary_semaphore m_writtenEvent;         /**< Signaled once the job is done. */
+            AZStd::atomic<bool>     m_isWritten{ false };
+            AZStd::atomic<bool>     m_isSuccess{ false };
+            AZStd::atomic<bool>     m_isCancelled{ false }; /**< Set when the segment got dropped, in which case whoever finishes last deletes the file. */
+        };
+
+        struct Segment
+        {
+            AZStd::vector<AZ::u8>           m_data;
+            AZStd::vector<float>            m_frameTimes;           /**< The record time of each frame, which stays in memory after the segment got spilled. */
+            AZStd::vector<float>            m_frameTimeDeltas;      /**< The time delta of each frame. */
+            AZStd::string                   m_spillFilename;        /**< The file the segment got spilled to, or empty when the data is in memory. */
+            AZStd::shared_ptr<SpillState>   m_spillState;           /**< The state of the spill write, or nullptr when the data is in memory. */
+            size_t                          m_numBytes = 0;         /**< The size of the encoded data, which is also known after it got spilled. */
+            uint32                          m_id = 0;               /**< A unique id, used to name the spill file and to identify the segment in the decoder. */
+        };
+
+        struct Slot
+        {
+            ActorInstance*          m_actorInstance = nullptr;
+            uint32                  m_numJoints = 0;
+            uint32                  m_numMorphs = 0;
+            size_t                  m_valueOffset = 0;      /**< The offset of the first value of this slot inside m_previousValues. */
+        };
+
+        // The state of the lazy decoder, which continues decoding where it left off when playing forward.
+        struct Decoder
+        {
+            AZStd::vector<AZ::u8>   m_spilledData;          /**< The data of the spilled segment that is being decoded. */
+            AZStd::vector<int32>    m_previousValues;
+            size_t                  m_offset = 0;           /**< The offset of the next frame to decode inside the segment data. */
+            size_t                  m_numDecodedFrames = 0;
+            uint32                  m_segmentId = s_invalidSegmentId;
+            bool                    m_isSpilled = false;    /**< Whether the segment was already spilled when decoding started. */
+        };
+
+        void CloseCurrentSegment();
+        void EnforceBudget();
+        void SpillSegment(Segment& segment);
+        void DeleteSpilledSegment(Segment& segment);
+        const Segment* FindSegment(float recordTime) const;
+        bool LoadSpilledSegment(const Segment& segment, AZStd::vector<AZ::u8>& outData) const;
+        bool DecodeFrame(const AZ::u8*& data, const AZ::u8* dataEnd, const Segment& segment, size_t frameIndex, int32* previousValues);
+        bool DecodeTransform(const AZ::u8*& data, const AZ::u8* dataEnd, int32* previousValues, Transform& outTransform) const;
+        void EncodeTransform(const Transform& transform, int32* previousValues);
+        void WriteValue(int32 value, int32& previousValue);
+        static bool ReadValue(const AZ::u8*& data, const AZ::u8* dataEnd, int32& previousValue);
+
+        AZStd::vector<Slot>                 m_slots;
+        AZStd::deque<Segment>               m_segments;             /**< The closed segments, oldest first. The spilled segments are at the front. */
+        Segment                             m_currentSegment;
+        AZStd::vector<int32>                m_previousValues;       /**< The quantized values of the previous frame, for all slots. */
+        Frame                               m_decodedFrame;
+        Decoder                             m_decoder;
+        AZStd::string                       m_spillFolder;
+        AZStd::string                       m_spillFilePrefix;
+        size_t                              m_maxMemoryBytes = 0;
+        size_t                              m_numMemoryBytes = 0;   /**< The memory used by the closed segments that are still in memory. */
+        size_t                              m_maxSpilledSegments = 0;
+        size_t                              m_numSpilledSegments = 0;
+        size_t                              m_numDroppedSegments = 0;
+        size_t                              m_lastSegmentNumBytes = 0;
+        uint32                              m_segmentNumFrames = 0;
+        uint32                              m_nextSegmentId = 0;
+        float                               m_positionPrecision = 0.0001f;
+        bool                                m_recordScale = false;
+        AZStd::shared_ptr<AZStd::atomic<uint32>> m_numPendingWrites; /**< Shared with the spill jobs, which can outlive the ring buffer. */
+    };
+}   // namespace EMotionFX
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/SimulatedObjectSolverStage.h>
+#include <EMotionFX/Source/SpringSolver.h>
+#include <EMotionFX/Source/TransformData.h>
+
+
+namespace EMotionFX
+{
+    void SimulatedObjectSolverStage::BeginFrame()
+    {
+        MCore::LockGuard lock(m_mutex);
+        m_chainActorInstances.clear();
+        m_chains.clear();
+        m_isCollecting = true;
+    }
+
+
+    bool SimulatedObjectSolverStage::AddChains(ActorInstance* actorInstance, const Chain* chains, size_t numChains)
+    {
+        MCore::LockGuard lock(m_mutex);
+        if (!m_isCollecting)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < numChains; ++i)
+        {
+            m_chainActorInstances.emplace_back(actorInstance);
+            m_chains.emplace_back(chains[i]);
+        }
+
+        return true;
+    }
+
+
+    void SimulatedObjectSolverStage::RemoveActorInstance(ActorInstance* actorInstance)
+    {
+        MCore::LockGuard lock(m_mutex);
+        for (size_t i = 0; i < m_chainActorInstances.size();)
+        {
+            if (m_chainActorInstances[i] == actorInstance)
+            {
+                m_chainActorInstances.erase(m_chainActorInstances.begin() + i);
+                m_chains.erase(m_chains.begin() + i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+
+    bool SimulatedObjectSolverStage::GetIsCollecting() const
+    {
+        MCore::LockGuard lock(m_mutex);
+        return m_isCollecting;
+    }
+
+
+    void SimulatedObjectSolverStage::Execute()
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "SimulatedObjectSolverStage::Execute");
+
+        MCore::LockGuard lock(m_mutex);
+        m_isCollecting = false;
+        m_numSolvedChains = m_chains.size();
+        m_groups.clear();
+
+        if (m_chains.empty())
+        {
+            m_numSolvedActorInstances = 0;
+            return;
+        }
+
+        // Sort the chains per actor instance, so that all chains of an actor instance are solved by the same job and in the order they got added in.
+        const size_t numChains = m_chains.size();
+        m_sortedChainIndices.resize(numChains);
+        for (size_t i = 0; i < numChains; ++i)
+        {
+            m_sortedChainIndices[i] = i;
+        }
+        AZStd::sort(m_sortedChainIndices.begin(), m_sortedChainIndices.end(), [this](size_t a, size_t b)
+        {
+            if (m_chainActorInstances[a] != m_chainActorInstances[b])
+            {
+                return m_chainActorInstances[a] < m_chainActorInstances[b];
+            }
+            return a < b;
+        });
+
+        for (size_t i = 0; i < numChains; ++i)
+        {
+            ActorInstance* actorInstance = m_chainActorInstances[m_sortedChainIndices[i]];
+            if (m_groups.empty() || m_groups.back().m_actorInstance != actorInstance)
+            {
+                m_groups.push_back({ actorInstance, i, 0 });
+            }
+            m_groups.back().m_numChains++;
+        }
+        m_numSolvedActorInstances = m_groups.size();
+
+        // Use enough jobs to keep the workers busy, but don't spawn jobs for just a few chains.
+        const AZ::u32 numWorkerThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        const AZ::u32 maxNumParallelJobs = (m_maxNumParallelJobs > 0) ? m_maxNumParallelJobs : numWorkerThreads;
+        const size_t maxNumJobsForChains = numChains / AZStd::max<size_t>(m_minNumChainsPerJob, 1);
+        const size_t numJobs = AZStd::max<size_t>(1, AZStd::min<size_t>(AZStd::min<size_t>(maxNumParallelJobs, m_groups.size()), maxNumJobsForChains));
+
+        while (m_inputPoses.size() < numJobs)
+        {
+            m_inputPoses.emplace_back(AZStd::make_unique<Pose>());
+        }
+
+        if (numJobs == 1)
+        {
+            for (const ActorGroup& group : m_groups)
+            {
+                SolveActorGroup(group, *m_inputPoses[0]);
+            }
+            return;
+        }
+
+        // Each job keeps picking the next actor instance that is not being solved yet.
+        AZStd::atomic<size_t> nextGroupIndex{ 0 };
+        AZ::JobCompletion jobCompletion;
+        for (size_t j = 0; j < numJobs; ++j)
+        {
+            Pose* inputPose = m_inputPoses[j].get();
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, inputPose, &nextGroupIndex]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "SimulatedObjectSolverStage::Execute::SolveJob");
+
+                const size_t numGroups = m_groups.size();
+                for (size_t groupIndex = nextGroupIndex++; groupIndex < numGroups; groupIndex = nextGroupIndex++)
+                {
+                    SolveActorGroup(m_groups[groupIndex], *inputPose);
+                }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void SimulatedObjectSolverStage::SolveActorGroup(const ActorGroup& group, Pose& inputPose)
+    {
+        ActorInstance* actorInstance = group.m_actorInstance;
+        Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+
+        // The evaluated pose is the input for all chains, like the input pose of the simulated object node.
+        inputPose.LinkToActorInstance(actorInstance);
+        inputPose.InitFromPose(pose);
+
+        for (size_t i = 0; i < group.m_numChains; ++i)
+        {
+            const Chain& chain = m_chains[m_sortedChainIndices[group.m_firstChain + i]];
+            SpringSolver* solver = chain.m_solver;
+            solver->SetStiffnessFactor(chain.m_stiffnessFactor);
+            solver->SetGravityFactor(chain.m_gravityFactor);
+            solver->SetDampingFactor(chain.m_dampingFactor);
+            solver->SetCollisionEnabled(chain.m_collisionEnabled);
+            solver->Update(inputPose, *pose, chain.m_timePassedInSeconds);
+        }
+
+        // Write the results back before the mesh deformers run.
+        actorInstance->UpdateSkinningMatrices();
+    }
+}   // namespace EMotionFX
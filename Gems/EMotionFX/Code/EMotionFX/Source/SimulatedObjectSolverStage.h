@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Pose.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+    class SpringSolver;
+
+
+    /**
+     * The simulated object solver stage, which solves the simulated object chains (like hair, tails and cloth-like strips) of all actor instances
+     * in one go, after all actor instances have been updated, instead of solving them interleaved with the anim graph evaluation of each actor instance.
+     * Simulated object nodes that have BlendTreeSimulatedObjectNode::GetSolveInBatchStage() enabled pass their input pose through and register
+     * their chains to this stage instead. When executing, the chains are grouped per actor instance and the groups are solved in parallel on the job system.
+     * Each actor instance its current pose is used as the solver input pose, and the solved pose is written back into it, after which the skinning matrices
+     * get updated, so that the mesh deformers see the simulated joints.
+     * The stage collects chains between BeginFrame() and Execute(), which ActorManager::UpdateActorInstances() calls around the scheduler execution.
+     * Outside of that, AddChains() returns false and the chains are solved inline by the node. Adding chains is thread safe.
+     */
+    class EMFX_API SimulatedObjectSolverStage
+    {
+    public:
+        struct EMFX_API Chain
+        {
+            SpringSolver*   m_solver = nullptr;
+            float           m_stiffnessFactor = 1.0f;
+            float           m_gravityFactor = 1.0f;
+            float           m_dampingFactor = 1.0f;
+            float           m_timePassedInSeconds = 0.0f;
+            bool            m_collisionEnabled = true;
+        };
+
+        SimulatedObjectSolverStage() = default;
+        ~SimulatedObjectSolverStage() = default;
+
+        /**
+         * Start collecting chains for a new frame. Chains that have not been executed yet are discarded.
+         */
+        void BeginFrame();
+
+        /**
+         * Register chains to be solved for the given actor instance when the stage executes.
+         * @param actorInstance The actor instance whose current pose the chains modify.
+         * @param chains The chains to solve, in the order in which they have to be solved.
+         * @param numChains The number of chains.
+         * @result True in case the chains got registered, false in case the stage isn't collecting, in which case the caller has to solve them itself.
+         */
+        bool AddChains(ActorInstance* actorInstance, const Chain* chains, size_t numChains);
+
+        /**
+         * Solve all registered chains and write the results back into the current poses of their actor instances.
+         * This stops collecting chains until the next BeginFrame() call.
+         */
+        void Execute();
+
+        /**
+         * Remove all chains of the given actor instance, for example because it is about to get destroyed.
+         * @param actorInstance The actor instance to remove the chains for.
+         */
+        void RemoveActorInstance(ActorInstance* actorInstance);
+
+        bool GetIsCollecting() const;
+        void SetMaxNumParallelJobs(AZ::u32 maxNumParallelJobs)         { m_maxNumParallelJobs = maxNumParallelJobs; }
+        void SetMinNumChainsPerJob(size_t minNumChainsPerJob)          { m_minNumChainsPerJob = minNumChainsPerJob; }
+        size_t GetNumSolvedChains() const                               { return m_numSolvedChains; }
+        size_t GetNumSolvedActorInstances() const                       { return m_numSolvedActorInstances; }
+
+    private:
+        struct ActorGroup
+        {
+            ActorInstance*  m_actorInstance = nullptr;
+            size_t          m_firstChain = 0;
+            size_t          m_numChains = 0;
+        };
+
+        void SolveActorGroup(const ActorGroup& group, Pose& inputPose);
+
+        // The chains are stored as parallel arrays, sorted per actor instance before solving.
+        AZStd::vector<ActorInstance*>           m_chainActorInstances;
+        AZStd::vector<Chain>                    m_chains;
+        AZStd::vector<size_t>                   m_sortedChainIndices;
+        AZStd::vector<ActorGroup>               m_groups;
+        AZStd::vector<AZStd::unique_ptr<Pose>>  m_inputPoses;           /**< The scratch input poses, one per job, reused every frame. */
+        mutable MCore::Mutex                    m_mutex;
+        size_t                                  m_minNumChainsPerJob = 4;
+        size_t                                  m_numSolvedChains = 0;
+        size_t                                  m_numSolvedActorInstances = 0;
+        AZ::u32                                 m_maxNumParallelJobs = 0; /**< The maximum number of jobs, or zero to use one job per worker thread. */
+        bool                                    m_isCollecting = false;
+    };
+}   // namespace EMotionFX
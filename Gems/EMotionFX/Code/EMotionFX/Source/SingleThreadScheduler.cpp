@@ -45,9 +45,7 @@ namespace EMotionFX
         const ActorManager& actorManager = GetActorManager();
 
         // reset stats
-        mNumUpdated.SetValue(0);
-        mNumVisible.SetValue(0);
-        mNumSampled.SetValue(0);
+        BeginFrame();
 
         // propagate root actor instance visibility to their attachments
         const uint32 numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -94,19 +92,8 @@ namespace EMotionFX
 
         const bool isVisible = actorInstance->GetIsVisible();
 
-        // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-        {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
-
-            if (isVisible)
-            {
-                mNumSampled.Increment();
-            }
-        }
+        // check if we want to sample motions, taking the update-rate LOD into account
+        const bool sampleMotions = CheckShouldSampleMotions(actorInstance, timePassedInSeconds, isVisible);
 
         if (isVisible)
         {
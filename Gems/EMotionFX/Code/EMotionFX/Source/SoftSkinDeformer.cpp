@@ -7,6 +7,9 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -69,6 +72,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->mNodeNumbers    = mNodeNumbers;
         result->mBoneMatrices   = mBoneMatrices;
+        result->m_packedInfluences = m_packedInfluences;
 
         // return the result
         return result;
@@ -103,7 +107,105 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(mMesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(mMesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(mMesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, mMesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        const uint32 numVertices = mMesh->GetNumVertices();
+        if (!m_packedInfluences.GetIsValid() || m_packedInfluences.GetNumVertices() != numVertices)
+        {
+            SkinVertexRange(0, numVertices, positions, normals, tangents, bitangents, orgVerts, layer);
+            return;
+        }
+
+        SkinVerticesPacked(numVertices, positions, normals, tangents, bitangents);
+    }
+
+
+    void SoftSkinDeformer::SkinVerticesPacked(uint32 numVertices, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+    {
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinVertexRangePacked(0, numVertices, positions, normals, tangents, bitangents);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+
+        // Split up the skinned vertices into batches.
+        const AZ::u32 numBatches = (numVertices + s_numVerticesPerBatch - 1) / s_numVerticesPerBatch;
+        for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
+            const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+            // Create a job for every batch and skin them simultaneously.
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents]()
+                {
+                    SkinVertexRangePacked(startVertex, endVertex, positions, normals, tangents, bitangents);
+                }, /*isAutoDelete=*/true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void SoftSkinDeformer::SkinVertexRangePacked(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+    {
+        using AZ::Simd::Vec4;
+
+        const uint32 numSlots = m_packedInfluences.GetNumInfluencesPerVertex();
+        for (uint32 v = startVertex; v < endVertex; ++v)
+        {
+            const AZ::u16* boneIndices = m_packedInfluences.GetBoneIndices(v);
+            const AZ::u16* weights = m_packedInfluences.GetWeights(v);
+
+            // vertices without influences are zeroed out, the same way the scalar path does, without touching any bone matrix
+            if (weights[0] == 0)
+            {
+                positions[v] = AZ::Vector3::CreateZero();
+                normals[v] = AZ::Vector3::CreateZero();
+                if (tangents)
+                {
+                    tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(AZ::Vector3::CreateZero(), tangents[v].GetW());
+                }
+                if (bitangents)
+                {
+                    bitangents[v] = AZ::Vector3::CreateZero();
+                }
+                continue;
+            }
+
+            // blend the rows of the bone matrices, the influences are sorted on weight so we can stop at the first empty slot
+            const Vec4::FloatType* boneRows = mBoneMatrices[boneIndices[0]].GetSimdValues();
+            Vec4::FloatType weight = Vec4::Splat(PackedSkinInfluences::DequantizeWeight(weights[0]));
+            Vec4::FloatType row0 = Vec4::Mul(boneRows[0], weight);
+            Vec4::FloatType row1 = Vec4::Mul(boneRows[1], weight);
+            Vec4::FloatType row2 = Vec4::Mul(boneRows[2], weight);
+            for (uint32 i = 1; i < numSlots && weights[i] != 0; ++i)
+            {
+                boneRows = mBoneMatrices[boneIndices[i]].GetSimdValues();
+                weight = Vec4::Splat(PackedSkinInfluences::DequantizeWeight(weights[i]));
+                row0 = Vec4::Madd(boneRows[0], weight, row0);
+                row1 = Vec4::Madd(boneRows[1], weight, row1);
+                row2 = Vec4::Madd(boneRows[2], weight, row2);
+            }
+
+            const AZ::Matrix3x4 skinMatrix = AZ::Matrix3x4::CreateFromRows(AZ::Vector4(row0), AZ::Vector4(row1), AZ::Vector4(row2));
+            positions[v] = skinMatrix * positions[v];
+            normals[v] = skinMatrix.Multiply3x3(normals[v]);
+
+            if (tangents)
+            {
+                const AZ::Vector3 tangent = skinMatrix.Multiply3x3(tangents[v].GetAsVector3());
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(tangent, tangents[v].GetW());
+            }
+
+            if (bitangents)
+            {
+                bitangents[v] = skinMatrix.Multiply3x3(bitangents[v]);
+            }
+        }
     }
 
 
@@ -258,5 +360,8 @@ namespace EMotionFX
         }
         // get rid of all items in the used bones array
         //  mBones.Shrink();
+
+        // pack the influences per vertex, now that the bone numbers are known
+        m_packedInfluences.Init(mMesh, skinningLayer);
     }
 } // namespace EMotionFX
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "PackedSkinInfluences.h"
 
 
 namespace EMotionFX
@@ -117,9 +118,20 @@ namespace EMotionFX
         MCORE_INLINE void ReserveLocalBones(uint32 numBones)                { mNodeNumbers.reserve(numBones); mBoneMatrices.reserve(numBones); }
 
 
+        /**
+         * Get the skin influences packed per vertex, which are used by the skinning in case all vertices have at most
+         * PackedSkinInfluences::s_maxInfluencesPerVertex influences.
+         * @result The packed skin influences.
+         */
+        const PackedSkinInfluences& GetPackedInfluences() const            { return m_packedInfluences; }
+
     protected:
         AZStd::vector<AZ::Matrix3x4>    mBoneMatrices;
         AZStd::vector<uint32>           mNodeNumbers;
+        PackedSkinInfluences            m_packedInfluences;
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
 
         /**
          * Default constructor.
@@ -152,5 +164,20 @@ namespace EMotionFX
         }
 
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices using the packed skin influences.
+         * This blends the bone matrices of the influences using SIMD first, and then transforms the vertex attributes only once with the blended matrix.
+         * @param startVertex The first vertex to skin.
+         * @param endVertex The vertex after the last one to skin.
+         */
+        void SkinVertexRangePacked(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const;
+
+        /**
+         * Skin all vertices of the mesh using the packed skin influences.
+         * Meshes with more than s_numVerticesPerBatch vertices are split into batches that are skinned in parallel jobs.
+         * @param numVertices The number of vertices to skin.
+         */
+        void SkinVerticesPacked(uint32 numVertices, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const;
     };
 } // namespace EMotionFX
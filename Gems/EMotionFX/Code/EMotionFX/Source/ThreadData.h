@@ -14,6 +14,7 @@
 #include "AnimGraphPosePool.h"
 #include "AnimGraphRefCountedDataPool.h"
 #include <MCore/Source/Array.h>
+#include <AzCore/std/containers/vector.h>
 
 
 namespace EMotionFX
@@ -40,10 +41,18 @@ namespace EMotionFX
         MCORE_INLINE AnimGraphRefCountedDataPool& GetRefCountedDataPool()                  { return mRefCountedDataPool; }
         MCORE_INLINE const AnimGraphRefCountedDataPool& GetRefCountedDataPool() const      { return mRefCountedDataPool; }
 
+        /**
+         * Get the scratch buffer that motion data can decode key rows into while sampling a pose.
+         * The buffer only grows, so after the first frames sampling doesn't allocate anymore.
+         * @result The scratch buffer of this thread.
+         */
+        MCORE_INLINE AZStd::vector<float>& GetMotionSampleBuffer()                         { return mMotionSampleBuffer; }
+
     private:
         uint32                          mThreadIndex;
         AnimGraphPosePool              mPosePool;
         AnimGraphRefCountedDataPool    mRefCountedDataPool;
+        AZStd::vector<float>           mMotionSampleBuffer;
 
         ThreadData();
         ThreadData(uint32 threadIndex);
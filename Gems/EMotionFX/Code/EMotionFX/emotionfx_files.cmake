@@ -15,6 +15,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -97,6 +98,8 @@ set(FILES
     Source/NodeMap.h
     Source/ObjectId.cpp
     Source/ObjectId.h
+    Source/PackedSkinInfluences.cpp
+    Source/PackedSkinInfluences.h
     Source/PlayBackInfo.h
     Source/PhysicsSetup.cpp
     Source/PhysicsSetup.h
@@ -115,11 +118,15 @@ set(FILES
     Source/Recorder.cpp
     Source/Recorder.h
     Source/RecorderBus.h
+    Source/RecorderRingBuffer.cpp
+    Source/RecorderRingBuffer.h
     Source/RepositioningLayerPass.cpp
     Source/RepositioningLayerPass.h
     Source/SimulatedObjectBus.h
     Source/SimulatedObjectSetup.cpp
     Source/SimulatedObjectSetup.h
+    Source/SimulatedObjectSolverStage.cpp
+    Source/SimulatedObjectSolverStage.h
     Source/SingleThreadScheduler.cpp
     Source/SingleThreadScheduler.h
     Source/Skeleton.cpp
@@ -199,6 +206,8 @@ set(FILES
     Source/AnimGraphStateMachine.h
     Source/AnimGraphStateTransition.cpp
     Source/AnimGraphStateTransition.h
+    Source/AnimGraphSharedEvaluation.cpp
+    Source/AnimGraphSharedEvaluation.h
     Source/AnimGraphSnapshot.cpp
     Source/AnimGraphSnapshot.h
     Source/AnimGraphSyncTrack.cpp
@@ -346,6 +355,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/MemoryDrillerBus.h>
+#include <AzCore/Memory/PlatformMemoryInstrumentation.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphPose.h>
+#include <EMotionFX/Source/AnimGraphPosePool.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeBlendNNode.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/ThreadData.h>
+#include <EMotionFX/Source/TransformData.h>
+
+namespace EMotionFX
+{
+    // Counts the allocations made through any allocator registered with the allocator manager, by putting the allocators in profiling mode.
+    class AllocationCounter
+        : public AZ::Debug::MemoryDrillerBus::Handler
+    {
+    public:
+        AllocationCounter()
+        {
+            AZ::Debug::MemoryDrillerBus::Handler::BusConnect();
+            AZ::AllocatorManager::Instance().EnterProfilingMode();
+        }
+
+        ~AllocationCounter() override
+        {
+            AZ::AllocatorManager::Instance().ExitProfilingMode();
+            AZ::Debug::MemoryDrillerBus::Handler::BusDisconnect();
+        }
+
+        size_t GetNumAllocations() const { return m_numAllocations.load(); }
+
+        // MemoryDrillerBus
+        void RegisterAllocator([[maybe_unused]] AZ::IAllocator* allocator) override {}
+        void UnregisterAllocator([[maybe_unused]] AZ::IAllocator* allocator) override {}
+        void RegisterAllocation([[maybe_unused]] AZ::IAllocator* allocator, [[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize, [[maybe_unused]] size_t alignment,
+            [[maybe_unused]] const char* name, [[maybe_unused]] const char* fileName, [[maybe_unused]] int lineNum, [[maybe_unused]] unsigned int stackSuppressCount) override
+        {
+            ++m_numAllocations;
+        }
+        void UnregisterAllocation([[maybe_unused]] AZ::IAllocator* allocator, [[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize,
+            [[maybe_unused]] size_t alignment, [[maybe_unused]] AZ::Debug::AllocationInfo* info) override {}
+        void ReallocateAllocation([[maybe_unused]] AZ::IAllocator* allocator, [[maybe_unused]] void* prevAddress, [[maybe_unused]] void* newAddress,
+            [[maybe_unused]] size_t newByteSize, [[maybe_unused]] size_t newAlignment) override
+        {
+            ++m_numAllocations;
+        }
+        void ResizeAllocation([[maybe_unused]] AZ::IAllocator* allocator, [[maybe_unused]] void* address, [[maybe_unused]] size_t newSize) override {}
+        void DumpAllAllocations() override {}
+
+    private:
+        AZStd::atomic<size_t> m_numAllocations{ 0 };
+    };
+
+    class AnimGraphPosePoolFixture
+        : public AnimGraphFixture
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(20);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            BlendTree* blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            /*
+                +------------+
+                | Motion 0-4 +-->+---------+
+                +------------+   | Blend N +--->+---------+      +-------+
+                +-------------+  |         |    | Blend 2 +----->+ Final |
+                | Const Float +->+---------+ +->+         |      +-------+
+                +-------------+              |  +---------+
+                +----------+                 |       ^
+                | Motion 5 +-----------------+       |
+                +----------+           +-------------+
+                                       | Const Float |
+                                       +-------------+
+            */
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+
+            BlendTreeBlend2Node* blend2Node = aznew BlendTreeBlend2Node();
+            blendTree->AddChildNode(blend2Node);
+            finalNode->AddConnection(blend2Node, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            BlendTreeBlendNNode* blendNNode = aznew BlendTreeBlendNNode();
+            blendTree->AddChildNode(blendNNode);
+            blend2Node->AddConnection(blendNNode, BlendTreeBlendNNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_A);
+
+            for (size_t i = 0; i < s_numMotionNodes; ++i)
+            {
+                AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+                motionNode->SetName(AZStd::string::format("MotionNode%zu", i).c_str());
+                blendTree->AddChildNode(motionNode);
+                if (i + 1 < s_numMotionNodes)
+                {
+                    blendNNode->AddConnection(motionNode, AnimGraphMotionNode::PORTID_OUTPUT_POSE, static_cast<AZ::u16>(i));
+                }
+                else
+                {
+                    blend2Node->AddConnection(motionNode, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_B);
+                }
+                m_motionNodes.push_back(motionNode);
+            }
+            blendNNode->UpdateParamWeights();
+            blendNNode->SetParamWeightsEquallyDistributed(0.0f, 1.0f);
+
+            m_blendNWeightNode = aznew BlendTreeFloatConstantNode();
+            blendTree->AddChildNode(m_blendNWeightNode);
+            blendNNode->AddConnection(m_blendNWeightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlendNNode::INPUTPORT_WEIGHT);
+
+            m_blend2WeightNode = aznew BlendTreeFloatConstantNode();
+            blendTree->AddChildNode(m_blend2WeightNode);
+            blend2Node->AddConnection(m_blend2WeightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+
+            for (size_t i = 0; i < m_motionNodes.size(); ++i)
+            {
+                const AZStd::string motionId = AZStd::string::format("testSkeletalMotion%zu", i);
+
+                Motion* motion = aznew Motion(motionId.c_str());
+                motion->SetMotionData(CreateKeyframedMotionData(i + 1.0f, static_cast<float>(i)));
+
+                MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion);
+                m_motionSet->AddMotionEntry(motionEntry);
+
+                m_motionNodes[i]->AddMotionId(motionId.c_str());
+                m_motionNodes[i]->RecursiveOnChangeMotionSet(m_animGraphInstance, m_motionSet);
+                m_motionNodes[i]->PickNewActiveMotion(m_animGraphInstance);
+            }
+        }
+
+        // Animate the position and rotation of every joint, sampled at 30 keys per second.
+        NonUniformMotionData* CreateKeyframedMotionData(float duration, float phase) const
+        {
+            NonUniformMotionData* motionData = aznew NonUniformMotionData();
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            const Pose* bindPose = m_actor->GetBindPose();
+            const size_t numSamples = static_cast<size_t>(duration * 30.0f) + 1;
+            for (AZ::u32 i = 0; i < skeleton->GetNumNodes(); ++i)
+            {
+                const Transform& bindTransform = bindPose->GetLocalSpaceTransform(i);
+                const size_t jointDataIndex = motionData->AddJoint(skeleton->GetNode(i)->GetNameString(), bindTransform, bindTransform);
+                motionData->AllocateJointPositionSamples(jointDataIndex, numSamples);
+                motionData->AllocateJointRotationSamples(jointDataIndex, numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    const float time = duration * s / static_cast<float>(numSamples - 1);
+                    const float angle = AZ::Sin(time * 3.0f + phase + i * 0.1f);
+                    motionData->SetJointPositionSample(jointDataIndex, s, { time, bindTransform.mPosition + AZ::Vector3(angle * 0.1f, 0.0f, 0.0f) });
+                    motionData->SetJointRotationSample(jointDataIndex, s, { time, bindTransform.mRotation * AZ::Quaternion::CreateRotationZ(angle) });
+                }
+            }
+            motionData->UpdateDuration();
+            return motionData;
+        }
+
+        AnimGraphPosePool& GetPosePool()
+        {
+            return GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
+        }
+
+    protected:
+        static constexpr size_t s_numMotionNodes = 6;
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        AZStd::vector<AnimGraphMotionNode*> m_motionNodes;
+        BlendTreeFloatConstantNode* m_blendNWeightNode = nullptr;
+        BlendTreeFloatConstantNode* m_blend2WeightNode = nullptr;
+    };
+
+    TEST_F(AnimGraphPosePoolFixture, PosesUseFixedLayout)
+    {
+        AnimGraphPosePool& posePool = GetPosePool();
+        posePool.Reserve(m_actorInstance, 4);
+        EXPECT_GE(posePool.GetNumPoses(), 4);
+        EXPECT_GE(posePool.GetNumReservedTransforms(), m_actor->GetNumNodes());
+
+        // Requesting and freeing poses for an actor that fits the layout doesn't allocate.
+        posePool.ResetNumAllocations();
+        for (int i = 0; i < 10; ++i)
+        {
+            AnimGraphPose* poseA = posePool.RequestPose(m_actorInstance);
+            AnimGraphPose* poseB = posePool.RequestPose(m_actorInstance);
+            EXPECT_EQ(poseA->GetNumNodes(), m_actor->GetNumNodes());
+            EXPECT_GE(poseA->GetPose().GetNumReservedTransforms(), posePool.GetNumReservedTransforms());
+            posePool.FreePose(poseB);
+            posePool.FreePose(poseA);
+        }
+        EXPECT_EQ(posePool.GetNumAllocations(), 0);
+    }
+
+    TEST_F(AnimGraphPosePoolFixture, SteadyStateEvaluationDoesNotAllocate)
+    {
+#if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
+        GTEST_SKIP() << "Allocations are reported to the platform memory instrumentation instead of the memory driller bus.";
+#endif
+        AnimGraphPosePool& posePool = GetPosePool();
+
+        // Warm up, so that the pool contains enough poses for this anim graph, and all lazily created buffers are allocated.
+        for (int i = 0; i < 10; ++i)
+        {
+            m_blendNWeightNode->SetValue(0.1f * i);
+            m_blend2WeightNode->SetValue(0.5f);
+            GetEMotionFX().Update(1.0f / 60.0f);
+        }
+        EXPECT_GT(posePool.GetNumMaxUsedPoses(), 0);
+        const Transform warmUpTransform = m_actorInstance->GetTransformData()->GetCurrentPose()->GetLocalSpaceTransform(m_actor->GetNumNodes() - 1);
+
+        // Count every allocation made through the allocators during a full update: scheduling, anim graph evaluation, motion sampling and the pose pool.
+        posePool.ResetNumAllocations();
+        size_t numAllocations = 0;
+        {
+            AllocationCounter allocationCounter;
+            for (int i = 0; i < 100; ++i)
+            {
+                m_blendNWeightNode->SetValue(AZ::GetMod(0.07f * i, 1.0f));
+                m_blend2WeightNode->SetValue(AZ::GetMod(0.13f * i, 1.0f));
+                GetEMotionFX().Update(1.0f / 60.0f);
+            }
+            numAllocations = allocationCounter.GetNumAllocations();
+        }
+
+        EXPECT_EQ(numAllocations, 0) << "Steady state anim graph evaluation should not allocate any memory.";
+        EXPECT_EQ(posePool.GetNumAllocations(), 0);
+        EXPECT_EQ(posePool.GetNumUsedPoses(), 0);
+
+        // Make sure the motions actually got sampled, rather than the bind pose being output.
+        const Transform& currentTransform = m_actorInstance->GetTransformData()->GetCurrentPose()->GetLocalSpaceTransform(m_actor->GetNumNodes() - 1);
+        EXPECT_FALSE(currentTransform.mRotation.IsClose(warmUpTransform.mRotation, 0.0001f));
+    }
+} // namespace EMotionFX
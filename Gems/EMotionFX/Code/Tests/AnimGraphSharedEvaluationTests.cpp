@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphManager.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphSharedEvaluation.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Parameter/FloatSliderParameter.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AttributeFloat.h>
+
+namespace EMotionFX
+{
+    class AnimGraphSharedEvaluationFixture
+        : public AnimGraphFixture
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(20);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            BlendTree* blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            /*
+                +----------+
+                | Motion 0 +--->+---------+      +-------+
+                +----------+    | Blend 2 +----->+ Final |
+                +----------+    |         |      +-------+
+                | Motion 1 +--->+         |
+                +----------+    +---------+
+                                     ^
+                +-------------+      |
+                | Const Float +------+
+                +-------------+
+            */
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+
+            BlendTreeBlend2Node* blend2Node = aznew BlendTreeBlend2Node();
+            blendTree->AddChildNode(blend2Node);
+            finalNode->AddConnection(blend2Node, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+                motionNode->SetName(AZStd::string::format("MotionNode%zu", i).c_str());
+                blendTree->AddChildNode(motionNode);
+                blend2Node->AddConnection(motionNode, AnimGraphMotionNode::PORTID_OUTPUT_POSE,
+                    (i == 0) ? BlendTreeBlend2Node::PORTID_INPUT_POSE_A : BlendTreeBlend2Node::PORTID_INPUT_POSE_B);
+                m_motionNodes.push_back(motionNode);
+            }
+
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            weightNode->SetValue(0.5f);
+            blendTree->AddChildNode(weightNode);
+            blend2Node->AddConnection(weightNode, BlendTreeFloatConstantNode::OUTPUTPORT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+
+            // A parameter that isn't connected to anything, but that still separates the sharing groups.
+            FloatSliderParameter* parameter = aznew FloatSliderParameter();
+            parameter->SetName("Speed");
+            m_blendTreeAnimGraph->AddParameter(parameter);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+
+            for (size_t i = 0; i < m_motionNodes.size(); ++i)
+            {
+                const AZStd::string motionId = AZStd::string::format("testSkeletalMotion%zu", i);
+
+                Motion* motion = aznew Motion(motionId.c_str());
+                motion->SetMotionData(aznew NonUniformMotionData());
+                motion->GetMotionData()->SetDuration(i + 1.0f);
+
+                MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion);
+                m_motionSet->AddMotionEntry(motionEntry);
+                m_motionNodes[i]->AddMotionId(motionId.c_str());
+            }
+            PrepareInstance(m_animGraphInstance);
+            GetAnimGraphManager().GetSharedEvaluation().ResetCounters();
+        }
+
+        void TearDown() override
+        {
+            for (AnimGraphInstance* animGraphInstance : m_extraAnimGraphInstances)
+            {
+                animGraphInstance->Destroy();
+            }
+            for (ActorInstance* actorInstance : m_extraActorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_extraAnimGraphInstances.clear();
+            m_extraActorInstances.clear();
+
+            AnimGraphFixture::TearDown();
+        }
+
+        void PrepareInstance(AnimGraphInstance* animGraphInstance)
+        {
+            for (AnimGraphMotionNode* motionNode : m_motionNodes)
+            {
+                motionNode->RecursiveOnChangeMotionSet(animGraphInstance, m_motionSet);
+                motionNode->PickNewActiveMotion(animGraphInstance);
+            }
+            animGraphInstance->SetSharedEvaluationEnabled(true);
+        }
+
+        void AddInstances(size_t numInstances)
+        {
+            for (size_t i = 0; i < numInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                AnimGraphInstance* animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(actorInstance, m_motionSet);
+                PrepareInstance(animGraphInstance);
+                m_extraActorInstances.emplace_back(actorInstance);
+                m_extraAnimGraphInstances.emplace_back(animGraphInstance);
+            }
+        }
+
+        void SetSpeedParameter(AnimGraphInstance* animGraphInstance, float value)
+        {
+            static_cast<MCore::AttributeFloat*>(animGraphInstance->GetParameterValue(0))->SetValue(value);
+        }
+
+        void ExpectEqualPoses(const Pose* poseA, const Pose* poseB)
+        {
+            ASSERT_EQ(poseA->GetNumTransforms(), poseB->GetNumTransforms());
+            for (uint32 i = 0; i < poseA->GetNumTransforms(); ++i)
+            {
+                const Transform& transformA = poseA->GetLocalSpaceTransform(i);
+                const Transform& transformB = poseB->GetLocalSpaceTransform(i);
+                EXPECT_TRUE(transformA.mPosition.IsClose(transformB.mPosition));
+                EXPECT_TRUE(transformA.mRotation.IsClose(transformB.mRotation));
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        AZStd::vector<AnimGraphMotionNode*> m_motionNodes;
+        AZStd::vector<ActorInstance*> m_extraActorInstances;
+        AZStd::vector<AnimGraphInstance*> m_extraAnimGraphInstances;
+    };
+
+    TEST_F(AnimGraphSharedEvaluationFixture, InstancesInSameStateShareOutput)
+    {
+        AddInstances(4);
+
+        AnimGraphSharedEvaluation& sharedEvaluation = GetAnimGraphManager().GetSharedEvaluation();
+        for (int i = 0; i < 10; ++i)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            EXPECT_EQ(sharedEvaluation.GetNumGroups(), 1);
+        }
+
+        EXPECT_GT(sharedEvaluation.GetNumSharedOutputs(), 0);
+        EXPECT_EQ(sharedEvaluation.GetNumSharedOutputs() + sharedEvaluation.GetNumEvaluatedOutputs(), 50);
+        EXPECT_GT(sharedEvaluation.GetGroupHitRate(), 0.0f);
+
+        const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        for (ActorInstance* actorInstance : m_extraActorInstances)
+        {
+            ExpectEqualPoses(pose, actorInstance->GetTransformData()->GetCurrentPose());
+        }
+    }
+
+    TEST_F(AnimGraphSharedEvaluationFixture, DifferentParametersDoNotShare)
+    {
+        AddInstances(1);
+        AnimGraphInstance* otherInstance = m_extraAnimGraphInstances[0];
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(AnimGraphSharedEvaluation::CalcGroupKey(m_animGraphInstance), AnimGraphSharedEvaluation::CalcGroupKey(otherInstance));
+
+        SetSpeedParameter(otherInstance, 0.75f);
+        EXPECT_NE(AnimGraphSharedEvaluation::CalcGroupKey(m_animGraphInstance), AnimGraphSharedEvaluation::CalcGroupKey(otherInstance));
+
+        AnimGraphSharedEvaluation& sharedEvaluation = GetAnimGraphManager().GetSharedEvaluation();
+        sharedEvaluation.ResetCounters();
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(sharedEvaluation.GetNumGroups(), 2);
+        EXPECT_EQ(sharedEvaluation.GetNumSharedOutputs(), 0);
+        EXPECT_EQ(sharedEvaluation.GetNumEvaluatedOutputs(), 2);
+    }
+
+    TEST_F(AnimGraphSharedEvaluationFixture, DifferentPlayTimesDoNotShare)
+    {
+        AddInstances(1);
+
+        // Only update the extra instance, so that its motions are ahead of the ones of the main instance.
+        m_extraAnimGraphInstances[0]->Update(0.25f);
+        EXPECT_NE(AnimGraphSharedEvaluation::CalcGroupKey(m_animGraphInstance), AnimGraphSharedEvaluation::CalcGroupKey(m_extraAnimGraphInstances[0]));
+    }
+
+    TEST_F(AnimGraphSharedEvaluationFixture, DisabledInstancesAreNotShared)
+    {
+        AddInstances(2);
+        m_animGraphInstance->SetSharedEvaluationEnabled(false);
+        for (AnimGraphInstance* animGraphInstance : m_extraAnimGraphInstances)
+        {
+            animGraphInstance->SetSharedEvaluationEnabled(false);
+        }
+
+        AnimGraphSharedEvaluation& sharedEvaluation = GetAnimGraphManager().GetSharedEvaluation();
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(sharedEvaluation.GetNumGroups(), 0);
+        EXPECT_EQ(sharedEvaluation.GetNumSharedOutputs(), 0);
+        EXPECT_EQ(sharedEvaluation.GetNumEvaluatedOutputs(), 0);
+    }
+
+    TEST_F(AnimGraphSharedEvaluationFixture, KeysWithSameHashButDifferentStateAreNotEqual)
+    {
+        AddInstances(1);
+        AnimGraphInstance* otherInstance = m_extraAnimGraphInstances[0];
+        SetSpeedParameter(otherInstance, 0.75f);
+
+        // Simulate a hash collision: the groups must still be told apart by their full state.
+        const AnimGraphSharedEvaluation::GroupKey key = AnimGraphSharedEvaluation::CalcGroupKey(m_animGraphInstance);
+        AnimGraphSharedEvaluation::GroupKey otherKey = AnimGraphSharedEvaluation::CalcGroupKey(otherInstance);
+        ASSERT_NE(key.m_data, otherKey.m_data);
+        otherKey.m_hash = key.m_hash;
+        EXPECT_NE(key, otherKey);
+
+        // The key of the instance gets reused by the shared evaluation and matches a freshly calculated one.
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_animGraphInstance->GetSharedEvaluationKey(), AnimGraphSharedEvaluation::CalcGroupKey(m_animGraphInstance));
+    }
+
+    TEST_F(AnimGraphSharedEvaluationFixture, CrowdEvaluatesOncePerGroup)
+    {
+        const size_t numInstances = 100;
+        const size_t numFrames = 10;
+        AddInstances(numInstances - 1);
+
+        // Split the crowd in two parameter groups.
+        for (size_t i = 0; i < m_extraAnimGraphInstances.size(); i += 2)
+        {
+            SetSpeedParameter(m_extraAnimGraphInstances[i], 0.75f);
+        }
+
+        AnimGraphSharedEvaluation& sharedEvaluation = GetAnimGraphManager().GetSharedEvaluation();
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            EXPECT_EQ(sharedEvaluation.GetNumGroups(), 2);
+        }
+
+        EXPECT_EQ(sharedEvaluation.GetNumEvaluatedOutputs(), 2 * numFrames);
+        EXPECT_EQ(sharedEvaluation.GetNumSharedOutputs(), (numInstances - 2) * numFrames);
+
+        const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        for (size_t i = 1; i < m_extraActorInstances.size(); i += 2)
+        {
+            ExpectEqualPoses(pose, m_extraActorInstances[i]->GetTransformData()->GetCurrentPose());
+        }
+    }
+} // namespace EMotionFX
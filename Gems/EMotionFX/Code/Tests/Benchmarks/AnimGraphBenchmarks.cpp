@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/AnimGraphStateTransition.h>
+#include <EMotionFX/Source/AnimGraphTimeCondition.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/BlendTreeSimulatedObjectNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/SimulatedObjectSetup.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <Tests/Benchmarks/EMotionFXBenchmarkFixture.h>
+#include <Tests/TestAssetCode/AnimGraphFactory.h>
+
+namespace EMotionFX::Benchmarks
+{
+    namespace AnimGraphBenchmarkConstants
+    {
+        static constexpr size_t NumJoints = 50;
+        static constexpr size_t NumMotions = 4;
+        static constexpr float MotionDuration = 2.0f;
+    }
+
+    class AnimGraphBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            EMotionFXBenchmarkFixture::SetUp(state);
+            CreateActor(AnimGraphBenchmarkConstants::NumJoints);
+            for (size_t i = 0; i < AnimGraphBenchmarkConstants::NumMotions; ++i)
+            {
+                m_motionIds.emplace_back(AddMotion(AnimGraphBenchmarkConstants::MotionDuration + i * 0.5f));
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_motionIds.clear();
+            EMotionFXBenchmarkFixture::TearDown(state);
+        }
+
+        AnimGraphMotionNode* CreateMotionNode(AnimGraphNode* parent, size_t motionIndex)
+        {
+            AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+            motionNode->SetName(AZStd::string::format("MotionNode%zu", parent->GetNumChildNodes()).c_str());
+            motionNode->AddMotionId(m_motionIds[motionIndex % m_motionIds.size()]);
+            parent->AddChildNode(motionNode);
+            return motionNode;
+        }
+
+        //! Build a blend tree of the given depth, where every level blends the result of the previous level with another motion.
+        void CreateBlendTreeAnimGraph(size_t depth)
+        {
+            /*
+                +----------+
+                | Motion 0 +--->+---------+
+                +----------+    | Blend 2 +--->+---------+
+                +----------+    |         |    | Blend 2 +---> ... ---> Final
+                | Motion 1 +--->+         |    |         |
+                +----------+    +---------+    |         |
+                +----------+                   |         |
+                | Motion 2 +------------------>+         |
+                +----------+                   +---------+
+            */
+            AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            BlendTree* blendTree = animGraph->GetBlendTreeNode();
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            weightNode->SetValue(0.5f);
+            blendTree->AddChildNode(weightNode);
+
+            AnimGraphNode* result = CreateMotionNode(blendTree, 0);
+            for (size_t level = 0; level < depth; ++level)
+            {
+                BlendTreeBlend2Node* blend2Node = aznew BlendTreeBlend2Node();
+                blendTree->AddChildNode(blend2Node);
+                blend2Node->AddConnection(result, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_A);
+                blend2Node->AddConnection(CreateMotionNode(blendTree, level + 1), AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_B);
+                blend2Node->AddConnection(weightNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+                result = blend2Node;
+            }
+            finalNode->AddConnection(result, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            animGraph->InitAfterLoading();
+            m_animGraph = AZStd::move(animGraph);
+        }
+
+        //! Build a state machine with the given number of motion states, that transitions to the next state every quarter of a second.
+        void CreateStateMachineAnimGraph(size_t numStates)
+        {
+            AZStd::unique_ptr<EmptyAnimGraph> animGraph = AnimGraphFactory::Create<EmptyAnimGraph>();
+            AnimGraphStateMachine* stateMachine = animGraph->GetRootStateMachine();
+
+            AZStd::vector<AnimGraphMotionNode*> states;
+            for (size_t i = 0; i < numStates; ++i)
+            {
+                states.emplace_back(CreateMotionNode(stateMachine, i));
+            }
+            stateMachine->SetEntryState(states[0]);
+
+            for (size_t i = 0; i < numStates; ++i)
+            {
+                AnimGraphStateTransition* transition = aznew AnimGraphStateTransition();
+                transition->SetSourceNode(states[i]);
+                transition->SetTargetNode(states[(i + 1) % numStates]);
+                transition->SetBlendTime(0.2f);
+
+                AnimGraphTimeCondition* condition = aznew AnimGraphTimeCondition();
+                condition->SetCountDownTime(0.25f);
+                transition->AddCondition(condition);
+
+                stateMachine->AddTransition(transition);
+            }
+
+            animGraph->InitAfterLoading();
+            m_animGraph = AZStd::move(animGraph);
+        }
+
+        //! Build a blend tree that plays a motion and simulates two chains of ten joints at the end of the skeleton, like hair strands or tails.
+        void CreateSimulatedObjectAnimGraph(bool solveInBatchStage)
+        {
+            /*
+                +--------+    +------------------+    +-------+
+                | Motion +--->+ Simulated object +--->+ Final |
+                +--------+    +------------------+    +-------+
+            */
+            SimulatedObjectSetup* simSetup = m_actor->GetSimulatedObjectSetup().get();
+            const size_t numChainJoints = 10;
+            AZStd::vector<AZStd::string> simObjectNames;
+            for (size_t chain = 0; chain < 2; ++chain)
+            {
+                simObjectNames.emplace_back(AZStd::string::format("Chain%zu", chain));
+                SimulatedObject* simObject = simSetup->AddSimulatedObject(simObjectNames.back());
+                const size_t firstJoint = AnimGraphBenchmarkConstants::NumJoints - (2 - chain) * numChainJoints;
+                for (size_t i = 0; i < numChainJoints; ++i)
+                {
+                    SimulatedJoint* simJoint = simObject->AddSimulatedJoint(aznumeric_cast<AZ::u32>(firstJoint + i));
+                    simJoint->SetPinned(i == 0);
+                }
+            }
+
+            AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            BlendTree* blendTree = animGraph->GetBlendTreeNode();
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+
+            BlendTreeSimulatedObjectNode* simNode = aznew BlendTreeSimulatedObjectNode();
+            simNode->SetSimulatedObjectNames(simObjectNames);
+            simNode->SetSolveInBatchStage(solveInBatchStage);
+            blendTree->AddChildNode(simNode);
+
+            simNode->AddConnection(CreateMotionNode(blendTree, 0), AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeSimulatedObjectNode::INPUTPORT_POSE);
+            finalNode->AddConnection(simNode, BlendTreeSimulatedObjectNode::OUTPUTPORT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            animGraph->InitAfterLoading();
+            m_animGraph = AZStd::move(animGraph);
+        }
+
+        //! Update and output all actor instances through the actor manager, like the engine does every frame.
+        void RunFrames(::benchmark::State& state)
+        {
+            // Make sure everything is initialized before measuring.
+            GetEMotionFX().Update(0.0f);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                GetEMotionFX().Update(DefaultTimeStep);
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_actorInstances.size());
+        }
+
+    protected:
+        std::vector<AZStd::string> m_motionIds;
+    };
+
+    //! state.range(0) - The number of blend 2 nodes in the chain.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_BlendTreeDepth)(benchmark::State& state)
+    {
+        CreateBlendTreeAnimGraph(aznumeric_cast<size_t>(state.range(0)));
+        CreateActorInstances(1);
+        RunFrames(state);
+    }
+
+    //! state.range(0) - The number of states, which all transition into the next one.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_StateMachineTransitions)(benchmark::State& state)
+    {
+        CreateStateMachineAnimGraph(aznumeric_cast<size_t>(state.range(0)));
+        CreateActorInstances(1);
+        RunFrames(state);
+    }
+
+    //! state.range(0) - The number of actor instances.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_SingleThreadScheduler)(benchmark::State& state)
+    {
+        GetActorManager().SetScheduler(SingleThreadScheduler::Create());
+        CreateBlendTreeAnimGraph(2);
+        CreateActorInstances(aznumeric_cast<size_t>(state.range(0)));
+        RunFrames(state);
+    }
+
+    //! state.range(0) - The number of actor instances.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_MultiThreadScheduler)(benchmark::State& state)
+    {
+        GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+        CreateBlendTreeAnimGraph(2);
+        CreateActorInstances(aznumeric_cast<size_t>(state.range(0)));
+        RunFrames(state);
+    }
+
+    //! The scaling of the multi threaded scheduler with the number of parallel jobs, which are capped by the number of worker threads.
+    //! state.range(0) - The maximum number of parallel jobs.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_MultiThreadSchedulerParallelJobs)(benchmark::State& state)
+    {
+        MultiThreadScheduler* scheduler = MultiThreadScheduler::Create();
+        scheduler->SetMaxNumParallelJobs(aznumeric_cast<uint32>(state.range(0)));
+        GetActorManager().SetScheduler(scheduler);
+        CreateBlendTreeAnimGraph(2);
+        CreateActorInstances(2000);
+        RunFrames(state);
+    }
+
+    //! A crowd spread over 200 meters in front of the camera, updated at full rate or with update-rate LOD.
+    //! state.range(0) - 0 to update all actor instances every frame, 1 to use update-rate LOD bands.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_UpdateRateLodCrowd)(benchmark::State& state)
+    {
+        const size_t numActorInstances = 1000;
+        CreateBlendTreeAnimGraph(2);
+        CreateActorInstances(numActorInstances);
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            m_actorInstances[i]->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i) * 0.2f, 0.0f, 0.0f));
+        }
+
+        ActorUpdateScheduler::UpdateRateLodSettings settings;
+        settings.m_enabled = state.range(0) != 0;
+        settings.m_bands = {
+            { 10.0f, 1 },
+            { 30.0f, 2 },
+            { 80.0f, 4 },
+            { 200.0f, 8 }
+        };
+        GetActorManager().GetScheduler()->SetUpdateRateLodSettings(settings);
+
+        RunFrames(state);
+    }
+
+    //! A crowd that plays the same blend tree in lock step, with every instance evaluating its own output or sharing it with the others.
+    //! state.range(0) - 0 to evaluate every actor instance, 1 to enable shared evaluation.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_SharedEvaluationCrowd)(benchmark::State& state)
+    {
+        CreateBlendTreeAnimGraph(4);
+        CreateActorInstances(500);
+        for (AnimGraphInstance* animGraphInstance : m_animGraphInstances)
+        {
+            animGraphInstance->SetSharedEvaluationEnabled(state.range(0) != 0);
+        }
+
+        RunFrames(state);
+    }
+
+    //! A crowd with two simulated chains per character, solved inline by every anim graph instance or batched in the solver stage of the actor manager.
+    //! state.range(0) - 0 to solve inline, 1 to solve in the batch stage.
+    BENCHMARK_DEFINE_F(AnimGraphBenchmarkFixture, BM_SimulatedObjectBatchStage)(benchmark::State& state)
+    {
+        GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+        CreateSimulatedObjectAnimGraph(state.range(0) != 0);
+        CreateActorInstances(500);
+        RunFrames(state);
+    }
+
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_BlendTreeDepth)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_StateMachineTransitions)->Arg(2)->Arg(8)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_SingleThreadScheduler)->Arg(1)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_MultiThreadScheduler)->Arg(1)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_MultiThreadSchedulerParallelJobs)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_UpdateRateLodCrowd)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_SharedEvaluationCrowd)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(AnimGraphBenchmarkFixture, BM_SimulatedObjectBatchStage)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
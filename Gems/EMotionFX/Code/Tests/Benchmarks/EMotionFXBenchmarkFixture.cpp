@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <Tests/Benchmarks/EMotionFXBenchmarkFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX::Benchmarks
+{
+    void EMotionFXBenchmarkFixture::SetUp([[maybe_unused]] const ::benchmark::State& state)
+    {
+        m_systemFixture = std::make_unique<BenchmarkSystemComponentFixture>();
+        m_systemFixture->SetUp();
+        m_motionSet = aznew MotionSet("BenchmarkMotionSet");
+    }
+
+    void EMotionFXBenchmarkFixture::TearDown([[maybe_unused]] const ::benchmark::State& state)
+    {
+        for (AnimGraphInstance* animGraphInstance : m_animGraphInstances)
+        {
+            animGraphInstance->Destroy();
+        }
+        m_animGraphInstances.clear();
+
+        for (ActorInstance* actorInstance : m_actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+        m_actorInstances.clear();
+
+        m_animGraph.reset();
+        delete m_motionSet;
+        m_motionSet = nullptr;
+        m_actor.reset();
+
+        m_systemFixture->TearDown();
+        m_systemFixture.reset();
+    }
+
+    void EMotionFXBenchmarkFixture::CreateActor(size_t numJoints)
+    {
+        m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(numJoints, "BenchmarkActor");
+    }
+
+    void EMotionFXBenchmarkFixture::FillMotionData(NonUniformMotionData& motionData, const Actor* actor, float duration, float sampleRate, AZ::u64 seed)
+    {
+        AZ::SimpleLcgRandom random(seed);
+        const size_t numSamples = static_cast<size_t>(duration * sampleRate) + 1;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actor->GetBindPose();
+        for (AZ::u32 i = 0; i < skeleton->GetNumNodes(); ++i)
+        {
+            const Transform& bindTransform = bindPose->GetLocalSpaceTransform(i);
+            const size_t jointDataIndex = motionData.AddJoint(skeleton->GetNode(i)->GetNameString(), bindTransform, bindTransform);
+
+            const float frequency = 1.0f + random.GetRandomFloat() * 2.0f;
+            const float amplitude = 0.1f + random.GetRandomFloat();
+            motionData.AllocateJointPositionSamples(jointDataIndex, numSamples);
+            motionData.AllocateJointRotationSamples(jointDataIndex, numSamples);
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const float time = s / sampleRate;
+                const AZ::Vector3 offset(AZ::Sin(time * frequency) * amplitude, AZ::Cos(time * frequency) * amplitude, 0.0f);
+                const AZ::Quaternion rotation = bindTransform.mRotation * AZ::Quaternion::CreateRotationZ(AZ::Sin(time * frequency) * amplitude);
+                motionData.SetJointPositionSample(jointDataIndex, s, { time, bindTransform.mPosition + offset });
+                motionData.SetJointRotationSample(jointDataIndex, s, { time, rotation.GetNormalized() });
+            }
+        }
+
+        motionData.UpdateDuration();
+    }
+
+    AZStd::string EMotionFXBenchmarkFixture::AddMotion(float duration, float sampleRate)
+    {
+        const AZStd::string motionId = AZStd::string::format("BenchmarkMotion%zu", m_motionSet->GetNumMotionEntries());
+
+        NonUniformMotionData* motionData = aznew NonUniformMotionData();
+        FillMotionData(*motionData, m_actor.get(), duration, sampleRate, m_motionSet->GetNumMotionEntries() + 1);
+
+        Motion* motion = aznew Motion(motionId.c_str());
+        motion->SetMotionData(motionData);
+        m_motionSet->AddMotionEntry(aznew MotionSet::MotionEntry(motionId.c_str(), motionId, motion));
+        return motionId;
+    }
+
+    void EMotionFXBenchmarkFixture::CreateActorInstances(size_t numActorInstances)
+    {
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            m_actorInstances.emplace_back(actorInstance);
+
+            if (m_animGraph)
+            {
+                AnimGraphInstance* animGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), actorInstance, m_motionSet);
+                actorInstance->SetAnimGraphInstance(animGraphInstance);
+                animGraphInstance->IncreaseReferenceCount(); // Owned by both the fixture and the actor instance.
+                animGraphInstance->RecursiveInvalidateUniqueDatas();
+                m_animGraphInstances.emplace_back(animGraphInstance);
+            }
+        }
+    }
+
+    Mesh* EMotionFXBenchmarkFixture::CreateSkinnedMesh(AZ::u32 numVertices, size_t numJoints)
+    {
+        AZ::SimpleLcgRandom random;
+        AZStd::vector<AZ::u32> indices(numVertices);
+        AZStd::vector<AZ::Vector3> positions(numVertices);
+        AZStd::vector<AZ::Vector3> normals(numVertices);
+        AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(numVertices);
+        for (AZ::u32 v = 0; v < numVertices; ++v)
+        {
+            indices[v] = v;
+            positions[v] = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 2.0f;
+            normals[v] = AZ::Vector3(random.GetRandomFloat() + 0.1f, random.GetRandomFloat(), random.GetRandomFloat()).GetNormalized();
+
+            const size_t numInfluences = 1 + (random.GetRandom() % 4);
+            float totalWeight = 0.0f;
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const float weight = random.GetRandomFloat() + 0.01f;
+                skinningInfo[v].emplace_back((v + i) % numJoints, weight);
+                totalWeight += weight;
+            }
+
+            for (MeshFactory::SkinInfluence& influence : skinningInfo[v])
+            {
+                AZStd::get<1>(influence) /= totalWeight;
+            }
+        }
+
+        return MeshFactory::Create(indices, positions, normals, {}, skinningInfo);
+    }
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
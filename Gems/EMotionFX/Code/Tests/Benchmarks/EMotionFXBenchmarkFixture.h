@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#ifdef HAVE_BENCHMARK
+
+#include <memory>
+#include <vector>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class ActorInstance;
+    class AnimGraphInstance;
+    class Mesh;
+    class Motion;
+    class MotionSet;
+    class NonUniformMotionData;
+}
+
+namespace EMotionFX::Benchmarks
+{
+    static constexpr float DefaultTimeStep = 1.0f / 60.0f;
+
+    //! Starts the EMotionFX runtime the same way the unit tests do.
+    class BenchmarkSystemComponentFixture
+        : public SystemComponentFixture
+    {
+    protected:
+        void TestBody() override {}
+    };
+
+    //! Base fixture for the EMotionFX benchmarks.
+    //! Starts the EMotionFX runtime like the unit tests do, and generates all skeletons, meshes and motions procedurally,
+    //! so the benchmarks don't depend on any assets from disk.
+    //! Benchmark fixtures get constructed during static initialization, before any allocator exists, so all EMotionFX
+    //! objects have to be created in SetUp().
+    class EMotionFXBenchmarkFixture
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override;
+        void TearDown(const ::benchmark::State& state) override;
+
+    protected:
+        //! Create a joint chain actor with the given number of joints.
+        void CreateActor(size_t numJoints);
+
+        //! Fill the motion data with smooth, randomized keys for every joint of the given actor.
+        static void FillMotionData(NonUniformMotionData& motionData, const Actor* actor, float duration, float sampleRate, AZ::u64 seed);
+
+        //! Create a motion with smooth, randomized keys for every joint of the actor and add it to the motion set.
+        //! @result The motion id inside the motion set.
+        AZStd::string AddMotion(float duration, float sampleRate = 30.0f);
+
+        //! Create the given number of actor instances, each with their own instance of m_animGraph, if there is one.
+        void CreateActorInstances(size_t numActorInstances);
+
+        //! Create a mesh with random positions and normals, where each vertex is skinned to up to four joints.
+        static Mesh* CreateSkinnedMesh(AZ::u32 numVertices, size_t numJoints);
+
+        std::unique_ptr<BenchmarkSystemComponentFixture> m_systemFixture;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<AnimGraph> m_animGraph;
+        MotionSet* m_motionSet = nullptr;
+        // Standard containers, as the fixture outlives the allocators.
+        std::vector<ActorInstance*> m_actorInstances;
+        std::vector<AnimGraphInstance*> m_animGraphInstances;
+    };
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
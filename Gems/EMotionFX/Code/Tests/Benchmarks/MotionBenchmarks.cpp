@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/Benchmarks/EMotionFXBenchmarkFixture.h>
+
+namespace EMotionFX::Benchmarks
+{
+    //! Samples a full pose from a 10 second motion at a varying time.
+    //! state.range(0) - The number of joints in the skeleton.
+    class SamplePoseBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            EMotionFXBenchmarkFixture::SetUp(state);
+            CreateActor(aznumeric_cast<size_t>(state.range(0)));
+            CreateActorInstances(1);
+            m_sourceMotionData = AZStd::make_unique<NonUniformMotionData>();
+            FillMotionData(*m_sourceMotionData, m_actor.get(), 10.0f, 30.0f, 1);
+
+            m_pose = AZStd::make_unique<Pose>();
+            m_pose->LinkToActorInstance(m_actorInstances[0]);
+            m_pose->InitFromBindPose(m_actor.get());
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_pose.reset();
+            m_sourceMotionData.reset();
+            EMotionFXBenchmarkFixture::TearDown(state);
+        }
+
+        void RunSamplePose(::benchmark::State& state, const MotionData& motionData)
+        {
+            MotionData::SampleSettings sampleSettings;
+            sampleSettings.m_actorInstance = m_actorInstances[0];
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                sampleSettings.m_sampleTime += 0.0123f;
+                if (sampleSettings.m_sampleTime > motionData.GetDuration())
+                {
+                    sampleSettings.m_sampleTime = 0.0f;
+                }
+                motionData.SamplePose(sampleSettings, m_pose.get());
+                benchmark::DoNotOptimize(m_pose->GetLocalSpaceTransform(0));
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_actor->GetNumNodes());
+        }
+
+    protected:
+        AZStd::unique_ptr<NonUniformMotionData> m_sourceMotionData;
+        AZStd::unique_ptr<Pose> m_pose;
+    };
+
+    BENCHMARK_DEFINE_F(SamplePoseBenchmarkFixture, BM_SamplePoseNonUniform)(benchmark::State& state)
+    {
+        RunSamplePose(state, *m_sourceMotionData);
+    }
+
+    BENCHMARK_DEFINE_F(SamplePoseBenchmarkFixture, BM_SamplePoseUniform)(benchmark::State& state)
+    {
+        UniformMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceMotionData.get(), true);
+        RunSamplePose(state, motionData);
+    }
+
+    BENCHMARK_DEFINE_F(SamplePoseBenchmarkFixture, BM_SamplePoseCompressed)(benchmark::State& state)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceMotionData.get(), true);
+        RunSamplePose(state, motionData);
+    }
+
+    BENCHMARK_REGISTER_F(SamplePoseBenchmarkFixture, BM_SamplePoseNonUniform)->Arg(20)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SamplePoseBenchmarkFixture, BM_SamplePoseUniform)->Arg(20)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SamplePoseBenchmarkFixture, BM_SamplePoseCompressed)->Arg(20)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
+
+    //! Skins a mesh where every vertex is influenced by up to four of the 64 joints, once for every actor instance, each in another pose.
+    //! The mesh is shared by the actor instances and skinned in place, as the cost doesn't depend on the vertex values.
+    //! state.range(0) - The number of vertices in the mesh.
+    //! state.range(1) - The number of actor instances.
+    class SkinDeformerBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            EMotionFXBenchmarkFixture::SetUp(state);
+            CreateActor(64);
+            CreateActorInstances(aznumeric_cast<size_t>(state.range(1)));
+
+            // Give every joint of every actor instance a different skinning matrix.
+            for (size_t actorInstanceIndex = 0; actorInstanceIndex < m_actorInstances.size(); ++actorInstanceIndex)
+            {
+                ActorInstance* actorInstance = m_actorInstances[actorInstanceIndex];
+                Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+                for (AZ::u32 i = 0; i < pose->GetNumTransforms(); ++i)
+                {
+                    Transform transform = pose->GetLocalSpaceTransform(i);
+                    transform.mRotation = AZ::Quaternion::CreateRotationZ(0.05f * i + 0.01f * actorInstanceIndex);
+                    pose->SetLocalSpaceTransform(i, transform);
+                }
+                actorInstance->UpdateSkinningMatrices();
+            }
+
+            m_mesh = CreateSkinnedMesh(aznumeric_cast<AZ::u32>(state.range(0)), 64);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            if (m_deformer)
+            {
+                m_deformer->Destroy();
+                m_deformer = nullptr;
+            }
+            m_mesh->Destroy();
+            m_mesh = nullptr;
+            EMotionFXBenchmarkFixture::TearDown(state);
+        }
+
+        void RunSkinning(::benchmark::State& state, MeshDeformer* deformer)
+        {
+            m_deformer = deformer;
+            Node* node = m_actor->GetSkeleton()->GetNode(0);
+            m_deformer->Reinitialize(m_actor.get(), node, 0);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (ActorInstance* actorInstance : m_actorInstances)
+                {
+                    m_deformer->Update(actorInstance, node, DefaultTimeStep);
+                }
+                benchmark::DoNotOptimize(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_mesh->GetNumVertices() * state.range(1));
+        }
+
+    protected:
+        Mesh* m_mesh = nullptr;
+        MeshDeformer* m_deformer = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(SkinDeformerBenchmarkFixture, BM_SoftSkinDeformerUpdate)(benchmark::State& state)
+    {
+        RunSkinning(state, SoftSkinDeformer::Create(m_mesh));
+    }
+
+    BENCHMARK_DEFINE_F(SkinDeformerBenchmarkFixture, BM_DualQuatSkinDeformerUpdate)(benchmark::State& state)
+    {
+        RunSkinning(state, DualQuatSkinDeformer::Create(m_mesh));
+    }
+
+    BENCHMARK_REGISTER_F(SkinDeformerBenchmarkFixture, BM_SoftSkinDeformerUpdate)
+        ->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 50000, 1 })->Args({ 50000, 100 })->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK_REGISTER_F(SkinDeformerBenchmarkFixture, BM_DualQuatSkinDeformerUpdate)
+        ->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 50000, 1 })->Args({ 50000, 100 })->Unit(benchmark::kMillisecond)->UseRealTime();
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
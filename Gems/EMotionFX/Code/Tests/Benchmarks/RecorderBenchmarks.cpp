@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Recorder.h>
+#include <EMotionFX/Source/RecorderRingBuffer.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/Benchmarks/EMotionFXBenchmarkFixture.h>
+
+namespace EMotionFX::Benchmarks
+{
+    //! Records one frame of 64 joint actor instances per iteration, with every joint moving each frame.
+    //! state.range(0) - The number of actor instances.
+    class RecorderBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            EMotionFXBenchmarkFixture::SetUp(state);
+            CreateActor(64);
+            CreateActorInstances(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            GetRecorder().Clear();
+            EMotionFXBenchmarkFixture::TearDown(state);
+        }
+
+        void RunRecording(::benchmark::State& state, bool useRingBuffer)
+        {
+            Recorder::RecordSettings settings;
+            settings.m_actorInstances.assign(m_actorInstances.begin(), m_actorInstances.end());
+            settings.mRecordMorphs = false;
+            settings.mUseRingBuffer = useRingBuffer;
+            GetRecorder().StartRecording(settings);
+
+            AZ::u32 frame = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                frame++;
+                for (ActorInstance* actorInstance : m_actorInstances)
+                {
+                    Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+                    for (AZ::u32 i = 0; i < pose->GetNumTransforms(); ++i)
+                    {
+                        Transform transform = pose->GetLocalSpaceTransform(i);
+                        transform.mPosition.SetZ(0.001f * frame);
+                        transform.mRotation = AZ::Quaternion::CreateRotationZ(0.01f * frame + 0.05f * i);
+                        pose->SetLocalSpaceTransform(i, transform);
+                    }
+                }
+                state.ResumeTiming();
+
+                GetRecorder().Update(DefaultTimeStep);
+            }
+
+            state.counters["MaxFrameMs"] = GetRecorder().GetMaxFrameRecordDuration() * 1000.0f;
+            if (const RecorderRingBuffer* ringBuffer = GetRecorder().GetRingBuffer())
+            {
+                state.counters["MemoryBytes"] = aznumeric_cast<double>(ringBuffer->GetNumMemoryBytes());
+            }
+            GetRecorder().StopRecording();
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+    };
+
+    BENCHMARK_DEFINE_F(RecorderBenchmarkFixture, BM_RecorderKeyTracks)(benchmark::State& state)
+    {
+        RunRecording(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(RecorderBenchmarkFixture, BM_RecorderRingBuffer)(benchmark::State& state)
+    {
+        RunRecording(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(RecorderBenchmarkFixture, BM_RecorderKeyTracks)->Arg(1)->Arg(100)->Iterations(600)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(RecorderBenchmarkFixture, BM_RecorderRingBuffer)->Arg(1)->Arg(100)->Iterations(600)->Unit(benchmark::kMicrosecond);
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
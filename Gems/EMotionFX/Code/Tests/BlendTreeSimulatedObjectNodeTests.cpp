@@ -7,6 +7,7 @@
  */
 
 #include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/TransformData.h>
 #include <EMotionFX/Source/Pose.h>
@@ -20,6 +21,7 @@
 #include <EMotionFX/Source/BlendTreeSimulatedObjectNode.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/SimulatedObjectSetup.h>
+#include <EMotionFX/Source/SimulatedObjectSolverStage.h>
 #include <EMotionFX/Source/Parameter/FloatSliderParameter.h>
 #include <EMotionFX/Source/Parameter/ParameterFactory.h>
 #include <Tests/JackGraphFixture.h>
@@ -189,4 +191,112 @@ namespace EMotionFX
         EXPECT_EQ(uniqueData->m_simulations[1]->m_solver.GetNumSprings(), 2);
         EXPECT_EQ(uniqueData->m_simulations[1]->m_solver.GetNumParticles(), 3);
     }
+
+    TEST_F(BlendTreeSimulatedObjectNodeFixture, BatchStageMatchesInlineSolve)
+    {
+        SetActiveObjects({"leftLeg", "rightLeg"});
+
+        const size_t numFrames = 100;
+        const auto runFrames = [this, numFrames]()
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            const Pose& currentPose = *m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                GetEMotionFX().Update(1.0f / 60.0f);
+                for (size_t joint = 0; joint < 3; ++joint)
+                {
+                    positions.emplace_back(currentPose.GetModelSpaceTransform(m_jointIndices[joint]).mPosition);
+                }
+            }
+            return positions;
+        };
+
+        const AZStd::vector<AZ::Vector3> inlinePositions = runFrames();
+
+        // Restart the simulation from scratch, now solving in the batch stage.
+        m_simNode->SetSolveInBatchStage(true);
+        m_simNode->InvalidateUniqueData(m_animGraphInstance);
+        const AZStd::vector<AZ::Vector3> batchPositions = runFrames();
+
+        const SimulatedObjectSolverStage& solverStage = GetActorManager().GetSimulatedObjectSolverStage();
+        EXPECT_EQ(solverStage.GetNumSolvedChains(), 2);
+        EXPECT_EQ(solverStage.GetNumSolvedActorInstances(), 1);
+
+        ASSERT_EQ(inlinePositions.size(), batchPositions.size());
+        for (size_t i = 0; i < inlinePositions.size(); ++i)
+        {
+            EXPECT_THAT(batchPositions[i], IsClose(inlinePositions[i]));
+        }
+    }
+
+    TEST_F(BlendTreeSimulatedObjectNodeFixture, BatchStageOnlyCollectsDuringUpdate)
+    {
+        SetActiveObjects({"leftLeg"});
+        m_simNode->SetSolveInBatchStage(true);
+
+        // Updating the actor instance directly, outside of the actor manager update, makes the node solve inline.
+        SimulatedObjectSolverStage& solverStage = GetActorManager().GetSimulatedObjectSolverStage();
+        EXPECT_FALSE(solverStage.GetIsCollecting());
+        m_actorInstance->UpdateTransformations(1.0f / 60.0f);
+
+        SimulatedObjectSolverStage::Chain chain;
+        EXPECT_FALSE(solverStage.AddChains(m_actorInstance, &chain, 1));
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_FALSE(solverStage.GetIsCollecting());
+        EXPECT_EQ(solverStage.GetNumSolvedChains(), 1);
+    }
+
+    TEST_F(BlendTreeSimulatedObjectNodeFixture, BatchStageIsNotUsedWithSharedEvaluation)
+    {
+        SetActiveObjects({"leftLeg", "rightLeg"});
+        m_simNode->SetSolveInBatchStage(true);
+        m_animGraphInstance->SetSharedEvaluationEnabled(true);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        const SimulatedObjectSolverStage& solverStage = GetActorManager().GetSimulatedObjectSolverStage();
+        EXPECT_EQ(solverStage.GetNumSolvedChains(), 0);
+        EXPECT_EQ(solverStage.GetNumSolvedActorInstances(), 0);
+    }
+
+    TEST_F(BlendTreeSimulatedObjectNodeFixture, BatchStageSolvesAllActorInstances)
+    {
+        SetActiveObjects({"leftLeg", "rightLeg"});
+        m_simNode->SetSolveInBatchStage(true);
+
+        // Characters with two chains each, like hair strands or tails.
+        const size_t numInstances = 20;
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 1; i < numInstances; ++i)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            actorInstance->SetAnimGraphInstance(AnimGraphInstance::Create(m_animGraph.get(), actorInstance, m_motionSet));
+            actorInstances.emplace_back(actorInstance);
+        }
+
+        const SimulatedObjectSolverStage& solverStage = GetActorManager().GetSimulatedObjectSolverStage();
+        for (size_t frame = 0; frame < 10; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            EXPECT_EQ(solverStage.GetNumSolvedChains(), 2 * numInstances);
+            EXPECT_EQ(solverStage.GetNumSolvedActorInstances(), numInstances);
+        }
+
+        // All characters start from the same pose and get the same input, so they all end up with the same solved pose.
+        const Pose& expectedPose = *m_actorInstance->GetTransformData()->GetCurrentPose();
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            const Pose& pose = *actorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t joint = 0; joint < 3; ++joint)
+            {
+                EXPECT_THAT(pose.GetModelSpaceTransform(m_jointIndices[joint]).mPosition, IsClose(expectedPose.GetModelSpaceTransform(m_jointIndices[joint]).mPosition));
+            }
+        }
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // end namespace EMotionFX
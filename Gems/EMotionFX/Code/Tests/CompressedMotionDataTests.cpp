@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/MotionDataFactory.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown() override
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+        // Animate every joint of the actor with a few seconds of randomized, smooth motion.
+        // Every third joint only gets a static transform, to make sure static and animated joints can be mixed.
+        void CreateSourceMotionData(NonUniformMotionData& motionData, size_t numKeys = 61, float sampleRate = 30.0f)
+        {
+            AZ::SimpleLcgRandom random;
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            const Pose* bindPose = m_actor->GetBindPose();
+            for (AZ::u32 i = 0; i < skeleton->GetNumNodes(); ++i)
+            {
+                const Transform& bindTransform = bindPose->GetLocalSpaceTransform(i);
+                const size_t jointDataIndex = motionData.AddJoint(skeleton->GetNode(i)->GetNameString(), bindTransform, bindTransform);
+                if (i % 3 == 2)
+                {
+                    continue;
+                }
+
+                const float frequency = 1.0f + random.GetRandomFloat() * 2.0f;
+                const float amplitude = 0.1f + random.GetRandomFloat();
+                motionData.AllocateJointPositionSamples(jointDataIndex, numKeys);
+                motionData.AllocateJointRotationSamples(jointDataIndex, numKeys);
+                for (size_t s = 0; s < numKeys; ++s)
+                {
+                    const float time = s / sampleRate;
+                    const AZ::Vector3 offset(AZ::Sin(time * frequency) * amplitude, AZ::Cos(time * frequency) * amplitude, time * 0.1f);
+                    const AZ::Quaternion rotation = bindTransform.mRotation * AZ::Quaternion::CreateRotationZ(AZ::Sin(time * frequency) * amplitude);
+                    motionData.SetJointPositionSample(jointDataIndex, s, { time, bindTransform.mPosition + offset });
+                    motionData.SetJointRotationSample(jointDataIndex, s, { time, rotation.GetNormalized() });
+                }
+            }
+
+            const size_t floatIndex = motionData.AddFloat("Float", 0.0f);
+            motionData.AllocateFloatSamples(floatIndex, numKeys);
+            for (size_t s = 0; s < numKeys; ++s)
+            {
+                const float time = s / sampleRate;
+                motionData.SetFloatSample(floatIndex, s, { time, AZ::Sin(time) * 10.0f });
+            }
+
+            motionData.UpdateDuration();
+        }
+    };
+
+    TEST_F(CompressedMotionDataTests, IsRegistered)
+    {
+        EXPECT_TRUE(GetMotionManager().GetMotionDataFactory().IsRegisteredTypeId(azrtti_typeid<CompressedMotionData>()));
+    }
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, true);
+        EXPECT_EQ(motionData.GetNumJoints(), sourceData.GetNumJoints());
+        EXPECT_EQ(motionData.GetNumFloats(), 1);
+        EXPECT_EQ(motionData.GetNumSamples(), 61);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), sourceData.GetDuration());
+        EXPECT_FLOAT_EQ(motionData.GetSampleRate(), 30.0f);
+        EXPECT_EQ(motionData.GetNumLanes() % CompressedMotionData::s_numLanesPerBlock, 0);
+
+        for (size_t i = 0; i < sourceData.GetNumJoints(); ++i)
+        {
+            EXPECT_EQ(motionData.IsJointPositionAnimated(i), sourceData.IsJointPositionAnimated(i));
+            EXPECT_EQ(motionData.IsJointRotationAnimated(i), sourceData.IsJointRotationAnimated(i));
+            EXPECT_EQ(motionData.GetJointName(i), sourceData.GetJointName(i));
+        }
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+    }
+
+    TEST_F(CompressedMotionDataTests, SamplingMatchesUniformMotionData)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData);
+
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&sourceData, true);
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, true);
+
+        Pose uniformPose;
+        uniformPose.LinkToActorInstance(m_actorInstance);
+        uniformPose.InitFromBindPose(m_actor.get());
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+
+        MotionData::SampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = m_actorInstance;
+        for (float time = 0.0f; time <= motionData.GetDuration(); time += 0.0123f)
+        {
+            sampleSettings.m_sampleTime = time;
+            uniformData.SamplePose(sampleSettings, &uniformPose);
+            motionData.SamplePose(sampleSettings, &pose);
+            for (AZ::u32 i = 0; i < m_actor->GetNumNodes(); ++i)
+            {
+                const Transform& expected = uniformPose.GetLocalSpaceTransform(i);
+                const Transform& result = pose.GetLocalSpaceTransform(i);
+                EXPECT_THAT(result.mPosition, IsClose(expected.mPosition));
+                EXPECT_THAT(result.mRotation, IsClose(expected.mRotation));
+
+                const Transform jointResult = motionData.SampleJointTransform(sampleSettings, i);
+                EXPECT_THAT(jointResult.mPosition, IsClose(result.mPosition));
+                EXPECT_THAT(jointResult.mRotation, IsClose(result.mRotation));
+            }
+
+            EXPECT_NEAR(motionData.SampleFloat(time, 0), uniformData.SampleFloat(time, 0), 0.001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeMakesTracksStatic)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData);
+
+        // Add a joint that moves and rotates less than the error bounds, which removes a full block of lanes.
+        const size_t jointIndex = sourceData.AddJoint("AlmostStatic", Transform::CreateIdentity(), Transform::CreateIdentity());
+        sourceData.AllocateJointPositionSamples(jointIndex, 2);
+        sourceData.SetJointPositionSample(jointIndex, 0, { 0.0f, AZ::Vector3(1.0f, 2.0f, 3.0f) });
+        sourceData.SetJointPositionSample(jointIndex, 1, { sourceData.GetDuration(), AZ::Vector3(1.0f, 2.0f, 3.0005f) });
+        sourceData.AllocateJointRotationSamples(jointIndex, 2);
+        sourceData.SetJointRotationSample(jointIndex, 0, { 0.0f, AZ::Quaternion::CreateIdentity() });
+        sourceData.SetJointRotationSample(jointIndex, 1, { sourceData.GetDuration(), AZ::Quaternion::CreateRotationZ(0.0001f) });
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, true);
+        ASSERT_TRUE(motionData.IsJointPositionAnimated(jointIndex));
+        ASSERT_TRUE(motionData.IsJointRotationAnimated(jointIndex));
+        const AZ::u32 numLanes = motionData.GetNumLanes();
+        const size_t keyDataSize = motionData.CalcKeyDataSizeInBytes();
+
+        MotionData::OptimizeSettings optimizeSettings;
+        optimizeSettings.m_maxPosError = 0.001f;
+        motionData.Optimize(optimizeSettings);
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(jointIndex));
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(jointIndex));
+        EXPECT_THAT(motionData.GetJointStaticPosition(jointIndex), IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_EQ(motionData.GetNumLanes(), numLanes - CompressedMotionData::s_numLanesPerBlock);
+        EXPECT_LT(motionData.CalcKeyDataSizeInBytes(), keyDataSize);
+
+        // The animated joints should still be animated.
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+    }
+
+    TEST_F(CompressedMotionDataTests, ClearAndRemoveKeepData)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, true);
+        const Transform expected = motionData.SampleJointTransform(0.5f, 1);
+
+        motionData.ClearJointTransformSamples(0);
+        EXPECT_FALSE(motionData.IsJointAnimated(0));
+        EXPECT_THAT(motionData.SampleJointTransform(0.5f, 1).mPosition, IsClose(expected.mPosition));
+
+        motionData.RemoveJoint(0);
+        EXPECT_EQ(motionData.GetNumJoints(), sourceData.GetNumJoints() - 1);
+        EXPECT_THAT(motionData.SampleJointTransform(0.5f, 0).mPosition, IsClose(expected.mPosition));
+        EXPECT_THAT(motionData.SampleJointTransform(0.5f, 0).mRotation, IsClose(expected.mRotation));
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, true);
+
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        file.Seek(0);
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumLanes(), motionData.GetNumLanes());
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+
+        for (size_t i = 0; i < motionData.GetNumJoints(); ++i)
+        {
+            EXPECT_EQ(loadedData.GetJointName(i), motionData.GetJointName(i));
+            const Transform expected = motionData.SampleJointTransform(0.75f, i);
+            const Transform result = loadedData.SampleJointTransform(0.75f, i);
+            EXPECT_THAT(result.mPosition, IsClose(expected.mPosition));
+            EXPECT_THAT(result.mRotation, IsClose(expected.mRotation));
+        }
+        EXPECT_FLOAT_EQ(loadedData.SampleFloat(0.75f, 0), motionData.SampleFloat(0.75f, 0));
+    }
+} // namespace EMotionFX
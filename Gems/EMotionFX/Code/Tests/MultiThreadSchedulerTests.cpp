@@ -9,6 +9,7 @@
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AttachmentNode.h>
 #include <EMotionFX/Source/MultiThreadScheduler.h>
 #include <Tests/SystemComponentFixture.h>
 #include <Tests/TestAssetCode/JackActor.h>
@@ -25,21 +26,178 @@ namespace EMotionFX
 
         // Create the actor (internally creates an actor instance for the static AABB calculation and removes it again).
         AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
-        EXPECT_EQ(scheduler->GetNumScheduleSteps(), 0)
+        EXPECT_EQ(scheduler->GetNumRootActorInstances(), 0)
             << "Expected an empty scheduler as the temporarily created actor instance got destroyed again.";
 
         // Create an actor instance and make sure it is in the scheduler.
         ActorInstance* actorInstance = ActorInstance::Create(actor.get());
-        EXPECT_EQ(scheduler->GetNumScheduleSteps(), 1) << "The actor instance should be part of the scheduler.";
-        EXPECT_EQ(scheduler->GetScheduleStep(0).mActorInstances.size(), 1) << "The step should hold exactly one actor instance.";
-        EXPECT_EQ(scheduler->GetScheduleStep(0).mActorInstances[0], actorInstance) << "The actor instance should be part of the step.";
+        EXPECT_EQ(scheduler->GetNumRootActorInstances(), 1) << "The actor instance should be part of the scheduler.";
+        EXPECT_EQ(scheduler->GetRootActorInstance(0), actorInstance) << "The actor instance should be part of the scheduler.";
 
         // Insert the actor instance manually again and make sure there is no duplicate.
         scheduler->RecursiveInsertActorInstance(actorInstance);
-        EXPECT_EQ(scheduler->GetNumScheduleSteps(), 1) << "The actor instance should be part of the scheduler.";
-        EXPECT_EQ(scheduler->GetScheduleStep(0).mActorInstances.size(), 1) << "The step should hold exactly one actor instance.";
-        EXPECT_EQ(scheduler->GetScheduleStep(0).mActorInstances[0], actorInstance) << "The actor instance should be part of the step.";
+        EXPECT_EQ(scheduler->GetNumRootActorInstances(), 1) << "The actor instance should be part of the scheduler.";
+        EXPECT_EQ(scheduler->GetRootActorInstance(0), actorInstance) << "The actor instance should be part of the scheduler.";
 
         actorInstance->Destroy();
     }
+
+    class MultiThreadSchedulerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+            m_scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        void CreateActorInstances(size_t numActorInstances)
+        {
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                m_actorInstances.emplace_back(ActorInstance::Create(m_actor.get()));
+            }
+        }
+
+    protected:
+        MultiThreadScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    //! Lets the test destroy actor instances as if another thread did while the actor instances are being updated
+    class MultiThreadSchedulerWithExecuteFlag
+        : public MultiThreadScheduler
+    {
+    public:
+        static MultiThreadSchedulerWithExecuteFlag* Create()
+        {
+            return aznew MultiThreadSchedulerWithExecuteFlag();
+        }
+
+        void SetIsExecuting(bool isExecuting)
+        {
+            MCore::LockGuardRecursive guard(mMutex);
+            m_isExecuting = isExecuting;
+        }
+    };
+
+    TEST_F(MultiThreadSchedulerFixture, AttachmentsFollowTheirParent)
+    {
+        CreateActorInstances(3);
+        EXPECT_EQ(m_scheduler->GetNumRootActorInstances(), 3);
+
+        // Attach the second actor instance to the first one and the third to the second one.
+        m_actorInstances[0]->AddAttachment(AttachmentNode::Create(m_actorInstances[0], 0, m_actorInstances[1]));
+        m_actorInstances[1]->AddAttachment(AttachmentNode::Create(m_actorInstances[1], 0, m_actorInstances[2]));
+        ASSERT_EQ(m_scheduler->GetNumRootActorInstances(), 1) << "Attachments should only be updated through the actor instance they are attached to.";
+        EXPECT_EQ(m_scheduler->GetRootActorInstance(0), m_actorInstances[0]);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3);
+
+        // Detaching re-adds the actor instance as a root.
+        m_actorInstances[0]->RemoveAttachment(m_actorInstances[1]);
+        EXPECT_EQ(m_scheduler->GetNumRootActorInstances(), 2);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3);
+    }
+
+    TEST_F(MultiThreadSchedulerFixture, Batching)
+    {
+        CreateActorInstances(16);
+        const uint32 numJoints = m_actorInstances[0]->GetNumEnabledNodes();
+
+        m_scheduler->SetMaxJointsPerBatch(1);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumBatches(), 16);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 16);
+
+        m_scheduler->SetMaxJointsPerBatch(numJoints * 4);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumBatches(), 4);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 16);
+
+        m_actorInstances[0]->SetIsEnabled(false);
+        m_scheduler->SetMaxNumParallelJobs(1);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 15);
+    }
+
+    TEST_F(MultiThreadSchedulerFixture, AttachmentsOfDestroyedParentBecomeRoots)
+    {
+        CreateActorInstances(3);
+
+        // Attach both the second and the third actor instance to the first one.
+        ActorInstance* parent = m_actorInstances[0];
+        parent->AddAttachment(AttachmentNode::Create(parent, 0, m_actorInstances[1]));
+        parent->AddAttachment(AttachmentNode::Create(parent, 0, m_actorInstances[2]));
+        ASSERT_EQ(m_scheduler->GetNumRootActorInstances(), 1);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3);
+
+        m_actorInstances.erase(m_actorInstances.begin());
+        parent->Destroy();
+        ASSERT_EQ(m_scheduler->GetNumRootActorInstances(), 2) << "The former attachments should be scheduled as roots.";
+
+        // The former attachments keep getting updated, which also moves them to their new local space positions.
+        for (size_t i = 0; i < m_actorInstances.size(); ++i)
+        {
+            EXPECT_EQ(m_actorInstances[i]->GetAttachedTo(), nullptr);
+            m_actorInstances[i]->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i + 1), 0.0f, 0.0f));
+        }
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 2);
+        for (size_t i = 0; i < m_actorInstances.size(); ++i)
+        {
+            EXPECT_TRUE(m_actorInstances[i]->GetWorldSpaceTransform().mPosition.IsClose(AZ::Vector3(static_cast<float>(i + 1), 0.0f, 0.0f)));
+        }
+    }
+
+    TEST_F(MultiThreadSchedulerFixture, ActorInstanceDestroyedDuringExecute_IsDeletedOnceTheExecuteFinished)
+    {
+        MultiThreadSchedulerWithExecuteFlag* scheduler = MultiThreadSchedulerWithExecuteFlag::Create();
+        GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+        m_scheduler = scheduler;
+
+        CreateActorInstances(2);
+        ActorInstance* destroyedInstance = m_actorInstances[1];
+        m_actorInstances.pop_back();
+
+        scheduler->SetIsExecuting(true);
+        destroyedInstance->Destroy();
+        EXPECT_EQ(GetEMotionFX().GetActorManager()->GetNumActorInstances(), 2) << "The actor instance may still be updated, so it should not be deleted yet.";
+        EXPECT_EQ(m_scheduler->GetNumRootActorInstances(), 2);
+        scheduler->SetIsExecuting(false);
+
+        // The execute still updates the destroyed actor instance, and deletes it once all updates finished.
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 2);
+        EXPECT_EQ(GetEMotionFX().GetActorManager()->GetNumActorInstances(), 1);
+        EXPECT_EQ(m_scheduler->GetNumRootActorInstances(), 1);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 1);
+    }
 } // namespace EMotionFX
@@ -1284,7 +1284,7 @@ namespace EMotionFX
         PoseData* poseData = pose.GetAndPreparePoseData(azrtti_typeid<PoseDataRagdoll>(), m_actorInstance);
 
         EXPECT_NE(poseData, nullptr);
-        EXPECT_EQ(pose.GetPoseDatas().size(), 1);
+        EXPECT_EQ(pose.GetNumPoseDatas(), 1);
         EXPECT_EQ(poseData->RTTI_GetType(), azrtti_typeid<PoseDataRagdoll>());
         EXPECT_EQ(poseData->IsUsed(), true);
     }
@@ -1296,7 +1296,7 @@ namespace EMotionFX
         PoseData* poseData = pose.GetAndPreparePoseData<PoseDataRagdoll>(m_actorInstance);
 
         EXPECT_NE(poseData, nullptr);
-        EXPECT_EQ(pose.GetPoseDatas().size(), 1);
+        EXPECT_EQ(pose.GetNumPoseDatas(), 1);
         EXPECT_EQ(poseData->RTTI_GetType(), azrtti_typeid<PoseDataRagdoll>());
         EXPECT_EQ(poseData->IsUsed(), true);
     }
@@ -1308,7 +1308,7 @@ namespace EMotionFX
         PoseData* poseData = pose.GetAndPreparePoseData(azrtti_typeid<PoseDataRagdoll>(), m_actorInstance);
 
         EXPECT_NE(poseData, nullptr);
-        EXPECT_EQ(pose.GetPoseDatas().size(), 1);
+        EXPECT_EQ(pose.GetNumPoseDatas(), 1);
         EXPECT_EQ(pose.HasPoseData(azrtti_typeid<PoseDataRagdoll>()), true);
         EXPECT_EQ(pose.GetPoseDataByType(azrtti_typeid<PoseDataRagdoll>()), poseData);
         EXPECT_EQ(pose.GetPoseData<PoseDataRagdoll>(), poseData);
@@ -1322,7 +1322,7 @@ namespace EMotionFX
         pose.AddPoseData(poseData);
 
         EXPECT_NE(poseData, nullptr);
-        EXPECT_EQ(pose.GetPoseDatas().size(), 1);
+        EXPECT_EQ(pose.GetNumPoseDatas(), 1);
         EXPECT_EQ(pose.HasPoseData(azrtti_typeid<PoseDataRagdoll>()), true);
         EXPECT_EQ(pose.GetPoseDataByType(azrtti_typeid<PoseDataRagdoll>()), poseData);
         EXPECT_EQ(pose.GetPoseData<PoseDataRagdoll>(), poseData);
@@ -1335,9 +1335,9 @@ namespace EMotionFX
         PoseData* poseData = PoseDataFactory::Create(&pose, azrtti_typeid<PoseDataRagdoll>());
         pose.AddPoseData(poseData);
         EXPECT_NE(poseData, nullptr);
-        EXPECT_EQ(pose.GetPoseDatas().size(), 1);
+        EXPECT_EQ(pose.GetNumPoseDatas(), 1);
 
         pose.ClearPoseDatas();
-        EXPECT_TRUE(pose.GetPoseDatas().empty());
+        EXPECT_EQ(pose.GetNumPoseDatas(), 0);
     }
 } // namespace EMotionFX
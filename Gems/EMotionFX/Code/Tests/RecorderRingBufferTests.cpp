@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzTest/Utils.h>
+#include <Tests/ActorFixture.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Recorder.h>
+#include <EMotionFX/Source/RecorderRingBuffer.h>
+#include <EMotionFX/Source/TransformData.h>
+
+namespace EMotionFX
+{
+    class RecorderRingBufferFixture
+        : public ActorFixture
+    {
+    public:
+        void TearDown() override
+        {
+            GetRecorder().Clear();
+            ActorFixture::TearDown();
+        }
+
+        Recorder::RecordSettings CreateRingBufferSettings() const
+        {
+            Recorder::RecordSettings settings;
+            settings.m_actorInstances = { m_actorInstance };
+            settings.mUseRingBuffer = true;
+            settings.mRecordMorphs = false;
+            settings.mRingBufferSegmentFrames = 8;
+            return settings;
+        }
+
+        // Move all joints of the actor instance to a frame dependent position and rotation.
+        void PoseActorInstance(uint32 frame)
+        {
+            Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (uint32 j = 0; j < pose->GetNumTransforms(); ++j)
+            {
+                Transform transform = pose->GetLocalSpaceTransform(j);
+                transform.mPosition = AZ::Vector3(0.01f * frame, 0.1f * j, -0.003f * frame * j);
+                transform.mRotation = AZ::Quaternion::CreateRotationZ(0.05f * frame + 0.1f * j) * AZ::Quaternion::CreateRotationX(0.02f * j);
+                pose->SetLocalSpaceTransform(j, transform);
+            }
+            m_actorInstance->SetLocalSpacePosition(AZ::Vector3(0.5f * frame, 0.0f, 0.0f));
+        }
+
+        void RecordFrames(uint32 numFrames, float timeDelta)
+        {
+            for (uint32 frame = 1; frame <= numFrames; ++frame)
+            {
+                PoseActorInstance(frame);
+                GetRecorder().Update(timeDelta);
+            }
+        }
+    };
+
+    TEST_F(RecorderRingBufferFixture, DecodedFramesMatchRecordedPoses)
+    {
+        const Recorder::RecordSettings settings = CreateRingBufferSettings();
+        RecorderRingBuffer ringBuffer;
+        ringBuffer.Init(settings, settings.m_actorInstances, "DecodeTest");
+
+        const uint32 numFrames = 20;
+        for (uint32 frame = 0; frame < numFrames; ++frame)
+        {
+            PoseActorInstance(frame);
+            ringBuffer.RecordFrame(frame / 30.0f, 1.0f / 30.0f);
+        }
+        EXPECT_EQ(ringBuffer.GetNumFrames(), numFrames);
+        EXPECT_EQ(ringBuffer.GetNumSegments(), 3);
+
+        uint32 frame = 0;
+        Pose expectedPose;
+        expectedPose.LinkToActorInstance(m_actorInstance);
+        const bool success = ringBuffer.DecodeFrames([&](const RecorderRingBuffer::Frame& decodedFrame)
+        {
+            PoseActorInstance(frame);
+            expectedPose.InitFromPose(m_actorInstance->GetTransformData()->GetCurrentPose());
+
+            EXPECT_FLOAT_EQ(decodedFrame.m_recordTime, frame / 30.0f);
+            ASSERT_EQ(decodedFrame.m_actorFrames.size(), 1);
+            const RecorderRingBuffer::ActorFrame& actorFrame = decodedFrame.m_actorFrames[0];
+            EXPECT_EQ(actorFrame.m_actorInstance, m_actorInstance);
+            EXPECT_TRUE(actorFrame.m_localTransform.mPosition.IsClose(m_actorInstance->GetLocalSpaceTransform().mPosition, 0.001f));
+
+            ASSERT_EQ(actorFrame.m_jointTransforms.size(), expectedPose.GetNumTransforms());
+            for (uint32 j = 0; j < expectedPose.GetNumTransforms(); ++j)
+            {
+                const Transform& expected = expectedPose.GetLocalSpaceTransform(j);
+                EXPECT_TRUE(actorFrame.m_jointTransforms[j].mPosition.IsClose(expected.mPosition, 0.001f));
+                EXPECT_TRUE(actorFrame.m_jointTransforms[j].mRotation.IsClose(expected.mRotation, 0.001f) ||
+                    actorFrame.m_jointTransforms[j].mRotation.IsClose(-expected.mRotation, 0.001f));
+            }
+            frame++;
+        });
+
+        EXPECT_TRUE(success);
+        EXPECT_EQ(frame, numFrames);
+
+        // Random access decodes the segment of the requested frame, also when going back in time.
+        for (uint32 requestedFrame : { 19u, 3u, 4u, 12u, 0u })
+        {
+            const RecorderRingBuffer::Frame* decodedFrame = ringBuffer.DecodeFrameAtTime(requestedFrame / 30.0f + 0.001f);
+            ASSERT_TRUE(decodedFrame);
+            EXPECT_FLOAT_EQ(decodedFrame->m_recordTime, requestedFrame / 30.0f);
+            EXPECT_NEAR(decodedFrame->m_actorFrames[0].m_localTransform.mPosition.GetX(), 0.5f * requestedFrame, 0.001f);
+        }
+    }
+
+    TEST_F(RecorderRingBufferFixture, TruncatedSpilledSegmentsAreSkipped)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        Recorder::RecordSettings settings = CreateRingBufferSettings();
+        settings.mRingBufferMaxBytes = 1;
+        settings.mRingBufferSpillFolder = tempDirectory.GetDirectory();
+
+        RecorderRingBuffer ringBuffer;
+        ringBuffer.Init(settings, settings.m_actorInstances, "TruncateTest");
+        const uint32 numFrames = 20;
+        for (uint32 frame = 0; frame < numFrames; ++frame)
+        {
+            PoseActorInstance(frame);
+            ringBuffer.RecordFrame(frame / 30.0f, 1.0f / 30.0f);
+        }
+        ringBuffer.WaitForPendingWrites();
+        ASSERT_GT(ringBuffer.GetNumSpilledSegments(), 0);
+
+        // Replace all spilled segments with a few bytes, which must be rejected before anything gets decoded.
+        AZStd::vector<AZStd::string> filenames;
+        const AZStd::string filter = AZStd::string::format("%s/*.emfxsegment", tempDirectory.GetDirectory());
+        AZ::IO::SystemFile::FindFiles(filter.c_str(), [&filenames, &tempDirectory](const char* filename, bool isFile)
+            {
+                if (isFile)
+                {
+                    filenames.emplace_back(AZStd::string::format("%s/%s", tempDirectory.GetDirectory(), filename));
+                }
+                return true;
+            });
+        ASSERT_FALSE(filenames.empty());
+        const AZ::u8 garbage[3] = { 0xff, 0xff, 0xff };
+        for (const AZStd::string& filename : filenames)
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(filename.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(garbage, sizeof(garbage));
+            file.Close();
+        }
+
+        size_t numDecodedFrames = 0;
+        EXPECT_FALSE(ringBuffer.DecodeFrames([&numDecodedFrames]([[maybe_unused]] const RecorderRingBuffer::Frame& frame) { numDecodedFrames++; }));
+        EXPECT_LT(numDecodedFrames, ringBuffer.GetNumFrames());
+        EXPECT_EQ(ringBuffer.DecodeFrameAtTime(0.0f), nullptr);
+        EXPECT_TRUE(ringBuffer.DecodeFrameAtTime(ringBuffer.GetEndTime()));
+    }
+
+    TEST_F(RecorderRingBufferFixture, MemoryStaysWithinBudget)
+    {
+        Recorder::RecordSettings settings = CreateRingBufferSettings();
+        settings.mRingBufferMaxBytes = 16 * 1024;
+
+        GetRecorder().StartRecording(settings);
+        RecordFrames(1000, 1.0f / 30.0f);
+
+        const RecorderRingBuffer* ringBuffer = GetRecorder().GetRingBuffer();
+        ASSERT_TRUE(ringBuffer);
+        EXPECT_LE(ringBuffer->GetNumMemoryBytes(), 2 * settings.mRingBufferMaxBytes);
+        EXPECT_GT(ringBuffer->GetNumDroppedSegments(), 0);
+        EXPECT_EQ(ringBuffer->GetNumSpilledSegments(), 0);
+        EXPECT_GT(GetRecorder().GetAvgFrameRecordDuration(), 0.0f);
+
+        // Only the most recent frames are kept, starting at time zero. They are not decoded when stopping.
+        GetRecorder().StopRecording();
+        ASSERT_TRUE(GetRecorder().GetRingBuffer());
+        EXPECT_GT(GetRecorder().GetRecordTime(), 0.0f);
+        EXPECT_LT(GetRecorder().GetRecordTime(), 1000.0f / 30.0f);
+        EXPECT_EQ(GetRecorder().GetTimeDeltas().size(), GetRecorder().GetRingBuffer()->GetNumFrames());
+        EXPECT_EQ(GetRecorder().GetActorInstanceData(0).m_transformTracks[1].mPositions.GetNumKeys(), 0);
+
+        GetRecorder().SampleAndApplyMainTransform(GetRecorder().GetRecordTime(), m_actorInstance);
+        EXPECT_NEAR(m_actorInstance->GetLocalSpaceTransform().mPosition.GetX(), 0.5f * 1000.0f, 0.001f);
+    }
+
+    TEST_F(RecorderRingBufferFixture, SpilledSegmentsAreLoadedForPlayback)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        Recorder::RecordSettings settings = CreateRingBufferSettings();
+        settings.mRingBufferMaxBytes = 16 * 1024;
+        settings.mRingBufferSpillFolder = tempDirectory.GetDirectory();
+
+        const uint32 numFrames = 500;
+        GetRecorder().StartRecording(settings);
+        RecordFrames(numFrames, 1.0f / 30.0f);
+
+        const RecorderRingBuffer* ringBuffer = GetRecorder().GetRingBuffer();
+        ASSERT_TRUE(ringBuffer);
+        EXPECT_GT(ringBuffer->GetNumSpilledSegments(), 0);
+        EXPECT_EQ(ringBuffer->GetNumDroppedSegments(), 0);
+
+        // All frames, including the initial one, are available again after lazily reloading the spilled segments.
+        GetRecorder().StopRecording();
+        ASSERT_TRUE(GetRecorder().GetRingBuffer());
+        EXPECT_EQ(GetRecorder().GetRingBuffer()->GetNumFrames(), numFrames + 1);
+        EXPECT_EQ(GetRecorder().GetTimeDeltas().size(), numFrames + 1);
+        EXPECT_NEAR(GetRecorder().GetRecordTime(), numFrames / 30.0f, 0.01f);
+
+        GetRecorder().SampleAndApplyMainTransform(0.0f, m_actorInstance);
+        EXPECT_NEAR(m_actorInstance->GetLocalSpaceTransform().mPosition.GetX(), 0.0f, 0.001f);
+        GetRecorder().SampleAndApplyMainTransform(GetRecorder().GetRecordTime(), m_actorInstance);
+        EXPECT_NEAR(m_actorInstance->GetLocalSpaceTransform().mPosition.GetX(), 0.5f * numFrames, 0.001f);
+
+        // Extracting decodes everything into the key tracks, which is what gets saved.
+        GetRecorder().ExtractRingBufferRecording();
+        EXPECT_EQ(GetRecorder().GetRingBuffer(), nullptr);
+        const Recorder::ActorInstanceData& actorInstanceData = GetRecorder().GetActorInstanceData(0);
+        EXPECT_NEAR(actorInstanceData.mActorLocalTransform.mPositions.GetValueAtTime(0.0f).GetX(), 0.0f, 0.001f);
+        EXPECT_NEAR(actorInstanceData.mActorLocalTransform.mPositions.GetValueAtTime(GetRecorder().GetRecordTime()).GetX(), 0.5f * numFrames, 0.001f);
+    }
+} // namespace EMotionFX
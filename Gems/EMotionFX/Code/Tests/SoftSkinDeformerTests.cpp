@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/PackedSkinInfluences.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+
+namespace EMotionFX
+{
+    // Gives the tests access to both the scalar and the packed skinning paths.
+    class TestSoftSkinDeformer
+        : public SoftSkinDeformer
+    {
+    public:
+        explicit TestSoftSkinDeformer(Mesh* mesh)
+            : SoftSkinDeformer(mesh)
+        {
+        }
+
+        void SetBoneMatrix(uint32 localBoneIndex, const AZ::Matrix3x4& matrix)
+        {
+            mBoneMatrices[localBoneIndex] = matrix;
+        }
+
+        void SkinScalar()
+        {
+            SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(mMesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+            SkinVertexRange(0, mMesh->GetNumVertices(), GetPositions(), GetNormals(), nullptr, nullptr,
+                static_cast<uint32*>(mMesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS)), layer);
+        }
+
+        void SkinPacked()
+        {
+            SkinVertexRangePacked(0, mMesh->GetNumVertices(), GetPositions(), GetNormals(), nullptr, nullptr);
+        }
+
+        // Skins the mesh the way Update() does, which splits large meshes into batches that are skinned by jobs.
+        void SkinPackedBatched()
+        {
+            SkinVerticesPacked(mMesh->GetNumVertices(), GetPositions(), GetNormals(), nullptr, nullptr);
+        }
+
+        static AZ::u32 GetNumVerticesPerBatch() { return s_numVerticesPerBatch; }
+
+        AZ::Vector3* GetPositions() const { return static_cast<AZ::Vector3*>(mMesh->FindVertexData(Mesh::ATTRIB_POSITIONS)); }
+        AZ::Vector3* GetNormals() const { return static_cast<AZ::Vector3*>(mMesh->FindVertexData(Mesh::ATTRIB_NORMALS)); }
+    };
+
+    // Gives the tests access to both the scalar and the packed dual quaternion skinning paths.
+    class TestDualQuatSkinDeformer
+        : public DualQuatSkinDeformer
+    {
+    public:
+        explicit TestDualQuatSkinDeformer(Mesh* mesh)
+            : DualQuatSkinDeformer(mesh)
+        {
+        }
+
+        void SetBoneTransform(uint32 localBoneIndex, const AZ::Transform& transform)
+        {
+            m_bones[localBoneIndex].mDualQuat.FromRotationTranslation(transform.GetRotation(), transform.GetTranslation());
+        }
+
+        void SkinScalar()
+        {
+            SkinRange(mMesh, 0, mMesh->GetNumVertices(), m_bones);
+        }
+
+        void SkinPacked()
+        {
+            SkinRangePacked(mMesh, 0, mMesh->GetNumVertices(), m_bones, m_packedInfluences);
+        }
+
+        const PackedSkinInfluences& GetPackedInfluences() const { return m_packedInfluences; }
+    };
+
+    class SoftSkinDeformerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void TearDown() override
+        {
+            m_deformer.reset();
+            m_dualQuatDeformer.reset();
+            if (m_mesh)
+            {
+                m_mesh->Destroy();
+                m_mesh = nullptr;
+            }
+
+            SystemComponentFixture::TearDown();
+        }
+
+        // Create a mesh where every vertex is influenced by a random number of bones, up to the given maximum.
+        // Every unskinnedVertexInterval-th vertex has no influences at all, in case the interval is non-zero.
+        void CreateMesh(uint32 numVertices, uint32 numBones, size_t maxNumInfluences, uint32 unskinnedVertexInterval = 0)
+        {
+            AZ::SimpleLcgRandom random;
+            AZStd::vector<AZ::u32> indices(numVertices);
+            AZStd::vector<AZ::Vector3> positions(numVertices);
+            AZStd::vector<AZ::Vector3> normals(numVertices);
+            AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(numVertices);
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                indices[v] = v;
+                positions[v] = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 2.0f;
+                normals[v] = AZ::Vector3(random.GetRandomFloat() + 0.1f, random.GetRandomFloat(), random.GetRandomFloat()).GetNormalized();
+                if (unskinnedVertexInterval > 0 && (v % unskinnedVertexInterval) == 0)
+                {
+                    continue;
+                }
+
+                const size_t numInfluences = 1 + (random.GetRandom() % maxNumInfluences);
+                float totalWeight = 0.0f;
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const float weight = random.GetRandomFloat() + 0.01f;
+                    skinningInfo[v].emplace_back((v + i) % numBones, weight);
+                    totalWeight += weight;
+                }
+
+                for (MeshFactory::SkinInfluence& influence : skinningInfo[v])
+                {
+                    AZStd::get<1>(influence) /= totalWeight;
+                }
+            }
+
+            m_mesh = MeshFactory::Create(indices, positions, normals, {}, skinningInfo);
+            m_deformer = AZStd::make_unique<TestSoftSkinDeformer>(m_mesh);
+            m_deformer->Reinitialize(nullptr, nullptr, 0);
+
+            // one random rigid transform per joint, the local bone indices of the deformers map onto those
+            m_jointTransforms.clear();
+            for (uint32 i = 0; i < numBones; ++i)
+            {
+                m_jointTransforms.emplace_back(AZ::Transform::CreateFromQuaternionAndTranslation(
+                    AZ::Quaternion::CreateRotationZ(random.GetRandomFloat() * 3.0f) * AZ::Quaternion::CreateRotationX(random.GetRandomFloat()),
+                    AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 5.0f));
+            }
+
+            for (uint32 i = 0; i < static_cast<uint32>(m_deformer->GetNumLocalBones()); ++i)
+            {
+                m_deformer->SetBoneMatrix(i, AZ::Matrix3x4::CreateFromTransform(m_jointTransforms[m_deformer->GetLocalBone(i)]));
+            }
+        }
+
+        void CreateDualQuatDeformer()
+        {
+            m_dualQuatDeformer = AZStd::make_unique<TestDualQuatSkinDeformer>(m_mesh);
+            m_dualQuatDeformer->Reinitialize(nullptr, nullptr, 0);
+            for (uint32 i = 0; i < m_dualQuatDeformer->GetNumLocalBones(); ++i)
+            {
+                m_dualQuatDeformer->SetBoneTransform(i, m_jointTransforms[m_dualQuatDeformer->GetLocalBone(i)]);
+            }
+        }
+
+        // Runs the given skinning function on the original mesh data and returns the skinned positions and normals.
+        template<typename SkinFunction>
+        AZStd::pair<AZStd::vector<AZ::Vector3>, AZStd::vector<AZ::Vector3>> Skin(const SkinFunction& skinFunction)
+        {
+            const uint32 numVertices = m_mesh->GetNumVertices();
+            m_mesh->ResetToOriginalData();
+            skinFunction();
+
+            const AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            return { AZStd::vector<AZ::Vector3>(positions, positions + numVertices), AZStd::vector<AZ::Vector3>(normals, normals + numVertices) };
+        }
+
+        static void ExpectEqualResults(
+            const AZStd::pair<AZStd::vector<AZ::Vector3>, AZStd::vector<AZ::Vector3>>& expected,
+            const AZStd::pair<AZStd::vector<AZ::Vector3>, AZStd::vector<AZ::Vector3>>& actual)
+        {
+            ASSERT_EQ(expected.first.size(), actual.first.size());
+            for (size_t v = 0; v < expected.first.size(); ++v)
+            {
+                EXPECT_TRUE(actual.first[v].IsClose(expected.first[v], 0.001f)) << "Position of vertex " << v << " differs.";
+                EXPECT_TRUE(actual.second[v].IsClose(expected.second[v], 0.001f)) << "Normal of vertex " << v << " differs.";
+            }
+        }
+
+    protected:
+        Mesh* m_mesh = nullptr;
+        AZStd::unique_ptr<TestSoftSkinDeformer> m_deformer;
+        AZStd::unique_ptr<TestDualQuatSkinDeformer> m_dualQuatDeformer;
+        AZStd::vector<AZ::Transform> m_jointTransforms;
+    };
+
+    TEST_F(SoftSkinDeformerFixture, PackedInfluencesAreSortedAndQuantized)
+    {
+        CreateMesh(300, 10, 4);
+
+        const PackedSkinInfluences& packedInfluences = m_deformer->GetPackedInfluences();
+        ASSERT_TRUE(packedInfluences.GetIsValid());
+        EXPECT_EQ(packedInfluences.GetNumInfluencesPerVertex(), 4);
+        EXPECT_EQ(packedInfluences.GetNumVertices(), m_mesh->GetNumVertices());
+
+        SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        for (uint32 v = 0; v < packedInfluences.GetNumVertices(); ++v)
+        {
+            const AZ::u16* weights = packedInfluences.GetWeights(v);
+            const AZ::u16* boneIndices = packedInfluences.GetBoneIndices(v);
+
+            AZ::u32 totalWeight = 0;
+            for (uint32 i = 0; i < packedInfluences.GetNumInfluencesPerVertex(); ++i)
+            {
+                if (i > 0)
+                {
+                    EXPECT_LE(weights[i], weights[i - 1]);
+                }
+                totalWeight += weights[i];
+            }
+            EXPECT_EQ(totalWeight, 65535);
+
+            // the heaviest slot has to match one of the original influences
+            bool found = false;
+            for (size_t i = 0; i < layer->GetNumInfluences(v); ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                if (influence->GetBoneNr() == boneIndices[0] &&
+                    AZ::IsClose(influence->GetWeight(), PackedSkinInfluences::DequantizeWeight(weights[0]), 0.001f))
+                {
+                    found = true;
+                }
+            }
+            EXPECT_TRUE(found);
+        }
+    }
+
+    TEST_F(SoftSkinDeformerFixture, PackedInfluencesUseEightSlots)
+    {
+        CreateMesh(100, 20, 8);
+        EXPECT_EQ(m_deformer->GetPackedInfluences().GetNumInfluencesPerVertex(), 8);
+    }
+
+    TEST_F(SoftSkinDeformerFixture, PackedInfluencesFallBackForTooManyInfluences)
+    {
+        CreateMesh(100, 20, PackedSkinInfluences::s_maxInfluencesPerVertex + 4);
+        EXPECT_FALSE(m_deformer->GetPackedInfluences().GetIsValid());
+    }
+
+    TEST_F(SoftSkinDeformerFixture, PackedSkinningMatchesScalarSkinning)
+    {
+        CreateMesh(1000, 16, 8);
+        ASSERT_TRUE(m_deformer->GetPackedInfluences().GetIsValid());
+
+        const auto scalarResult = Skin([this] { m_deformer->SkinScalar(); });
+        const auto packedResult = Skin([this] { m_deformer->SkinPacked(); });
+        ExpectEqualResults(scalarResult, packedResult);
+    }
+
+    TEST_F(SoftSkinDeformerFixture, PackedSkinningMatchesScalarSkinningForUnskinnedVertices)
+    {
+        CreateMesh(100, 8, 4, /*unskinnedVertexInterval=*/3);
+        ASSERT_TRUE(m_deformer->GetPackedInfluences().GetIsValid());
+
+        const auto scalarResult = Skin([this] { m_deformer->SkinScalar(); });
+        const auto packedResult = Skin([this] { m_deformer->SkinPacked(); });
+        ExpectEqualResults(scalarResult, packedResult);
+
+        // vertices without influences collapse onto the origin, for both paths
+        for (size_t v = 0; v < packedResult.first.size(); v += 3)
+        {
+            EXPECT_TRUE(packedResult.first[v].IsZero());
+            EXPECT_TRUE(packedResult.second[v].IsZero());
+        }
+    }
+
+    TEST_F(SoftSkinDeformerFixture, BatchedPackedSkinningMatchesScalarSkinning)
+    {
+        // make sure the mesh gets split into multiple batches that are skinned by jobs, with a partial last batch
+        const AZ::u32 numVertices = TestSoftSkinDeformer::GetNumVerticesPerBatch() * 2 + 123;
+        CreateMesh(numVertices, 32, 4, /*unskinnedVertexInterval=*/101);
+        ASSERT_TRUE(m_deformer->GetPackedInfluences().GetIsValid());
+
+        const auto scalarResult = Skin([this] { m_deformer->SkinScalar(); });
+        const auto batchedResult = Skin([this] { m_deformer->SkinPackedBatched(); });
+        ExpectEqualResults(scalarResult, batchedResult);
+    }
+
+    TEST_F(SoftSkinDeformerFixture, PackedDualQuatSkinningMatchesScalarDualQuatSkinning)
+    {
+        CreateMesh(1000, 16, 8, /*unskinnedVertexInterval=*/50);
+        CreateDualQuatDeformer();
+        ASSERT_TRUE(m_dualQuatDeformer->GetPackedInfluences().GetIsValid());
+
+        const auto scalarResult = Skin([this] { m_dualQuatDeformer->SkinScalar(); });
+        const auto packedResult = Skin([this] { m_dualQuatDeformer->SkinPacked(); });
+        ExpectEqualResults(scalarResult, packedResult);
+
+        // the dual quaternion paths leave vertices without influences untouched
+        m_mesh->ResetToOriginalData();
+        const AZ::Vector3* orgPositions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        EXPECT_TRUE(packedResult.first[0].IsClose(orgPositions[0]));
+    }
+} // namespace EMotionFX
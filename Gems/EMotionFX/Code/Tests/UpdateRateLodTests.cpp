@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionInstance.h>
+#include <EMotionFX/Source/MotionSystem.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class UpdateRateLodFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            // The parameter selects the multi threaded (true) or the single threaded (false) scheduler.
+            if (!GetParam())
+            {
+                GetActorManager().SetScheduler(SingleThreadScheduler::Create());
+            }
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            if (m_motion)
+            {
+                m_motion->Destroy();
+                m_motion = nullptr;
+            }
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        void CreateActorInstances(size_t numActorInstances, float spacing)
+        {
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                actorInstance->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i) * spacing, 0.0f, 0.0f));
+                m_actorInstances.emplace_back(actorInstance);
+            }
+        }
+
+        static ActorUpdateScheduler::UpdateRateLodSettings CreateDistanceSettings()
+        {
+            ActorUpdateScheduler::UpdateRateLodSettings settings;
+            settings.m_enabled = true;
+            settings.m_bands = {
+                { 10.0f, 1 },
+                { 50.0f, 2 },
+                { 100.0f, 4 }
+            };
+            return settings;
+        }
+
+        // Create a two joint chain actor, of which the motion moves the child joint along the x axis with a speed of one unit per second.
+        void CreateLinearMotionActor()
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(2);
+
+            NonUniformMotionData* motionData = aznew NonUniformMotionData();
+            const Transform& bindTransform = m_actor->GetBindPose()->GetLocalSpaceTransform(1);
+            const size_t jointDataIndex = motionData->AddJoint("joint1", bindTransform, bindTransform);
+            motionData->AllocateJointPositionSamples(jointDataIndex, 2);
+            motionData->SetJointPositionSample(jointDataIndex, 0, { 0.0f, AZ::Vector3::CreateZero() });
+            motionData->SetJointPositionSample(jointDataIndex, 1, { 10.0f, AZ::Vector3(10.0f, 0.0f, 0.0f) });
+            motionData->UpdateDuration();
+
+            m_motion = aznew Motion("LinearMotion");
+            m_motion->SetMotionData(motionData);
+        }
+
+        static float GetJointPositionX(const ActorInstance* actorInstance)
+        {
+            return actorInstance->GetTransformData()->GetCurrentPose()->GetLocalSpaceTransform(1).mPosition.GetX();
+        }
+
+    protected:
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+        Motion* m_motion = nullptr;
+    };
+
+    TEST_P(UpdateRateLodFixture, DisabledSamplesEveryFrame)
+    {
+        CreateActorInstances(10, 20.0f);
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+
+        for (int frame = 0; frame < 8; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            EXPECT_EQ(scheduler->GetNumUpdateRateLodSkippedActorInstances(), 0);
+            for (const ActorInstance* actorInstance : m_actorInstances)
+            {
+                EXPECT_FLOAT_EQ(actorInstance->GetMotionSamplingTimer(), 0.0f);
+                EXPECT_FALSE(actorInstance->GetPoseInterpolationEnabled());
+            }
+        }
+    }
+
+    TEST_P(UpdateRateLodFixture, CalcBandByDistance)
+    {
+        CreateActorInstances(4, 30.0f); // 0m, 30m, 60m, 90m
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+
+        ActorUpdateScheduler::UpdateRateLodSettings settings = CreateDistanceSettings();
+        settings.m_bands.pop_back(); // The last band (50m, sample every 2nd frame) is used for everything further away.
+        scheduler->SetUpdateRateLodSettings(settings);
+        GetEMotionFX().Update(0.0f);
+
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[0]), 0);
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[1]), 1);
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[2]), 1);
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[3]), 1);
+
+        scheduler->SetUpdateRateLodReferencePoint(AZ::Vector3(90.0f, 0.0f, 0.0f));
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[0]), 1);
+        EXPECT_EQ(scheduler->CalcUpdateRateLodBand(m_actorInstances[3]), 0);
+    }
+
+    TEST_P(UpdateRateLodFixture, StaggeredSampling)
+    {
+        CreateActorInstances(12, 30.0f); // 0m .. 330m
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+        scheduler->SetUpdateRateLodSettings(CreateDistanceSettings());
+        GetEMotionFX().Update(0.0f);
+
+        // Count how often each actor instance got sampled over a number of frames that is a multiple of all update intervals.
+        const size_t numFrames = 16;
+        AZStd::vector<size_t> numSamples(m_actorInstances.size(), 0);
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+
+            EXPECT_EQ(scheduler->GetNumUpdateRateLodBandActorInstances(0), 1);
+            EXPECT_EQ(scheduler->GetNumUpdateRateLodBandActorInstances(1), 1);
+            EXPECT_EQ(scheduler->GetNumUpdateRateLodBandActorInstances(2), 10);
+
+            for (size_t i = 0; i < m_actorInstances.size(); ++i)
+            {
+                if (m_actorInstances[i]->GetMotionSamplingTimer() == 0.0f)
+                {
+                    numSamples[i]++;
+                }
+            }
+        }
+
+        EXPECT_EQ(numSamples[0], numFrames);
+        EXPECT_EQ(numSamples[1], numFrames / 2);
+        for (size_t i = 2; i < m_actorInstances.size(); ++i)
+        {
+            EXPECT_EQ(numSamples[i], numFrames / 4);
+            EXPECT_TRUE(m_actorInstances[i]->GetPoseInterpolationEnabled());
+        }
+        EXPECT_FALSE(m_actorInstances[0]->GetPoseInterpolationEnabled());
+
+        // The far actor instances should not all sample within the same frame.
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_LT(scheduler->GetNumUpdateRateLodSkippedActorInstances(), 11);
+        EXPECT_GT(scheduler->GetNumUpdateRateLodSkippedActorInstances(), 0);
+    }
+
+    TEST_P(UpdateRateLodFixture, BandIndexOutOfRange)
+    {
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(scheduler->GetNumUpdateRateLodBandActorInstances(ActorUpdateScheduler::s_maxUpdateRateLodBands), 0);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_P(UpdateRateLodFixture, PoseInterpolation)
+    {
+        CreateLinearMotionActor();
+        CreateActorInstances(1, 0.0f);
+        ActorInstance* actorInstance = m_actorInstances[0];
+        ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+
+        PlayBackInfo playBackInfo;
+        playBackInfo.mBlendInTime = 0.0f;
+        const MotionInstance* motionInstance = actorInstance->GetMotionSystem()->PlayMotion(m_motion, &playBackInfo);
+
+        const uint32 updateInterval = 4;
+        ActorUpdateScheduler::UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_bands = { { 0.0f, updateInterval } };
+        scheduler->SetUpdateRateLodSettings(settings);
+
+        // Run two sample intervals, after which the interpolation started from a sampled pose.
+        const float timeDelta = 1.0f / 60.0f;
+        for (size_t frame = 0; frame < updateInterval * 2; ++frame)
+        {
+            GetEMotionFX().Update(timeDelta);
+        }
+        ASSERT_TRUE(actorInstance->GetPoseInterpolationEnabled());
+
+        // The motion is only sampled every fourth frame, but the interpolated joint moves with the speed of the motion every frame,
+        // lagging behind the motion by the frames that passed between two samples, minus the frame in which the sample got taken.
+        float lastPositionX = GetJointPositionX(actorInstance);
+        for (size_t frame = 0; frame < updateInterval * 2; ++frame)
+        {
+            GetEMotionFX().Update(timeDelta);
+            const float positionX = GetJointPositionX(actorInstance);
+            EXPECT_NEAR(positionX - lastPositionX, timeDelta, 0.0001f);
+            EXPECT_NEAR(positionX, motionInstance->GetCurrentTime() - (updateInterval - 1) * timeDelta, 0.0001f);
+            lastPositionX = positionX;
+        }
+
+        // Without interpolation the joint only moves in the frames in which the motion got sampled.
+        settings.m_interpolatePoses = false;
+        scheduler->SetUpdateRateLodSettings(settings);
+        size_t numMoves = 0;
+        for (size_t frame = 0; frame < updateInterval * 2; ++frame)
+        {
+            GetEMotionFX().Update(timeDelta);
+            EXPECT_FALSE(actorInstance->GetPoseInterpolationEnabled());
+            const float positionX = GetJointPositionX(actorInstance);
+            if (!AZ::IsClose(positionX, lastPositionX, 0.00001f))
+            {
+                EXPECT_NEAR(positionX, motionInstance->GetCurrentTime(), 0.0001f);
+                numMoves++;
+            }
+            lastPositionX = positionX;
+        }
+        EXPECT_EQ(numMoves, 2);
+
+        // Interpolating again starts from the displayed pose, using the poses that were kept while interpolation was disabled.
+        settings.m_interpolatePoses = true;
+        scheduler->SetUpdateRateLodSettings(settings);
+        for (size_t frame = 0; frame < updateInterval * 2; ++frame)
+        {
+            GetEMotionFX().Update(timeDelta);
+        }
+        lastPositionX = GetJointPositionX(actorInstance);
+        GetEMotionFX().Update(timeDelta);
+        EXPECT_TRUE(actorInstance->GetPoseInterpolationEnabled());
+        EXPECT_NEAR(GetJointPositionX(actorInstance) - lastPositionX, timeDelta, 0.0001f);
+
+        // Without update-rate LOD the motion is sampled every frame again.
+        settings.m_enabled = false;
+        scheduler->SetUpdateRateLodSettings(settings);
+        GetEMotionFX().Update(timeDelta);
+        EXPECT_FALSE(actorInstance->GetPoseInterpolationEnabled());
+        EXPECT_NEAR(GetJointPositionX(actorInstance), motionInstance->GetCurrentTime(), 0.0001f);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UpdateRateLod,
+        UpdateRateLodFixture,
+        ::testing::Bool());
+} // namespace EMotionFX
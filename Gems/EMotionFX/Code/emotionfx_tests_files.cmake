@@ -35,6 +35,7 @@ set(FILES
     Tests/AnimGraphNodeEventFilterTests.cpp
     Tests/AnimGraphNodeGroupTests.cpp
     Tests/AnimGraphNodeProcessingTests.cpp
+    Tests/AnimGraphPosePoolTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterConditionCommandTests.cpp
@@ -42,6 +43,7 @@ set(FILES
     Tests/AnimGraphParameterConditionCommandTests.cpp
     Tests/AnimGraphRefCountTests.cpp
     Tests/AnimGraphReferenceNodeTests.cpp
+    Tests/AnimGraphSharedEvaluationTests.cpp
     Tests/AnimGraphStateMachineTests.cpp
     Tests/AnimGraphStateMachineInterruptionTests.cpp
     Tests/AnimGraphStateMachineSyncTests.cpp
@@ -57,6 +59,11 @@ set(FILES
     Tests/AnimGraphTransitionTests.cpp
     Tests/AnimGraphVector2ConditionTests.cpp
     Tests/AutoSkeletonLODTests.cpp
+    Tests/Benchmarks/AnimGraphBenchmarks.cpp
+    Tests/Benchmarks/EMotionFXBenchmarkFixture.cpp
+    Tests/Benchmarks/EMotionFXBenchmarkFixture.h
+    Tests/Benchmarks/MotionBenchmarks.cpp
+    Tests/Benchmarks/RecorderBenchmarks.cpp
     Tests/BlendSpaceFixture.h
     Tests/BlendSpaceFixture.cpp
     Tests/BlendSpaceTests.cpp
@@ -77,6 +84,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -101,6 +109,7 @@ set(FILES
     Tests/QuaternionParameterTests.cpp
     Tests/RagdollCommandTests.cpp
     Tests/RandomMotionSelectionTests.cpp
+    Tests/RecorderRingBufferTests.cpp
     Tests/RenderBackendManagerTests.cpp
     Tests/SelectionListTests.cpp
     Tests/SimpleMotionComponentBusTests.cpp
@@ -108,10 +117,12 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SoftSkinDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
     Tests/TransformUnitTests.cpp
+    Tests/UpdateRateLodTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
     Tests/PhysicsSetupUtils.h
@@ -76,6 +76,16 @@ namespace NvCloth
         //! Returns the FabricCookedData used when the cloth was created.
         virtual const FabricCookedData& GetFabricCookedData() const = 0;
 
+        //! Freezes or unfreezes the cloth. A frozen cloth stays in its solver but it's not
+        //! simulated and its simulation events are not signaled, keeping its current particles.
+        //! Useful to stop simulating cloths that are too far away to be noticed.
+        //!
+        //! @note The change takes effect the next time the solver starts a simulation.
+        virtual void SetFrozen(bool frozen) = 0;
+
+        //! Returns whether the cloth is frozen.
+        virtual bool IsFrozen() const = 0;
+
         //! Returns the interface to IClothConfigurator to set all cloth
         //! parameters that define its behavior during simulation.
         virtual IClothConfigurator* GetClothConfigurator() = 0;
@@ -185,22 +185,47 @@ namespace NvCloth
             return transformData->GetSkinningMatrices();
         }
 
-        AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> ObtainSkinningDualQuaternions(
+        // Gathers the skinning matrices of the joints, in the order of the joint list.
+        bool ObtainSkinningJointMatrices(
             AZ::EntityId entityId,
-            const AZStd::vector<AZ::u16>& jointIndices)
+            const AZStd::vector<AZ::u16>& jointIndices,
+            AZStd::vector<AZ::Matrix3x4>& jointMatrices)
         {
             const AZ::Matrix3x4* skinningMatrices = ObtainSkinningMatrices(entityId);
             if (!skinningMatrices)
             {
-                return {};
+                jointMatrices.clear();
+                return false;
             }
 
-            AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> skinningDualQuaternions;
-            for (AZ::u16 jointIndex : jointIndices)
+            jointMatrices.resize(jointIndices.size());
+            for (size_t jointSlot = 0; jointSlot < jointIndices.size(); ++jointSlot)
             {
-                skinningDualQuaternions.emplace(jointIndex, MCore::DualQuaternion(AZ::Transform::CreateFromMatrix3x4(skinningMatrices[jointIndex])));
+                jointMatrices[jointSlot] = skinningMatrices[jointIndices[jointSlot]];
             }
-            return skinningDualQuaternions;
+            return true;
+        }
+
+        // Gathers the skinning dual quaternions of the joints, in the order of the joint list.
+        bool ObtainSkinningDualQuaternions(
+            AZ::EntityId entityId,
+            const AZStd::vector<AZ::u16>& jointIndices,
+            AZStd::vector<MCore::DualQuaternion>& jointDualQuaternions)
+        {
+            const AZ::Matrix3x4* skinningMatrices = ObtainSkinningMatrices(entityId);
+            if (!skinningMatrices)
+            {
+                jointDualQuaternions.clear();
+                return false;
+            }
+
+            jointDualQuaternions.resize(jointIndices.size());
+            for (size_t jointSlot = 0; jointSlot < jointIndices.size(); ++jointSlot)
+            {
+                jointDualQuaternions[jointSlot] =
+                    MCore::DualQuaternion(AZ::Transform::CreateFromMatrix3x4(skinningMatrices[jointIndices[jointSlot]]));
+            }
+            return true;
         }
     }
 
@@ -224,93 +249,56 @@ namespace NvCloth
             ClothComponentMesh::RenderData& renderData) override;
 
     private:
-        AZ::Matrix3x4 ComputeVertexSkinnningTransform(AZ::u32 vertexIndex);
-
-        const AZ::Matrix3x4* m_skinningMatrices = nullptr;
-
-        inline static const AZ::Matrix3x4 s_zeroMatrix3x4 = AZ::Matrix3x4::CreateZero();
+        // Skinning matrices of the joints that influence the vertices, in the order of m_jointIndices.
+        AZStd::vector<AZ::Matrix3x4> m_jointMatrices;
     };
 
     void ActorClothSkinningLinear::UpdateSkinning()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        m_skinningMatrices = Internal::ObtainSkinningMatrices(m_entityId);
+        Internal::ObtainSkinningJointMatrices(m_entityId, m_jointIndices, m_jointMatrices);
     }
 
     void ActorClothSkinningLinear::ApplySkinning(
         const AZStd::vector<AZ::Vector4>& originalPositions,
         AZStd::vector<AZ::Vector4>& positions)
     {
-        if (!m_skinningMatrices ||
+        if (m_jointMatrices.empty() ||
             originalPositions.empty() ||
             originalPositions.size() != positions.size() ||
-            originalPositions.size() != m_simulatedVertices.size())
+            originalPositions.size() != m_simulatedInfluences.GetNumVertices())
         {
             return;
         }
 
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        const size_t vertexCount = m_simulatedVertices.size();
-        for (size_t index = 0; index < vertexCount; ++index)
-        {
-            const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
-
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalPositions[index].GetAsVector3();
-            positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
-        }
+        SkinningKernels::SkinPositionsLinear(
+            m_simulatedInfluences, m_jointMatrices.data(), originalPositions.data(), positions.data());
     }
 
     void ActorClothSkinningLinear::ApplySkinningOnNonSimulatedVertices(
         const MeshClothInfo& originalData,
         ClothComponentMesh::RenderData& renderData)
     {
-        if (!m_skinningMatrices ||
+        if (m_jointMatrices.empty() ||
             originalData.m_particles.empty() ||
             originalData.m_particles.size() != renderData.m_particles.size() ||
-            originalData.m_particles.size() != m_skinningInfluences.size() / m_numberOfInfluencesPerVertex)
+            originalData.m_particles.size() != m_numVertices)
         {
             return;
         }
 
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        for (const AZ::u32 index : m_nonSimulatedVertices)
-        {
-            const AZ::Matrix3x4 vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
-
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalData.m_particles[index].GetAsVector3();
-            renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
+        SkinningKernels::SkinVerticesLinear(
+            m_nonSimulatedInfluences, m_jointMatrices.data(),
+            originalData.m_particles.data(), originalData.m_normals.data(),
+            renderData.m_particles.data(), renderData.m_normals.data());
 
-            // Calculate the reciprocal scale version of the matrix to transform the normals.
-            // Note: This operation is not strictly equivalent to the full inverse transpose when the matrix's
-            //       basis vectors are not perpendicular, which is the case blending linearly the matrices.
-            //       This is a fast approximation, which is also done by the GPU skinning shader.
-            const AZ::Matrix3x4 vertexSkinningTransformReciprocalScale = vertexSkinningTransform.GetReciprocalScaled();
-
-            renderData.m_normals[index] = vertexSkinningTransformReciprocalScale.TransformVector(originalData.m_normals[index]).GetNormalized();
-
-            // Tangents and Bitangents are recalculated immediately after this call
-            // by cloth mesh component, so there is no need to transform them here.
-        }
-    }
-
-    AZ::Matrix3x4 ActorClothSkinningLinear::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex)
-    {
-        AZ::Matrix3x4 vertexSkinningTransform = s_zeroMatrix3x4;
-        for (size_t influenceIndex = 0; influenceIndex < m_numberOfInfluencesPerVertex; ++influenceIndex)
-        {
-            const size_t vertexInfluenceIndex = vertexIndex * m_numberOfInfluencesPerVertex + influenceIndex;
-
-            const AZ::u16 jointIndex = m_skinningInfluences[vertexInfluenceIndex].m_jointIndex;
-            const float jointWeight = m_skinningInfluences[vertexInfluenceIndex].m_jointWeight;
-
-            // Blending matrices the same way done in GPU shaders, by adding each weighted matrix element by element.
-            // This operation results in a non orthogonal matrix, but it's done this way because it's fast to perform.
-            vertexSkinningTransform += m_skinningMatrices[jointIndex] * jointWeight;
-        }
-        return vertexSkinningTransform;
+        // Tangents and Bitangents are recalculated immediately after this call
+        // by cloth mesh component, so there is no need to transform them here.
     }
 
     // Specialized class that applies dual quaternion blending skinning
@@ -333,94 +321,56 @@ namespace NvCloth
             ClothComponentMesh::RenderData& renderData) override;
 
     private:
-        MCore::DualQuaternion ComputeVertexSkinnningTransform(AZ::u32 vertexIndex);
-
-        AZStd::unordered_map<AZ::u16, MCore::DualQuaternion> m_skinningDualQuaternions;
-
-        inline static const MCore::DualQuaternion s_zeroDualQuaternion = MCore::DualQuaternion(AZ::Quaternion::CreateZero(), AZ::Quaternion::CreateZero());
+        // Skinning dual quaternions of the joints that influence the vertices, in the order of m_jointIndices.
+        AZStd::vector<MCore::DualQuaternion> m_jointDualQuaternions;
     };
 
     void ActorClothSkinningDualQuaternion::UpdateSkinning()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        m_skinningDualQuaternions = Internal::ObtainSkinningDualQuaternions(m_entityId, m_jointIndices);
+        Internal::ObtainSkinningDualQuaternions(m_entityId, m_jointIndices, m_jointDualQuaternions);
     }
 
     void ActorClothSkinningDualQuaternion::ApplySkinning(
         const AZStd::vector<AZ::Vector4>& originalPositions,
         AZStd::vector<AZ::Vector4>& positions)
     {
-        if (m_skinningDualQuaternions.empty() ||
+        if (m_jointDualQuaternions.empty() ||
             originalPositions.empty() ||
             originalPositions.size() != positions.size() ||
-            originalPositions.size() != m_simulatedVertices.size())
+            originalPositions.size() != m_simulatedInfluences.GetNumVertices())
         {
             return;
         }
 
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        const size_t vertexCount = m_simulatedVertices.size();
-        for (size_t index = 0; index < vertexCount; ++index)
-        {
-            const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(m_simulatedVertices[index]);
-
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalPositions[index].GetAsVector3());
-            positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
-        }
+        SkinningKernels::SkinPositionsDualQuaternion(
+            m_simulatedInfluences, m_jointDualQuaternions.data(), originalPositions.data(), positions.data());
     }
 
     void ActorClothSkinningDualQuaternion::ApplySkinningOnNonSimulatedVertices(
         const MeshClothInfo& originalData,
         ClothComponentMesh::RenderData& renderData)
     {
-        if (m_skinningDualQuaternions.empty() ||
+        if (m_jointDualQuaternions.empty() ||
             originalData.m_particles.empty() ||
             originalData.m_particles.size() != renderData.m_particles.size() ||
-            originalData.m_particles.size() != m_skinningInfluences.size() / m_numberOfInfluencesPerVertex)
+            originalData.m_particles.size() != m_numVertices)
         {
             return;
         }
 
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        for (const AZ::u32 index : m_nonSimulatedVertices)
-        {
-            const MCore::DualQuaternion vertexSkinningTransform = ComputeVertexSkinnningTransform(index);
-
-            const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalData.m_particles[index].GetAsVector3());
-            renderData.m_particles[index].Set(skinnedPosition, renderData.m_particles[index].GetW()); // Avoid overwriting the w component
-
-            // ComputeVertexSkinnningTransform is normalizing the blended dual quaternion. This means the dual
-            // quaternion will not have any scale and there is no need to compute the reciprocal scale version
-            // for transforming normals.
-            // Note: The GPU skinning shader does the same operation.
-            renderData.m_normals[index] = vertexSkinningTransform.TransformVector(originalData.m_normals[index]).GetNormalized();
-
-            // Tangents and Bitangents are recalculated immediately after this call
-            // by cloth mesh component, so there is no need to transform them here.
-        }
-    }
+        SkinningKernels::SkinVerticesDualQuaternion(
+            m_nonSimulatedInfluences, m_jointDualQuaternions.data(),
+            originalData.m_particles.data(), originalData.m_normals.data(),
+            renderData.m_particles.data(), renderData.m_normals.data());
 
-    MCore::DualQuaternion ActorClothSkinningDualQuaternion::ComputeVertexSkinnningTransform(AZ::u32 vertexIndex)
-    {
-        MCore::DualQuaternion vertexSkinningTransform = s_zeroDualQuaternion;
-        for (size_t influenceIndex = 0; influenceIndex < m_numberOfInfluencesPerVertex; ++influenceIndex)
-        {
-            const size_t vertexInfluenceIndex = vertexIndex * m_numberOfInfluencesPerVertex + influenceIndex;
-
-            const AZ::u16 jointIndex = m_skinningInfluences[vertexInfluenceIndex].m_jointIndex;
-            const float jointWeight = m_skinningInfluences[vertexInfluenceIndex].m_jointWeight;
-
-            const MCore::DualQuaternion& skinningDualQuaternion = m_skinningDualQuaternions.at(jointIndex);
-
-            float flip = AZ::GetSign(vertexSkinningTransform.mReal.Dot(skinningDualQuaternion.mReal));
-            vertexSkinningTransform += skinningDualQuaternion * jointWeight * flip;
-        }
-        // Normalizing the dual quaternion as the GPU shaders do. This will remove the scale from the transform.
-        vertexSkinningTransform.Normalize();
-        return vertexSkinningTransform;
+        // Tangents and Bitangents are recalculated immediately after this call
+        // by cloth mesh component, so there is no need to transform them here.
     }
 
     AZStd::unique_ptr<ActorClothSkinning> ActorClothSkinning::Create(
@@ -456,8 +406,8 @@ namespace NvCloth
             return nullptr;
         }
 
-        actorClothSkinning->m_numberOfInfluencesPerVertex = skinningInfluences.size() / numVertices;
-        if (actorClothSkinning->m_numberOfInfluencesPerVertex == 0)
+        const size_t numberOfInfluencesPerVertex = skinningInfluences.size() / numVertices;
+        if (numberOfInfluencesPerVertex == 0)
         {
             AZ_Error("ActorClothSkinning", false,
                 "Number of skinning joint influences per vertex is zero.");
@@ -473,26 +423,32 @@ namespace NvCloth
         actorClothSkinning->m_jointIndices.assign(jointIndices.begin(), jointIndices.end());
 
         // Collect the indices for simulated and non-simulated vertices
-        actorClothSkinning->m_simulatedVertices.resize(numSimulatedVertices);
-        actorClothSkinning->m_nonSimulatedVertices.reserve(numVertices);
+        AZStd::vector<AZ::u32> simulatedVertices(numSimulatedVertices);
+        AZStd::vector<AZ::u32> nonSimulatedVertices;
+        nonSimulatedVertices.reserve(numVertices);
         for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
         {
             const int remappedIndex = meshRemappedVertices[vertexIndex];
 
             if (remappedIndex >= 0)
             {
-                actorClothSkinning->m_simulatedVertices[remappedIndex] = vertexIndex;
+                simulatedVertices[remappedIndex] = aznumeric_cast<AZ::u32>(vertexIndex);
             }
 
             if (remappedIndex < 0 ||
                 originalMeshParticles[vertexIndex].GetW() == 0.0f)
             {
-                actorClothSkinning->m_nonSimulatedVertices.emplace_back(vertexIndex);
+                nonSimulatedVertices.emplace_back(aznumeric_cast<AZ::u32>(vertexIndex));
             }
         }
-        actorClothSkinning->m_nonSimulatedVertices.shrink_to_fit();
 
-        actorClothSkinning->m_skinningInfluences = AZStd::move(skinningInfluences);
+        // Pack the influences in the order the vertices are skinned, so the skinning
+        // kernels walk through them sequentially.
+        actorClothSkinning->m_numVertices = numVertices;
+        actorClothSkinning->m_simulatedInfluences = PackedSkinningInfluences::Create(
+            skinningInfluences, numberOfInfluencesPerVertex, simulatedVertices, actorClothSkinning->m_jointIndices);
+        actorClothSkinning->m_nonSimulatedInfluences = PackedSkinningInfluences::Create(
+            skinningInfluences, numberOfInfluencesPerVertex, nonSimulatedVertices, actorClothSkinning->m_jointIndices);
 
         return actorClothSkinning;
     }
@@ -8,25 +8,15 @@
 
 #pragma once
 
-#include <AzCore/std/limits.h>
 #include <AzCore/Component/Entity.h>
 
 #include <NvCloth/Types.h>
 
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
+#include <Components/ClothComponentMesh/ClothSkinningKernels.h>
 
 namespace NvCloth
 {
-    //! One skinning influence of a vertex.
-    struct SkinningInfluence
-    {
-        //! Weight of the joint that influences the vertex.
-        float m_jointWeight = 0.0f;
-
-        //! Index of the joint that influences the vertex.
-        AZ::u16 m_jointIndex = AZStd::numeric_limits<AZ::u16>::max();
-    };
-
     //! Class to retrieve skinning information from an actor on the same entity
     //! and use that data to apply skinning to vertices.
     class ActorClothSkinning
@@ -72,18 +62,17 @@ namespace NvCloth
     protected:
         AZ::EntityId m_entityId;
 
-        size_t m_numberOfInfluencesPerVertex = 0;
-
-        // Skinning influences of all vertices
-        AZStd::vector<SkinningInfluence> m_skinningInfluences;
+        // Number of vertices in the mesh
+        size_t m_numVertices = 0;
 
-        // Indices to skinning influences that are part of the simulation
-        AZStd::vector<AZ::u32> m_simulatedVertices;
+        // Skinning influences of the vertices that are part of the simulation, in simulation order
+        PackedSkinningInfluences m_simulatedInfluences;
 
-        // Indices to skinning influences that are not part of the simulation
-        AZStd::vector<AZ::u32> m_nonSimulatedVertices;
+        // Skinning influences of the vertices that are not part of the simulation
+        PackedSkinningInfluences m_nonSimulatedInfluences;
 
-        // Collection of skeleton joint indices that influence the vertices
+        // Collection of skeleton joint indices that influence the vertices.
+        // The packed influences refer to the joints by their position in this list.
         AZStd::vector<AZ::u16> m_jointIndices;
 
         // Visibility variables
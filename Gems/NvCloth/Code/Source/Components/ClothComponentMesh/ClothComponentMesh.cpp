@@ -24,6 +24,7 @@
 #include <Components/ClothComponentMesh/ClothDebugDisplay.h>
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/WindBus.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -36,6 +37,9 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    // Fraction of a simulation LOD distance a cloth has to get closer than it to go back to a more detailed level.
+    static const float SimulationLodHysteresis = 0.1f;
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -157,6 +161,7 @@ namespace NvCloth
 
         m_entityId = entityId;
         m_config = config;
+        m_simulationLod = SimulationLod::Full;
 
         if (!CreateCloth())
         {
@@ -241,6 +246,7 @@ namespace NvCloth
         m_actorClothColliders.reset();
         m_actorClothSkinning.reset();
         m_clothConstraints.reset();
+        m_frozenParticles.clear();
         m_motionConstraints.clear();
         m_separationConstraints.clear();
         m_clothDebugDisplay.reset();
@@ -293,6 +299,13 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        UpdateSimulationLod();
+
+        if (m_simulationLod == SimulationLod::Frozen)
+        {
+            UpdateFrozenClothSkinning();
+        }
+
         CopyRenderDataToModel();
     }
 
@@ -322,6 +335,37 @@ namespace NvCloth
         return m_renderDataBuffer[m_renderDataBufferIndex];
     }
 
+    ClothComponentMesh::SimulationLod ClothComponentMesh::GetSimulationLod() const
+    {
+        return m_simulationLod;
+    }
+
+    ClothComponentMesh::SimulationLod ClothComponentMesh::CalculateSimulationLod(
+        const ClothConfiguration& config, float distance, SimulationLod currentLod)
+    {
+        if (!config.m_simulationLodEnabled)
+        {
+            return SimulationLod::Full;
+        }
+
+        const auto isBeyond = [distance, currentLod](float lodDistance, SimulationLod lod)
+        {
+            return (currentLod >= lod)
+                ? distance >= lodDistance * (1.0f - SimulationLodHysteresis)
+                : distance >= lodDistance;
+        };
+
+        if (isBeyond(config.m_simulationLodFrozenDistance, SimulationLod::Frozen))
+        {
+            return SimulationLod::Frozen;
+        }
+        if (isBeyond(config.m_simulationLodReducedDistance, SimulationLod::Reduced))
+        {
+            return SimulationLod::Reduced;
+        }
+        return SimulationLod::Full;
+    }
+
     void ClothComponentMesh::UpdateSimulationCollisions()
     {
         if (m_actorClothColliders)
@@ -447,6 +491,80 @@ namespace NvCloth
         AZ_Assert(tangentsAndBitangentsCalculated, "Cloth component mesh failed to calculate tangents and bitangents.");
     }
 
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        if (!m_cloth)
+        {
+            return;
+        }
+
+        SimulationLod simulationLod = SimulationLod::Full;
+        if (m_config.m_simulationLodEnabled)
+        {
+            // Without an active camera there is no reference to measure the distance, keep the current level.
+            if (!Camera::ActiveCameraRequestBus::HasHandlers())
+            {
+                return;
+            }
+
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(
+                cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+
+            const float distance = m_worldPosition.GetDistance(cameraTransform.GetTranslation());
+            simulationLod = CalculateSimulationLod(m_config, distance, m_simulationLod);
+        }
+
+        if (simulationLod == m_simulationLod)
+        {
+            return;
+        }
+
+        const bool wasFrozen = (m_simulationLod == SimulationLod::Frozen);
+        m_simulationLod = simulationLod;
+
+        m_cloth->GetClothConfigurator()->SetSolverFrequency(GetSolverFrequency());
+        m_cloth->SetFrozen(m_simulationLod == SimulationLod::Frozen);
+
+        if (wasFrozen)
+        {
+            // The entity could have moved far away while the cloth was frozen,
+            // clearing inertia avoids the sudden impulse it would cause.
+            m_cloth->GetClothConfigurator()->ClearInertia();
+
+            // Skinned cloths start from the animated pose and
+            // the simulation is overridden for a short amount of time.
+            m_timeClothSkinningUpdates = 0.0f;
+        }
+    }
+
+    void ClothComponentMesh::UpdateFrozenClothSkinning()
+    {
+        // Frozen cloths keep their last simulated particles, except when
+        // there is skinning data, then they follow the actor's animation.
+        if (m_actorClothSkinning)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+            m_actorClothSkinning->UpdateSkinning();
+
+            m_frozenParticles = m_cloth->GetParticles();
+            m_actorClothSkinning->ApplySkinning(m_cloth->GetInitialParticles(), m_frozenParticles);
+
+            // Next buffer index of the render data
+            m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+
+            UpdateRenderData(m_frozenParticles);
+        }
+    }
+
+    float ClothComponentMesh::GetSolverFrequency() const
+    {
+        return (m_simulationLod == SimulationLod::Reduced)
+            ? m_config.m_solverFrequency * m_config.m_simulationLodReducedSolverFrequencyScale
+            : m_config.m_solverFrequency;
+    }
+
     void ClothComponentMesh::CopyRenderDataToModel()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
@@ -723,7 +841,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(GetSolverFrequency());
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
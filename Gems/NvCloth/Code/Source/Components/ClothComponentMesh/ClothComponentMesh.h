@@ -52,9 +52,24 @@ namespace NvCloth
             AZStd::vector<AZ::Vector3> m_normals;
         };
 
+        //! Level of detail of the cloth simulation, chosen by the distance to the active camera.
+        enum class SimulationLod : AZ::u8
+        {
+            Full,    //!< Simulated with the solver frequency of the configuration.
+            Reduced, //!< Simulated with a reduced solver frequency.
+            Frozen   //!< Not simulated, skinned cloths follow the actor's skinning.
+        };
+
+        //! Returns the simulation level of detail for a cloth at a distance from the active camera.
+        //! Going back to a more detailed level requires getting closer than the level's distance
+        //! by a margin, so a cloth at the boundary doesn't switch levels every frame.
+        static SimulationLod CalculateSimulationLod(const ClothConfiguration& config, float distance, SimulationLod currentLod);
+
         const RenderData& GetRenderData() const;
         RenderData& GetRenderData();
 
+        SimulationLod GetSimulationLod() const;
+
         void UpdateConfiguration(AZ::EntityId entityId, const ClothConfiguration& config);
 
         void CopyRenderDataToModel();
@@ -84,6 +99,9 @@ namespace NvCloth
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
         void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateSimulationLod();
+        void UpdateFrozenClothSkinning();
+        float GetSolverFrequency() const;
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
@@ -131,6 +149,9 @@ namespace NvCloth
         AZStd::unique_ptr<ActorClothSkinning> m_actorClothSkinning;
         float m_timeClothSkinningUpdates = 0.0f;
 
+        SimulationLod m_simulationLod = SimulationLod::Full;
+        AZStd::vector<SimParticleFormat> m_frozenParticles; // Skinned particles of the cloth while frozen.
+
         // Cloth Constraints
         AZStd::unique_ptr<ClothConstraints> m_clothConstraints;
         AZStd::vector<AZ::Vector4> m_motionConstraints;
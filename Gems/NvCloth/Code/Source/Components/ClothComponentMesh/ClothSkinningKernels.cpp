@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+#include <MCore/Source/DualQuaternion.h>
+
+#include <Components/ClothComponentMesh/ClothSkinningKernels.h>
+
+namespace NvCloth
+{
+    namespace Internal
+    {
+        // Calls the function with ranges of packed vertices, in parallel on the job system when there
+        // are enough vertices to split in several jobs.
+        template<typename Function>
+        void ForEachVertexBatch(size_t numVertices, const Function& function)
+        {
+            if (numVertices < 2 * SkinningKernels::VerticesPerJob)
+            {
+                function(size_t(0), numVertices);
+                return;
+            }
+
+            const size_t numBatches = (numVertices + SkinningKernels::VerticesPerJob - 1) / SkinningKernels::VerticesPerJob;
+            AZ::parallel_for(size_t(0), numBatches,
+                [numVertices, &function](int batchIndex)
+                {
+                    const size_t begin = static_cast<size_t>(batchIndex) * SkinningKernels::VerticesPerJob;
+                    const size_t end = AZStd::min(begin + SkinningKernels::VerticesPerJob, numVertices);
+                    function(begin, end);
+                });
+        }
+
+        // Blends the joint matrices the same way done in GPU shaders, by adding each weighted matrix element by element.
+        // This operation results in a non orthogonal matrix, but it's done this way because it's fast to perform.
+        AZ_FORCE_INLINE AZ::Matrix3x4 BlendJointMatrices(
+            const PackedSkinningInfluences& influences,
+            size_t packedIndex,
+            const AZ::Matrix3x4* jointMatrices)
+        {
+            using AZ::Simd::Vec4;
+
+            Vec4::FloatType rows[3] = { Vec4::ZeroFloat(), Vec4::ZeroFloat(), Vec4::ZeroFloat() };
+
+            const AZ::u32 influenceEnd = influences.m_influenceOffsets[packedIndex + 1];
+            for (AZ::u32 influenceIndex = influences.m_influenceOffsets[packedIndex]; influenceIndex < influenceEnd; ++influenceIndex)
+            {
+                const Vec4::FloatType* jointRows = jointMatrices[influences.m_jointSlots[influenceIndex]].GetSimdValues();
+                const Vec4::FloatType jointWeight = Vec4::Splat(influences.m_jointWeights[influenceIndex]);
+
+                rows[0] = Vec4::Madd(jointRows[0], jointWeight, rows[0]);
+                rows[1] = Vec4::Madd(jointRows[1], jointWeight, rows[1]);
+                rows[2] = Vec4::Madd(jointRows[2], jointWeight, rows[2]);
+            }
+
+            AZ::Matrix3x4 vertexSkinningTransform;
+            Vec4::FloatType* vertexSkinningTransformRows = vertexSkinningTransform.GetSimdValues();
+            vertexSkinningTransformRows[0] = rows[0];
+            vertexSkinningTransformRows[1] = rows[1];
+            vertexSkinningTransformRows[2] = rows[2];
+            return vertexSkinningTransform;
+        }
+
+        AZ_FORCE_INLINE MCore::DualQuaternion BlendJointDualQuaternions(
+            const PackedSkinningInfluences& influences,
+            size_t packedIndex,
+            const MCore::DualQuaternion* jointDualQuaternions)
+        {
+            AZ::Quaternion real = AZ::Quaternion::CreateZero();
+            AZ::Quaternion dual = AZ::Quaternion::CreateZero();
+
+            const AZ::u32 influenceEnd = influences.m_influenceOffsets[packedIndex + 1];
+            for (AZ::u32 influenceIndex = influences.m_influenceOffsets[packedIndex]; influenceIndex < influenceEnd; ++influenceIndex)
+            {
+                const MCore::DualQuaternion& jointDualQuaternion = jointDualQuaternions[influences.m_jointSlots[influenceIndex]];
+
+                const float flip = AZ::GetSign(real.Dot(jointDualQuaternion.mReal));
+                const float jointWeight = influences.m_jointWeights[influenceIndex] * flip;
+                real += jointDualQuaternion.mReal * jointWeight;
+                dual += jointDualQuaternion.mDual * jointWeight;
+            }
+
+            // Normalizing the dual quaternion as the GPU shaders do. This will remove the scale from the transform.
+            MCore::DualQuaternion vertexSkinningTransform(real, dual);
+            vertexSkinningTransform.Normalize();
+            return vertexSkinningTransform;
+        }
+    } // namespace Internal
+
+    PackedSkinningInfluences PackedSkinningInfluences::Create(
+        const AZStd::vector<SkinningInfluence>& skinningInfluences,
+        size_t numInfluencesPerVertex,
+        const AZStd::vector<AZ::u32>& vertexIndices,
+        const AZStd::vector<AZ::u16>& jointIndices)
+    {
+        PackedSkinningInfluences packedInfluences;
+        packedInfluences.m_vertexIndices = vertexIndices;
+        packedInfluences.m_influenceOffsets.reserve(vertexIndices.size() + 1);
+        packedInfluences.m_jointSlots.reserve(vertexIndices.size() * numInfluencesPerVertex);
+        packedInfluences.m_jointWeights.reserve(vertexIndices.size() * numInfluencesPerVertex);
+
+        packedInfluences.m_influenceOffsets.push_back(0);
+        for (const AZ::u32 vertexIndex : vertexIndices)
+        {
+            for (size_t influenceIndex = 0; influenceIndex < numInfluencesPerVertex; ++influenceIndex)
+            {
+                const SkinningInfluence& skinningInfluence = skinningInfluences[vertexIndex * numInfluencesPerVertex + influenceIndex];
+                if (skinningInfluence.m_jointWeight == 0.0f)
+                {
+                    continue;
+                }
+
+                const auto jointIt = AZStd::lower_bound(jointIndices.begin(), jointIndices.end(), skinningInfluence.m_jointIndex);
+                AZ_Assert(jointIt != jointIndices.end() && *jointIt == skinningInfluence.m_jointIndex,
+                    "Joint index %u is not in the list of joints.", skinningInfluence.m_jointIndex);
+
+                packedInfluences.m_jointSlots.push_back(aznumeric_cast<AZ::u16>(AZStd::distance(jointIndices.begin(), jointIt)));
+                packedInfluences.m_jointWeights.push_back(skinningInfluence.m_jointWeight);
+            }
+            packedInfluences.m_influenceOffsets.push_back(aznumeric_cast<AZ::u32>(packedInfluences.m_jointSlots.size()));
+        }
+
+        packedInfluences.m_jointSlots.shrink_to_fit();
+        packedInfluences.m_jointWeights.shrink_to_fit();
+
+        return packedInfluences;
+    }
+
+    size_t PackedSkinningInfluences::GetNumVertices() const
+    {
+        return m_vertexIndices.size();
+    }
+
+    namespace SkinningKernels
+    {
+        void SkinPositionsLinear(
+            const PackedSkinningInfluences& influences,
+            const AZ::Matrix3x4* jointMatrices,
+            const AZ::Vector4* originalPositions,
+            AZ::Vector4* positions)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+            Internal::ForEachVertexBatch(influences.GetNumVertices(),
+                [&influences, jointMatrices, originalPositions, positions](size_t begin, size_t end)
+                {
+                    for (size_t index = begin; index < end; ++index)
+                    {
+                        const AZ::Matrix3x4 vertexSkinningTransform = Internal::BlendJointMatrices(influences, index, jointMatrices);
+
+                        const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalPositions[index].GetAsVector3();
+                        positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+                    }
+                });
+        }
+
+        void SkinVerticesLinear(
+            const PackedSkinningInfluences& influences,
+            const AZ::Matrix3x4* jointMatrices,
+            const AZ::Vector4* originalPositions,
+            const AZ::Vector3* originalNormals,
+            AZ::Vector4* positions,
+            AZ::Vector3* normals)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+            Internal::ForEachVertexBatch(influences.GetNumVertices(),
+                [&influences, jointMatrices, originalPositions, originalNormals, positions, normals](size_t begin, size_t end)
+                {
+                    for (size_t packedIndex = begin; packedIndex < end; ++packedIndex)
+                    {
+                        const AZ::u32 index = influences.m_vertexIndices[packedIndex];
+
+                        const AZ::Matrix3x4 vertexSkinningTransform = Internal::BlendJointMatrices(influences, packedIndex, jointMatrices);
+
+                        const AZ::Vector3 skinnedPosition = vertexSkinningTransform * originalPositions[index].GetAsVector3();
+                        positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+
+                        // Calculate the reciprocal scale version of the matrix to transform the normals.
+                        // Note: This operation is not strictly equivalent to the full inverse transpose when the matrix's
+                        //       basis vectors are not perpendicular, which is the case blending linearly the matrices.
+                        //       This is a fast approximation, which is also done by the GPU skinning shader.
+                        const AZ::Matrix3x4 vertexSkinningTransformReciprocalScale = vertexSkinningTransform.GetReciprocalScaled();
+
+                        normals[index] = vertexSkinningTransformReciprocalScale.TransformVector(originalNormals[index]).GetNormalized();
+                    }
+                });
+        }
+
+        void SkinPositionsDualQuaternion(
+            const PackedSkinningInfluences& influences,
+            const MCore::DualQuaternion* jointDualQuaternions,
+            const AZ::Vector4* originalPositions,
+            AZ::Vector4* positions)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+            Internal::ForEachVertexBatch(influences.GetNumVertices(),
+                [&influences, jointDualQuaternions, originalPositions, positions](size_t begin, size_t end)
+                {
+                    for (size_t index = begin; index < end; ++index)
+                    {
+                        const MCore::DualQuaternion vertexSkinningTransform =
+                            Internal::BlendJointDualQuaternions(influences, index, jointDualQuaternions);
+
+                        const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalPositions[index].GetAsVector3());
+                        positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+                    }
+                });
+        }
+
+        void SkinVerticesDualQuaternion(
+            const PackedSkinningInfluences& influences,
+            const MCore::DualQuaternion* jointDualQuaternions,
+            const AZ::Vector4* originalPositions,
+            const AZ::Vector3* originalNormals,
+            AZ::Vector4* positions,
+            AZ::Vector3* normals)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+            Internal::ForEachVertexBatch(influences.GetNumVertices(),
+                [&influences, jointDualQuaternions, originalPositions, originalNormals, positions, normals](size_t begin, size_t end)
+                {
+                    for (size_t packedIndex = begin; packedIndex < end; ++packedIndex)
+                    {
+                        const AZ::u32 index = influences.m_vertexIndices[packedIndex];
+
+                        const MCore::DualQuaternion vertexSkinningTransform =
+                            Internal::BlendJointDualQuaternions(influences, packedIndex, jointDualQuaternions);
+
+                        const AZ::Vector3 skinnedPosition = vertexSkinningTransform.TransformPoint(originalPositions[index].GetAsVector3());
+                        positions[index].Set(skinnedPosition, positions[index].GetW()); // Avoid overwriting the w component
+
+                        // The blended dual quaternion is normalized, so it has no scale and there is no need to
+                        // compute the reciprocal scale version for transforming normals.
+                        // Note: The GPU skinning shader does the same operation.
+                        normals[index] = vertexSkinningTransform.TransformVector(originalNormals[index]).GetNormalized();
+                    }
+                });
+        }
+    } // namespace SkinningKernels
+} // namespace NvCloth
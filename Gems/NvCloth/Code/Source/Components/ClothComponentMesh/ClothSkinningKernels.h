@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace MCore
+{
+    class DualQuaternion;
+}
+
+namespace NvCloth
+{
+    //! One skinning influence of a vertex.
+    struct SkinningInfluence
+    {
+        //! Weight of the joint that influences the vertex.
+        float m_jointWeight = 0.0f;
+
+        //! Index of the joint that influences the vertex.
+        AZ::u16 m_jointIndex = AZStd::numeric_limits<AZ::u16>::max();
+    };
+
+    //! Skinning influences of a list of vertices, packed as a structure of arrays in the order the vertices are skinned.
+    //! Influences with zero weight are left out, so the skinning kernels only visit the joints that move each vertex.
+    struct PackedSkinningInfluences
+    {
+        //! Packs the influences of the vertices in the order given.
+        //! @param skinningInfluences Influences of all mesh vertices, numInfluencesPerVertex consecutive influences per vertex.
+        //! @param numInfluencesPerVertex Number of influences per vertex in skinningInfluences.
+        //! @param vertexIndices Indices of the mesh vertices to pack.
+        //! @param jointIndices Sorted list of all joints used by the influences. The packed influences refer to
+        //!                     the joints by their position in this list.
+        static PackedSkinningInfluences Create(
+            const AZStd::vector<SkinningInfluence>& skinningInfluences,
+            size_t numInfluencesPerVertex,
+            const AZStd::vector<AZ::u32>& vertexIndices,
+            const AZStd::vector<AZ::u16>& jointIndices);
+
+        size_t GetNumVertices() const;
+
+        //! Index of each packed vertex in the mesh.
+        AZStd::vector<AZ::u32> m_vertexIndices;
+
+        //! The influences of packed vertex i are in the range [m_influenceOffsets[i], m_influenceOffsets[i + 1]).
+        AZStd::vector<AZ::u32> m_influenceOffsets;
+
+        //! Position in the joint list of the joint of each influence.
+        AZStd::vector<AZ::u16> m_jointSlots;
+
+        //! Weight of each influence.
+        AZStd::vector<float> m_jointWeights;
+    };
+
+    //! Skinning kernels working on packed influences.
+    //! The joint transforms are indexed by joint slot, see PackedSkinningInfluences::m_jointSlots.
+    //! Large lists of vertices are split in batches that are skinned in parallel on the job system.
+    namespace SkinningKernels
+    {
+        //! Number of vertices skinned by each job.
+        static constexpr size_t VerticesPerJob = 2048;
+
+        //! Applies linear blend skinning to a list of positions, where position i belongs to packed vertex i.
+        //! @note w components are not affected.
+        void SkinPositionsLinear(
+            const PackedSkinningInfluences& influences,
+            const AZ::Matrix3x4* jointMatrices,
+            const AZ::Vector4* originalPositions,
+            AZ::Vector4* positions);
+
+        //! Applies linear blend skinning to the positions and normals of the mesh vertices in the packed influences.
+        //! @note w components are not affected.
+        void SkinVerticesLinear(
+            const PackedSkinningInfluences& influences,
+            const AZ::Matrix3x4* jointMatrices,
+            const AZ::Vector4* originalPositions,
+            const AZ::Vector3* originalNormals,
+            AZ::Vector4* positions,
+            AZ::Vector3* normals);
+
+        //! Applies dual quaternion skinning to a list of positions, where position i belongs to packed vertex i.
+        //! @note w components are not affected.
+        void SkinPositionsDualQuaternion(
+            const PackedSkinningInfluences& influences,
+            const MCore::DualQuaternion* jointDualQuaternions,
+            const AZ::Vector4* originalPositions,
+            AZ::Vector4* positions);
+
+        //! Applies dual quaternion skinning to the positions and normals of the mesh vertices in the packed influences.
+        //! @note w components are not affected.
+        void SkinVerticesDualQuaternion(
+            const PackedSkinningInfluences& influences,
+            const MCore::DualQuaternion* jointDualQuaternions,
+            const AZ::Vector4* originalPositions,
+            const AZ::Vector3* originalNormals,
+            AZ::Vector4* positions,
+            AZ::Vector3* normals);
+    } // namespace SkinningKernels
+} // namespace NvCloth
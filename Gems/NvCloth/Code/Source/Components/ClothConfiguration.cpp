@@ -18,7 +18,7 @@ namespace NvCloth
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<ClothConfiguration>()
-                ->Version(2)
+                ->Version(3)
                 ->Field("Mesh Node", &ClothConfiguration::m_meshNode)
                 ->Field("Mass", &ClothConfiguration::m_mass)
                 ->Field("Use Custom Gravity", &ClothConfiguration::m_useCustomGravity)
@@ -71,6 +71,10 @@ namespace NvCloth
                 ->Field("Acceleration Filter Iterations", &ClothConfiguration::m_accelerationFilterIterations)
                 ->Field("Remove Static Triangles", &ClothConfiguration::m_removeStaticTriangles)
                 ->Field("Update Normals of Static Particles", &ClothConfiguration::m_updateNormalsOfStaticParticles)
+                ->Field("Simulation LOD Enabled", &ClothConfiguration::m_simulationLodEnabled)
+                ->Field("Simulation LOD Reduced Distance", &ClothConfiguration::m_simulationLodReducedDistance)
+                ->Field("Simulation LOD Reduced Solver Frequency Scale", &ClothConfiguration::m_simulationLodReducedSolverFrequencyScale)
+                ->Field("Simulation LOD Frozen Distance", &ClothConfiguration::m_simulationLodFrozenDistance)
                 ;
         }
     }
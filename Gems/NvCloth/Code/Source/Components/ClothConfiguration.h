@@ -34,6 +34,7 @@ namespace NvCloth
 
         bool IsUsingWorldBusGravity() const { return !m_useCustomGravity; }
         bool IsUsingWindBus() const { return !m_useCustomWindVelocity; }
+        bool IsSimulationLodDisabled() const { return !m_simulationLodEnabled; }
 
         AZStd::string m_meshNode;
 
@@ -94,6 +95,12 @@ namespace NvCloth
         bool m_removeStaticTriangles = true;
         bool m_updateNormalsOfStaticParticles = false;
 
+        // Simulation LOD parameters (distances to the active camera)
+        bool m_simulationLodEnabled = false;
+        float m_simulationLodReducedDistance = 15.0f;
+        float m_simulationLodReducedSolverFrequencyScale = 0.5f;
+        float m_simulationLodFrozenDistance = 40.0f;
+
         // Fabric phases parameters
         float m_horizontalStiffness = 1.0f;
         float m_horizontalStiffnessMultiplier = 0.0f;
@@ -379,6 +379,28 @@ namespace NvCloth
                     ->DataElement(AZ::Edit::UIHandlers::Default, &ClothConfiguration::m_updateNormalsOfStaticParticles, "Update normals of static particles",
                         "When enabled the normals of static particles will be updated according with the movement of the simulated mesh.\n"
                         "When disabled the static particles will keep the same normals as the original mesh.")
+
+                    // Simulation LOD
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Simulation LOD")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ClothConfiguration::m_simulationLodEnabled, "Enable simulation LOD",
+                        "When enabled the simulation quality is reduced based on the distance from the cloth to the active camera.")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ClothConfiguration::m_simulationLodReducedDistance, "Reduced distance",
+                        "Distance to the active camera beyond which the solver frequency is reduced.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                        ->Attribute(AZ::Edit::Attributes::ReadOnly, &ClothConfiguration::IsSimulationLodDisabled)
+                    ->DataElement(AZ::Edit::UIHandlers::Slider, &ClothConfiguration::m_simulationLodReducedSolverFrequencyScale, "Reduced solver frequency scale",
+                        "Scale applied to the solver frequency while the cloth is beyond the reduced distance.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                        ->Attribute(AZ::Edit::Attributes::Max, 1.0f)
+                        ->Attribute(AZ::Edit::Attributes::ReadOnly, &ClothConfiguration::IsSimulationLodDisabled)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ClothConfiguration::m_simulationLodFrozenDistance, "Frozen distance",
+                        "Distance to the active camera beyond which the cloth is not simulated. The cloth keeps its last simulated shape, "
+                        "following the skinning of the actor if there is one.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                        ->Attribute(AZ::Edit::Attributes::ReadOnly, &ClothConfiguration::IsSimulationLodDisabled)
                     ;
             }
         }
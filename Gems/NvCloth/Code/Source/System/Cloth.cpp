@@ -236,6 +236,16 @@ namespace NvCloth
         return m_fabric->m_cookedData;
     }
 
+    void Cloth::SetFrozen(bool frozen)
+    {
+        m_frozen = frozen;
+    }
+
+    bool Cloth::IsFrozen() const
+    {
+        return m_frozen;
+    }
+
     IClothConfigurator* Cloth::GetClothConfigurator()
     {
         return this;
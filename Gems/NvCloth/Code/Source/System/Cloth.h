@@ -56,6 +56,8 @@ namespace NvCloth
         void SetParticles(AZStd::vector<SimParticleFormat>&& particles) override;
         void DiscardParticleDelta() override;
         const FabricCookedData& GetFabricCookedData() const override;
+        void SetFrozen(bool frozen) override;
+        bool IsFrozen() const override;
         IClothConfigurator* GetClothConfigurator() override;
 
         // IClothConfigurator overrides ...
@@ -171,12 +173,19 @@ namespace NvCloth
         // and would wake the simulation.
         AZStd::vector<AZ::Vector4> m_motionConstraints;
 
+        // When true, the solver skips this cloth.
+        bool m_frozen = false;
+
+        // When true, the cloth has been taken out of the NvCloth solver because it's frozen.
+        // Managed by the solver, which applies the frozen state when it starts a simulation.
+        bool m_removedFromNvSolver = false;
+
         // Number of continuous invalid simulations.
         // That's when NvCloth provided invalid data when retrieving simulation results.
         AZ::u32 m_numInvalidSimulations = 0;
 
         // Solver has the responsibility of adding/removing cloths to solvers,
-        // so it needs exclusive access to m_solver and m_nvCloth members.
+        // so it needs exclusive access to m_solver, m_nvCloth and m_removedFromNvSolver members.
         friend class Solver;
     };
 } // namespace NvCloth
@@ -9,6 +9,7 @@
 #include <System/Solver.h>
 #include <System/Cloth.h>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Jobs/JobFunction.h>
 
 // NvCloth library includes
@@ -76,6 +77,11 @@ namespace NvCloth
         return m_cloths.size();
     }
 
+    const Solver::SimulationStats& Solver::GetSimulationStats() const
+    {
+        return m_simulationStats;
+    }
+
     const AZStd::string& Solver::GetName() const
     {
         return m_name;
@@ -103,6 +109,11 @@ namespace NvCloth
 
     void Solver::StartSimulation(float deltaTime)
     {
+        if (!m_isSimulating)
+        {
+            m_simulationStats = SimulationStats();
+        }
+
         if (!IsEnabled() || m_cloths.empty())
         {
             return;
@@ -114,30 +125,43 @@ namespace NvCloth
 
         m_deltaTime = deltaTime;
         m_simulationCompletion.Reset(true /*isClearDependent*/);
+        m_simulationTimePoints.m_preSimulationStart = AZStd::chrono::system_clock::now();
 
         m_preSimulationEvent.Signal(m_name, deltaTime);
 
         // Set isSimulating flag after the pre-simulation event is sent in case if there are handlers adding/removing cloth from the solver.
         m_isSimulating = true;
 
+        UpdateSimulatedCloths();
+
         // Setup the chain of jobs for the simulation pass
 
-        // Post simulation jobs will unlock the entire simulation pass completion.
-        ClothsPostSimulationJob* clothsPostSimulationJob = aznew ClothsPostSimulationJob(&m_cloths, m_deltaTime, &m_simulationCompletion);
-        clothsPostSimulationJob->SetDependent(&m_simulationCompletion);
+        // The end job records when the simulation pass finished and unlocks its completion.
+        AZ::Job* simulationEndJob = AZ::CreateJobFunction([endTime = &m_simulationTimePoints.m_postSimulationEnd]
+        {
+            *endTime = AZStd::chrono::system_clock::now();
+        }, true /*isAutoDelete*/);
+        simulationEndJob->SetDependent(&m_simulationCompletion);
+
+        // Post simulation jobs will unlock the end job.
+        ClothsPostSimulationJob* clothsPostSimulationJob = aznew ClothsPostSimulationJob(
+            &m_simulatedCloths, m_deltaTime, &m_simulationTimePoints.m_postSimulationStart, simulationEndJob);
+        clothsPostSimulationJob->SetDependent(simulationEndJob);
 
         // Simulation jobs will unlock the post simulation job.
-        ClothsSimulationJob* clothsSimulationJob = aznew ClothsSimulationJob(m_nvSolver.get(), m_deltaTime, clothsPostSimulationJob);
+        ClothsSimulationJob* clothsSimulationJob = aznew ClothsSimulationJob(
+            m_nvSolver.get(), m_deltaTime, &m_simulationTimePoints.m_simulationStart, clothsPostSimulationJob);
         clothsSimulationJob->SetDependent(clothsPostSimulationJob);
 
         // Pre-simulation jobs will unlock the simulation job.
-        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_cloths, m_deltaTime, clothsSimulationJob);
+        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_simulatedCloths, m_deltaTime, clothsSimulationJob);
         clothsPreSimulationJob->SetDependent(clothsSimulationJob);
 
         // Start the jobs.
         clothsPreSimulationJob->Start();
         clothsSimulationJob->Start();
         clothsPostSimulationJob->Start();
+        simulationEndJob->Start();
     }
 
     void Solver::FinishSimulation()
@@ -153,6 +177,18 @@ namespace NvCloth
         m_simulationCompletion.StartAndWaitForCompletion();
         m_isSimulating = false;
 
+        const auto toMilliseconds = [](TimePoint::duration duration)
+        {
+            return AZStd::chrono::duration<float, AZStd::chrono::milliseconds::period>(duration).count();
+        };
+        m_simulationStats.m_preSimulationTimeMs =
+            toMilliseconds(m_simulationTimePoints.m_simulationStart - m_simulationTimePoints.m_preSimulationStart);
+        m_simulationStats.m_simulationTimeMs =
+            toMilliseconds(m_simulationTimePoints.m_postSimulationStart - m_simulationTimePoints.m_simulationStart);
+        m_simulationStats.m_postSimulationTimeMs =
+            toMilliseconds(m_simulationTimePoints.m_postSimulationEnd - m_simulationTimePoints.m_postSimulationStart);
+        m_simulationStats.m_numSimulatedCloths = aznumeric_cast<AZ::u32>(m_simulatedCloths.size());
+
         m_postSimulationEvent.Signal(m_name, m_deltaTime);
     }
 
@@ -174,16 +210,50 @@ namespace NvCloth
     // Note: Requires a valid cloth iterator that does not point to end()
     void Solver::RemoveClothInternal(Cloths::iterator clothIt)
     {
-        m_nvSolver->removeCloth((*clothIt)->m_nvCloth.get());
+        if (!(*clothIt)->m_removedFromNvSolver)
+        {
+            m_nvSolver->removeCloth((*clothIt)->m_nvCloth.get());
+        }
 
         (*clothIt)->m_solver = nullptr;
+        (*clothIt)->m_removedFromNvSolver = false;
 
         m_cloths.erase(clothIt);
     }
 
-    Solver::ClothsSimulationJob::ClothsSimulationJob(nv::cloth::Solver* solver, float deltaTime,
+    void Solver::UpdateSimulatedCloths()
+    {
+        m_simulatedCloths.clear();
+
+        for (Cloth* cloth : m_cloths)
+        {
+            const bool frozen = cloth->IsFrozen();
+
+            // Frozen cloths are taken out of the NvCloth solver so they don't cost any simulation time.
+            if (frozen != cloth->m_removedFromNvSolver)
+            {
+                if (frozen)
+                {
+                    m_nvSolver->removeCloth(cloth->m_nvCloth.get());
+                }
+                else
+                {
+                    m_nvSolver->addCloth(cloth->m_nvCloth.get());
+                }
+                cloth->m_removedFromNvSolver = frozen;
+            }
+
+            if (!frozen)
+            {
+                m_simulatedCloths.push_back(cloth);
+            }
+        }
+    }
+
+    Solver::ClothsSimulationJob::ClothsSimulationJob(nv::cloth::Solver* solver, float deltaTime, TimePoint* startTime,
         AZ::Job* continuationJob, AZ::JobContext* context) : Job(true /*isAutoDelete*/, context)
         , m_solver(solver)
+        , m_startTime(startTime)
         , m_continuationJob(continuationJob)
         , m_deltaTime(deltaTime)
     {
@@ -193,6 +263,8 @@ namespace NvCloth
     {
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Cloth, "NvCloth::BeginSimulationJob");
 
+        *m_startTime = AZStd::chrono::system_clock::now();
+
         if (m_solver->beginSimulation(m_deltaTime))
         {
             // Setup the end simulation job.
@@ -227,9 +299,10 @@ namespace NvCloth
         // This is expected behavior.
     }
 
-    Solver::ClothsPostSimulationJob::ClothsPostSimulationJob(const Cloths* cloths, float deltaTime,
+    Solver::ClothsPostSimulationJob::ClothsPostSimulationJob(const Cloths* cloths, float deltaTime, TimePoint* startTime,
         AZ::Job* continuationJob, AZ::JobContext* context) : Job(true /*isAutoDelete*/, context)
         , m_cloths(cloths)
+        , m_startTime(startTime)
         , m_continuationJob(continuationJob)
         , m_deltaTime(deltaTime)
     {
@@ -237,6 +310,8 @@ namespace NvCloth
 
     void Solver::ClothsPostSimulationJob::Process()
     {
+        *m_startTime = AZStd::chrono::system_clock::now();
+
         for (Cloth* cloth : *m_cloths)
         {
             AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloth, deltaTime = m_deltaTime]
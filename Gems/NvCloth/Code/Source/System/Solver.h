@@ -11,6 +11,7 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <NvCloth/ISolver.h>
@@ -25,12 +26,24 @@ namespace NvCloth
     //!
     //! When enabled, it runs the simulation on all its cloths and sends
     //! notifications before and after the simulation has been executed.
+    //! The simulation pass is a chain of jobs: per-cloth pre-simulation jobs,
+    //! the NvCloth simulation split in chunks and per-cloth post-simulation jobs.
+    //! Frozen cloths are left out of the simulation pass.
     class Solver
         : public ISolver
     {
     public:
         AZ_RTTI(Solver, "{111055FC-F590-4BCD-A7B9-D96B1C44E3E8}", ISolver);
 
+        //! Statistics of the last simulation pass.
+        struct SimulationStats
+        {
+            float m_preSimulationTimeMs = 0.0f; //!< Time from starting the simulation until all pre-simulation events were handled.
+            float m_simulationTimeMs = 0.0f; //!< Time NvCloth took to simulate the cloths.
+            float m_postSimulationTimeMs = 0.0f; //!< Time to retrieve the simulation results and handle all post-simulation events.
+            AZ::u32 m_numSimulatedCloths = 0; //!< Number of cloths simulated, frozen cloths are not included.
+        };
+
         Solver(const AZStd::string& name, NvSolverUniquePtr nvSolver);
         ~Solver();
 
@@ -38,6 +51,10 @@ namespace NvCloth
         void RemoveCloth(Cloth* cloth);
         size_t GetNumCloths() const;
 
+        //! Returns the statistics of the last finished simulation pass.
+        //! They are reset when starting a simulation that doesn't run because the solver is disabled or empty.
+        const SimulationStats& GetSimulationStats() const;
+
         // ISolver overrides ...
         const AZStd::string& GetName() const override;
         void Enable(bool value) override;
@@ -52,6 +69,16 @@ namespace NvCloth
 
     private:
         using Cloths = AZStd::vector<Cloth*>;
+        using TimePoint = AZStd::chrono::system_clock::time_point;
+
+        // Time points of the stages of a simulation pass, written by the jobs running each stage.
+        struct SimulationTimePoints
+        {
+            TimePoint m_preSimulationStart;
+            TimePoint m_simulationStart;
+            TimePoint m_postSimulationStart;
+            TimePoint m_postSimulationEnd;
+        };
 
         class ClothsPreSimulationJob
             : public AZ::Job
@@ -81,7 +108,7 @@ namespace NvCloth
         public:
             AZ_CLASS_ALLOCATOR(Solver::ClothsSimulationJob, AZ::ThreadPoolAllocator, 0)
 
-            ClothsSimulationJob(nv::cloth::Solver* solver, float deltaTime,
+            ClothsSimulationJob(nv::cloth::Solver* solver, float deltaTime, TimePoint* startTime,
                 AZ::Job* continuationJob, AZ::JobContext* context = nullptr);
 
             void Process() override;
@@ -90,6 +117,9 @@ namespace NvCloth
             // NvCloth solver object to simulate.
             nv::cloth::Solver* m_solver = nullptr;
 
+            // Where to record the time the simulation starts.
+            TimePoint* m_startTime = nullptr;
+
             // The job to run after all simulation jobs are completed.
             AZ::Job* m_continuationJob = nullptr;
 
@@ -103,7 +133,7 @@ namespace NvCloth
         public:
             AZ_CLASS_ALLOCATOR(ClothsPostSimulationJob, AZ::ThreadPoolAllocator, 0);
 
-            ClothsPostSimulationJob(const Cloths* cloths, float deltaTime,
+            ClothsPostSimulationJob(const Cloths* cloths, float deltaTime, TimePoint* startTime,
                 AZ::Job* continuationJob, AZ::JobContext* context = nullptr);
 
             void Process() override;
@@ -112,6 +142,9 @@ namespace NvCloth
             // List of cloths to do the post-simulation work for.
             const Cloths* m_cloths = nullptr;
 
+            // Where to record the time the post-simulation work starts.
+            TimePoint* m_startTime = nullptr;
+
             // The job to run after all post-simulation jobs are completed.
             AZ::Job* m_continuationJob = nullptr;
 
@@ -121,6 +154,10 @@ namespace NvCloth
 
         void RemoveClothInternal(Cloths::iterator clothIt);
 
+        // Takes frozen cloths out of the NvCloth solver, adds back the ones unfrozen
+        // and collects the cloths to simulate in m_simulatedCloths.
+        void UpdateSimulatedCloths();
+
         // Name of the solver.
         AZStd::string m_name;
 
@@ -136,6 +173,9 @@ namespace NvCloth
         // List of Cloth instances added to this solver.
         Cloths m_cloths;
 
+        // List of Cloth instances simulated in the current simulation pass.
+        Cloths m_simulatedCloths;
+
         // Stored delta time during the simulation.
         float m_deltaTime = 0.0f;
 
@@ -144,6 +184,12 @@ namespace NvCloth
 
         // Simulation synchronization job
         AZ::JobCompletion m_simulationCompletion;
+
+        // Time points of the stages of the current simulation pass.
+        SimulationTimePoints m_simulationTimePoints;
+
+        // Statistics of the last finished simulation pass.
+        SimulationStats m_simulationStats;
     };
 
 } // namespace NvCloth
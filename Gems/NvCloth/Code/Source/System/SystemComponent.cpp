@@ -405,14 +405,37 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
+        // Start the simulation jobs of all solvers before waiting for any of them,
+        // so the solvers are simulated in parallel instead of one after another.
+        m_simulatingSolvers.clear();
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
-                solverIt->FinishSimulation();
+                m_simulatingSolvers.push_back(solverIt.get());
             }
         }
+
+        AZ::s64 preSimulationTimeUs = 0;
+        AZ::s64 simulationTimeUs = 0;
+        AZ::s64 postSimulationTimeUs = 0;
+        AZ::s64 numSimulatedCloths = 0;
+        for (Solver* solver : m_simulatingSolvers)
+        {
+            solver->FinishSimulation();
+
+            const Solver::SimulationStats& stats = solver->GetSimulationStats();
+            preSimulationTimeUs += static_cast<AZ::s64>(stats.m_preSimulationTimeMs * 1000.0f);
+            simulationTimeUs += static_cast<AZ::s64>(stats.m_simulationTimeMs * 1000.0f);
+            postSimulationTimeUs += static_cast<AZ::s64>(stats.m_postSimulationTimeMs * 1000.0f);
+            numSimulatedCloths += stats.m_numSimulatedCloths;
+        }
+        m_simulatingSolvers.clear();
+
+        // Time of each stage summed over all solvers, in microseconds.
+        AZ_PROFILE_VALUE_SET("Cloth", "NvCloth::SimulationStages",
+            preSimulationTimeUs, simulationTimeUs, postSimulationTimeUs, numSimulatedCloths);
     }
 
     int SystemComponent::GetTickOrder()
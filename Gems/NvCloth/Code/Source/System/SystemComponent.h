@@ -27,6 +27,7 @@ namespace NvCloth
     //! This class has the responsibility to initialize and tear down NvCloth library.
     //! It owns all Solvers, Cloths and Fabrics, and it manages their creation and destruction.
     //! It's also the responsible for updating (on Physics Tick) all the solvers that are not flagged as "user simulated".
+    //! The solvers are simulated concurrently: all of them are started before waiting for any to finish.
     class SystemComponent
         : public AZ::Component
         , protected IClothSystem
@@ -84,6 +85,9 @@ namespace NvCloth
         // List of all the solvers created.
         AZStd::vector<AZStd::unique_ptr<Solver>> m_solvers;
 
+        // Solvers being simulated during the tick.
+        AZStd::vector<Solver*> m_simulatingSolvers;
+
         // List of all the fabrics created.
         AZStd::unordered_map<FabricId, AZStd::unique_ptr<Fabric>> m_fabrics;
 
@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/Jobs/Algorithms.h>
+
 #include <System/TangentSpaceHelper.h>
 
 namespace NvCloth
@@ -13,6 +15,31 @@ namespace NvCloth
     namespace
     {
         const float Tolerance = 1e-7f;
+
+        // Number of triangles and vertices processed by each job.
+        const size_t TrianglesPerJob = 1024;
+        const size_t VerticesPerJob = 2048;
+
+        // Calls the function with ranges of elements, in parallel on the job system
+        // when there are enough elements to split in several jobs.
+        template<typename Function>
+        void ForEachBatch(size_t count, size_t countPerJob, const Function& function)
+        {
+            if (count < 2 * countPerJob)
+            {
+                function(size_t(0), count);
+                return;
+            }
+
+            const size_t numBatches = (count + countPerJob - 1) / countPerJob;
+            AZ::parallel_for(size_t(0), numBatches,
+                [count, countPerJob, &function](int batchIndex)
+                {
+                    const size_t begin = static_cast<size_t>(batchIndex) * countPerJob;
+                    const size_t end = AZStd::min(begin + countPerJob, count);
+                    function(begin, end);
+                });
+        }
     }
 
     bool TangentSpaceHelper::CalculateNormals(
@@ -37,43 +64,58 @@ namespace NvCloth
         outNormals.resize(vertexCount);
         AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
 
-        // calculate the normals per triangle
+        // calculate the normals per triangle, triangles are independent so they are processed in parallel.
+        AZStd::vector<TriangleBase> triangleBases(triangleCount);
+        ForEachBatch(triangleCount, TrianglesPerJob,
+            [this, &vertices, &indices, &triangleBases](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    GetTriangleData(
+                        i, indices, vertices,
+                        triangleIndices, trianglePositions, triangleEdges);
+
+                    TriangleBase& triangleBase = triangleBases[i];
+                    ComputeNormal(triangleEdges, triangleBase.m_normal);
+                    ComputeVertexWeightsInTriangle(trianglePositions, triangleBase.m_weights);
+                }
+            });
+
+        // distribute the normals to the vertices.
+        // This is done serially in triangle order, which keeps the results deterministic.
         for (size_t i = 0; i < triangleCount; ++i)
         {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            GetTriangleData(
-                i, indices, vertices,
-                triangleIndices, trianglePositions, triangleEdges);
-
-            AZ::Vector3 normal;
-            ComputeNormal(triangleEdges, normal);
-
-            // distribute the normals to the vertices.
+            const TriangleBase& triangleBase = triangleBases[i];
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+                const SimIndexType vertexIndex = indices[i * 3 + vertexIndexInTriangle];
+                const float weight = triangleBase.m_weights[vertexIndexInTriangle];
 
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
+                outNormals[vertexIndex] += triangleBase.m_normal * AZStd::max(weight, Tolerance);
             }
         }
 
         // adjust the normals per vertex
-        for (auto& outNormal : outNormals)
-        {
-            outNormal.NormalizeSafe(Tolerance);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outNormal.IsFinite())
+        ForEachBatch(vertexCount, VerticesPerJob,
+            [&outNormals](size_t begin, size_t end)
             {
-                outNormal = AZ::Vector3::CreateAxisZ();
-            }
-        }
+                for (size_t i = begin; i < end; ++i)
+                {
+                    AZ::Vector3& outNormal = outNormals[i];
+                    outNormal.NormalizeSafe(Tolerance);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!outNormal.IsFinite())
+                    {
+                        outNormal = AZ::Vector3::CreateAxisZ();
+                    }
+                }
+            });
 
         return true;
     }
@@ -121,47 +163,61 @@ namespace NvCloth
         AZStd::fill(outTangents.begin(), outTangents.end(), AZ::Vector3::CreateZero());
         AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
 
-        // calculate the base vectors per triangle
+        // calculate the base vectors per triangle, triangles are independent so they are processed in parallel.
+        AZStd::vector<TriangleBase> triangleBases(triangleCount);
+        ForEachBatch(triangleCount, TrianglesPerJob,
+            [this, &vertices, &indices, &uvs, &triangleBases](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    TriangleUVs triangleUVs;
+                    GetTriangleData(
+                        i, indices, vertices, uvs,
+                        triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+
+                    TriangleBase& triangleBase = triangleBases[i];
+                    ComputeTangentAndBitangent(triangleUVs, triangleEdges, triangleBase.m_tangent, triangleBase.m_bitangent);
+                    ComputeVertexWeightsInTriangle(trianglePositions, triangleBase.m_weights);
+                }
+            });
+
+        // distribute the uv vectors to the vertices.
+        // This is done serially in triangle order, which keeps the results deterministic.
         for (size_t i = 0; i < triangleCount; ++i)
         {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
-
-            AZ::Vector3 tangent, bitangent;
-            ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
-
-            // distribute the uv vectors to the vertices.
+            const TriangleBase& triangleBase = triangleBases[i];
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+                const SimIndexType vertexIndex = indices[i * 3 + vertexIndexInTriangle];
+                const float weight = triangleBase.m_weights[vertexIndexInTriangle];
 
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
+                outTangents[vertexIndex] += triangleBase.m_tangent * weight;
+                outBitangents[vertexIndex] += triangleBase.m_bitangent * weight;
             }
         }
 
         // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
-        {
-            AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outTangents[i].IsFinite() ||
-                !outBitangents[i].IsFinite())
+        ForEachBatch(vertexCount, VerticesPerJob,
+            [this, &normals, &outTangents, &outBitangents](size_t begin, size_t end)
             {
-                outTangents[i] = AZ::Vector3::CreateAxisX();
-                outBitangents[i] = AZ::Vector3::CreateAxisY();
-            }
-        }
+                for (size_t i = begin; i < end; ++i)
+                {
+                    AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!outTangents[i].IsFinite() ||
+                        !outBitangents[i].IsFinite())
+                    {
+                        outTangents[i] = AZ::Vector3::CreateAxisX();
+                        outBitangents[i] = AZ::Vector3::CreateAxisY();
+                    }
+                }
+            });
 
         return true;
     }
@@ -203,64 +259,78 @@ namespace NvCloth
         AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
         AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
 
-        // calculate the base vectors per triangle
+        // calculate the base vectors per triangle, triangles are independent so they are processed in parallel.
+        AZStd::vector<TriangleBase> triangleBases(triangleCount);
+        ForEachBatch(triangleCount, TrianglesPerJob,
+            [this, &vertices, &indices, &uvs, &triangleBases](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    TriangleIndices triangleIndices;
+                    TrianglePositions trianglePositions;
+                    TriangleEdges triangleEdges;
+                    TriangleUVs triangleUVs;
+                    GetTriangleData(
+                        i, indices, vertices, uvs,
+                        triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+
+                    TriangleBase& triangleBase = triangleBases[i];
+                    if (ComputeNormal(triangleEdges, triangleBase.m_normal))
+                    {
+                        ComputeTangentAndBitangent(triangleUVs, triangleEdges, triangleBase.m_tangent, triangleBase.m_bitangent);
+                    }
+                    else
+                    {
+                        // Use the identity base with low influence to leave other valid triangles to
+                        // affect these vertices. In case no other triangle affects the vertices the base
+                        // will still be valid with identity values as it gets normalized later.
+                        const float identityInfluence = 0.01f;
+                        triangleBase.m_tangent = AZ::Vector3::CreateAxisX(identityInfluence);
+                        triangleBase.m_bitangent = AZ::Vector3::CreateAxisY(identityInfluence);
+                    }
+                    ComputeVertexWeightsInTriangle(trianglePositions, triangleBase.m_weights);
+                }
+            });
+
+        // distribute the normals and uv vectors to the vertices.
+        // This is done serially in triangle order, which keeps the results deterministic.
         for (size_t i = 0; i < triangleCount; ++i)
         {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
-
-            AZ::Vector3 tangent, bitangent, normal;
-            if (ComputeNormal(triangleEdges, normal))
-            {
-                ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
-            }
-            else
-            {
-                // Use the identity base with low influence to leave other valid triangles to
-                // affect these vertices. In case no other triangle affects the vertices the base
-                // will still be valid with identity values as it gets normalized later.
-                const float identityInfluence = 0.01f;
-                tangent = AZ::Vector3::CreateAxisX(identityInfluence);
-                bitangent = AZ::Vector3::CreateAxisY(identityInfluence);
-            }
-
-            // distribute the normals and uv vectors to the vertices.
+            const TriangleBase& triangleBase = triangleBases[i];
             for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                const SimIndexType vertexIndex = indices[i * 3 + vertexIndexInTriangle];
+                const float weight = triangleBase.m_weights[vertexIndexInTriangle];
 
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
-
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
+                outNormals[vertexIndex] += triangleBase.m_normal * AZStd::max(weight, Tolerance);
+                outTangents[vertexIndex] += triangleBase.m_tangent * weight;
+                outBitangents[vertexIndex] += triangleBase.m_bitangent * weight;
             }
         }
 
         // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
-        {
-            outNormals[i].NormalizeSafe(Tolerance);
-
-            AdjustTangentAndBitangent(outNormals[i], outTangents[i], outBitangents[i]);
-
-            // Safety check for situations where simulation gets out of control.
-            // Particles' positions can have huge floating point values that
-            // could lead to non-finite numbers when calculating tangent spaces.
-            if (!outNormals[i].IsFinite() ||
-                !outTangents[i].IsFinite() ||
-                !outBitangents[i].IsFinite())
+        ForEachBatch(vertexCount, VerticesPerJob,
+            [this, &outTangents, &outBitangents, &outNormals](size_t begin, size_t end)
             {
-                outTangents[i] = AZ::Vector3::CreateAxisX();
-                outBitangents[i] = AZ::Vector3::CreateAxisY();
-                outNormals[i] = AZ::Vector3::CreateAxisZ();
-            }
-        }
+                for (size_t i = begin; i < end; ++i)
+                {
+                    outNormals[i].NormalizeSafe(Tolerance);
+
+                    AdjustTangentAndBitangent(outNormals[i], outTangents[i], outBitangents[i]);
+
+                    // Safety check for situations where simulation gets out of control.
+                    // Particles' positions can have huge floating point values that
+                    // could lead to non-finite numbers when calculating tangent spaces.
+                    if (!outNormals[i].IsFinite() ||
+                        !outTangents[i].IsFinite() ||
+                        !outBitangents[i].IsFinite())
+                    {
+                        outTangents[i] = AZ::Vector3::CreateAxisX();
+                        outBitangents[i] = AZ::Vector3::CreateAxisY();
+                        outNormals[i] = AZ::Vector3::CreateAxisZ();
+                    }
+                }
+            });
 
         return true;
     }
@@ -382,6 +452,14 @@ namespace NvCloth
         bitangent = normal.Cross(tangent) * handedness;
     }
 
+    void TangentSpaceHelper::ComputeVertexWeightsInTriangle(const TrianglePositions& trianglePositions, AZStd::array<float, 3>& weights)
+    {
+        for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+        {
+            weights[vertexIndexInTriangle] = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+        }
+    }
+
     float TangentSpaceHelper::GetVertexWeightInTriangle(AZ::u32 vertexIndexInTriangle, const TrianglePositions& trianglePositions)
     {
         // weight by angle to fix the L-Shape problem
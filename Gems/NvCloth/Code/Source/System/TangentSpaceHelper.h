@@ -50,6 +50,16 @@ namespace NvCloth
         using TriangleUVs = AZStd::array<SimUVType, 3>;
         using TriangleEdges = AZStd::array<AZ::Vector3, 2>;
 
+        //! Base vectors of a triangle and the weights of its vertices, computed in parallel for
+        //! all triangles before they are accumulated into the vertices.
+        struct TriangleBase
+        {
+            AZ::Vector3 m_normal = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_tangent = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_bitangent = AZ::Vector3::CreateZero();
+            AZStd::array<float, 3> m_weights = {{ 0.0f, 0.0f, 0.0f }};
+        };
+
         void GetTriangleData(
             size_t triangleIndex,
             const AZStd::vector<SimIndexType>& indices,
@@ -77,6 +87,8 @@ namespace NvCloth
         void AdjustTangentAndBitangent(
             const AZ::Vector3& normal, AZ::Vector3& tangent, AZ::Vector3& bitangent);
 
+        void ComputeVertexWeightsInTriangle(const TrianglePositions& trianglePositions, AZStd::array<float, 3>& weights);
+
         float GetVertexWeightInTriangle(AZ::u32 vertexIndexInTriangle, const TrianglePositions& trianglePositions);
     };
 } // namespace NvCloth
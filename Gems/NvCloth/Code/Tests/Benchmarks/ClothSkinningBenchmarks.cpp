@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <MCore/Source/DualQuaternion.h>
+
+#include <Components/ClothComponentMesh/ClothSkinningKernels.h>
+#include <System/TangentSpaceHelper.h>
+
+#include <SkinningInputHelper.h>
+#include <TriangleInputHelper.h>
+
+namespace NvCloth::Benchmarks
+{
+    namespace SkinningConstants
+    {
+        //! Number of joints in the skeleton of the garment, every other joint influences the mesh.
+        static const AZ::u16 NumJoints = 64;
+
+        static const size_t NumInfluencesPerVertex = 4;
+
+        //! Flags to select the skinning method.
+        static const int LinearSkinning = 0;
+        static const int DualQuaternionSkinning = 1;
+    } // namespace SkinningConstants
+
+    //! Creates a garment mesh from a plane with state.range(0) x state.range(0) segments, skinned to a procedural skeleton.
+    //! Starts its own job manager, so the skinning kernels and the tangent space helper can spread the work over all cores.
+    //! Benchmark fixtures get constructed during static initialization, before any allocator exists, so everything
+    //! is created in SetUp().
+    class ClothSkinningBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (AZ::u32 i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobManagerDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            m_tangentSpaceHelper = AZStd::make_unique<TangentSpaceHelper>();
+
+            const AZ::u32 segments = aznumeric_cast<AZ::u32>(state.range(0));
+            m_garment = AZStd::make_unique<UnitTest::TriangleInput>(UnitTest::CreatePlane(1.0f, 1.5f, segments, segments));
+
+            const size_t numVertices = m_garment->m_vertices.size();
+            m_skinning = AZStd::make_unique<UnitTest::SkinningInput>(UnitTest::CreateSkinningInput(
+                numVertices, SkinningConstants::NumInfluencesPerVertex, SkinningConstants::NumJoints, true));
+
+            AZStd::vector<AZ::u32> vertexIndices(numVertices);
+            for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+            {
+                vertexIndices[vertexIndex] = aznumeric_cast<AZ::u32>(vertexIndex);
+            }
+            m_packedInfluences = AZStd::make_unique<PackedSkinningInfluences>(PackedSkinningInfluences::Create(
+                m_skinning->m_skinningInfluences, m_skinning->m_numInfluencesPerVertex, vertexIndices, m_skinning->m_jointIndices));
+
+            m_jointMatrices = AZStd::make_unique<AZStd::vector<AZ::Matrix3x4>>();
+            m_jointDualQuaternions = AZStd::make_unique<AZStd::vector<MCore::DualQuaternion>>();
+            for (const AZ::u16 jointIndex : m_skinning->m_jointIndices)
+            {
+                m_jointMatrices->push_back(m_skinning->m_skinningMatrices[jointIndex]);
+                m_jointDualQuaternions->emplace_back(AZ::Transform::CreateFromMatrix3x4(m_skinning->m_skinningMatrices[jointIndex]));
+            }
+
+            m_skinnedParticles = AZStd::make_unique<AZStd::vector<SimParticleFormat>>(m_garment->m_vertices);
+            m_normals = AZStd::make_unique<AZStd::vector<AZ::Vector3>>();
+            m_tangents = AZStd::make_unique<AZStd::vector<AZ::Vector3>>();
+            m_bitangents = AZStd::make_unique<AZStd::vector<AZ::Vector3>>();
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_bitangents.reset();
+            m_tangents.reset();
+            m_normals.reset();
+            m_skinnedParticles.reset();
+            m_jointDualQuaternions.reset();
+            m_jointMatrices.reset();
+            m_packedInfluences.reset();
+            m_skinning.reset();
+            m_garment.reset();
+            m_tangentSpaceHelper.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+        }
+
+    protected:
+        void ApplySkinning(int skinningMethod)
+        {
+            if (skinningMethod == SkinningConstants::LinearSkinning)
+            {
+                SkinningKernels::SkinPositionsLinear(
+                    *m_packedInfluences, m_jointMatrices->data(), m_garment->m_vertices.data(), m_skinnedParticles->data());
+            }
+            else
+            {
+                SkinningKernels::SkinPositionsDualQuaternion(
+                    *m_packedInfluences, m_jointDualQuaternions->data(), m_garment->m_vertices.data(), m_skinnedParticles->data());
+            }
+        }
+
+        //! Skins every vertex by walking all of its influences and looking up the joints in the skeleton,
+        //! which is how the skinning was done before the influences were packed.
+        void ApplyPerVertexSkinning(int skinningMethod)
+        {
+            const size_t numInfluencesPerVertex = m_skinning->m_numInfluencesPerVertex;
+            const size_t numVertices = m_garment->m_vertices.size();
+            for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+            {
+                const SkinningInfluence* vertexInfluences = &m_skinning->m_skinningInfluences[vertexIndex * numInfluencesPerVertex];
+                const AZ::Vector3 originalPosition = m_garment->m_vertices[vertexIndex].GetAsVector3();
+
+                AZ::Vector3 skinnedPosition;
+                if (skinningMethod == SkinningConstants::LinearSkinning)
+                {
+                    AZ::Matrix3x4 vertexSkinningTransform = AZ::Matrix3x4::CreateZero();
+                    for (size_t influenceIndex = 0; influenceIndex < numInfluencesPerVertex; ++influenceIndex)
+                    {
+                        vertexSkinningTransform += m_skinning->m_skinningMatrices[vertexInfluences[influenceIndex].m_jointIndex] *
+                            vertexInfluences[influenceIndex].m_jointWeight;
+                    }
+                    skinnedPosition = vertexSkinningTransform * originalPosition;
+                }
+                else
+                {
+                    MCore::DualQuaternion vertexSkinningTransform(AZ::Quaternion::CreateZero(), AZ::Quaternion::CreateZero());
+                    for (size_t influenceIndex = 0; influenceIndex < numInfluencesPerVertex; ++influenceIndex)
+                    {
+                        const auto jointIt = AZStd::lower_bound(
+                            m_skinning->m_jointIndices.begin(), m_skinning->m_jointIndices.end(), vertexInfluences[influenceIndex].m_jointIndex);
+                        const MCore::DualQuaternion& skinningDualQuaternion =
+                            (*m_jointDualQuaternions)[AZStd::distance(m_skinning->m_jointIndices.begin(), jointIt)];
+
+                        const float flip = AZ::GetSign(vertexSkinningTransform.mReal.Dot(skinningDualQuaternion.mReal));
+                        vertexSkinningTransform += skinningDualQuaternion * vertexInfluences[influenceIndex].m_jointWeight * flip;
+                    }
+                    vertexSkinningTransform.Normalize();
+                    skinnedPosition = vertexSkinningTransform.TransformPoint(originalPosition);
+                }
+
+                (*m_skinnedParticles)[vertexIndex].Set(skinnedPosition, (*m_skinnedParticles)[vertexIndex].GetW());
+            }
+        }
+
+        void UpdateTangentSpace()
+        {
+            ITangentSpaceHelper* tangentSpaceHelper = m_tangentSpaceHelper.get();
+            tangentSpaceHelper->CalculateNormals(*m_skinnedParticles, m_garment->m_indices, *m_normals);
+            tangentSpaceHelper->CalculateTangentsAndBitagents(
+                *m_skinnedParticles, m_garment->m_indices, m_garment->m_uvs, *m_normals, *m_tangents, *m_bitangents);
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+
+        AZStd::unique_ptr<TangentSpaceHelper> m_tangentSpaceHelper;
+        AZStd::unique_ptr<UnitTest::TriangleInput> m_garment;
+        AZStd::unique_ptr<UnitTest::SkinningInput> m_skinning;
+        AZStd::unique_ptr<PackedSkinningInfluences> m_packedInfluences;
+        AZStd::unique_ptr<AZStd::vector<AZ::Matrix3x4>> m_jointMatrices;
+        AZStd::unique_ptr<AZStd::vector<MCore::DualQuaternion>> m_jointDualQuaternions;
+        AZStd::unique_ptr<AZStd::vector<SimParticleFormat>> m_skinnedParticles;
+        AZStd::unique_ptr<AZStd::vector<AZ::Vector3>> m_normals;
+        AZStd::unique_ptr<AZStd::vector<AZ::Vector3>> m_tangents;
+        AZStd::unique_ptr<AZStd::vector<AZ::Vector3>> m_bitangents;
+    };
+
+    //! BM_ClothSkinning - Skins all garment particles with the packed influences.
+    //! state.range(0) - The number of segments of the garment plane, 141 segments result in 20164 particles.
+    //! state.range(1) - SkinningConstants::LinearSkinning or SkinningConstants::DualQuaternionSkinning.
+    BENCHMARK_DEFINE_F(ClothSkinningBenchmarkFixture, BM_ClothSkinning)(benchmark::State& state)
+    {
+        const int skinningMethod = aznumeric_cast<int>(state.range(1));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ApplySkinning(skinningMethod);
+            benchmark::DoNotOptimize(m_skinnedParticles->data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_skinnedParticles->size());
+    }
+
+    //! BM_ClothSkinningPerVertex - Skins all garment particles walking the unpacked influences of each vertex, on one thread.
+    //! Baseline for BM_ClothSkinning, same arguments.
+    BENCHMARK_DEFINE_F(ClothSkinningBenchmarkFixture, BM_ClothSkinningPerVertex)(benchmark::State& state)
+    {
+        const int skinningMethod = aznumeric_cast<int>(state.range(1));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ApplyPerVertexSkinning(skinningMethod);
+            benchmark::DoNotOptimize(m_skinnedParticles->data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_skinnedParticles->size());
+    }
+
+    //! BM_ClothTangentSpace - Recomputes normals, tangents and bitangents of the garment.
+    //! state.range(0) - The number of segments of the garment plane.
+    BENCHMARK_DEFINE_F(ClothSkinningBenchmarkFixture, BM_ClothTangentSpace)(benchmark::State& state)
+    {
+        ApplySkinning(SkinningConstants::LinearSkinning);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            UpdateTangentSpace();
+            benchmark::DoNotOptimize(m_tangents->data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_skinnedParticles->size());
+    }
+
+    //! BM_ClothMeshUpdate - Skins the garment and recomputes its tangent space, the work done by the cloth
+    //! mesh component every frame for a garment which is not simulated.
+    //! Same arguments as BM_ClothSkinning.
+    BENCHMARK_DEFINE_F(ClothSkinningBenchmarkFixture, BM_ClothMeshUpdate)(benchmark::State& state)
+    {
+        const int skinningMethod = aznumeric_cast<int>(state.range(1));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ApplySkinning(skinningMethod);
+            UpdateTangentSpace();
+            benchmark::DoNotOptimize(m_tangents->data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_skinnedParticles->size());
+    }
+
+    BENCHMARK_REGISTER_F(ClothSkinningBenchmarkFixture, BM_ClothSkinning)
+        ->Args({ 70, SkinningConstants::LinearSkinning })
+        ->Args({ 70, SkinningConstants::DualQuaternionSkinning })
+        ->Args({ 141, SkinningConstants::LinearSkinning })
+        ->Args({ 141, SkinningConstants::DualQuaternionSkinning })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ClothSkinningBenchmarkFixture, BM_ClothSkinningPerVertex)
+        ->Args({ 141, SkinningConstants::LinearSkinning })
+        ->Args({ 141, SkinningConstants::DualQuaternionSkinning })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ClothSkinningBenchmarkFixture, BM_ClothTangentSpace)
+        ->Arg(70)
+        ->Arg(141)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ClothSkinningBenchmarkFixture, BM_ClothMeshUpdate)
+        ->Args({ 141, SkinningConstants::LinearSkinning })
+        ->Args({ 141, SkinningConstants::DualQuaternionSkinning })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+} // namespace NvCloth::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -98,6 +98,55 @@ namespace UnitTest
         EXPECT_TRUE(renderData.m_normals.empty());
     }
     
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLodDisabled_ReturnsFull)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+
+        NvCloth::ClothConfiguration config;
+        config.m_simulationLodEnabled = false;
+
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 1000.0f, SimulationLod::Full), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 1000.0f, SimulationLod::Frozen), SimulationLod::Full);
+    }
+
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLod_ReturnsLodForDistance)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+
+        NvCloth::ClothConfiguration config;
+        config.m_simulationLodEnabled = true;
+        config.m_simulationLodReducedDistance = 10.0f;
+        config.m_simulationLodFrozenDistance = 20.0f;
+
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 5.0f, SimulationLod::Full), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 10.0f, SimulationLod::Full), SimulationLod::Reduced);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 15.0f, SimulationLod::Full), SimulationLod::Reduced);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 25.0f, SimulationLod::Full), SimulationLod::Frozen);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 5.0f, SimulationLod::Frozen), SimulationLod::Full);
+    }
+
+    TEST_F(NvClothComponentMesh, ClothComponentMesh_CalculateSimulationLodNearBoundary_KeepsCurrentLod)
+    {
+        using SimulationLod = NvCloth::ClothComponentMesh::SimulationLod;
+
+        NvCloth::ClothConfiguration config;
+        config.m_simulationLodEnabled = true;
+        config.m_simulationLodReducedDistance = 10.0f;
+        config.m_simulationLodFrozenDistance = 20.0f;
+
+        // Slightly closer than the distance of the current level keeps it.
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 9.5f, SimulationLod::Reduced), SimulationLod::Reduced);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 19.5f, SimulationLod::Frozen), SimulationLod::Frozen);
+
+        // Slightly closer than the distance of a less detailed level doesn't switch to it.
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 9.5f, SimulationLod::Full), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 19.5f, SimulationLod::Reduced), SimulationLod::Reduced);
+
+        // Clearly closer goes back to the more detailed level.
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 8.0f, SimulationLod::Reduced), SimulationLod::Full);
+        EXPECT_EQ(NvCloth::ClothComponentMesh::CalculateSimulationLod(config, 17.0f, SimulationLod::Frozen), SimulationLod::Reduced);
+    }
+
     TEST_F(NvClothComponentMesh, ClothComponentMesh_InitWithEmptyActor_ReturnsEmptyRenderData)
     {
         {
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/std/algorithm.h>
+
+#include <MCore/Source/DualQuaternion.h>
+
+#include <Components/ClothComponentMesh/ClothSkinningKernels.h>
+
+#include <SkinningInputHelper.h>
+#include <TriangleInputHelper.h>
+#include <UnitTestHelper.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        // Per vertex linear blend skinning, as done before the influences were packed.
+        AZ::Matrix3x4 ComputeReferenceLinearTransform(const SkinningInput& skinning, size_t vertexIndex)
+        {
+            AZ::Matrix3x4 vertexSkinningTransform = AZ::Matrix3x4::CreateZero();
+            for (size_t influenceIndex = 0; influenceIndex < skinning.m_numInfluencesPerVertex; ++influenceIndex)
+            {
+                const NvCloth::SkinningInfluence& influence =
+                    skinning.m_skinningInfluences[vertexIndex * skinning.m_numInfluencesPerVertex + influenceIndex];
+                vertexSkinningTransform += skinning.m_skinningMatrices[influence.m_jointIndex] * influence.m_jointWeight;
+            }
+            return vertexSkinningTransform;
+        }
+
+        // Per vertex dual quaternion skinning, as done before the influences were packed.
+        MCore::DualQuaternion ComputeReferenceDualQuaternionTransform(const SkinningInput& skinning, size_t vertexIndex)
+        {
+            MCore::DualQuaternion vertexSkinningTransform(AZ::Quaternion::CreateZero(), AZ::Quaternion::CreateZero());
+            for (size_t influenceIndex = 0; influenceIndex < skinning.m_numInfluencesPerVertex; ++influenceIndex)
+            {
+                const NvCloth::SkinningInfluence& influence =
+                    skinning.m_skinningInfluences[vertexIndex * skinning.m_numInfluencesPerVertex + influenceIndex];
+                const MCore::DualQuaternion skinningDualQuaternion(
+                    AZ::Transform::CreateFromMatrix3x4(skinning.m_skinningMatrices[influence.m_jointIndex]));
+
+                const float flip = AZ::GetSign(vertexSkinningTransform.mReal.Dot(skinningDualQuaternion.mReal));
+                vertexSkinningTransform += skinningDualQuaternion * influence.m_jointWeight * flip;
+            }
+            vertexSkinningTransform.Normalize();
+            return vertexSkinningTransform;
+        }
+
+        AZStd::vector<AZ::Matrix3x4> GatherJointMatrices(const SkinningInput& skinning)
+        {
+            AZStd::vector<AZ::Matrix3x4> jointMatrices;
+            for (const AZ::u16 jointIndex : skinning.m_jointIndices)
+            {
+                jointMatrices.push_back(skinning.m_skinningMatrices[jointIndex]);
+            }
+            return jointMatrices;
+        }
+
+        AZStd::vector<MCore::DualQuaternion> GatherJointDualQuaternions(const SkinningInput& skinning)
+        {
+            AZStd::vector<MCore::DualQuaternion> jointDualQuaternions;
+            for (const AZ::u16 jointIndex : skinning.m_jointIndices)
+            {
+                jointDualQuaternions.emplace_back(AZ::Transform::CreateFromMatrix3x4(skinning.m_skinningMatrices[jointIndex]));
+            }
+            return jointDualQuaternions;
+        }
+
+        AZStd::vector<AZ::u32> CreateVertexList(size_t numVertices, size_t step)
+        {
+            AZStd::vector<AZ::u32> vertexIndices;
+            for (size_t vertexIndex = 0; vertexIndex < numVertices; vertexIndex += step)
+            {
+                vertexIndices.push_back(aznumeric_cast<AZ::u32>(vertexIndex));
+            }
+            return vertexIndices;
+        }
+    }
+
+    //! Runs the skinning kernels on a plane, for vertex counts that are skinned in one batch and in several jobs.
+    class NvClothSkinningKernels
+        : public ::testing::TestWithParam<AZ::u32>
+    {
+    protected:
+        void SetUp() override
+        {
+            const AZ::u32 segments = GetParam();
+            m_plane = CreatePlane(1.0f, 1.0f, segments, segments);
+            m_normals.resize(m_plane.m_vertices.size(), AZ::Vector3::CreateAxisZ());
+        }
+
+        TriangleInput m_plane;
+        AZStd::vector<AZ::Vector3> m_normals;
+    };
+
+    TEST(NvClothPackedSkinningInfluences, Create_ZeroWeights_AreLeftOut)
+    {
+        const AZStd::vector<NvCloth::SkinningInfluence> skinningInfluences = {{
+            { 0.5f, 4 }, { 0.5f, 2 },
+            { 1.0f, 9 }, { 0.0f, 2 }
+        }};
+        const AZStd::vector<AZ::u16> jointIndices = {{ 2, 4, 9 }};
+
+        const NvCloth::PackedSkinningInfluences packedInfluences =
+            NvCloth::PackedSkinningInfluences::Create(skinningInfluences, 2, {{ 1, 0 }}, jointIndices);
+
+        EXPECT_EQ(packedInfluences.GetNumVertices(), 2u);
+        EXPECT_THAT(packedInfluences.m_vertexIndices, ::testing::ElementsAre(1u, 0u));
+        EXPECT_THAT(packedInfluences.m_influenceOffsets, ::testing::ElementsAre(0u, 1u, 3u));
+        EXPECT_THAT(packedInfluences.m_jointSlots, ::testing::ElementsAre(2, 1, 0));
+        EXPECT_THAT(packedInfluences.m_jointWeights, ::testing::ElementsAre(1.0f, 0.5f, 0.5f));
+    }
+
+    TEST_P(NvClothSkinningKernels, SkinPositionsLinear_MatchesPerVertexSkinning)
+    {
+        const size_t numVertices = m_plane.m_vertices.size();
+        const SkinningInput skinning = CreateSkinningInput(numVertices, 4, 32, true);
+        const AZStd::vector<AZ::Matrix3x4> jointMatrices = GatherJointMatrices(skinning);
+
+        // Simulated particles are in a different order than the mesh vertices.
+        AZStd::vector<AZ::u32> simulatedVertices = CreateVertexList(numVertices, 1);
+        AZStd::reverse(simulatedVertices.begin(), simulatedVertices.end());
+        const NvCloth::PackedSkinningInfluences packedInfluences = NvCloth::PackedSkinningInfluences::Create(
+            skinning.m_skinningInfluences, skinning.m_numInfluencesPerVertex, simulatedVertices, skinning.m_jointIndices);
+
+        AZStd::vector<AZ::Vector4> skinnedPositions(numVertices, AZ::Vector4(0.0f, 0.0f, 0.0f, 0.5f));
+        NvCloth::SkinningKernels::SkinPositionsLinear(
+            packedInfluences, jointMatrices.data(), m_plane.m_vertices.data(), skinnedPositions.data());
+
+        for (size_t index = 0; index < numVertices; ++index)
+        {
+            const AZ::Matrix3x4 expectedTransform = ComputeReferenceLinearTransform(skinning, simulatedVertices[index]);
+            const AZ::Vector3 expectedPosition = expectedTransform * m_plane.m_vertices[index].GetAsVector3();
+            EXPECT_THAT(skinnedPositions[index].GetAsVector3(), IsCloseTolerance(expectedPosition, Tolerance));
+            EXPECT_EQ(skinnedPositions[index].GetW(), 0.5f);
+        }
+    }
+
+    TEST_P(NvClothSkinningKernels, SkinVerticesLinear_OnlySkinsListedVertices)
+    {
+        const size_t numVertices = m_plane.m_vertices.size();
+        const SkinningInput skinning = CreateSkinningInput(numVertices, 4, 32, true);
+        const AZStd::vector<AZ::Matrix3x4> jointMatrices = GatherJointMatrices(skinning);
+
+        const AZStd::vector<AZ::u32> nonSimulatedVertices = CreateVertexList(numVertices, 2);
+        const NvCloth::PackedSkinningInfluences packedInfluences = NvCloth::PackedSkinningInfluences::Create(
+            skinning.m_skinningInfluences, skinning.m_numInfluencesPerVertex, nonSimulatedVertices, skinning.m_jointIndices);
+
+        AZStd::vector<AZ::Vector4> skinnedPositions(numVertices, AZ::Vector4(0.0f, 0.0f, 0.0f, 0.5f));
+        AZStd::vector<AZ::Vector3> skinnedNormals(numVertices, AZ::Vector3::CreateZero());
+        NvCloth::SkinningKernels::SkinVerticesLinear(
+            packedInfluences, jointMatrices.data(),
+            m_plane.m_vertices.data(), m_normals.data(),
+            skinnedPositions.data(), skinnedNormals.data());
+
+        for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+        {
+            if (vertexIndex % 2 == 0)
+            {
+                const AZ::Matrix3x4 expectedTransform = ComputeReferenceLinearTransform(skinning, vertexIndex);
+                const AZ::Vector3 expectedPosition = expectedTransform * m_plane.m_vertices[vertexIndex].GetAsVector3();
+                const AZ::Vector3 expectedNormal =
+                    expectedTransform.GetReciprocalScaled().TransformVector(m_normals[vertexIndex]).GetNormalized();
+                EXPECT_THAT(skinnedPositions[vertexIndex].GetAsVector3(), IsCloseTolerance(expectedPosition, Tolerance));
+                EXPECT_THAT(skinnedNormals[vertexIndex], IsCloseTolerance(expectedNormal, Tolerance));
+            }
+            else
+            {
+                EXPECT_THAT(skinnedPositions[vertexIndex].GetAsVector3(), IsClose(AZ::Vector3::CreateZero()));
+                EXPECT_THAT(skinnedNormals[vertexIndex], IsClose(AZ::Vector3::CreateZero()));
+            }
+            EXPECT_EQ(skinnedPositions[vertexIndex].GetW(), 0.5f);
+        }
+    }
+
+    TEST_P(NvClothSkinningKernels, SkinPositionsDualQuaternion_MatchesPerVertexSkinning)
+    {
+        const size_t numVertices = m_plane.m_vertices.size();
+        const SkinningInput skinning = CreateSkinningInput(numVertices, 4, 32, false);
+        const AZStd::vector<MCore::DualQuaternion> jointDualQuaternions = GatherJointDualQuaternions(skinning);
+
+        const AZStd::vector<AZ::u32> simulatedVertices = CreateVertexList(numVertices, 1);
+        const NvCloth::PackedSkinningInfluences packedInfluences = NvCloth::PackedSkinningInfluences::Create(
+            skinning.m_skinningInfluences, skinning.m_numInfluencesPerVertex, simulatedVertices, skinning.m_jointIndices);
+
+        AZStd::vector<AZ::Vector4> skinnedPositions(numVertices, AZ::Vector4(0.0f, 0.0f, 0.0f, 0.5f));
+        NvCloth::SkinningKernels::SkinPositionsDualQuaternion(
+            packedInfluences, jointDualQuaternions.data(), m_plane.m_vertices.data(), skinnedPositions.data());
+
+        for (size_t index = 0; index < numVertices; ++index)
+        {
+            const MCore::DualQuaternion expectedTransform = ComputeReferenceDualQuaternionTransform(skinning, index);
+            const AZ::Vector3 expectedPosition = expectedTransform.TransformPoint(m_plane.m_vertices[index].GetAsVector3());
+            EXPECT_THAT(skinnedPositions[index].GetAsVector3(), IsCloseTolerance(expectedPosition, Tolerance));
+            EXPECT_EQ(skinnedPositions[index].GetW(), 0.5f);
+        }
+    }
+
+    TEST_P(NvClothSkinningKernels, SkinVerticesDualQuaternion_OnlySkinsListedVertices)
+    {
+        const size_t numVertices = m_plane.m_vertices.size();
+        const SkinningInput skinning = CreateSkinningInput(numVertices, 4, 32, false);
+        const AZStd::vector<MCore::DualQuaternion> jointDualQuaternions = GatherJointDualQuaternions(skinning);
+
+        const AZStd::vector<AZ::u32> nonSimulatedVertices = CreateVertexList(numVertices, 2);
+        const NvCloth::PackedSkinningInfluences packedInfluences = NvCloth::PackedSkinningInfluences::Create(
+            skinning.m_skinningInfluences, skinning.m_numInfluencesPerVertex, nonSimulatedVertices, skinning.m_jointIndices);
+
+        AZStd::vector<AZ::Vector4> skinnedPositions(numVertices, AZ::Vector4(0.0f, 0.0f, 0.0f, 0.5f));
+        AZStd::vector<AZ::Vector3> skinnedNormals(numVertices, AZ::Vector3::CreateZero());
+        NvCloth::SkinningKernels::SkinVerticesDualQuaternion(
+            packedInfluences, jointDualQuaternions.data(),
+            m_plane.m_vertices.data(), m_normals.data(),
+            skinnedPositions.data(), skinnedNormals.data());
+
+        for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+        {
+            if (vertexIndex % 2 == 0)
+            {
+                const MCore::DualQuaternion expectedTransform = ComputeReferenceDualQuaternionTransform(skinning, vertexIndex);
+                const AZ::Vector3 expectedPosition = expectedTransform.TransformPoint(m_plane.m_vertices[vertexIndex].GetAsVector3());
+                const AZ::Vector3 expectedNormal = expectedTransform.TransformVector(m_normals[vertexIndex]).GetNormalized();
+                EXPECT_THAT(skinnedPositions[vertexIndex].GetAsVector3(), IsCloseTolerance(expectedPosition, Tolerance));
+                EXPECT_THAT(skinnedNormals[vertexIndex], IsCloseTolerance(expectedNormal, Tolerance));
+            }
+            else
+            {
+                EXPECT_THAT(skinnedPositions[vertexIndex].GetAsVector3(), IsClose(AZ::Vector3::CreateZero()));
+                EXPECT_THAT(skinnedNormals[vertexIndex], IsClose(AZ::Vector3::CreateZero()));
+            }
+            EXPECT_EQ(skinnedPositions[vertexIndex].GetW(), 0.5f);
+        }
+    }
+
+    // 10x10 segments are skinned in one batch, 100x100 segments are split in several jobs.
+    INSTANTIATE_TEST_CASE_P(NvClothSkinningKernels, NvClothSkinningKernels, ::testing::Values(10u, 100u));
+} // namespace UnitTest
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/set.h>
+
+#include <SkinningInputHelper.h>
+
+namespace UnitTest
+{
+    SkinningInput CreateSkinningInput(
+        size_t numVertices,
+        size_t numInfluencesPerVertex,
+        AZ::u16 numJoints,
+        bool withScale,
+        AZ::u64 seed)
+    {
+        AZ::SimpleLcgRandom random(seed);
+
+        SkinningInput skinning;
+        skinning.m_numInfluencesPerVertex = numInfluencesPerVertex;
+
+        skinning.m_skinningMatrices.resize(numJoints);
+        for (AZ::Matrix3x4& skinningMatrix : skinning.m_skinningMatrices)
+        {
+            const AZ::Vector3 axis = AZ::Vector3(
+                random.GetRandomFloat() - 0.5f,
+                random.GetRandomFloat() - 0.5f,
+                random.GetRandomFloat() - 0.5f).GetNormalizedSafe();
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(
+                axis.IsZero() ? AZ::Vector3::CreateAxisZ() : axis,
+                random.GetRandomFloat() * AZ::Constants::HalfPi);
+            const AZ::Vector3 translation(
+                random.GetRandomFloat() - 0.5f,
+                random.GetRandomFloat() - 0.5f,
+                random.GetRandomFloat() - 0.5f);
+
+            skinningMatrix = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation);
+            if (withScale)
+            {
+                skinningMatrix = skinningMatrix * AZ::Matrix3x4::CreateScale(AZ::Vector3(
+                    0.5f + random.GetRandomFloat(),
+                    0.5f + random.GetRandomFloat(),
+                    0.5f + random.GetRandomFloat()));
+            }
+        }
+
+        // Only every other joint influences the mesh, so the joint list doesn't map 1:1 to the skeleton.
+        const AZ::u32 numUsedJoints = AZStd::max<AZ::u32>(numJoints / 2, 1);
+
+        AZStd::set<AZ::u16> jointIndices;
+        skinning.m_skinningInfluences.resize(numVertices * numInfluencesPerVertex);
+        for (size_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+        {
+            NvCloth::SkinningInfluence* vertexInfluences = &skinning.m_skinningInfluences[vertexIndex * numInfluencesPerVertex];
+
+            float totalWeight = 0.0f;
+            for (size_t influenceIndex = 0; influenceIndex < numInfluencesPerVertex; ++influenceIndex)
+            {
+                const AZ::u16 jointIndex = aznumeric_cast<AZ::u16>((random.GetRandom() % numUsedJoints) * 2 % numJoints);
+                // The first influence always has weight, the others are left unused now and then.
+                const bool unused = influenceIndex > 0 && (random.GetRandom() % 4) == 0;
+                const float weight = unused ? 0.0f : 0.1f + random.GetRandomFloat();
+
+                vertexInfluences[influenceIndex].m_jointIndex = jointIndex;
+                vertexInfluences[influenceIndex].m_jointWeight = weight;
+                totalWeight += weight;
+                jointIndices.insert(jointIndex);
+            }
+
+            for (size_t influenceIndex = 0; influenceIndex < numInfluencesPerVertex; ++influenceIndex)
+            {
+                vertexInfluences[influenceIndex].m_jointWeight /= totalWeight;
+            }
+        }
+        skinning.m_jointIndices.assign(jointIndices.begin(), jointIndices.end());
+
+        return skinning;
+    }
+} // namespace UnitTest
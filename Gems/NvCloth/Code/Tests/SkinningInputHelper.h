@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Components/ClothComponentMesh/ClothSkinningKernels.h>
+
+namespace UnitTest
+{
+    //! Class to provide skinning input data for tests
+    struct SkinningInput
+    {
+        size_t m_numInfluencesPerVertex = 0;
+
+        //! Influences of all vertices, m_numInfluencesPerVertex consecutive influences per vertex.
+        AZStd::vector<NvCloth::SkinningInfluence> m_skinningInfluences;
+
+        //! Sorted list of the joints used by the influences.
+        AZStd::vector<AZ::u16> m_jointIndices;
+
+        //! Skinning matrices of all joints in the skeleton, indexed by joint index.
+        AZStd::vector<AZ::Matrix3x4> m_skinningMatrices;
+    };
+
+    //! Creates random skinning influences for the vertices, where each vertex is influenced by
+    //! up to numInfluencesPerVertex joints, and random skinning matrices for the joints.
+    //! Some influences get zero weight, as it happens in real meshes with fewer joints per vertex.
+    //! @param withScale Whether the skinning matrices have non-uniform scale, or are rigid transforms.
+    SkinningInput CreateSkinningInput(
+        size_t numVertices,
+        size_t numInfluencesPerVertex,
+        AZ::u16 numJoints,
+        bool withScale,
+        AZ::u64 seed = 1234);
+} // namespace UnitTest
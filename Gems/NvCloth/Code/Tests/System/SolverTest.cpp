@@ -332,6 +332,144 @@ namespace UnitTest
         m_solver->FinishSimulation();
     }
 
+    TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulationWithFrozenCloth_ClothSimulationEventsNotSignaled)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+
+        bool clothPreSimulationEventSignaled = false;
+        NvCloth::ICloth::PreSimulationEvent::Handler clothPreSimulationEventHandler(
+            [&clothPreSimulationEventSignaled](NvCloth::ClothId, float)
+            {
+                clothPreSimulationEventSignaled = true;
+            });
+
+        bool clothPostSimulationEventSignaled = false;
+        NvCloth::ICloth::PostSimulationEvent::Handler clothPostSimulationEventHandler(
+            [&clothPostSimulationEventSignaled](NvCloth::ClothId, float, const AZStd::vector<NvCloth::SimParticleFormat>&)
+            {
+                clothPostSimulationEventSignaled = true;
+            });
+
+        m_cloth->ConnectPreSimulationEventHandler(clothPreSimulationEventHandler);
+        m_cloth->ConnectPostSimulationEventHandler(clothPostSimulationEventHandler);
+
+        m_solver->AddCloth(m_cloth.get());
+        m_cloth->SetFrozen(true);
+
+        const AZStd::vector<NvCloth::SimParticleFormat> particlesBeforeSimulation = m_cloth->GetParticles();
+
+        m_solver->StartSimulation(deltaTimeSim);
+        m_solver->FinishSimulation();
+
+        EXPECT_TRUE(m_cloth->IsFrozen());
+        EXPECT_FALSE(clothPreSimulationEventSignaled);
+        EXPECT_FALSE(clothPostSimulationEventSignaled);
+        EXPECT_EQ(m_solver->GetSimulationStats().m_numSimulatedCloths, 0u);
+        EXPECT_THAT(m_cloth->GetParticles(), ::testing::Pointwise(ContainerIsCloseTolerance(Tolerance), particlesBeforeSimulation));
+
+        m_cloth->SetFrozen(false);
+
+        m_solver->StartSimulation(deltaTimeSim);
+        m_solver->FinishSimulation();
+
+        EXPECT_FALSE(m_cloth->IsFrozen());
+        EXPECT_TRUE(clothPreSimulationEventSignaled);
+        EXPECT_TRUE(clothPostSimulationEventSignaled);
+        EXPECT_EQ(m_solver->GetSimulationStats().m_numSimulatedCloths, 1u);
+    }
+
+    TEST_F(NvClothSystemSolver, Solver_FrozenClothRemoved_ClothIsRemovedFromSolver)
+    {
+        m_solver->AddCloth(m_cloth.get());
+        m_cloth->SetFrozen(true);
+
+        m_solver->StartSimulation(1.0f / 60.0f);
+        m_solver->FinishSimulation();
+
+        m_solver->RemoveCloth(m_cloth.get());
+
+        EXPECT_EQ(m_solver->GetNumCloths(), 0);
+        EXPECT_EQ(m_cloth->GetSolver(), nullptr);
+
+        // Adding it again to a solver while still frozen
+        auto anotherSolver = CreateSolver("AnotherSolver");
+        anotherSolver->AddCloth(m_cloth.get());
+
+        anotherSolver->StartSimulation(1.0f / 60.0f);
+        anotherSolver->FinishSimulation();
+
+        EXPECT_EQ(anotherSolver->GetNumCloths(), 1);
+        EXPECT_EQ(anotherSolver->GetSimulationStats().m_numSimulatedCloths, 0u);
+    }
+
+    TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulation_SimulationStatsUpdated)
+    {
+        auto anotherCloth = CreateCloth();
+
+        m_solver->AddCloth(m_cloth.get());
+        m_solver->AddCloth(anotherCloth.get());
+
+        m_solver->StartSimulation(1.0f / 60.0f);
+        m_solver->FinishSimulation();
+
+        const NvCloth::Solver::SimulationStats& stats = m_solver->GetSimulationStats();
+        EXPECT_EQ(stats.m_numSimulatedCloths, 2u);
+        EXPECT_GE(stats.m_preSimulationTimeMs, 0.0f);
+        EXPECT_GE(stats.m_simulationTimeMs, 0.0f);
+        EXPECT_GE(stats.m_postSimulationTimeMs, 0.0f);
+
+        m_solver->Enable(false);
+
+        m_solver->StartSimulation(1.0f / 60.0f);
+        m_solver->FinishSimulation();
+
+        EXPECT_EQ(m_solver->GetSimulationStats().m_numSimulatedCloths, 0u);
+    }
+
+    // This test uses Cloth System to check if the system's tick simulates all its solvers.
+    TEST(NvClothSystem, Solver_SeveralSolversTickedBySystem_AllSolversSimulated)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const NvCloth::FabricCookedData fabricCookedData = CreateTestFabricCookedData();
+
+        const size_t numSolvers = 3;
+        AZStd::vector<NvCloth::ISolver*> solvers;
+        AZStd::vector<NvCloth::ICloth*> cloths;
+        AZStd::vector<NvCloth::ISolver::PostSimulationEvent::Handler> solverPostSimulationEventHandlers;
+        solverPostSimulationEventHandlers.reserve(numSolvers);
+        size_t numSolversSimulated = 0;
+        for (size_t solverIndex = 0; solverIndex < numSolvers; ++solverIndex)
+        {
+            NvCloth::ISolver* solver = AZ::Interface<NvCloth::IClothSystem>::Get()->FindOrCreateSolver(
+                AZStd::string::format("Solver_ParallelTest%zu", solverIndex));
+            NvCloth::ICloth* cloth = AZ::Interface<NvCloth::IClothSystem>::Get()->CreateCloth(fabricCookedData.m_particles, fabricCookedData);
+            AZ::Interface<NvCloth::IClothSystem>::Get()->AddCloth(cloth, solver->GetName());
+
+            solverPostSimulationEventHandlers.emplace_back(
+                [&numSolversSimulated](const AZStd::string&, float)
+                {
+                    ++numSolversSimulated;
+                });
+            solver->ConnectPostSimulationEventHandler(solverPostSimulationEventHandlers.back());
+
+            solvers.push_back(solver);
+            cloths.push_back(cloth);
+        }
+
+        // Ticking Cloth System updates all its solvers
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+            deltaTimeSim,
+            AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+
+        EXPECT_EQ(numSolversSimulated, numSolvers);
+
+        for (size_t index = 0; index < numSolvers; ++index)
+        {
+            AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solvers[index]);
+            AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloths[index]);
+        }
+    }
+
     // This test uses Cloth System to check if the system's tick will update a solver in user simulated mode.
     // Since it relies on cloth system, the test has to use a solver and a cloth created from the system.
     // NvClothSystemSolver fixture is not necessary for this test.
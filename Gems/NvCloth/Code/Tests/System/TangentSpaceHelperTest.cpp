@@ -472,6 +472,33 @@ namespace UnitTest
         EXPECT_THAT(normals, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisZ(), Tolerance)));
     }
 
+    TEST(NvClothSystem, TangentSpaceHelper_CalculateTangentSpaceLargePlaneXY_ReturnsCorrectTangentSpace)
+    {
+        // Enough triangles and vertices to be processed in several jobs.
+        const float width = 10.0f;
+        const float height = 10.0f;
+        const AZ::u32 segmentsX = 100;
+        const AZ::u32 segmentsY = 100;
+
+        const TriangleInput planeXY = CreatePlane(width, height, segmentsX, segmentsY);
+        const size_t numVertices = planeXY.m_vertices.size();
+
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        AZStd::vector<AZ::Vector3> normals;
+        bool tangentsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentSpace(
+            planeXY.m_vertices, planeXY.m_indices, planeXY.m_uvs,
+            tangents, bitangents, normals);
+
+        EXPECT_TRUE(tangentsCalculated);
+        EXPECT_EQ(tangents.size(), numVertices);
+        EXPECT_EQ(bitangents.size(), numVertices);
+        EXPECT_EQ(normals.size(), numVertices);
+        EXPECT_THAT(tangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisX(), Tolerance)));
+        EXPECT_THAT(bitangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance)));
+        EXPECT_THAT(normals, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisZ(), Tolerance)));
+    }
+
 
     TEST(NvClothSystem, TangentSpaceHelper_CalculateNormalsPlaneXYRot90Y_ReturnsCorrectNormals)
     {
@@ -26,6 +26,8 @@ set(FILES
     Source/Components/ClothComponentMesh/ActorClothColliders.h
     Source/Components/ClothComponentMesh/ActorClothSkinning.cpp
     Source/Components/ClothComponentMesh/ActorClothSkinning.h
+    Source/Components/ClothComponentMesh/ClothSkinningKernels.cpp
+    Source/Components/ClothComponentMesh/ClothSkinningKernels.h
     Source/Components/ClothComponentMesh/ClothDebugDisplay.cpp
     Source/Components/ClothComponentMesh/ClothDebugDisplay.h
     Source/System/SystemComponent.cpp
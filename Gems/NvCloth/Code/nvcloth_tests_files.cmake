@@ -15,6 +15,8 @@ set(FILES
     Tests/ActorHelper.cpp
     Tests/TriangleInputHelper.h
     Tests/TriangleInputHelper.cpp
+    Tests/SkinningInputHelper.h
+    Tests/SkinningInputHelper.cpp
     Tests/System/ClothSystemTest.cpp
     Tests/System/ClothTest.cpp
     Tests/System/FabricCookerTest.cpp
@@ -26,6 +28,8 @@ set(FILES
     Tests/Components/ClothComponentMesh/ClothComponentMeshTest.cpp
     Tests/Components/ClothComponentMesh/ActorClothCollidersTest.cpp
     Tests/Components/ClothComponentMesh/ActorClothSkinningTest.cpp
+    Tests/Components/ClothComponentMesh/ClothSkinningKernelsTest.cpp
     Tests/Components/ClothComponentMesh/ClothConstraintsTest.cpp
     Tests/Utils/ActorAssetHelperTest.cpp
+    Tests/Benchmarks/ClothSkinningBenchmarks.cpp
 )
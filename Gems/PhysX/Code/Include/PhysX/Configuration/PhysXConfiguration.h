@@ -50,6 +50,7 @@ namespace PhysX
         static PhysXSystemConfiguration CreateDefault();
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
+        AZ::u32 m_numDedicatedWorkerThreads = 0; //!< Number of worker threads reserved for PhysX tasks, 0 to run them on the shared job system.
 
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
@@ -95,8 +95,9 @@ namespace PhysX
         if (auto* serializeContext = azdynamic_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
-                ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
+                ->Version(3, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("NumDedicatedWorkerThreads", &PhysXSystemConfiguration::m_numDedicatedWorkerThreads)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -105,6 +106,11 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_numDedicatedWorkerThreads,
+                        "Dedicated worker threads",
+                        "Number of worker threads reserved for PhysX tasks, so they don't compete with other jobs.\n"
+                        "When 0, PhysX tasks run on the shared job system.")
+                        ->Attribute(AZ::Edit::Attributes::Max, 64)
                     ;
             }
         }
@@ -120,7 +126,8 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_numDedicatedWorkerThreads == other.m_numDedicatedWorkerThreads
             ;
     }
 
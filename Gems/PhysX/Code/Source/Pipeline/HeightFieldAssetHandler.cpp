@@ -15,6 +15,8 @@
 #include <PhysX/SystemComponentBus.h>
 #include <PhysX/ComponentTypeIds.h>
 #include <Source/Pipeline/HeightFieldAssetHandler.h>
+#include <System/PhysXCookingCache.h>
+#include <System/PhysXSystem.h>
 #include <PxPhysicsAPI.h>
 
 #include <extensions/PxSerialization.h>
@@ -185,32 +187,22 @@ namespace PhysX
             HeightFieldAssetHeader header;
             if (header.m_assetVersion == 2)
             {
-                physx::PxCooking* cooking = nullptr;
-                SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
-
                 // Read samples from heightfield
                 AZStd::vector<physx::PxHeightFieldSample> samples;
                 samples.resize(heightField->getNbColumns() * heightField->getNbRows());
                 heightField->saveCells(samples.data(), (physx::PxU32)samples.size() * heightField->getSampleStride());
 
-                // Read description from heightfield
-                physx::PxHeightFieldDesc heightFieldDesc;
-                heightFieldDesc.format = heightField->getFormat();
-                heightFieldDesc.nbColumns = heightField->getNbColumns();
-                heightFieldDesc.nbRows = heightField->getNbRows();
-                heightFieldDesc.samples.data = samples.data();
-                heightFieldDesc.samples.stride = heightField->getSampleStride();
-
-                // Cook description to file
-                physx::PxDefaultMemoryOutputStream writer;
-                bool success = cooking->cookHeightField(heightFieldDesc, writer);
-                header.m_assetDataSize = writer.getSize() + 2 * sizeof(float);
+                // Cook samples to file, height fields which were saved before are loaded from the cooking cache
+                AZStd::vector<AZ::u8> cookedData;
+                bool success = GetPhysXSystem()->GetCookingCache()->CookHeightField(samples.data(),
+                    heightField->getNbRows(), heightField->getNbColumns(), cookedData);
+                header.m_assetDataSize = aznumeric_cast<AZ::u32>(cookedData.size() + 2 * sizeof(float));
 
                 PhysX::StreamWrapper writerStream(stream);
                 writerStream.write(&header, sizeof(header));
                 writerStream.write(&physXHeightFieldAsset->m_minHeight, sizeof(physXHeightFieldAsset->m_minHeight));
                 writerStream.write(&physXHeightFieldAsset->m_maxHeight, sizeof(physXHeightFieldAsset->m_maxHeight));
-                writerStream.write(writer.getData(), writer.getSize());
+                writerStream.write(cookedData.data(), aznumeric_cast<physx::PxU32>(cookedData.size()));
 
                 return success;
             }
@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -19,6 +20,7 @@
 #include <Source/RigidBodyComponent.h>
 #include <Source/Shape.h>
 #include <Source/RigidBody.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -216,6 +218,32 @@ namespace PhysX
             }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
     }
 
+    void RigidBodyComponent::UpdateTransformWriteBack()
+    {
+        // Dynamic bodies without interpolation get their entity transform updated by the scene in bulk.
+        // Kinematic and interpolated bodies need the per component update in PostPhysicsTick.
+        PhysXScene* scene = nullptr;
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            scene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_attachedSceneHandle));
+        }
+
+        const bool useTransformWriteBack = scene != nullptr && !m_configuration.m_interpolateMotion && !IsKinematic();
+        if (scene != nullptr)
+        {
+            scene->SetTransformWriteBackEnabled(m_rigidBodyHandle, useTransformWriteBack);
+        }
+
+        m_sceneFinishSimHandler.Disconnect();
+        if (!useTransformWriteBack)
+        {
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            }
+        }
+    }
+
     void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
     {
         // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
@@ -299,10 +327,7 @@ namespace PhysX
         }
 
         // Listen to the PhysX system for events concerning this entity.
-        if (sceneInterface != nullptr)
-        {
-            sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
-        }
+        UpdateTransformWriteBack();
         AZ::TickBus::Handler::BusConnect();
         AZ::TransformNotificationBus::MultiHandler::BusConnect(GetEntityId());
         Physics::RigidBodyRequestBus::Handler::BusConnect(GetEntityId());
@@ -571,6 +596,7 @@ namespace PhysX
         if (AzPhysics::RigidBody* body = GetRigidBody())
         {
             body->SetKinematic(kinematic);
+            UpdateTransformWriteBack();
         }
     }
 
@@ -147,6 +147,7 @@ namespace PhysX
         void SetupConfiguration();
         void CreatePhysics();
         void InitPhysicsTickHandler();
+        void UpdateTransformWriteBack();
         void PostPhysicsTick(float fixedDeltaTime);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
@@ -7,7 +7,13 @@
  */
 #include <Scene/PhysXScene.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -451,6 +457,24 @@ namespace PhysX
             }
             return results;
         }
+
+        //helper to copy a request, so async queries don't depend on the lifetime of the caller's request.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (azrtti_istypeof<AzPhysics::RayCastRequest>(request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*azdynamic_cast<const AzPhysics::RayCastRequest*>(request));
+            }
+            else if (azrtti_istypeof<AzPhysics::ShapeCastRequest>(request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request));
+            }
+            else if (azrtti_istypeof<AzPhysics::OverlapRequest>(request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*azdynamic_cast<const AzPhysics::OverlapRequest*>(request));
+            }
+            return nullptr;
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -475,6 +499,8 @@ namespace PhysX
             }
             //register for future changes to the buffer sizes.
             physXSystem->RegisterSystemConfigurationChangedEvent(m_physicsSystemConfigChanged);
+
+            m_cpuDispatcher = physXSystem->GetPhysXCpuDispatcher();
         }
         
         PhysXScene::s_rayCastBuffer = {};
@@ -493,6 +519,10 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Async queries still hold on to the scene, their callbacks are dropped.
+        WaitForAsyncSceneQueries();
+        m_completedAsyncQueries.clear();
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -531,9 +561,17 @@ namespace PhysX
     {
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::StartSimulation");
 
+        if (BeginSimulation(deltatime))
+        {
+            SubmitSimulation();
+        }
+    }
+
+    bool PhysXScene::BeginSimulation(float deltatime)
+    {
         if (!IsEnabled())
         {
-            return;
+            return false;
         }
 
         {
@@ -542,9 +580,22 @@ namespace PhysX
         }
 
         m_currentDeltaTime = deltatime;
+        return true;
+    }
 
+    void PhysXScene::SubmitSimulation()
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::SubmitSimulation");
+
+        // Start the first tasks of the step together, once simulate has submitted all of them.
+        PhysXCpuDispatcher::TaskBatchScope taskBatchScope(m_cpuDispatcher);
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-        m_pxScene->simulate(deltatime);
+        m_pxScene->simulate(m_currentDeltaTime);
+    }
+
+    bool PhysXScene::IsSimulationComplete() const
+    {
+        return m_pxScene->checkResults(false);
     }
 
     void PhysXScene::FinishSimulation()
@@ -553,6 +604,9 @@ namespace PhysX
 
         if (!IsEnabled())
         {
+            // Async queries are still answered while the scene is disabled.
+            WaitForAsyncSceneQueries();
+            FlushCompletedAsyncSceneQueries();
             return;
         }
 
@@ -567,6 +621,9 @@ namespace PhysX
             m_pxScene->checkResults(true);
         }
 
+        // Finish the async queries before fetching the results, so they all see the scene state from before this step.
+        WaitForAsyncSceneQueries();
+
         bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::FetchResults");
@@ -577,7 +634,7 @@ namespace PhysX
             // Swap the buffers, invoke callbacks, build the list of active actors.
             m_pxScene->fetchResults(true);
         }
-        
+
         if (activeActorsEnabled)
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::ActiveActors");
@@ -588,18 +645,36 @@ namespace PhysX
             physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
             activeBodyHandles.reserve(numActiveActors);
+            m_activeRigidBodyTransforms.Clear();
+            m_activeRigidBodyTransforms.Reserve(numActiveActors);
             for (physx::PxU32 i = 0; i < numActiveActors; ++i)
             {
                 if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
                 {
                     activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+
+                    // Read the poses of the rigid bodies in the same pass, so they can be written back in bulk.
+                    if (actorData->GetRigidBody() != nullptr)
+                    {
+                        const physx::PxTransform pose = static_cast<physx::PxRigidActor*>(activeActors[i])->getGlobalPose();
+                        m_activeRigidBodyTransforms.m_bodyHandles.emplace_back(actorData->GetBodyHandle());
+                        m_activeRigidBodyTransforms.m_entityIds.emplace_back(actorData->GetEntityId());
+                        m_activeRigidBodyTransforms.m_positions.emplace_back(PxMathConvert(pose.p));
+                        m_activeRigidBodyTransforms.m_orientations.emplace_back(PxMathConvert(pose.q));
+                    }
                 }
             }
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
+        else
+        {
+            GatherTransformWriteBackBodies();
+        }
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
+        FlushCompletedAsyncSceneQueries();
+        ApplyTransformWriteBack();
 
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "OnSceneSimulationFinishedEvent::Signaled");
@@ -609,6 +684,137 @@ namespace PhysX
         UpdateAzProfilerDataPoints();
     }
 
+    void ActiveRigidBodyTransforms::Clear()
+    {
+        m_bodyHandles.clear();
+        m_entityIds.clear();
+        m_positions.clear();
+        m_orientations.clear();
+    }
+
+    void ActiveRigidBodyTransforms::Reserve(size_t size)
+    {
+        m_bodyHandles.reserve(size);
+        m_entityIds.reserve(size);
+        m_positions.reserve(size);
+        m_orientations.reserve(size);
+    }
+
+    void PhysXScene::SetTransformWriteBackEnabled(AzPhysics::SimulatedBodyHandle bodyHandle, bool enabled)
+    {
+        if (GetSimulatedBodyFromHandle(bodyHandle) == nullptr)
+        {
+            return;
+        }
+
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (index >= m_transformWriteBackEnabled.size())
+        {
+            m_transformWriteBackEnabled.resize(m_simulatedBodies.size(), 0);
+        }
+
+        if (static_cast<bool>(m_transformWriteBackEnabled[index]) != enabled)
+        {
+            m_transformWriteBackEnabled[index] = enabled ? 1 : 0;
+            m_numTransformWriteBackBodies = enabled ? m_numTransformWriteBackBodies + 1 : m_numTransformWriteBackBodies - 1;
+        }
+    }
+
+    bool PhysXScene::IsTransformWriteBackEnabled(AzPhysics::SimulatedBodyHandle bodyHandle) const
+    {
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        return index < m_transformWriteBackEnabled.size()
+            && m_simulatedBodies[index].first == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle)
+            && m_transformWriteBackEnabled[index] != 0;
+    }
+
+    void PhysXScene::RegisterActiveRigidBodyTransformsUpdatedHandler(OnActiveRigidBodyTransformsUpdatedEvent::Handler& handler)
+    {
+        handler.Connect(m_activeRigidBodyTransformsUpdatedEvent);
+    }
+
+    void PhysXScene::GatherTransformWriteBackBodies()
+    {
+        // Without active actors, read the poses of the awake bodies with write-back enabled.
+        m_activeRigidBodyTransforms.Clear();
+        if (m_numTransformWriteBackBodies == 0)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::GatherTransformWriteBackBodies");
+
+        m_activeRigidBodyTransforms.Reserve(m_numTransformWriteBackBodies);
+
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        for (size_t index = 0; index < m_transformWriteBackEnabled.size(); ++index)
+        {
+            AzPhysics::SimulatedBody* body = m_simulatedBodies[index].second;
+            if (m_transformWriteBackEnabled[index] == 0 || body == nullptr || !body->m_simulating)
+            {
+                continue;
+            }
+
+            auto* pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+            if (pxActor == nullptr || !pxActor->is<physx::PxRigidDynamic>())
+            {
+                continue;
+            }
+
+            auto* pxRigidDynamic = static_cast<physx::PxRigidDynamic*>(pxActor);
+            if (pxRigidDynamic->isSleeping())
+            {
+                continue;
+            }
+
+            const physx::PxTransform pose = pxRigidDynamic->getGlobalPose();
+            m_activeRigidBodyTransforms.m_bodyHandles.emplace_back(
+                m_simulatedBodies[index].first, aznumeric_cast<AzPhysics::SimulatedBodyIndex>(index));
+            m_activeRigidBodyTransforms.m_entityIds.emplace_back(body->GetEntityId());
+            m_activeRigidBodyTransforms.m_positions.emplace_back(PxMathConvert(pose.p));
+            m_activeRigidBodyTransforms.m_orientations.emplace_back(PxMathConvert(pose.q));
+        }
+    }
+
+    void PhysXScene::ApplyTransformWriteBack()
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::ApplyTransformWriteBack");
+
+        if (m_numTransformWriteBackBodies > 0)
+        {
+            const size_t numBodies = m_activeRigidBodyTransforms.GetSize();
+            for (size_t i = 0; i < numBodies; ++i)
+            {
+                const AzPhysics::SimulatedBodyHandle& bodyHandle = m_activeRigidBodyTransforms.m_bodyHandles[i];
+                if (!IsTransformWriteBackEnabled(bodyHandle))
+                {
+                    continue;
+                }
+
+                // Transform changed notifications are addressed per entity, and their handlers (child entities, render components,
+                // scripts) expect them for every entity, so they can't be merged across entities. Consumers that can work on all bodies
+                // at once should use the active rigid body transforms event instead. Here we only make sure each entity gets at most a
+                // single notification, by setting rotation and translation at once and skipping bodies that are awake but didn't move.
+                if (AZ::TransformInterface* transform = AZ::TransformBus::FindFirstHandler(m_activeRigidBodyTransforms.m_entityIds[i]))
+                {
+                    const AZ::Vector3& position = m_activeRigidBodyTransforms.m_positions[i];
+                    const AZ::Quaternion& orientation = m_activeRigidBodyTransforms.m_orientations[i];
+                    AZ::Transform worldTM = transform->GetWorldTM();
+                    if (worldTM.GetTranslation() == position && worldTM.GetRotation() == orientation)
+                    {
+                        continue;
+                    }
+
+                    worldTM.SetRotation(orientation);
+                    worldTM.SetTranslation(position);
+                    transform->SetWorldTM(worldTM);
+                }
+            }
+        }
+
+        m_activeRigidBodyTransformsUpdatedEvent.Signal(m_sceneHandle, m_activeRigidBodyTransforms);
+    }
+
     void PhysXScene::FlushQueuedEvents()
     {
         //send queued trigger events
@@ -766,6 +972,8 @@ namespace PhysX
 
             m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, bodyHandle);
 
+            SetTransformWriteBackEnabled(bodyHandle, false);
+
             m_deferredDeletions.push_back(m_simulatedBodies[index].second);
             m_simulatedBodies[index] = AZStd::make_pair(AZ::Crc32(), nullptr);
             m_freeSceneSlots.push(index);
@@ -950,26 +1158,153 @@ namespace PhysX
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        QuerySceneBatchInternal(requests, results);
+        return results;
+    }
+
+    void PhysXScene::QuerySceneBatchInternal(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch");
+
+        const size_t numRequests = requests.size();
+        results.clear();
+        results.resize(numRequests);
+
+        const AZ::u32 numWorkerThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        // a single job would only add overhead compared to running the batch on this thread
+        const size_t numJobs = AZStd::min<size_t>(numWorkerThreads, numRequests / MinNumRequestsPerBatchJob);
+        if (numJobs <= 1)
         {
-            results.emplace_back(QueryScene(request.get()));
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t i = 0; i < numRequests; ++i)
+            {
+                results[i] = QueryScene(requests[i].get());
+            }
+            return;
         }
-        return results;
+
+        // Each job keeps picking the next range of requests, as the cost of the requests can differ a lot.
+        // Every request writes to its own slot in the results, so the order matches the requests.
+        AZStd::atomic<size_t> nextRequestIndex{ 0 };
+        AZ::JobCompletion jobCompletion;
+        for (size_t j = 0; j < numJobs; ++j)
+        {
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, &requests, &results, &nextRequestIndex, numRequests]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch::Job");
+
+                PHYSX_SCENE_READ_LOCK(m_pxScene);
+                for (size_t begin = nextRequestIndex.fetch_add(MinNumRequestsPerBatchJob); begin < numRequests;
+                    begin = nextRequestIndex.fetch_add(MinNumRequestsPerBatchJob))
+                {
+                    const size_t end = AZStd::min(begin + MinNumRequestsPerBatchJob, numRequests);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        results[i] = QueryScene(requests[i].get());
+                    }
+                }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (!requestCopy)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests.emplace_back(AZStd::move(requestCopy));
+        asyncQuery->m_callback = AZStd::move(callback);
+        return StartAsyncSceneQuery(AZStd::move(asyncQuery));
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared with the caller, they must not be modified until the callback is called.
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests = requests;
+        asyncQuery->m_batchCallback = AZStd::move(callback);
+        return StartAsyncSceneQuery(AZStd::move(asyncQuery));
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    bool PhysXScene::StartAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            m_numRunningAsyncQueries++;
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::Job* job = AZ::CreateJobFunction([this, query = asyncQuery.release()]()
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::AsyncSceneQuery");
+
+            QuerySceneBatchInternal(query->m_requests, query->m_results);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            m_completedAsyncQueries.emplace_back(query);
+            m_numRunningAsyncQueries--;
+            m_asyncQueryCondition.notify_all();
+        }, true, jobContext);
+        job->Start();
+
+        return true;
+    }
+
+    void PhysXScene::WaitForAsyncSceneQueries()
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::WaitForAsyncSceneQueries");
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_asyncQueryMutex);
+        m_asyncQueryCondition.wait(lock, [this]() { return m_numRunningAsyncQueries == 0; });
+    }
+
+    void PhysXScene::FlushCompletedAsyncSceneQueries()
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::FlushCompletedAsyncSceneQueries");
+
+        // Take the completed queries first, so callbacks can start new async queries.
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> completedQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            completedQueries.swap(m_completedAsyncQueries);
+        }
+
+        for (AZStd::unique_ptr<AsyncSceneQuery>& query : completedQueries)
+        {
+            if (query->m_batchCallback)
+            {
+                query->m_batchCallback(query->m_requestId, AZStd::move(query->m_results));
+            }
+            else
+            {
+                query->m_callback(query->m_requestId, AZStd::move(query->m_results[0]));
+            }
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
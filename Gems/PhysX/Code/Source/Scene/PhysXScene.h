@@ -7,6 +7,13 @@
  */
 #pragma once
 
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsJoint.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -15,6 +22,7 @@
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <System/PhysXCpuDispatcher.h>
 
 namespace physx
 {
@@ -27,6 +35,24 @@ namespace physx
 
 namespace PhysX
 {
+    //! Poses of the rigid bodies that moved during the last simulation step, in structure of arrays layout.
+    //! Contains all active rigid bodies when active actors are enabled on the scene,
+    //! otherwise only the awake bodies which have transform write-back enabled.
+    struct ActiveRigidBodyTransforms
+    {
+        void Clear();
+        void Reserve(size_t size);
+        size_t GetSize() const { return m_bodyHandles.size(); }
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_bodyHandles;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Quaternion> m_orientations;
+    };
+
+    //! Signaled once per simulation step, after the entity transforms of all bodies with transform write-back enabled got updated.
+    using OnActiveRigidBodyTransformsUpdatedEvent = AZ::Event<AzPhysics::SceneHandle, const ActiveRigidBodyTransforms&>;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene
         : public AzPhysics::Scene
@@ -58,7 +84,10 @@ namespace PhysX
         AzPhysics::Joint* GetJointFromHandle(AzPhysics::JointHandle jointHandle) override;
         void RemoveJoint(AzPhysics::JointHandle jointHandle) override;
         AzPhysics::SceneQueryHits QueryScene(const AzPhysics::SceneQueryRequest* request) override;
+        //! Large batches are split across the job system. Filter callbacks of the requests may be called from worker threads.
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        //! The query runs on a worker thread against the scene as it is when the job runs.
+        //! The callback is called on the thread calling FinishSimulation, after the simulation results are fetched.
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -79,7 +108,45 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Enables writing the pose of the rigid body to the transform of its entity at the end of every simulation step.
+        //! All bodies with write-back enabled are updated in one pass, instead of each body updating its own entity.
+        void SetTransformWriteBackEnabled(AzPhysics::SimulatedBodyHandle bodyHandle, bool enabled);
+        bool IsTransformWriteBackEnabled(AzPhysics::SimulatedBodyHandle bodyHandle) const;
+
+        const ActiveRigidBodyTransforms& GetActiveRigidBodyTransforms() const { return m_activeRigidBodyTransforms; }
+        void RegisterActiveRigidBodyTransformsUpdatedHandler(OnActiveRigidBodyTransformsUpdatedEvent::Handler& handler);
+
+        //! StartSimulation split in two, for schedulers that step several scenes at the same time.
+        //! BeginSimulation signals the simulation start event, and returns false if the scene is disabled.
+        //! It must be called on the thread that calls FinishSimulation.
+        //! SubmitSimulation starts the PhysX simulation, it can be called from a job.
+        bool BeginSimulation(float deltatime);
+        void SubmitSimulation();
+
+        //! Check if the simulation step completed, without blocking. FinishSimulation still needs to be called afterwards.
+        bool IsSimulationComplete() const;
+
+        //! The number of requests a batch job takes at a time, and the minimum number of requests per job.
+        //! Batches are only split across jobs when they fill at least two jobs, so batches with fewer than 2 * MinNumRequestsPerBatchJob (128)
+        //! requests, or scenes without worker threads, are run on the calling thread.
+        static constexpr size_t MinNumRequestsPerBatchJob = 64;
+
     private:
+        //! An async scene query which is being processed on a worker thread, or waiting for its callback to be called.
+        struct AsyncSceneQuery
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQuery::AsyncCallback m_callback; //!< Set for single requests.
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback; //!< Set for batched requests.
+            AzPhysics::SceneQueryHitsList m_results;
+        };
+
+        void QuerySceneBatchInternal(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results);
+        bool StartAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery);
+        void WaitForAsyncSceneQueries();
+        void FlushCompletedAsyncSceneQueries();
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
@@ -90,6 +157,9 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        void GatherTransformWriteBackBodies();
+        void ApplyTransformWriteBack();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -118,5 +188,17 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        PhysXCpuDispatcher* m_cpuDispatcher = nullptr; //!< The dispatcher running the tasks of the scene, if it is a PhysXCpuDispatcher.
+
+        AZStd::vector<AZ::u8> m_transformWriteBackEnabled; //!< Per simulated body index, if the pose is written to the entity in bulk.
+        size_t m_numTransformWriteBackBodies = 0;
+        ActiveRigidBodyTransforms m_activeRigidBodyTransforms;
+        OnActiveRigidBodyTransformsUpdatedEvent m_activeRigidBodyTransformsUpdatedEvent;
+
+        AZStd::mutex m_asyncQueryMutex; //!< Guards the async scene query members below.
+        AZStd::condition_variable m_asyncQueryCondition; //!< Signaled when an async scene query completed.
+        size_t m_numRunningAsyncQueries = 0;
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> m_completedAsyncQueries;
     };
 }
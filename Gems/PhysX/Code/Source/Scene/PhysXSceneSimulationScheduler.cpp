@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneSimulationScheduler.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/clocks.h>
+
+#include <Scene/PhysXScene.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX
+{
+    PhysXSceneSimulationScheduler::PhysXSceneSimulationScheduler(PhysXSystem* physXSystem)
+        : m_physXSystem(physXSystem)
+    {
+    }
+
+    bool PhysXSceneSimulationScheduler::AddScene(AzPhysics::SceneHandle sceneHandle, float fixedTimeStep, AZ::u32 maxSubSteps)
+    {
+        if (fixedTimeStep <= 0.0f)
+        {
+            AZ_Error("PhysXSceneSimulationScheduler", false, "AddScene: The fixed time step must be positive, got %f", fixedTimeStep);
+            return false;
+        }
+
+        if (azrtti_cast<PhysXScene*>(m_physXSystem->GetScene(sceneHandle)) == nullptr)
+        {
+            AZ_Error("PhysXSceneSimulationScheduler", false, "AddScene: Scene not found");
+            return false;
+        }
+
+        RemoveScene(sceneHandle);
+
+        ScheduledScene scheduledScene;
+        scheduledScene.m_sceneHandle = sceneHandle;
+        scheduledScene.m_fixedTimeStep = fixedTimeStep;
+        scheduledScene.m_maxSubSteps = AZStd::max(maxSubSteps, 1u);
+        m_scenes.emplace_back(scheduledScene);
+        return true;
+    }
+
+    void PhysXSceneSimulationScheduler::RemoveScene(AzPhysics::SceneHandle sceneHandle)
+    {
+        m_scenes.erase(
+            AZStd::remove_if(m_scenes.begin(), m_scenes.end(),
+                [sceneHandle](const ScheduledScene& scheduledScene)
+                {
+                    return scheduledScene.m_sceneHandle == sceneHandle;
+                }),
+            m_scenes.end());
+    }
+
+    void PhysXSceneSimulationScheduler::RemoveAllScenes()
+    {
+        m_scenes.clear();
+    }
+
+    bool PhysXSceneSimulationScheduler::IsSceneScheduled(AzPhysics::SceneHandle sceneHandle) const
+    {
+        return GetSceneStepStats(sceneHandle) != nullptr;
+    }
+
+    const PhysXSceneSimulationScheduler::SceneStepStats* PhysXSceneSimulationScheduler::GetSceneStepStats(AzPhysics::SceneHandle sceneHandle) const
+    {
+        for (const ScheduledScene& scheduledScene : m_scenes)
+        {
+            if (scheduledScene.m_sceneHandle == sceneHandle)
+            {
+                return &scheduledScene.m_stats;
+            }
+        }
+        return nullptr;
+    }
+
+    void PhysXSceneSimulationScheduler::Simulate(float deltaTime)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXSceneSimulationScheduler::Simulate");
+
+        AZ::u32 numRounds = 0;
+        for (ScheduledScene& scheduledScene : m_scenes)
+        {
+            scheduledScene.m_stats = {};
+            scheduledScene.m_scene = azrtti_cast<PhysXScene*>(m_physXSystem->GetScene(scheduledScene.m_sceneHandle));
+            if (scheduledScene.m_scene == nullptr || !scheduledScene.m_scene->IsEnabled())
+            {
+                continue;
+            }
+
+            scheduledScene.m_accumulatedTime += deltaTime;
+            AZ::u32 numSubSteps = static_cast<AZ::u32>(scheduledScene.m_accumulatedTime / scheduledScene.m_fixedTimeStep);
+            if (numSubSteps > scheduledScene.m_maxSubSteps)
+            {
+                // Drop the time the scene can't catch up with, instead of falling further behind every frame.
+                numSubSteps = scheduledScene.m_maxSubSteps;
+                scheduledScene.m_accumulatedTime = numSubSteps * scheduledScene.m_fixedTimeStep;
+            }
+            scheduledScene.m_accumulatedTime -= numSubSteps * scheduledScene.m_fixedTimeStep;
+            scheduledScene.m_stats.m_numSubSteps = numSubSteps;
+            numRounds = AZStd::max(numRounds, numSubSteps);
+        }
+
+        // Every round steps all scenes which still have sub-steps left, so scenes with a small time step
+        // overlap with the others as much as possible.
+        for (AZ::u32 round = 0; round < numRounds; ++round)
+        {
+            m_steppingScenes.clear();
+            for (ScheduledScene& scheduledScene : m_scenes)
+            {
+                if (scheduledScene.m_stats.m_numSubSteps > round)
+                {
+                    m_steppingScenes.emplace_back(&scheduledScene);
+                }
+            }
+            StepScenes();
+        }
+
+        for (ScheduledScene& scheduledScene : m_scenes)
+        {
+            scheduledScene.m_scene = nullptr;
+        }
+    }
+
+    void PhysXSceneSimulationScheduler::StepScenes()
+    {
+        const AZStd::chrono::system_clock::time_point startTime = AZStd::chrono::system_clock::now();
+
+        // The start events are signaled on this thread, only the simulation itself is handed to the job system.
+        m_steppingScenes.erase(
+            AZStd::remove_if(m_steppingScenes.begin(), m_steppingScenes.end(),
+                [](ScheduledScene* scheduledScene)
+                {
+                    return !scheduledScene->m_scene->BeginSimulation(scheduledScene->m_fixedTimeStep);
+                }),
+            m_steppingScenes.end());
+
+        if (m_steppingScenes.size() == 1)
+        {
+            m_steppingScenes[0]->m_scene->SubmitSimulation();
+        }
+        else if (m_steppingScenes.size() > 1)
+        {
+            // Submitting from jobs lets dispatchers that run the tasks on the submitting thread simulate the scenes in parallel.
+            AZ::JobCompletion jobCompletion;
+            for (ScheduledScene* scheduledScene : m_steppingScenes)
+            {
+                PhysXScene* scene = scheduledScene->m_scene;
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([scene]()
+                    {
+                        scene->SubmitSimulation();
+                    }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // Fetch the results in the order the scenes complete, so a slow scene doesn't hold up the others.
+        while (!m_steppingScenes.empty())
+        {
+            auto completedSceneIt = AZStd::find_if(m_steppingScenes.begin(), m_steppingScenes.end(),
+                [](const ScheduledScene* scheduledScene)
+                {
+                    return scheduledScene->m_scene->IsSimulationComplete();
+                });
+            if (completedSceneIt == m_steppingScenes.end())
+            {
+                completedSceneIt = m_steppingScenes.begin();
+            }
+
+            ScheduledScene* scheduledScene = *completedSceneIt;
+            scheduledScene->m_scene->FinishSimulation();
+            scheduledScene->m_stats.m_stepTimeMs +=
+                AZStd::chrono::duration<float, AZStd::chrono::milliseconds::period>(AZStd::chrono::system_clock::now() - startTime).count();
+            m_steppingScenes.erase(completedSceneIt);
+        }
+    }
+} // namespace PhysX
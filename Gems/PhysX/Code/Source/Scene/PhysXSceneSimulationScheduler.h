@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace PhysX
+{
+    class PhysXScene;
+    class PhysXSystem;
+
+    //! Steps independent scenes at the same time, each with its own fixed time step.
+    //! The simulation of all scenes that take a sub-step runs on the job system concurrently, so the cost of stepping
+    //! the scenes scales with the number of cores instead of adding up.
+    //! All scene events are signaled on the thread that calls Simulate.
+    class PhysXSceneSimulationScheduler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXSceneSimulationScheduler, AZ::SystemAllocator, 0);
+
+        //! Statistics of a scene for the last Simulate call.
+        struct SceneStepStats
+        {
+            AZ::u32 m_numSubSteps = 0; //!< Number of fixed sub-steps the scene took.
+            float m_stepTimeMs = 0.0f; //!< Time from starting each sub-step until its results got fetched, summed over all sub-steps.
+        };
+
+        explicit PhysXSceneSimulationScheduler(PhysXSystem* physXSystem);
+
+        //! Let the scheduler step the scene. The physics system stops stepping the scene itself.
+        //! @param sceneHandle The scene to step.
+        //! @param fixedTimeStep The time step of every sub-step of the scene.
+        //! @param maxSubSteps Maximum number of sub-steps per Simulate call, any time beyond that is dropped.
+        //! @return False if the scene does not exist or the time step is not positive.
+        bool AddScene(AzPhysics::SceneHandle sceneHandle, float fixedTimeStep, AZ::u32 maxSubSteps = 4);
+        void RemoveScene(AzPhysics::SceneHandle sceneHandle);
+        void RemoveAllScenes();
+        bool IsSceneScheduled(AzPhysics::SceneHandle sceneHandle) const;
+        size_t GetNumScenes() const { return m_scenes.size(); }
+
+        //! Get the statistics of the last Simulate call, nullptr if the scene is not scheduled.
+        const SceneStepStats* GetSceneStepStats(AzPhysics::SceneHandle sceneHandle) const;
+
+        //! Advance the time of all scheduled scenes, and run as many fixed sub-steps as fit into their accumulated time.
+        void Simulate(float deltaTime);
+
+    private:
+        struct ScheduledScene
+        {
+            AzPhysics::SceneHandle m_sceneHandle;
+            float m_fixedTimeStep = 0.0f;
+            AZ::u32 m_maxSubSteps = 0;
+            float m_accumulatedTime = 0.0f;
+            PhysXScene* m_scene = nullptr; //!< Only valid during Simulate.
+            SceneStepStats m_stats;
+        };
+
+        //! Run one sub-step for each of the scenes in m_steppingScenes.
+        void StepScenes();
+
+        PhysXSystem* m_physXSystem = nullptr;
+        AZStd::vector<ScheduledScene> m_scenes;
+        AZStd::vector<ScheduledScene*> m_steppingScenes;
+    };
+} // namespace PhysX
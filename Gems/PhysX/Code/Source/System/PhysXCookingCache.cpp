@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Platform.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/time.h>
+#include <Source/Utils.h>
+#include <System/PhysXCookingCache.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Header of the cache files, followed by the cooked data.
+        struct CookingCacheFileHeader
+        {
+            static constexpr AZ::u32 Magic = 0x4b4f4f43; // "COOK"
+            //! Increase when the file layout or the data that goes into the cache key changes.
+            static constexpr AZ::u32 Version = 1;
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_version = Version;
+            AZ::u64 m_dataSize = 0;
+            AZ::u32 m_dataCrc = 0;
+            AZ::u32 m_padding = 0;
+        };
+
+        template<typename T>
+        void HashValue(AZ::Sha1& sha, T value)
+        {
+            sha.ProcessBytes(&value, sizeof(value));
+        }
+
+        void HashVertices(AZ::Sha1& sha, const AZ::Vector3* vertices, AZ::u32 vertexCount)
+        {
+            HashValue(sha, vertexCount);
+            // AZ::Vector3 may be padded, only the components take part in the hash.
+            for (AZ::u32 i = 0; i < vertexCount; ++i)
+            {
+                HashValue(sha, vertices[i].GetX());
+                HashValue(sha, vertices[i].GetY());
+                HashValue(sha, vertices[i].GetZ());
+            }
+        }
+
+        double TicksToNs(AZ::s64 ticks)
+        {
+            return static_cast<double>(ticks) * 1e9 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        }
+    } // namespace Internal
+
+    float PhysXCookingCacheStats::GetHitRate() const
+    {
+        return m_numRequests > 0 ? static_cast<float>(m_numHits) / static_cast<float>(m_numRequests) : 0.0f;
+    }
+
+    bool PhysXCookingFuture::IsValid() const
+    {
+        return m_state != nullptr;
+    }
+
+    bool PhysXCookingFuture::IsReady() const
+    {
+        return m_state && m_state->m_ready.load(AZStd::memory_order_acquire);
+    }
+
+    bool PhysXCookingFuture::Wait() const
+    {
+        AZ_Assert(m_state, "Waiting on an invalid cooking future.");
+        if (!IsReady())
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_state->m_mutex);
+            m_state->m_condition.wait(lock, [this]()
+                {
+                    return m_state->m_ready.load(AZStd::memory_order_acquire);
+                });
+        }
+        return m_state->m_success;
+    }
+
+    const AZStd::vector<AZ::u8>& PhysXCookingFuture::GetCookedData() const
+    {
+        Wait();
+        return m_state->m_cookedData;
+    }
+
+    PhysXCookingCache::PhysXCookingCache(physx::PxCooking* cooking)
+        : m_cooking(cooking)
+    {
+        AZ_Assert(m_cooking, "PhysXCookingCache requires a cooking object.");
+    }
+
+    PhysXCookingCache::~PhysXCookingCache()
+    {
+        // The cooking jobs use the cooking object, which gets released right after the cache.
+        while (m_numPendingJobs.load(AZStd::memory_order_acquire) > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        const PhysXCookingCacheStats stats = GetStats();
+        if (stats.m_numRequests > 0)
+        {
+            AZ_TracePrintf("PhysXCookingCache", "%llu cooking requests, hit rate %.1f%%, %.2f ms cooking, %.2f ms loading from the cache.\n",
+                stats.m_numRequests, stats.GetHitRate() * 100.0f, stats.m_cookingTimeNs / 1e6, stats.m_loadTimeNs / 1e6);
+        }
+    }
+
+    void PhysXCookingCache::SetCacheFolder(const AZStd::string& cacheFolder)
+    {
+        AZStd::string resolvedFolder;
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO && !cacheFolder.empty())
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            // Paths using an alias which is not set, e.g. @user@ in tools without a project, stay unresolved
+            // and leave the cache disabled.
+            if (fileIO->ResolvePath(resolvedPath, AZ::IO::PathView(cacheFolder)) &&
+                !resolvedPath.empty() && resolvedPath.Native().front() != '@')
+            {
+                if (fileIO->CreatePath(resolvedPath.c_str()))
+                {
+                    resolvedFolder = resolvedPath.c_str();
+                }
+                else
+                {
+                    AZ_Warning("PhysXCookingCache", false, "Unable to create the cooking cache folder '%s', the cache is disabled.",
+                        resolvedPath.c_str());
+                }
+            }
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheFolderMutex);
+        m_cacheFolder = AZStd::move(resolvedFolder);
+    }
+
+    AZStd::string PhysXCookingCache::GetCacheFolder() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheFolderMutex);
+        return m_cacheFolder;
+    }
+
+    bool PhysXCookingCache::CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZ::Sha1 sha;
+        BeginCacheKey(sha, CookedDataType::ConvexMesh);
+        Internal::HashVertices(sha, vertices, vertexCount);
+        AZ::u32 key[5];
+        sha.GetDigest(key);
+
+        return CookCached(key,
+            [this, vertices, vertexCount](physx::PxOutputStream& stream)
+            {
+                return Utils::CookConvexToPxOutputStream(*m_cooking, vertices, vertexCount, stream);
+            },
+            result);
+    }
+
+    bool PhysXCookingCache::CookTriangleMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+        const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZ::Sha1 sha;
+        BeginCacheKey(sha, CookedDataType::TriangleMesh);
+        Internal::HashVertices(sha, vertices, vertexCount);
+        Internal::HashValue(sha, indexCount);
+        sha.ProcessBytes(indices, indexCount * sizeof(AZ::u32));
+        AZ::u32 key[5];
+        sha.GetDigest(key);
+
+        return CookCached(key,
+            [this, vertices, vertexCount, indices, indexCount](physx::PxOutputStream& stream)
+            {
+                return Utils::CookTriangleMeshToToPxOutputStream(*m_cooking, vertices, vertexCount, indices, indexCount, stream);
+            },
+            result);
+    }
+
+    bool PhysXCookingCache::CookHeightField(const physx::PxHeightFieldSample* samples, AZ::u32 numRows, AZ::u32 numColumns,
+        AZStd::vector<AZ::u8>& result)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        const size_t numSamples = static_cast<size_t>(numRows) * numColumns;
+
+        AZ::Sha1 sha;
+        BeginCacheKey(sha, CookedDataType::HeightField);
+        Internal::HashValue(sha, numRows);
+        Internal::HashValue(sha, numColumns);
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            Internal::HashValue(sha, samples[i].height);
+            Internal::HashValue(sha, static_cast<AZ::u8>(samples[i].materialIndex0));
+            Internal::HashValue(sha, samples[i].materialIndex0.isBitSet());
+            Internal::HashValue(sha, static_cast<AZ::u8>(samples[i].materialIndex1));
+            Internal::HashValue(sha, samples[i].materialIndex1.isBitSet());
+        }
+        AZ::u32 key[5];
+        sha.GetDigest(key);
+
+        return CookCached(key,
+            [this, samples, numRows, numColumns](physx::PxOutputStream& stream)
+            {
+                physx::PxHeightFieldDesc heightFieldDesc;
+                heightFieldDesc.format = physx::PxHeightFieldFormat::eS16_TM;
+                heightFieldDesc.nbRows = numRows;
+                heightFieldDesc.nbColumns = numColumns;
+                heightFieldDesc.samples.data = samples;
+                heightFieldDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+                const bool success = m_cooking->cookHeightField(heightFieldDesc, stream);
+                AZ_Error("PhysXCookingCache", success, "Failed to cook height field with %u rows and %u columns.", numRows, numColumns);
+                return success;
+            },
+            result);
+    }
+
+    PhysXCookingFuture PhysXCookingCache::CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices)
+    {
+        return StartCookingJob(
+            [this, vertices = AZStd::move(vertices)](AZStd::vector<AZ::u8>& result)
+            {
+                return CookConvexMesh(vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()), result);
+            });
+    }
+
+    PhysXCookingFuture PhysXCookingCache::CookTriangleMeshAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices)
+    {
+        return StartCookingJob(
+            [this, vertices = AZStd::move(vertices), indices = AZStd::move(indices)](AZStd::vector<AZ::u8>& result)
+            {
+                return CookTriangleMesh(vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()),
+                    indices.data(), aznumeric_cast<AZ::u32>(indices.size()), result);
+            });
+    }
+
+    PhysXCookingFuture PhysXCookingCache::CookHeightFieldAsync(AZStd::vector<physx::PxHeightFieldSample> samples,
+        AZ::u32 numRows, AZ::u32 numColumns)
+    {
+        AZ_Assert(samples.size() == static_cast<size_t>(numRows) * numColumns, "Expected %u height field samples, got %zu.",
+            numRows * numColumns, samples.size());
+        return StartCookingJob(
+            [this, samples = AZStd::move(samples), numRows, numColumns](AZStd::vector<AZ::u8>& result)
+            {
+                return CookHeightField(samples.data(), numRows, numColumns, result);
+            });
+    }
+
+    PhysXCookingCacheStats PhysXCookingCache::GetStats() const
+    {
+        PhysXCookingCacheStats stats;
+        stats.m_numRequests = m_numRequests.load(AZStd::memory_order_relaxed);
+        stats.m_numHits = m_numHits.load(AZStd::memory_order_relaxed);
+        stats.m_numCooked = m_numCooked.load(AZStd::memory_order_relaxed);
+        stats.m_numFailed = m_numFailed.load(AZStd::memory_order_relaxed);
+        stats.m_cookingTimeNs = static_cast<AZ::u64>(Internal::TicksToNs(m_cookingTimeTicks.load(AZStd::memory_order_relaxed)));
+        stats.m_loadTimeNs = static_cast<AZ::u64>(Internal::TicksToNs(m_loadTimeTicks.load(AZStd::memory_order_relaxed)));
+        return stats;
+    }
+
+    bool PhysXCookingCache::CookCached(const CacheKey& key, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& result)
+    {
+        m_numRequests.fetch_add(1, AZStd::memory_order_relaxed);
+
+        const AZStd::string cacheFilePath = GetCacheFilePath(key);
+        if (!cacheFilePath.empty())
+        {
+            const AZStd::sys_time_t loadStartTime = AZStd::GetTimeNowTicks();
+            const bool loaded = ReadCacheFile(cacheFilePath, result);
+            m_loadTimeTicks.fetch_add(AZStd::GetTimeNowTicks() - loadStartTime, AZStd::memory_order_relaxed);
+            if (loaded)
+            {
+                m_numHits.fetch_add(1, AZStd::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        const AZStd::sys_time_t cookingStartTime = AZStd::GetTimeNowTicks();
+        physx::PxDefaultMemoryOutputStream memoryStream;
+        const bool cooked = cookFunction(memoryStream);
+        m_cookingTimeTicks.fetch_add(AZStd::GetTimeNowTicks() - cookingStartTime, AZStd::memory_order_relaxed);
+        if (!cooked)
+        {
+            m_numFailed.fetch_add(1, AZStd::memory_order_relaxed);
+            return false;
+        }
+
+        result.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+        m_numCooked.fetch_add(1, AZStd::memory_order_relaxed);
+
+        if (!cacheFilePath.empty())
+        {
+            WriteCacheFile(cacheFilePath, result);
+        }
+        return true;
+    }
+
+    void PhysXCookingCache::BeginCacheKey(AZ::Sha1& sha, CookedDataType dataType) const
+    {
+        Internal::HashValue(sha, Internal::CookingCacheFileHeader::Version);
+        Internal::HashValue(sha, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+        Internal::HashValue(sha, dataType);
+
+        // Hash the params one by one, the struct has padding.
+        const physx::PxCookingParams& params = m_cooking->getParams();
+        Internal::HashValue(sha, params.areaTestEpsilon);
+        Internal::HashValue(sha, params.planeTolerance);
+        Internal::HashValue(sha, static_cast<AZ::u32>(params.convexMeshCookingType));
+        Internal::HashValue(sha, params.suppressTriangleMeshRemapTable);
+        Internal::HashValue(sha, params.buildTriangleAdjacencies);
+        Internal::HashValue(sha, params.buildGPUData);
+        Internal::HashValue(sha, params.scale.length);
+        Internal::HashValue(sha, params.scale.speed);
+        Internal::HashValue(sha, static_cast<AZ::u32>(params.meshPreprocessParams));
+        Internal::HashValue(sha, params.meshWeldTolerance);
+        Internal::HashValue(sha, static_cast<AZ::u32>(params.midphaseDesc.getType()));
+        if (params.midphaseDesc.getType() == physx::PxMeshMidPhase::eBVH33)
+        {
+            Internal::HashValue(sha, static_cast<AZ::u32>(params.midphaseDesc.mBVH33Desc.meshCookingHint));
+            Internal::HashValue(sha, params.midphaseDesc.mBVH33Desc.meshSizePerformanceTradeOff);
+        }
+        else
+        {
+            Internal::HashValue(sha, params.midphaseDesc.mBVH34Desc.numPrimsPerLeaf);
+        }
+        Internal::HashValue(sha, params.gaussMapLimit);
+    }
+
+    bool PhysXCookingCache::ReadCacheFile(const AZStd::string& filePath, AZStd::vector<AZ::u8>& result) const
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO || !fileIO->Exists(filePath.c_str()))
+        {
+            return false;
+        }
+
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            return false;
+        }
+
+        // Validate the data size against the file before allocating for it, a corrupt header must not trigger a huge allocation.
+        AZ::u64 fileSize = 0;
+        Internal::CookingCacheFileHeader header;
+        bool valid = fileIO->Size(file, fileSize) &&
+            fileSize >= sizeof(header) &&
+            fileIO->Read(file, &header, sizeof(header), true) &&
+            header.m_magic == Internal::CookingCacheFileHeader::Magic &&
+            header.m_version == Internal::CookingCacheFileHeader::Version &&
+            header.m_dataSize == fileSize - sizeof(header);
+        if (valid)
+        {
+            result.resize_no_construct(header.m_dataSize);
+            valid = fileIO->Read(file, result.data(), header.m_dataSize, true) &&
+                AZ::Crc32(result.data(), result.size()) == AZ::Crc32(header.m_dataCrc);
+        }
+        fileIO->Close(file);
+
+        // Corrupt files get cooked again and overwritten.
+        AZ_Warning("PhysXCookingCache", valid, "Ignoring invalid cooking cache file '%s'.", filePath.c_str());
+        if (!valid)
+        {
+            result.clear();
+        }
+        return valid;
+    }
+
+    void PhysXCookingCache::WriteCacheFile(const AZStd::string& filePath, const AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO)
+        {
+            return;
+        }
+
+        // Write to a file of its own first, so other threads or processes never read a partially written cache file.
+        // Thread ids are only unique within a process, the process id keeps editor and game launcher instances apart.
+        const AZStd::string tempFilePath = AZStd::string::format("%s.%u.%zu.tmp", filePath.c_str(),
+            AZ::Platform::GetCurrentProcessId(), AZStd::hash<AZStd::thread::id>()(AZStd::this_thread::get_id()));
+
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(tempFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, file))
+        {
+            AZ_Warning("PhysXCookingCache", false, "Unable to write cooking cache file '%s'.", tempFilePath.c_str());
+            return;
+        }
+
+        Internal::CookingCacheFileHeader header;
+        header.m_dataSize = cookedData.size();
+        header.m_dataCrc = AZ::Crc32(cookedData.data(), cookedData.size());
+        const bool written = fileIO->Write(file, &header, sizeof(header)) &&
+            fileIO->Write(file, cookedData.data(), cookedData.size());
+        fileIO->Close(file);
+
+        // The cache file might have been written by someone else in the meantime, which has the same content.
+        if (!written || !fileIO->Rename(tempFilePath.c_str(), filePath.c_str()))
+        {
+            fileIO->Remove(tempFilePath.c_str());
+        }
+    }
+
+    AZStd::string PhysXCookingCache::GetCacheFilePath(const CacheKey& key) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheFolderMutex);
+        if (m_cacheFolder.empty())
+        {
+            return {};
+        }
+        return AZStd::string::format("%s/%08x%08x%08x%08x%08x.pxcooked", m_cacheFolder.c_str(), key[0], key[1], key[2], key[3], key[4]);
+    }
+
+    PhysXCookingFuture PhysXCookingCache::StartCookingJob(AZStd::function<bool(AZStd::vector<AZ::u8>& result)> cookFunction)
+    {
+        PhysXCookingFuture future;
+        future.m_state = AZStd::make_shared<PhysXCookingFuture::SharedState>();
+
+        m_numPendingJobs.fetch_add(1, AZStd::memory_order_acq_rel);
+        AZ::JobContext* jobContext = nullptr;
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, state = future.m_state, cookFunction = AZStd::move(cookFunction)]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXCookingCache::CookingJob");
+                state->m_success = cookFunction(state->m_cookedData);
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(state->m_mutex);
+                    state->m_ready.store(true, AZStd::memory_order_release);
+                }
+                state->m_condition.notify_all();
+                m_numPendingJobs.fetch_sub(1, AZStd::memory_order_acq_rel);
+            }, true, jobContext);
+        job->Start();
+
+        return future;
+    }
+} // namespace PhysX
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <PxPhysicsAPI.h>
+
+namespace AZ
+{
+    class Sha1;
+}
+
+namespace PhysX
+{
+    //! Statistics about the cooking requests handled by the cooking cache.
+    struct PhysXCookingCacheStats
+    {
+        AZ::u64 m_numRequests = 0; //!< Number of cooking requests.
+        AZ::u64 m_numHits = 0; //!< Number of requests served from the cache.
+        AZ::u64 m_numCooked = 0; //!< Number of requests which were cooked and added to the cache.
+        AZ::u64 m_numFailed = 0; //!< Number of requests for which cooking failed.
+        AZ::u64 m_cookingTimeNs = 0; //!< Time spent on cooking, in nanoseconds.
+        AZ::u64 m_loadTimeNs = 0; //!< Time spent on loading cooked data from the cache, in nanoseconds.
+
+        //! Fraction of the requests served from the cache, 0 if there were no requests.
+        float GetHitRate() const;
+    };
+
+    //! Result of an asynchronous cooking request, which becomes ready once the cooking job finished.
+    class PhysXCookingFuture
+    {
+    public:
+        PhysXCookingFuture() = default;
+
+        //! False for default constructed futures, which don't refer to a cooking request.
+        bool IsValid() const;
+        //! True once the cooking job finished, Wait and GetCookedData don't block after that.
+        bool IsReady() const;
+        //! Block until the cooking job finished.
+        //! @return True if the data was cooked successfully.
+        bool Wait() const;
+        //! Block until the cooking job finished and get the cooked data, which is empty if cooking failed.
+        const AZStd::vector<AZ::u8>& GetCookedData() const;
+
+    private:
+        friend class PhysXCookingCache;
+
+        struct SharedState
+        {
+            AZStd::mutex m_mutex;
+            AZStd::condition_variable m_condition;
+            AZStd::atomic_bool m_ready{ false };
+            bool m_success = false;
+            AZStd::vector<AZ::u8> m_cookedData;
+        };
+
+        AZStd::shared_ptr<SharedState> m_state;
+    };
+
+    //! Cooks convex meshes, triangle meshes and height fields, and keeps the cooked data in an on-disk cache.
+    //! The cache files are named after a hash of the input data and the cooking params in use, so colliders which get
+    //! generated at run-time with the same data, e.g. from procedural geometry, are only cooked once.
+    //! Cooking can run synchronously on the calling thread or asynchronously on the job system.
+    class PhysXCookingCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXCookingCache, AZ::SystemAllocator, 0);
+
+        //! The folder the cache files are written to by default.
+        static constexpr const char* DefaultCacheFolder = "@user@/PhysX/CookingCache";
+
+        explicit PhysXCookingCache(physx::PxCooking* cooking);
+        //! Waits for all asynchronous cooking requests to finish.
+        ~PhysXCookingCache();
+
+        PhysXCookingCache(const PhysXCookingCache&) = delete;
+        PhysXCookingCache& operator=(const PhysXCookingCache&) = delete;
+
+        //! Set the folder to keep the cooked data in. The folder may start with a file IO alias.
+        //! An empty folder disables the cache, requests are always cooked then.
+        void SetCacheFolder(const AZStd::string& cacheFolder);
+        //! Get the resolved cache folder, empty if the cache is disabled.
+        AZStd::string GetCacheFolder() const;
+
+        //! Cook a convex mesh from a point cloud.
+        //! @return True if the result holds the cooked data.
+        bool CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result);
+        //! Cook a triangle mesh, every 3 indices form one triangle.
+        //! @return True if the result holds the cooked data.
+        bool CookTriangleMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result);
+        //! Cook a height field from numRows * numColumns samples in row major order.
+        //! @return True if the result holds the cooked data.
+        bool CookHeightField(const physx::PxHeightFieldSample* samples, AZ::u32 numRows, AZ::u32 numColumns,
+            AZStd::vector<AZ::u8>& result);
+
+        //! Asynchronous versions of the cooking functions, which take ownership of the input data and cook it on the job system.
+        //! @{
+        PhysXCookingFuture CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices);
+        PhysXCookingFuture CookTriangleMeshAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices);
+        PhysXCookingFuture CookHeightFieldAsync(AZStd::vector<physx::PxHeightFieldSample> samples, AZ::u32 numRows, AZ::u32 numColumns);
+        //! @}
+
+        PhysXCookingCacheStats GetStats() const;
+
+    private:
+        enum class CookedDataType : AZ::u8
+        {
+            ConvexMesh,
+            TriangleMesh,
+            HeightField
+        };
+
+        using CookFunction = AZStd::function<bool(physx::PxOutputStream& stream)>;
+        using CacheKey = AZ::u32[5];
+
+        //! Look up the cooked data in the cache, or cook it and add it to the cache.
+        bool CookCached(const CacheKey& key, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& result);
+        //! Hash the data type and the current cooking params into the key, the input data gets added by the caller.
+        void BeginCacheKey(AZ::Sha1& sha, CookedDataType dataType) const;
+
+        bool ReadCacheFile(const AZStd::string& filePath, AZStd::vector<AZ::u8>& result) const;
+        void WriteCacheFile(const AZStd::string& filePath, const AZStd::vector<AZ::u8>& cookedData) const;
+        AZStd::string GetCacheFilePath(const CacheKey& key) const;
+
+        //! Run the cooking function on the job system and make its result available through the returned future.
+        PhysXCookingFuture StartCookingJob(AZStd::function<bool(AZStd::vector<AZ::u8>& result)> cookFunction);
+
+        physx::PxCooking* m_cooking = nullptr;
+
+        mutable AZStd::mutex m_cacheFolderMutex;
+        AZStd::string m_cacheFolder; //!< Resolved cache folder, empty if the cache is disabled.
+
+        AZStd::atomic<AZ::u64> m_numRequests{ 0 };
+        AZStd::atomic<AZ::u64> m_numHits{ 0 };
+        AZStd::atomic<AZ::u64> m_numCooked{ 0 };
+        AZStd::atomic<AZ::u64> m_numFailed{ 0 };
+        AZStd::atomic<AZ::s64> m_cookingTimeTicks{ 0 };
+        AZStd::atomic<AZ::s64> m_loadTimeTicks{ 0 };
+        AZStd::atomic<AZ::u32> m_numPendingJobs{ 0 };
+    };
+} // namespace PhysX
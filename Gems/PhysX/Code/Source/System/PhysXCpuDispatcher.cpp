@@ -6,25 +6,234 @@
  *
  */
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/time.h>
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
 namespace PhysX
 {
+    namespace Internal
+    {
+        //! The innermost task batch scope of the current thread.
+        thread_local PhysXCpuDispatcher::TaskBatchScope* CurrentTaskBatchScope = nullptr;
+    }
+
+    PhysXCpuDispatchStats PhysXCpuDispatchStats::operator-(const PhysXCpuDispatchStats& rhs) const
+    {
+        PhysXCpuDispatchStats result;
+        result.m_numTasks = m_numTasks - rhs.m_numTasks;
+        result.m_numJobs = m_numJobs - rhs.m_numJobs;
+        result.m_numBatches = m_numBatches - rhs.m_numBatches;
+        result.m_numCreatedJobs = m_numCreatedJobs - rhs.m_numCreatedJobs;
+        result.m_dispatchTimeNs = m_dispatchTimeNs - rhs.m_dispatchTimeNs;
+        return result;
+    }
+
+    PhysXCpuDispatcher::TaskBatchScope::TaskBatchScope(PhysXCpuDispatcher* dispatcher)
+        : m_dispatcher(dispatcher)
+        , m_parentScope(Internal::CurrentTaskBatchScope)
+    {
+        Internal::CurrentTaskBatchScope = this;
+    }
+
+    PhysXCpuDispatcher::TaskBatchScope::~TaskBatchScope()
+    {
+        Internal::CurrentTaskBatchScope = m_parentScope;
+        if (m_dispatcher && !m_tasks.empty())
+        {
+            m_dispatcher->StartJobs(m_tasks.data(), m_tasks.size());
+        }
+    }
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        DestroyJobs();
+    }
+
+    void PhysXCpuDispatcher::SetNumDedicatedWorkerThreads(AZ::u32 numWorkerThreads)
+    {
+        if (numWorkerThreads == GetNumDedicatedWorkerThreads())
+        {
+            return;
+        }
+
+        // The pooled jobs are bound to the job context they got created with.
+        DestroyJobs();
+        m_dedicatedJobContext.reset();
+        m_dedicatedJobManager.reset();
+
+        if (numWorkerThreads > 0)
+        {
+            AZ::JobManagerDesc desc;
+            const size_t numThreads = AZStd::min<size_t>(numWorkerThreads, desc.m_workerThreads.capacity());
+            for (size_t i = 0; i < numThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_dedicatedJobManager = AZStd::make_unique<AZ::JobManager>(desc);
+            m_dedicatedJobContext = AZStd::make_unique<AZ::JobContext>(*m_dedicatedJobManager);
+        }
+    }
+
+    AZ::u32 PhysXCpuDispatcher::GetNumDedicatedWorkerThreads() const
+    {
+        return m_dedicatedJobManager ? m_dedicatedJobManager->GetNumWorkerThreads() : 0;
+    }
+
+    PhysXCpuDispatchStats PhysXCpuDispatcher::GetStats() const
+    {
+        PhysXCpuDispatchStats stats;
+        stats.m_numTasks = m_numTasks.load(AZStd::memory_order_relaxed);
+        stats.m_numJobs = m_numStartedJobs.load(AZStd::memory_order_relaxed);
+        stats.m_numBatches = m_numBatches.load(AZStd::memory_order_relaxed);
+        stats.m_numCreatedJobs = m_numCreatedJobs.load(AZStd::memory_order_relaxed);
+        const double ticksToNs = 1e9 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        stats.m_dispatchTimeNs = static_cast<AZ::u64>(static_cast<double>(m_dispatchTimeTicks.load(AZStd::memory_order_relaxed)) * ticksToNs);
+        return stats;
+    }
+
+    void PhysXCpuDispatcher::ProcessTask(physx::PxBaseTask& task)
+    {
+        physx::PxBaseTask* currentTask = &task;
+        while (currentTask)
+        {
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, currentTask->getName());
+                currentTask->run();
+            }
+
+            // Collect the tasks that get released by the task which is done, and start them together.
+            // Tasks submitted while it runs are started right away, so they don't wait for it to finish.
+            TaskBatchScope batchScope(this);
+            currentTask->release();
+
+            // Keep running the first released task on this thread, as it most likely works on the data that is still in the cache.
+            currentTask = nullptr;
+            if (!batchScope.m_tasks.empty())
+            {
+                currentTask = batchScope.m_tasks.front();
+                if (batchScope.m_tasks.size() > 1)
+                {
+                    StartJobs(batchScope.m_tasks.data() + 1, batchScope.m_tasks.size() - 1);
+                }
+                batchScope.m_tasks.clear();
+            }
+        }
+    }
+
+    void PhysXCpuDispatcher::ReleaseJob(PhysXJob* job)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_jobPoolMutex);
+        m_freeJobs.push_back(job);
+    }
+
+    size_t PhysXCpuDispatcher::GetNumPooledJobs() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_jobPoolMutex);
+        return m_freeJobs.size();
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        m_numTasks.fetch_add(1, AZStd::memory_order_relaxed);
+
+        TaskBatchScope* batchScope = Internal::CurrentTaskBatchScope;
+        if (batchScope && batchScope->m_dispatcher == this)
+        {
+            if (batchScope->m_tasks.size() == batchScope->m_tasks.capacity())
+            {
+                StartJobs(batchScope->m_tasks.data(), batchScope->m_tasks.size());
+                batchScope->m_tasks.clear();
+            }
+            batchScope->m_tasks.push_back(&task);
+            return;
+        }
+
+        physx::PxBaseTask* tasks[] = { &task };
+        StartJobs(tasks, 1);
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        return GetJobContext()->GetJobManager().GetNumWorkerThreads();
     }
-} // namespace PhysX
 
+    void PhysXCpuDispatcher::StartJobs(physx::PxBaseTask* const* tasks, size_t numTasks)
+    {
+        const AZStd::sys_time_t startTime = AZStd::GetTimeNowTicks();
+
+        AZ::JobContext* jobContext = GetJobContext();
+        AZStd::fixed_vector<PhysXJob*, TaskBatchScope::MaxNumTasks> jobs;
+        for (size_t firstTask = 0; firstTask < numTasks; firstTask += jobs.size())
+        {
+            const size_t numJobs = AZStd::min(numTasks - firstTask, TaskBatchScope::MaxNumTasks);
+            jobs.resize(numJobs, nullptr);
+
+            // Take all jobs for the batch from the pool at once, and only create new ones when it runs dry.
+            size_t numCreatedJobs = 0;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_jobPoolMutex);
+                const size_t numPooledJobs = AZStd::min(numJobs, m_freeJobs.size());
+                AZStd::copy(m_freeJobs.end() - numPooledJobs, m_freeJobs.end(), jobs.begin());
+                m_freeJobs.resize(m_freeJobs.size() - numPooledJobs);
+                numCreatedJobs = numJobs - numPooledJobs;
+                m_numJobs += numCreatedJobs;
+            }
+
+            for (size_t i = numJobs - numCreatedJobs; i < numJobs; ++i)
+            {
+                jobs[i] = aznew PhysXJob(*this, jobContext);
+            }
+            m_numCreatedJobs.fetch_add(numCreatedJobs, AZStd::memory_order_relaxed);
+
+            for (size_t i = 0; i < numJobs; ++i)
+            {
+                jobs[i]->SetTask(*tasks[firstTask + i]);
+                jobs[i]->Start();
+            }
+        }
+
+        m_numStartedJobs.fetch_add(numTasks, AZStd::memory_order_relaxed);
+        m_numBatches.fetch_add(1, AZStd::memory_order_relaxed);
+        m_dispatchTimeTicks.fetch_add(AZStd::GetTimeNowTicks() - startTime, AZStd::memory_order_relaxed);
+    }
+
+    void PhysXCpuDispatcher::DestroyJobs()
+    {
+        // Jobs return themselves to the pool at the very end of processing, which can be just after PhysX
+        // got notified that the last task completed.
+        while (true)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_jobPoolMutex);
+                if (m_freeJobs.size() == m_numJobs)
+                {
+                    break;
+                }
+            }
+            AZStd::this_thread::yield();
+        }
+
+        for (PhysXJob* job : m_freeJobs)
+        {
+            delete job;
+        }
+        m_freeJobs.clear();
+        m_numJobs = 0;
+    }
+
+    AZ::JobContext* PhysXCpuDispatcher::GetJobContext() const
+    {
+        return m_dedicatedJobContext ? m_dedicatedJobContext.get() : AZ::JobContext::GetGlobalContext();
+    }
+} // namespace PhysX
@@ -7,25 +7,116 @@
  */
 
 #pragma once
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
 
+namespace AZ
+{
+    class JobContext;
+    class JobManager;
+}
+
 namespace PhysX
 {
+    class PhysXJob;
+
+    //! Statistics about the tasks the CPU dispatcher handed to the job system.
+    struct PhysXCpuDispatchStats
+    {
+        AZ::u64 m_numTasks = 0; //!< Number of tasks submitted by PhysX.
+        AZ::u64 m_numJobs = 0; //!< Number of jobs started for them. Tasks that run inline on the job which released them don't need one.
+        AZ::u64 m_numBatches = 0; //!< Number of batches the jobs got started in.
+        AZ::u64 m_numCreatedJobs = 0; //!< Number of jobs that got created because the pool ran dry. The other started jobs were reused.
+        AZ::u64 m_dispatchTimeNs = 0; //!< Time spent on acquiring and starting the jobs, in nanoseconds.
+
+        PhysXCpuDispatchStats operator-(const PhysXCpuDispatchStats& rhs) const;
+    };
+
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! The jobs that run the tasks are pooled, so dispatching a task does not allocate.
+    //! Tasks released by a task once it is done running are collected and started together.
+    //! The first of them keeps running on the same thread, without going through the job system.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator, 0);
 
+        //! Collects the tasks submitted by the current thread while in scope, and starts them together when going out of scope.
+        //! Tasks submitted to other dispatchers are not affected.
+        class TaskBatchScope
+        {
+        public:
+            explicit TaskBatchScope(PhysXCpuDispatcher* dispatcher);
+            ~TaskBatchScope();
+
+            TaskBatchScope(const TaskBatchScope&) = delete;
+            TaskBatchScope& operator=(const TaskBatchScope&) = delete;
+
+        private:
+            friend class PhysXCpuDispatcher;
+
+            static constexpr size_t MaxNumTasks = 64;
+
+            PhysXCpuDispatcher* m_dispatcher = nullptr;
+            TaskBatchScope* m_parentScope = nullptr;
+            AZStd::fixed_vector<physx::PxBaseTask*, MaxNumTasks> m_tasks;
+        };
+
         PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
-        
+        ~PhysXCpuDispatcher();
+
+        //! Run the tasks on a job manager with the given number of worker threads, owned by this dispatcher,
+        //! instead of on the global job manager. This keeps the physics tasks from competing with other systems.
+        //! Must not be called while tasks are in flight.
+        //! @param numWorkerThreads The number of dedicated worker threads, 0 to use the global job manager.
+        void SetNumDedicatedWorkerThreads(AZ::u32 numWorkerThreads);
+        AZ::u32 GetNumDedicatedWorkerThreads() const;
+
+        //! Get the statistics accumulated since the dispatcher got created.
+        //! The difference between two snapshots gives the statistics for a simulation step.
+        PhysXCpuDispatchStats GetStats() const;
+
+        //! Get the number of jobs which are back in the pool, ready to be reused.
+        size_t GetNumPooledJobs() const;
+
+        //! Run the task and all tasks it releases that can keep running on the current thread.
+        //! Called by the jobs the dispatcher started.
+        void ProcessTask(physx::PxBaseTask& task);
+
+        //! Return a job to the pool once it is done.
+        void ReleaseJob(PhysXJob* job);
+
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        //! Start a job for each of the given tasks.
+        void StartJobs(physx::PxBaseTask* const* tasks, size_t numTasks);
+
+        //! Wait until all jobs are back in the pool, and delete them.
+        void DestroyJobs();
+
+        AZ::JobContext* GetJobContext() const;
+
+        mutable AZStd::mutex m_jobPoolMutex;
+        AZStd::vector<PhysXJob*> m_freeJobs;
+        size_t m_numJobs = 0; //!< The number of jobs created, both free and in flight.
+
+        AZStd::unique_ptr<AZ::JobManager> m_dedicatedJobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_dedicatedJobContext;
+
+        AZStd::atomic<AZ::u64> m_numTasks{ 0 };
+        AZStd::atomic<AZ::u64> m_numStartedJobs{ 0 };
+        AZStd::atomic<AZ::u64> m_numBatches{ 0 };
+        AZStd::atomic<AZ::u64> m_numCreatedJobs{ 0 };
+        AZStd::atomic<AZ::s64> m_dispatchTimeTicks{ 0 };
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
@@ -6,21 +6,30 @@
  *
  */
 
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
-#include <AzCore/Debug/Profiler.h>
 
 namespace PhysX
 {
-    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context)
-        : AZ::Job(true, context)
-        , m_pxTask(pxTask)
+    PhysXJob::PhysXJob(PhysXCpuDispatcher& dispatcher, AZ::JobContext* context)
+        : AZ::Job(false, context)
+        , m_dispatcher(dispatcher)
     {
     }
 
+    void PhysXJob::SetTask(physx::PxBaseTask& pxTask)
+    {
+        Reset(true);
+        m_pxTask = &pxTask;
+    }
+
     void PhysXJob::Process()
     {
-        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, m_pxTask.getName());
-        m_pxTask.run();
-        m_pxTask.release();
+        m_dispatcher.ProcessTask(*m_pxTask);
+        m_pxTask = nullptr;
+
+        // The job manager does not touch non auto-delete jobs without a dependent after processing them,
+        // so the job can be reused as soon as it is back in the pool.
+        m_dispatcher.ReleaseJob(this);
     }
 }
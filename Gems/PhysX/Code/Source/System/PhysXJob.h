@@ -13,20 +13,27 @@
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     //! Handles PhysX tasks in the Open 3D Engine job scheduler.
+    //! The jobs are owned and reused by the CPU dispatcher, they return themselves to its pool once the task is done.
     class PhysXJob
         : public AZ::Job
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXJob, AZ::ThreadPoolAllocator, 0);
 
-        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr);
+        PhysXJob(PhysXCpuDispatcher& dispatcher, AZ::JobContext* context = nullptr);
         ~PhysXJob() = default;
 
+        //! Reset the job to run the given task. The job must not be in flight.
+        void SetTask(physx::PxBaseTask& pxTask);
+
     protected:
         void Process() override;
 
     private:
-        physx::PxBaseTask& m_pxTask;
+        PhysXCpuDispatcher& m_dispatcher;
+        physx::PxBaseTask* m_pxTask = nullptr;
     };
 }
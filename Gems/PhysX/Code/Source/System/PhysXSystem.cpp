@@ -5,12 +5,14 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
 #include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookingCache.h>
 #include <System/PhysXCpuDispatcher.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 
@@ -68,6 +70,7 @@ namespace PhysX
                 UpdateMaterialLibrary(materialLibrary);
             })
         , m_sceneInterface(this)
+        , m_sceneSimulationScheduler(this)
     {
         // Start PhysX allocator
         PhysXAllocator::Descriptor allocatorDescriptor;
@@ -97,6 +100,11 @@ namespace PhysX
             m_systemConfig = *physXConfig;
         }
 
+        if (m_physXCpuDispatcher)
+        {
+            m_physXCpuDispatcher->SetNumDedicatedWorkerThreads(m_systemConfig.m_numDedicatedWorkerThreads);
+        }
+
         AzFramework::AssetCatalogEventBus::Handler::BusConnect();
 
         m_state = State::Initialized;
@@ -138,11 +146,22 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
+        // Scenes with their own fixed time step are stepped by the scheduler.
+        auto isSceneScheduled = [this](AzPhysics::Scene* scene)
+        {
+            if (m_sceneSimulationScheduler.GetNumScenes() == 0)
+            {
+                return false;
+            }
+            auto* physXScene = azrtti_cast<PhysXScene*>(scene);
+            return physXScene && m_sceneSimulationScheduler.IsSceneScheduled(physXScene->GetSceneHandle());
+        };
+
+        auto simulateScenes = [this, &isSceneScheduled](float timeStep)
         {
             for (auto& scenePtr : m_sceneList)
             {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
+                if (scenePtr != nullptr && scenePtr->IsEnabled() && !isSceneScheduled(scenePtr.get()))
                 {
                     scenePtr->StartSimulation(timeStep);
                     scenePtr->FinishSimulation();
@@ -172,6 +191,9 @@ namespace PhysX
 #endif
         deltaTime = AZ::GetClamp(deltaTime, 0.0f, m_systemConfig.m_maxTimestep);
 
+        // The dispatcher runs the tasks of all scenes, which can be stepped at the same time, so its stats are only reported for all scenes together.
+        const PhysXCpuDispatchStats startCpuDispatchStats = m_physXCpuDispatcher ? m_physXCpuDispatcher->GetStats() : PhysXCpuDispatchStats();
+
         AZ_Assert(m_systemConfig.m_fixedTimestep >= 0.0f, "PhysXSystem - fixed timestep is negitive.");
         float tickTime = deltaTime;
         if (m_systemConfig.m_fixedTimestep > 0.0f) //use the fixed timestep
@@ -193,9 +215,38 @@ namespace PhysX
 
             simulateScenes(tickTime);
         }
+
+        if (m_sceneSimulationScheduler.GetNumScenes() > 0)
+        {
+            m_sceneSimulationScheduler.Simulate(deltaTime);
+        }
+
+        if (m_physXCpuDispatcher)
+        {
+            m_lastSimulateCpuDispatchStats = m_physXCpuDispatcher->GetStats() - startCpuDispatchStats;
+            ReportCpuDispatchStats();
+        }
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::ReportCpuDispatchStats() const
+    {
+        bool isProfilingActive = false;
+        AZ::Debug::ProfilerRequestBus::BroadcastResult(isProfilingActive, &AZ::Debug::ProfilerRequests::IsActive);
+        if (!isProfilingActive)
+        {
+            return;
+        }
+
+        [[maybe_unused]] const char* RootCategory = "PhysX/%s/%s";
+        [[maybe_unused]] const char* DispatcherSubCategory = "Dispatcher";
+        AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Physics, m_lastSimulateCpuDispatchStats.m_numTasks, RootCategory, DispatcherSubCategory, "Tasks");
+        AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Physics, m_lastSimulateCpuDispatchStats.m_numJobs, RootCategory, DispatcherSubCategory, "Jobs");
+        AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Physics, m_lastSimulateCpuDispatchStats.m_numBatches, RootCategory, DispatcherSubCategory, "Batches");
+        AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Physics, m_lastSimulateCpuDispatchStats.m_numCreatedJobs, RootCategory, DispatcherSubCategory, "CreatedJobs");
+        AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Physics, m_lastSimulateCpuDispatchStats.m_dispatchTimeNs, RootCategory, DispatcherSubCategory, "DispatchTimeNs");
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -311,6 +362,7 @@ namespace PhysX
                 if (scenePtr->GetId() == AZStd::get<AzPhysics::HandleTypeIndex::Crc>(handle))
                 {
                     m_sceneRemovedEvent.Signal(handle);
+                    m_sceneSimulationScheduler.RemoveScene(handle);
                     m_sceneList[index].reset();
                     m_freeSceneSlots.push(index);
                 }
@@ -328,6 +380,7 @@ namespace PhysX
 
     void PhysXSystem::RemoveAllScenes()
     {
+        m_sceneSimulationScheduler.RemoveAllScenes();
         m_sceneList.clear();
 
         //clear the free slots queue
@@ -387,6 +440,12 @@ namespace PhysX
             m_systemConfig = (*physXConfig);
             m_configChangeEvent.Signal(physXConfig);
 
+            // Configuration updates happen in between simulation steps, when there are no PhysX tasks in flight.
+            if (m_physXCpuDispatcher)
+            {
+                m_physXCpuDispatcher->SetNumDedicatedWorkerThreads(m_systemConfig.m_numDedicatedWorkerThreads);
+            }
+
             //LYN-1146 -- Restarting the simulation if required
 
             if (newMaterialLibrary)
@@ -415,6 +474,8 @@ namespace PhysX
 
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
+        m_cookingCache = AZStd::make_unique<PhysXCookingCache>(m_physXSdk.m_cooking);
+        m_cookingCache->SetCacheFolder(PhysXCookingCache::DefaultCacheFolder);
 
         // Set up CPU dispatcher
 #if defined(AZ_PLATFORM_LINUX)
@@ -422,7 +483,8 @@ namespace PhysX
         // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
         m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(0);
 #else
-        m_cpuDispatcher = PhysXCpuDispatcherCreate();
+        m_physXCpuDispatcher = PhysXCpuDispatcherCreate();
+        m_cpuDispatcher = m_physXCpuDispatcher;
 #endif
 
         PxSetProfilerCallback(&m_pxAzProfilerCallback);
@@ -432,7 +494,9 @@ namespace PhysX
     {
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
+        m_physXCpuDispatcher = nullptr;
 
+        m_cookingCache.reset();
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
 
@@ -10,6 +10,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/SystemConfiguration.h>
@@ -17,7 +18,9 @@
 #include <Configuration/PhysXSettingsRegistryManager.h>
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
+#include <Scene/PhysXSceneSimulationScheduler.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -33,6 +36,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXCookingCache;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
         , private AzFramework::AssetCatalogEventBus::Handler
@@ -80,6 +85,16 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Get the scheduler which steps independent scenes at the same time, each with its own fixed time step.
+        //! Scenes added to it are no longer stepped with the system's time step.
+        PhysXSceneSimulationScheduler& GetSceneSimulationScheduler() { return m_sceneSimulationScheduler; }
+        //! Get the CPU dispatcher that runs the PhysX tasks on the job system, nullptr if PhysX uses its own dispatcher.
+        PhysXCpuDispatcher* GetPhysXCpuDispatcher() { return m_physXCpuDispatcher; }
+        //! Get how many tasks PhysX handed to the job system during the last Simulate call, for all scenes together, and how long that took.
+        //! Only available when PhysX runs its tasks through a PhysXCpuDispatcher.
+        const PhysXCpuDispatchStats& GetLastSimulateCpuDispatchStats() const { return m_lastSimulateCpuDispatchStats; }
+        //! Get the cache used for cooking meshes and height fields at run-time.
+        PhysXCookingCache* GetCookingCache() { return m_cookingCache.get(); }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -90,6 +105,8 @@ namespace PhysX
         void InitializePhysXSdk(const physx::PxCookingParams& cookingParams);
         void ShutdownPhysXSdk();
         bool LoadMaterialLibrary();
+        //! Report the dispatcher stats of the last Simulate call to the profiler, when it is active.
+        void ReportCpuDispatchStats() const;
 
         // AzFramework::AssetCatalogEventBus::Handler ...
         void OnCatalogLoaded(const char* catalogFile) override;
@@ -108,11 +125,14 @@ namespace PhysX
             physx::PxCooking* m_cooking = nullptr;
         };
         PhysXSdk m_physXSdk;
+        AZStd::unique_ptr<PhysXCookingCache> m_cookingCache; //!< Cooks with m_physXSdk.m_cooking, and keeps the cooked data on disk.
         PxAzAllocatorCallback m_physXAllocatorCallback;
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXCpuDispatcher* m_physXCpuDispatcher = nullptr; //!< Same as m_cpuDispatcher, when it is a PhysXCpuDispatcher.
+        PhysXCpuDispatchStats m_lastSimulateCpuDispatchStats;
 
         enum class State : AZ::u8
         {
@@ -125,6 +145,7 @@ namespace PhysX
         Debug::PhysXDebug m_physXDebug; //! Handler for the PhysXDebug Interface.
         PhysXSettingsRegistryManager& m_registryManager; //! Handles all settings registry interactions.
         PhysXSceneInterface m_sceneInterface; //! Implemented the Scene Az::Interface.
+        PhysXSceneSimulationScheduler m_sceneSimulationScheduler; //! Steps the scenes that have their own fixed time step.
         PhysXJointHelpersInterface m_jointHelperInterface; //! Implementation of the JointHelpersInterface.
 
         class MaterialLibraryAssetHelper
@@ -22,6 +22,7 @@
 #include <Source/WindProvider.h>
 
 #include <PhysX/Debug/PhysXDebugInterface.h>
+#include <System/PhysXCookingCache.h>
 #include <System/PhysXSystem.h>
 
 namespace PhysX
@@ -283,27 +284,27 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
+        // Meshes generated at run-time tend to be the same every time, the cache saves cooking them again.
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = m_physXSystem->GetCookingCache()->CookConvexMesh(vertices, vertexCount, cookedData);
+
+        if (cookingResult)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
         }
-        
+
         return cookingResult;
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = m_physXSystem->GetCookingCache()->CookTriangleMesh(vertices, vertexCount, indices, indexCount, cookedData);
 
         if (cookingResult)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
         }
 
         return cookingResult;
@@ -487,6 +487,12 @@ namespace PhysX
             physx::PxCooking* cooking = nullptr;
             SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
 
+            return CookConvexToPxOutputStream(*cooking, vertices, vertexCount, stream);
+        }
+
+        bool CookConvexToPxOutputStream(physx::PxCooking& cooking, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            physx::PxOutputStream& stream)
+        {
             physx::PxConvexMeshDesc convexDesc;
             convexDesc.points.count = vertexCount;
             convexDesc.points.stride = sizeof(AZ::Vector3);
@@ -495,7 +501,7 @@ namespace PhysX
 
             physx::PxConvexMeshCookingResult::Enum resultCode = physx::PxConvexMeshCookingResult::eSUCCESS;
 
-            bool result = cooking->cookConvexMesh(convexDesc, stream, &resultCode);
+            bool result = cooking.cookConvexMesh(convexDesc, stream, &resultCode);
 
             AZ_Error("PhysX", result,
                 "CookConvexToPxOutputStream: Failed to cook convex mesh. Please check the data is correct. Error: %s",
@@ -510,6 +516,12 @@ namespace PhysX
             physx::PxCooking* cooking = nullptr;
             SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
 
+            return CookTriangleMeshToToPxOutputStream(*cooking, vertices, vertexCount, indices, indexCount, stream);
+        }
+
+        bool CookTriangleMeshToToPxOutputStream(physx::PxCooking& cooking, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream)
+        {
             // Validate indices size
             AZ_Error("PhysX", indexCount % 3 == 0, "Number of indices must be a multiple of 3.");
 
@@ -524,7 +536,7 @@ namespace PhysX
 
             physx::PxTriangleMeshCookingResult::Enum resultCode = physx::PxTriangleMeshCookingResult::eSUCCESS;
 
-            bool result = cooking->cookTriangleMesh(meshDesc, stream, &resultCode);
+            bool result = cooking.cookTriangleMesh(meshDesc, stream, &resultCode);
 
             AZ_Error("PhysX", result,
                 "CookTriangleMeshToToPxOutputStream: Failed to cook triangle mesh. Please check the data is correct. Error: %s.",
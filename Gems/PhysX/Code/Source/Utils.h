@@ -105,9 +105,13 @@ namespace PhysX
             Physics::CookedMeshShapeConfiguration::MeshType meshType);
 
         bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream);
+        bool CookConvexToPxOutputStream(physx::PxCooking& cooking, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            physx::PxOutputStream& stream);
 
         bool CookTriangleMeshToToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount,
             const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream);
+        bool CookTriangleMeshToToPxOutputStream(physx::PxCooking& cooking, const AZ::Vector3* vertices, AZ::u32 vertexCount,
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream);
 
         bool MeshDataToPxGeometry(physx::PxBase* meshData, physx::PxGeometryHolder &pxGeometry, const AZ::Vector3& scale);
 
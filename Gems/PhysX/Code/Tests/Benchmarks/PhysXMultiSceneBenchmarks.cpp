@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+
+#include <Benchmarks/PhysXBenchmarksUtilities.h>
+#include <Benchmarks/PhysXBenchmarksCommon.h>
+
+#include <PhysXTestCommon.h>
+#include <Scene/PhysXSceneSimulationScheduler.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX::Benchmarks
+{
+    namespace MultiSceneConstants
+    {
+        //! Controls the simulation length of the test. 5secs at 60fps
+        static const int GameFramesToSimulate = 300;
+
+        //! The size of the area the rigid bodies get spawned in, in every scene.
+        static const float SpawnAreaSize = 200.0f;
+
+        static const float BoxSize = 1.0f;
+
+        static const int NumRigidBodiesPerScene = 2000;
+
+        //! Constant seed to use with random number generation
+        static const long long RandGenSeed = 8010412111588; //(Number generated by concatenating 'PhysX' ascii character codes (80 104 121 115 88).
+
+        //! Flags to select how the scenes are stepped
+        static const int SequentialScenes = 0; // every scene is stepped after the other, like the physics system does
+        static const int ScheduledScenes = 1; // the scheduler steps all scenes at the same time
+    } // namespace MultiSceneConstants
+
+    //! Creates a number of independent scenes, each with a floor and a pile of rigid bodies falling onto it.
+    class PhysXMultiSceneBenchmarkFixture
+        : public PhysXBaseBenchmarkFixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            PhysXBaseBenchmarkFixture::SetUpInternal();
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            physicsSystem->RemoveScenes(m_sceneHandles);
+            m_sceneHandles.clear();
+            PhysXBaseBenchmarkFixture::TearDownInternal();
+        }
+
+    protected:
+        // PhysXBaseBenchmarkFixture Interface ---------
+        AzPhysics::SceneConfiguration GetDefaultSceneConfiguration() override
+        {
+            return AzPhysics::SceneConfiguration::CreateDefault();
+        }
+        // PhysXBaseBenchmarkFixture Interface ---------
+
+        void CreateScenes(int numScenes, int numRigidBodiesPerScene)
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            AZ::SimpleLcgRandom rand;
+            rand.SetSeed(MultiSceneConstants::RandGenSeed);
+
+            Utils::GenerateSpawnPositionFuncPtr posGenerator = [&rand](int idx) -> const AZ::Vector3
+            {
+                const float x = (rand.GetRandomFloat() - 0.5f) * MultiSceneConstants::SpawnAreaSize;
+                const float y = (rand.GetRandomFloat() - 0.5f) * MultiSceneConstants::SpawnAreaSize;
+                const float z = MultiSceneConstants::BoxSize + MultiSceneConstants::BoxSize * 0.1f * idx;
+                return AZ::Vector3(x, y, z);
+            };
+            auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(MultiSceneConstants::BoxSize));
+            Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+            {
+                return boxShapeConfiguration;
+            };
+
+            AzPhysics::SceneConfiguration sceneConfig = GetDefaultSceneConfiguration();
+            for (int i = 0; i < numScenes; ++i)
+            {
+                sceneConfig.m_sceneName = AZStd::string::format("MultiSceneBenchmark%d", i);
+                const AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(sceneConfig);
+                m_sceneHandles.emplace_back(sceneHandle);
+
+                TestUtils::AddStaticFloorToScene(sceneHandle);
+                Utils::CreateRigidBodies(numRigidBodiesPerScene, physicsSystem->GetScene(sceneHandle), false,
+                    &colliderGenerator, &posGenerator);
+            }
+        }
+
+        AzPhysics::SceneHandleList m_sceneHandles;
+    };
+
+    //! BM_MultiScene_Simulate - Steps the requested number of scenes with 2000 rigid bodies each, either one after the other
+    //! or all at the same time through the scene simulation scheduler.
+    //! Reports the frame times, and the cost of each scene step as the sub tick times.
+    //! state.range(0) - The number of scenes.
+    //! state.range(1) - MultiSceneConstants::SequentialScenes or MultiSceneConstants::ScheduledScenes.
+    BENCHMARK_DEFINE_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)(benchmark::State& state)
+    {
+        const int numScenes = static_cast<int>(state.range(0));
+        const bool scheduled = state.range(1) == MultiSceneConstants::ScheduledScenes;
+        CreateScenes(numScenes, MultiSceneConstants::NumRigidBodiesPerScene);
+
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        PhysXSceneSimulationScheduler& scheduler = GetPhysXSystem()->GetSceneSimulationScheduler();
+        if (scheduled)
+        {
+            for (const AzPhysics::SceneHandle& sceneHandle : m_sceneHandles)
+            {
+                scheduler.AddScene(sceneHandle, DefaultTimeStep);
+            }
+        }
+
+        Types::TimeList tickTimes;
+        Types::TimeList sceneStepTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < MultiSceneConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                if (scheduled)
+                {
+                    scheduler.Simulate(DefaultTimeStep);
+                    for (const AzPhysics::SceneHandle& sceneHandle : m_sceneHandles)
+                    {
+                        sceneStepTimes.emplace_back(scheduler.GetSceneStepStats(sceneHandle)->m_stepTimeMs);
+                    }
+                }
+                else
+                {
+                    for (const AzPhysics::SceneHandle& sceneHandle : m_sceneHandles)
+                    {
+                        auto sceneStart = AZStd::chrono::system_clock::now();
+                        AzPhysics::Scene* scene = physicsSystem->GetScene(sceneHandle);
+                        scene->StartSimulation(DefaultTimeStep);
+                        scene->FinishSimulation();
+                        sceneStepTimes.emplace_back(Types::double_milliseconds(AZStd::chrono::system_clock::now() - sceneStart).count());
+                    }
+                }
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+
+        scheduler.RemoveAllScenes();
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, sceneStepTimes);
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, sceneStepTimes);
+    }
+
+    BENCHMARK_REGISTER_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)
+        ->Args({ 1, MultiSceneConstants::SequentialScenes })
+        ->Args({ 1, MultiSceneConstants::ScheduledScenes })
+        ->Args({ 8, MultiSceneConstants::SequentialScenes })
+        ->Args({ 8, MultiSceneConstants::ScheduledScenes })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(1)
+        ;
+} // namespace PhysX::Benchmarks
+
+#endif // HAVE_BENCHMARK
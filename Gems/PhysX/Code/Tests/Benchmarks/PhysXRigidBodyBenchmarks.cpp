@@ -12,6 +12,8 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
 
 #include <Benchmarks/PhysXBenchmarksUtilities.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -19,6 +21,7 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX::Benchmarks
 {
@@ -71,6 +74,13 @@ namespace PhysX::Benchmarks
 
             //! Number of iterations for each test
             static const int NumIterations = 3;
+
+            //! Flags to select how the transform write-back benchmark writes the poses to the entities
+            static const int BulkTransformWriteBack = 0; // the scene writes all poses in one pass
+            static const int PerBodyTransformWriteBack = 1; // every body writes its own pose, like each rigid body component used to
+
+            //! Controls the simulation length of the transform write-back benchmark. 5secs at 60fps, the bodies keep falling during this time.
+            static const int TransformWriteBackFramesToSimulate = 300;
         } // namespace BenchmarkRange
     } // namespace RigidBodyConstants
 
@@ -466,6 +476,89 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! BM_RigidBody_TransformWriteBack - This test will spawn the requested number of rigid body entities high above the ground,
+    //! so all of them are falling, and measures the physics tick including writing the poses back to the entity transforms.
+    //! state.range(1) selects between the bulk write-back of the scene and a write-back per body.
+    //! The test will run the simulation for ~300 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)(benchmark::State& state)
+    {
+        const int numRigidBodies = static_cast<int>(state.range(0));
+        const bool perBodyWriteBack = static_cast<int>(state.range(1)) == RigidBodyConstants::BenchmarkSettings::PerBodyTransformWriteBack;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* physXScene = azdynamic_cast<PhysXScene*>(m_defaultScene);
+
+        //spawn the rigid body entities in a grid
+        const float boxSizeWithSpacing = RigidBodyConstants::RigidBodys::BoxSize + 2.0f;
+        const int boxesPerCol = static_cast<const int>(RigidBodyConstants::TerrainSize / boxSizeWithSpacing) - 1;
+        const AZ::Vector3 boxDimensions(RigidBodyConstants::RigidBodys::BoxSize);
+        AZStd::vector<EntityPtr> entities;
+        entities.reserve(numRigidBodies);
+        for (int i = 0; i < numRigidBodies; i++)
+        {
+            const float x = boxSizeWithSpacing + (boxSizeWithSpacing * (i % boxesPerCol));
+            const float y = boxSizeWithSpacing + (boxSizeWithSpacing * (i / boxesPerCol));
+            const float z = 1000.0f + boxSizeWithSpacing * (i / (boxesPerCol * boxesPerCol));
+            entities.emplace_back(PhysX::TestUtils::CreateBoxEntity(m_testSceneHandle, AZ::Vector3(x, y, z), boxDimensions));
+        }
+
+        //for the per body write-back, replace the bulk write-back with a handler per body doing what each rigid body component used to
+        AZStd::vector<AZStd::unique_ptr<AzPhysics::SceneEvents::OnSceneSimulationFinishHandler>> perBodyHandlers;
+        if (perBodyWriteBack)
+        {
+            perBodyHandlers.reserve(numRigidBodies);
+            for (const EntityPtr& entity : entities)
+            {
+                AzPhysics::RigidBody* rigidBody = nullptr;
+                Physics::RigidBodyRequestBus::EventResult(rigidBody, entity->GetId(), &Physics::RigidBodyRequests::GetRigidBody);
+                const AzPhysics::SimulatedBodyHandle bodyHandle = rigidBody->m_bodyHandle;
+                physXScene->SetTransformWriteBackEnabled(bodyHandle, false);
+
+                const AZ::EntityId entityId = entity->GetId();
+                auto handler = AZStd::make_unique<AzPhysics::SceneEvents::OnSceneSimulationFinishHandler>(
+                    [sceneInterface, bodyHandle, entityId](AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+                    {
+                        if (AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle))
+                        {
+                            AZ::TransformBus::Event(entityId, &AZ::TransformInterface::SetWorldRotationQuaternion, body->GetOrientation());
+                            AZ::TransformBus::Event(entityId, &AZ::TransformInterface::SetWorldTranslation, body->GetPosition());
+                        }
+                    });
+                sceneInterface->RegisterSceneSimulationFinishHandler(m_testSceneHandle, *handler);
+                perBodyHandlers.emplace_back(AZStd::move(handler));
+            }
+        }
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        Types::TimeList tickTimes;
+        tickTimes.reserve(RigidBodyConstants::BenchmarkSettings::TransformWriteBackFramesToSimulate);
+        for (auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::BenchmarkSettings::TransformWriteBackFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        //object clean up
+        perBodyHandlers.clear();
+        entities.clear();
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -500,5 +593,16 @@ namespace PhysX::Benchmarks
         ->Unit(benchmark::kMillisecond)
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)
+        ->Args({ 1024, RigidBodyConstants::BenchmarkSettings::BulkTransformWriteBack })
+        ->Args({ 1024, RigidBodyConstants::BenchmarkSettings::PerBodyTransformWriteBack })
+        ->Args({ 4096, RigidBodyConstants::BenchmarkSettings::BulkTransformWriteBack })
+        ->Args({ 4096, RigidBodyConstants::BenchmarkSettings::PerBodyTransformWriteBack })
+        ->Args({ 10000, RigidBodyConstants::BenchmarkSettings::BulkTransformWriteBack })
+        ->Args({ 10000, RigidBodyConstants::BenchmarkSettings::PerBodyTransformWriteBack })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
 } // namespace PhysX::Benchmarks
 #endif
@@ -13,6 +13,7 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 #include <Tests/PhysXGenericTestFixture.h>
 #include <Tests/PhysXTestCommon.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -40,6 +41,11 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        //! Number of raycasts in a single batch, like the line of sight and hit-scan checks of a server tick.
+        static const size_t NumBatchRays = 10000;
+        //! {number of box entities, max radius} used for the batch benchmarks.
+        static const std::vector<int64_t> BatchBenchmarkConfig = {1024, 32};
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -108,6 +114,22 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Creates raycasts from the origin towards random boxes.
+        AzPhysics::SceneQueryRequests CreateRaycastBatch(size_t numRays)
+        {
+            AzPhysics::SceneQueryRequests requests;
+            requests.reserve(numRays);
+            for (size_t i = 0; i < numRays; ++i)
+            {
+                AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = m_boxes[m_random.GetRandom() % m_numBoxes].GetNormalized();
+                request->m_distance = 2000.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+            return requests;
+        }
+
         std::vector<EntityPtr> m_entities;
         std::vector<AZ::Vector3> m_boxes;
         AZ::u32 m_numBoxes = 0;
@@ -209,6 +231,78 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Runs the batch of raycasts one by one on the calling thread, as baseline for the batched queries.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSequential)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(SceneQueryConstants::NumBatchRays);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(SceneQueryConstants::NumBatchRays);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! Runs a simulation step followed by the batch of raycasts, as baseline for the async batch.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_SimulateThenRaycastBatch)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(SceneQueryConstants::NumBatchRays);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            sceneInterface->StartSimulation(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            sceneInterface->FinishSimulation(m_testSceneHandle);
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! Runs the batch of raycasts async while the simulation step runs, the results arrive when the simulation finishes.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchDuringSimulate)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(SceneQueryConstants::NumBatchRays);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        size_t numResults = 0;
+        for (auto _ : state)
+        {
+            sceneInterface->StartSimulation(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&numResults](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    numResults += results.size();
+                });
+            benchmark::DoNotOptimize(queued);
+            sceneInterface->FinishSimulation(m_testSceneHandle);
+        }
+
+        AZ_Assert(numResults == state.iterations() * requests.size(), "Not all async raycasts completed.");
+        state.SetItemsProcessed(numResults);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -233,5 +327,24 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSequential)
+        ->Args(SceneQueryConstants::BatchBenchmarkConfig)
+        ->Unit(::benchmark::kMillisecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)
+        ->Args(SceneQueryConstants::BatchBenchmarkConfig)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_SimulateThenRaycastBatch)
+        ->Args(SceneQueryConstants::BatchBenchmarkConfig)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchDuringSimulate)
+        ->Args(SceneQueryConstants::BatchBenchmarkConfig)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
 }
 #endif
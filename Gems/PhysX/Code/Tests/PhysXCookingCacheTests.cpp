@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/FileIO.h>
+
+#include <System/PhysXCookingCache.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX
+{
+    namespace CookingCacheTestInternal
+    {
+        static constexpr const char* CacheFolder = "@test@/PhysXCookingCacheTests";
+
+        const AZStd::vector<AZ::Vector3> BoxVertices = {
+            AZ::Vector3(-1.0f, -1.0f, -1.0f), AZ::Vector3(1.0f, -1.0f, -1.0f),
+            AZ::Vector3(-1.0f, 1.0f, -1.0f), AZ::Vector3(1.0f, 1.0f, -1.0f),
+            AZ::Vector3(-1.0f, -1.0f, 1.0f), AZ::Vector3(1.0f, -1.0f, 1.0f),
+            AZ::Vector3(-1.0f, 1.0f, 1.0f), AZ::Vector3(1.0f, 1.0f, 1.0f)
+        };
+
+        const AZStd::vector<AZ::u32> BoxIndices = {
+            0, 2, 1, 1, 2, 3, // bottom
+            4, 5, 6, 5, 7, 6, // top
+            0, 1, 4, 1, 5, 4, // front
+            2, 6, 3, 3, 6, 7, // back
+            0, 4, 2, 2, 4, 6, // left
+            1, 3, 5, 3, 7, 5  // right
+        };
+
+        AZStd::vector<physx::PxHeightFieldSample> CreateHeightFieldSamples(AZ::u32 numRows, AZ::u32 numColumns)
+        {
+            AZStd::vector<physx::PxHeightFieldSample> samples(numRows * numColumns);
+            for (AZ::u32 i = 0; i < samples.size(); ++i)
+            {
+                samples[i].height = static_cast<physx::PxI16>(i % 7);
+                samples[i].materialIndex0 = physx::PxBitAndByte(0);
+                samples[i].materialIndex1 = physx::PxBitAndByte(0);
+            }
+            return samples;
+        }
+    }
+
+    class PhysXCookingCacheFixture
+        : public testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(CookingCacheTestInternal::CacheFolder);
+            m_cookingCache = AZStd::make_unique<PhysXCookingCache>(GetPhysXSystem()->GetPxCooking());
+            m_cookingCache->SetCacheFolder(CookingCacheTestInternal::CacheFolder);
+        }
+
+        void TearDown() override
+        {
+            m_cookingCache.reset();
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(CookingCacheTestInternal::CacheFolder);
+        }
+
+        AZStd::unique_ptr<PhysXCookingCache> m_cookingCache;
+    };
+
+    TEST_F(PhysXCookingCacheFixture, CookConvexMesh_SameDataTwice_SecondRequestIsCacheHit)
+    {
+        using namespace CookingCacheTestInternal;
+        ASSERT_FALSE(m_cookingCache->GetCacheFolder().empty());
+
+        AZStd::vector<AZ::u8> cookedData;
+        AZStd::vector<AZ::u8> cachedData;
+        EXPECT_TRUE(m_cookingCache->CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), cookedData));
+        EXPECT_TRUE(m_cookingCache->CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), cachedData));
+
+        EXPECT_FALSE(cookedData.empty());
+        EXPECT_EQ(cookedData, cachedData);
+
+        const PhysXCookingCacheStats stats = m_cookingCache->GetStats();
+        EXPECT_EQ(stats.m_numRequests, 2u);
+        EXPECT_EQ(stats.m_numCooked, 1u);
+        EXPECT_EQ(stats.m_numHits, 1u);
+        EXPECT_FLOAT_EQ(stats.GetHitRate(), 0.5f);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CookTriangleMesh_DifferentData_BothAreCooked)
+    {
+        using namespace CookingCacheTestInternal;
+
+        AZStd::vector<AZ::Vector3> scaledVertices = BoxVertices;
+        for (AZ::Vector3& vertex : scaledVertices)
+        {
+            vertex *= 2.0f;
+        }
+
+        AZStd::vector<AZ::u8> cookedData;
+        AZStd::vector<AZ::u8> scaledCookedData;
+        EXPECT_TRUE(m_cookingCache->CookTriangleMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()),
+            BoxIndices.data(), aznumeric_cast<AZ::u32>(BoxIndices.size()), cookedData));
+        EXPECT_TRUE(m_cookingCache->CookTriangleMesh(scaledVertices.data(), aznumeric_cast<AZ::u32>(scaledVertices.size()),
+            BoxIndices.data(), aznumeric_cast<AZ::u32>(BoxIndices.size()), scaledCookedData));
+
+        EXPECT_NE(cookedData, scaledCookedData);
+
+        const PhysXCookingCacheStats stats = m_cookingCache->GetStats();
+        EXPECT_EQ(stats.m_numCooked, 2u);
+        EXPECT_EQ(stats.m_numHits, 0u);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CacheFile_UsedByNewCache_IsCacheHit)
+    {
+        using namespace CookingCacheTestInternal;
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(m_cookingCache->CookTriangleMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()),
+            BoxIndices.data(), aznumeric_cast<AZ::u32>(BoxIndices.size()), cookedData));
+
+        // A new cache, as after restarting, still finds the cooked data on disk.
+        PhysXCookingCache otherCookingCache(GetPhysXSystem()->GetPxCooking());
+        otherCookingCache.SetCacheFolder(CacheFolder);
+
+        AZStd::vector<AZ::u8> cachedData;
+        EXPECT_TRUE(otherCookingCache.CookTriangleMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()),
+            BoxIndices.data(), aznumeric_cast<AZ::u32>(BoxIndices.size()), cachedData));
+
+        EXPECT_EQ(cookedData, cachedData);
+        EXPECT_EQ(otherCookingCache.GetStats().m_numHits, 1u);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CacheFile_DataSizeExceedsFile_IsCookedAgain)
+    {
+        using namespace CookingCacheTestInternal;
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(m_cookingCache->CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), cookedData));
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZStd::vector<AZStd::string> cacheFiles;
+        fileIO->FindFiles(CacheFolder, "*.pxcooked",
+            [&cacheFiles](const char* filePath)
+            {
+                cacheFiles.push_back(filePath);
+                return true;
+            });
+        ASSERT_EQ(cacheFiles.size(), 1u);
+
+        // Claim far more data than the file holds, which must not be allocated or read.
+        AZ::IO::HandleType file = AZ::IO::InvalidHandle;
+        ASSERT_TRUE(fileIO->Open(cacheFiles[0].c_str(), AZ::IO::OpenMode::ModeUpdate | AZ::IO::OpenMode::ModeBinary, file));
+        const AZ::s64 dataSizeOffset = 2 * sizeof(AZ::u32);
+        const AZ::u64 corruptDataSize = AZ::u64(1) << 60;
+        EXPECT_TRUE(fileIO->Seek(file, dataSizeOffset, AZ::IO::SeekType::SeekFromStart));
+        EXPECT_TRUE(fileIO->Write(file, &corruptDataSize, sizeof(corruptDataSize)));
+        fileIO->Close(file);
+
+        PhysXCookingCache otherCookingCache(GetPhysXSystem()->GetPxCooking());
+        otherCookingCache.SetCacheFolder(CacheFolder);
+
+        AZStd::vector<AZ::u8> recookedData;
+        EXPECT_TRUE(otherCookingCache.CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), recookedData));
+
+        EXPECT_EQ(cookedData, recookedData);
+        const PhysXCookingCacheStats stats = otherCookingCache.GetStats();
+        EXPECT_EQ(stats.m_numHits, 0u);
+        EXPECT_EQ(stats.m_numCooked, 1u);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CacheDisabled_RequestsAreAlwaysCooked)
+    {
+        using namespace CookingCacheTestInternal;
+        m_cookingCache->SetCacheFolder("");
+        EXPECT_TRUE(m_cookingCache->GetCacheFolder().empty());
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(m_cookingCache->CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), cookedData));
+        EXPECT_TRUE(m_cookingCache->CookConvexMesh(BoxVertices.data(), aznumeric_cast<AZ::u32>(BoxVertices.size()), cookedData));
+
+        const PhysXCookingCacheStats stats = m_cookingCache->GetStats();
+        EXPECT_EQ(stats.m_numCooked, 2u);
+        EXPECT_EQ(stats.m_numHits, 0u);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CookHeightFieldAsync_MatchesSynchronousCooking)
+    {
+        using namespace CookingCacheTestInternal;
+        const AZ::u32 numRows = 16;
+        const AZ::u32 numColumns = 8;
+        AZStd::vector<physx::PxHeightFieldSample> samples = CreateHeightFieldSamples(numRows, numColumns);
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(m_cookingCache->CookHeightField(samples.data(), numRows, numColumns, cookedData));
+
+        PhysXCookingFuture future = m_cookingCache->CookHeightFieldAsync(samples, numRows, numColumns);
+        ASSERT_TRUE(future.IsValid());
+        EXPECT_TRUE(future.Wait());
+        EXPECT_TRUE(future.IsReady());
+        EXPECT_EQ(future.GetCookedData(), cookedData);
+    }
+
+    TEST_F(PhysXCookingCacheFixture, CookAsync_ManyRequests_AllComplete)
+    {
+        using namespace CookingCacheTestInternal;
+        constexpr int NumRequests = 16;
+
+        AZStd::vector<PhysXCookingFuture> futures;
+        for (int i = 0; i < NumRequests; ++i)
+        {
+            AZStd::vector<AZ::Vector3> vertices = BoxVertices;
+            vertices[0] -= AZ::Vector3(static_cast<float>(i % 4));
+            futures.emplace_back(m_cookingCache->CookConvexMeshAsync(AZStd::move(vertices)));
+        }
+
+        for (const PhysXCookingFuture& future : futures)
+        {
+            EXPECT_TRUE(future.Wait());
+            EXPECT_FALSE(future.GetCookedData().empty());
+        }
+
+        // Requests for the same data which run at the same time may all cook it.
+        const PhysXCookingCacheStats stats = m_cookingCache->GetStats();
+        EXPECT_EQ(stats.m_numRequests, aznumeric_cast<AZ::u64>(NumRequests));
+        EXPECT_EQ(stats.m_numHits + stats.m_numCooked, aznumeric_cast<AZ::u64>(NumRequests));
+        EXPECT_GE(stats.m_numCooked, 4u);
+    }
+} // namespace PhysX
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <System/PhysXCpuDispatcher.h>
+
+namespace PhysX
+{
+    namespace CpuDispatcherTestInternal
+    {
+        //! Task that submits all its child tasks when it gets released, like PhysX does with the tasks that depend on it.
+        class TestTask
+            : public physx::PxBaseTask
+        {
+        public:
+            TestTask(physx::PxCpuDispatcher& dispatcher, AZStd::atomic<int>& numCompletedTasks)
+                : m_dispatcher(dispatcher)
+                , m_numCompletedTasks(numCompletedTasks)
+            {
+            }
+
+            void run() override
+            {
+                m_runThreadId = AZStd::this_thread::get_id();
+                if (m_submitChildrenWhileRunning)
+                {
+                    SubmitChildren();
+                }
+            }
+
+            const char* getName() const override { return "TestTask"; }
+            void addReference() override {}
+            void removeReference() override {}
+            int32_t getReference() const override { return 0; }
+
+            void release() override
+            {
+                if (!m_submitChildrenWhileRunning)
+                {
+                    SubmitChildren();
+                }
+                m_numCompletedTasks++;
+            }
+
+            AZStd::vector<AZStd::unique_ptr<TestTask>> m_children;
+            AZStd::thread::id m_runThreadId;
+            bool m_submitChildrenWhileRunning = false;
+
+        private:
+            void SubmitChildren()
+            {
+                for (auto& child : m_children)
+                {
+                    m_dispatcher.submitTask(*child);
+                }
+            }
+
+            physx::PxCpuDispatcher& m_dispatcher;
+            AZStd::atomic<int>& m_numCompletedTasks;
+        };
+
+        constexpr int TreeDepth = 3;
+        constexpr int TreeNumChildren = 6;
+        // Every task with children releases them in one batch, the first child keeps running inline and the others
+        // get a job each. The root task gets a job and a batch of its own.
+        constexpr int TreeNumInnerTasks = 1 + TreeNumChildren + TreeNumChildren * TreeNumChildren;
+        constexpr AZ::u64 TreeNumJobs = 1 + TreeNumInnerTasks * (TreeNumChildren - 1);
+        constexpr AZ::u64 TreeNumBatches = 1 + TreeNumInnerTasks;
+
+        //! Create a tree of tasks with the given depth, where every task releases numChildren tasks.
+        //! @return The root task, the total number of tasks is added to numTasks.
+        AZStd::unique_ptr<TestTask> CreateTaskTree(physx::PxCpuDispatcher& dispatcher, AZStd::atomic<int>& numCompletedTasks,
+            int depth, int numChildren, int& numTasks)
+        {
+            auto task = AZStd::make_unique<TestTask>(dispatcher, numCompletedTasks);
+            numTasks++;
+            if (depth > 0)
+            {
+                for (int i = 0; i < numChildren; ++i)
+                {
+                    task->m_children.emplace_back(CreateTaskTree(dispatcher, numCompletedTasks, depth - 1, numChildren, numTasks));
+                }
+            }
+            return task;
+        }
+
+        template<typename Predicate>
+        bool WaitFor(Predicate predicate)
+        {
+            const auto timeout = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(10);
+            while (!predicate())
+            {
+                if (AZStd::chrono::system_clock::now() > timeout)
+                {
+                    return false;
+                }
+                AZStd::this_thread::yield();
+            }
+            return true;
+        }
+
+        //! Wait for the given number of tasks to complete, and for the jobs that ran them to be back in the pool.
+        bool WaitForTasks(const PhysXCpuDispatcher& dispatcher, const AZStd::atomic<int>& numCompletedTasks, int numTasks)
+        {
+            return WaitFor([&numCompletedTasks, numTasks]() { return numCompletedTasks >= numTasks; })
+                && WaitFor([&dispatcher]() { return dispatcher.GetNumPooledJobs() == dispatcher.GetStats().m_numCreatedJobs; });
+        }
+
+        void CollectThreadIds(const TestTask& task, AZStd::vector<AZStd::thread::id>& threadIds)
+        {
+            threadIds.push_back(task.m_runThreadId);
+            for (const auto& child : task.m_children)
+            {
+                CollectThreadIds(*child, threadIds);
+            }
+        }
+
+        //! Check that the first child released by every task kept running on the thread of its parent.
+        void ExpectFirstChildrenRunInline(const TestTask& task)
+        {
+            if (!task.m_children.empty())
+            {
+                EXPECT_EQ(task.m_children.front()->m_runThreadId, task.m_runThreadId);
+            }
+            for (const auto& child : task.m_children)
+            {
+                ExpectFirstChildrenRunInline(*child);
+            }
+        }
+
+        //! Submit a tree of tasks and wait for all of them to complete.
+        //! @return The thread ids the tasks in the tree ran on.
+        AZStd::vector<AZStd::thread::id> RunTaskTree(PhysXCpuDispatcher& dispatcher)
+        {
+            physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+            AZStd::atomic<int> numCompletedTasks{ 0 };
+            int numTasks = 0;
+            AZStd::unique_ptr<TestTask> rootTask = CreateTaskTree(pxDispatcher, numCompletedTasks, TreeDepth, TreeNumChildren, numTasks);
+            pxDispatcher.submitTask(*rootTask);
+            EXPECT_TRUE(WaitForTasks(dispatcher, numCompletedTasks, numTasks));
+
+            ExpectFirstChildrenRunInline(*rootTask);
+            AZStd::vector<AZStd::thread::id> threadIds;
+            CollectThreadIds(*rootTask, threadIds);
+            EXPECT_EQ(threadIds.size(), aznumeric_cast<size_t>(numTasks));
+            return threadIds;
+        }
+
+        size_t CountDistinctThreadIds(AZStd::vector<AZStd::thread::id> threadIds)
+        {
+            AZStd::sort(threadIds.begin(), threadIds.end());
+            return AZStd::distance(threadIds.begin(), AZStd::unique(threadIds.begin(), threadIds.end()));
+        }
+    }
+
+    TEST(PhysXCpuDispatcherTest, SubmittedTasks_AllTasksRun)
+    {
+        PhysXCpuDispatcher dispatcher;
+        const AZStd::vector<AZStd::thread::id> threadIds = CpuDispatcherTestInternal::RunTaskTree(dispatcher);
+
+        const PhysXCpuDispatchStats stats = dispatcher.GetStats();
+        EXPECT_EQ(stats.m_numTasks, aznumeric_cast<AZ::u64>(threadIds.size()));
+        // The first task released by a task runs inline, instead of getting its own job.
+        EXPECT_EQ(stats.m_numJobs, CpuDispatcherTestInternal::TreeNumJobs);
+        EXPECT_EQ(stats.m_numBatches, CpuDispatcherTestInternal::TreeNumBatches);
+        EXPECT_LE(stats.m_numCreatedJobs, stats.m_numJobs);
+    }
+
+    TEST(PhysXCpuDispatcherTest, SubmittedTasks_RunOneAfterAnother_SingleJobIsReused)
+    {
+        constexpr int NumTasks = 10;
+
+        PhysXCpuDispatcher dispatcher;
+        physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+        AZStd::atomic<int> numCompletedTasks{ 0 };
+        CpuDispatcherTestInternal::TestTask task(pxDispatcher, numCompletedTasks);
+        for (int i = 0; i < NumTasks; ++i)
+        {
+            pxDispatcher.submitTask(task);
+            EXPECT_TRUE(CpuDispatcherTestInternal::WaitForTasks(dispatcher, numCompletedTasks, i + 1));
+        }
+
+        const PhysXCpuDispatchStats stats = dispatcher.GetStats();
+        EXPECT_EQ(stats.m_numJobs, aznumeric_cast<AZ::u64>(NumTasks));
+        EXPECT_EQ(stats.m_numCreatedJobs, 1u);
+        EXPECT_EQ(dispatcher.GetNumPooledJobs(), 1u);
+    }
+
+    TEST(PhysXCpuDispatcherTest, SubmittedTasks_RunTwice_AllTasksRunWithPooledJobs)
+    {
+        PhysXCpuDispatcher dispatcher;
+        const size_t numTasks = CpuDispatcherTestInternal::RunTaskTree(dispatcher).size();
+        const PhysXCpuDispatchStats firstRunStats = dispatcher.GetStats();
+        CpuDispatcherTestInternal::RunTaskTree(dispatcher);
+        const PhysXCpuDispatchStats secondRunStats = dispatcher.GetStats() - firstRunStats;
+
+        EXPECT_EQ(secondRunStats.m_numTasks, aznumeric_cast<AZ::u64>(numTasks));
+        EXPECT_EQ(secondRunStats.m_numJobs, CpuDispatcherTestInternal::TreeNumJobs);
+
+        // The second run only creates jobs when it has more of them in flight at once than the first run had,
+        // so over both runs at least as many jobs get reused as a single run starts.
+        const PhysXCpuDispatchStats stats = dispatcher.GetStats();
+        EXPECT_LE(stats.m_numCreatedJobs, CpuDispatcherTestInternal::TreeNumJobs);
+        EXPECT_GE(stats.m_numJobs - stats.m_numCreatedJobs, CpuDispatcherTestInternal::TreeNumJobs);
+        EXPECT_EQ(dispatcher.GetNumPooledJobs(), stats.m_numCreatedJobs);
+    }
+
+    TEST(PhysXCpuDispatcherTest, TaskSubmitsWhileRunning_TasksStartWithoutWaitingForIt)
+    {
+        PhysXCpuDispatcher dispatcher;
+        physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+        AZStd::atomic<int> numCompletedTasks{ 0 };
+        int numTasks = 0;
+        AZStd::unique_ptr<CpuDispatcherTestInternal::TestTask> rootTask =
+            CpuDispatcherTestInternal::CreateTaskTree(pxDispatcher, numCompletedTasks, 1, 3, numTasks);
+        rootTask->m_submitChildrenWhileRunning = true;
+        pxDispatcher.submitTask(*rootTask);
+        EXPECT_TRUE(CpuDispatcherTestInternal::WaitForTasks(dispatcher, numCompletedTasks, numTasks));
+
+        // Tasks submitted from run() are not collected into the batch of the released tasks, so none of them runs inline.
+        const PhysXCpuDispatchStats stats = dispatcher.GetStats();
+        EXPECT_EQ(stats.m_numTasks, aznumeric_cast<AZ::u64>(numTasks));
+        EXPECT_EQ(stats.m_numJobs, aznumeric_cast<AZ::u64>(numTasks));
+        EXPECT_EQ(stats.m_numBatches, aznumeric_cast<AZ::u64>(numTasks));
+    }
+
+    TEST(PhysXCpuDispatcherTest, DedicatedWorkerThreads_TasksRunOnDedicatedWorkers)
+    {
+        constexpr AZ::u32 NumDedicatedWorkerThreads = 2;
+        const AZStd::thread::id mainThreadId = AZStd::this_thread::get_id();
+
+        PhysXCpuDispatcher dispatcher;
+        physx::PxCpuDispatcher& pxDispatcher = dispatcher;
+        const AZStd::vector<AZStd::thread::id> globalThreadIds = CpuDispatcherTestInternal::RunTaskTree(dispatcher);
+        EXPECT_EQ(AZStd::find(globalThreadIds.begin(), globalThreadIds.end(), mainThreadId), globalThreadIds.end());
+
+        dispatcher.SetNumDedicatedWorkerThreads(NumDedicatedWorkerThreads);
+        EXPECT_EQ(dispatcher.GetNumDedicatedWorkerThreads(), NumDedicatedWorkerThreads);
+        EXPECT_EQ(pxDispatcher.getWorkerCount(), NumDedicatedWorkerThreads);
+        // The jobs of the global job manager got destroyed, the dedicated job manager needs its own.
+        EXPECT_EQ(dispatcher.GetNumPooledJobs(), 0u);
+
+        const AZStd::vector<AZStd::thread::id> dedicatedThreadIds = CpuDispatcherTestInternal::RunTaskTree(dispatcher);
+        EXPECT_EQ(AZStd::find(dedicatedThreadIds.begin(), dedicatedThreadIds.end(), mainThreadId), dedicatedThreadIds.end());
+        EXPECT_LE(CpuDispatcherTestInternal::CountDistinctThreadIds(dedicatedThreadIds), NumDedicatedWorkerThreads);
+        for (const AZStd::thread::id& threadId : dedicatedThreadIds)
+        {
+            EXPECT_EQ(AZStd::find(globalThreadIds.begin(), globalThreadIds.end(), threadId), globalThreadIds.end());
+        }
+
+        dispatcher.SetNumDedicatedWorkerThreads(0);
+        EXPECT_EQ(dispatcher.GetNumDedicatedWorkerThreads(), 0u);
+        const AZStd::vector<AZStd::thread::id> threadIds = CpuDispatcherTestInternal::RunTaskTree(dispatcher);
+        for (const AZStd::thread::id& threadId : threadIds)
+        {
+            EXPECT_EQ(AZStd::find(dedicatedThreadIds.begin(), dedicatedThreadIds.end(), threadId), dedicatedThreadIds.end());
+        }
+    }
+} // namespace PhysX
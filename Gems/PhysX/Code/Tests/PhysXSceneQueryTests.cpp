@@ -17,8 +17,10 @@
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 
 #include <RigidBodyComponent.h>
+#include <Scene/PhysXScene.h>
 #include <SphereColliderComponent.h>
 
 namespace PhysX
@@ -1009,4 +1011,132 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_MatchesQueryScene)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f)
+        };
+
+        for (const AZ::Vector3& pos : positions)
+        {
+            TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f);
+        }
+
+        //create enough raycast requests for the batch to be split across jobs, with some rays missing all bodies
+        const size_t numRequests = PhysXScene::MinNumRequestsPerBatchJob * 16;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = (i % 5 == 4) ? AZ::Vector3::CreateAxisZ() : positions[i % 5].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result matches the result of a single query
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits expectedResult = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expectedResult.m_hits.size());
+            for (size_t j = 0; j < expectedResult.m_hits.size(); j++)
+            {
+                EXPECT_TRUE(results[i].m_hits[j].m_bodyHandle == expectedResult.m_hits[j].m_bodyHandle);
+            }
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackCalledOnFinishSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle boxHandle = TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        //the request is copied, so it can go out of scope before the query runs
+        AzPhysics::SceneQueryHits asyncResult;
+        int numCallbacks = 0;
+        {
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3::CreateZero();
+            request.m_direction = AZ::Vector3::CreateAxisX();
+            request.m_distance = 200.0f;
+
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 7, &request,
+                [&asyncResult, &numCallbacks](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+                {
+                    EXPECT_EQ(requestId, 7);
+                    asyncResult = AZStd::move(hits);
+                    numCallbacks++;
+                });
+            EXPECT_TRUE(queued);
+        }
+
+        //the callback is only called at the sync point
+        EXPECT_EQ(numCallbacks, 0);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(numCallbacks, 1);
+        ASSERT_EQ(asyncResult.m_hits.size(), 1);
+        EXPECT_TRUE(asyncResult.m_hits[0].m_bodyHandle == boxHandle);
+
+        //the callback is only called once
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(numCallbacks, 1);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddStaticBoxToScene(m_testSceneHandle, pos));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 3, requests,
+            [&results](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                EXPECT_EQ(requestId, 3);
+                results = AZStd::move(hits);
+            });
+        EXPECT_TRUE(queued);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        //results should be in the same order as the requests
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
 }
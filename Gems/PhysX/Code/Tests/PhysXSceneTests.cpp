@@ -8,9 +8,12 @@
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -519,6 +522,78 @@ namespace PhysX
         EXPECT_TRUE(eventTriggered);
     }
 
+    TEST_F(PhysXSceneFixture, TransformWriteBack_DynamicRigidBodyEntity_EntityTransformUpdated)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* scene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        const AZ::Vector3 startPosition(0.0f, 0.0f, 10.0f);
+        EntityPtr boxEntity = TestUtils::CreateBoxEntity(m_testSceneHandle, startPosition, AZ::Vector3::CreateOne());
+
+        AzPhysics::RigidBody* rigidBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(rigidBody, boxEntity->GetId(), &Physics::RigidBodyRequests::GetRigidBody);
+        ASSERT_NE(rigidBody, nullptr);
+
+        // dynamic bodies have their entity transform written by the scene in bulk
+        EXPECT_TRUE(scene->IsTransformWriteBackEnabled(rigidBody->m_bodyHandle));
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        AZ::Vector3 entityPosition = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(entityPosition, boxEntity->GetId(), &AZ::TransformInterface::GetWorldTranslation);
+        EXPECT_LT(entityPosition.GetZ(), startPosition.GetZ());
+        EXPECT_TRUE(entityPosition.IsClose(rigidBody->GetPosition()));
+
+        // kinematic bodies go through the rigid body component instead
+        Physics::RigidBodyRequestBus::Event(boxEntity->GetId(), &Physics::RigidBodyRequests::SetKinematic, true);
+        EXPECT_FALSE(scene->IsTransformWriteBackEnabled(rigidBody->m_bodyHandle));
+    }
+
+    namespace
+    {
+        class TransformChangedCounter
+            : public AZ::TransformNotificationBus::Handler
+        {
+        public:
+            explicit TransformChangedCounter(AZ::EntityId entityId)
+            {
+                AZ::TransformNotificationBus::Handler::BusConnect(entityId);
+            }
+
+            ~TransformChangedCounter()
+            {
+                AZ::TransformNotificationBus::Handler::BusDisconnect();
+            }
+
+            void OnTransformChanged([[maybe_unused]] const AZ::Transform& local, [[maybe_unused]] const AZ::Transform& world) override
+            {
+                m_numNotifications++;
+            }
+
+            int m_numNotifications = 0;
+        };
+    } // namespace
+
+    TEST_F(PhysXSceneFixture, TransformWriteBack_OnlyMovedBodiesNotifyOncePerStep)
+    {
+        EntityPtr fallingEntity = TestUtils::CreateBoxEntity(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), AZ::Vector3::CreateOne());
+        EntityPtr floatingEntity = TestUtils::CreateBoxEntity(m_testSceneHandle, AZ::Vector3(5.0f, 0.0f, 10.0f), AZ::Vector3::CreateOne());
+
+        // the floating body stays awake, but doesn't move
+        Physics::RigidBodyRequestBus::Event(floatingEntity->GetId(), &Physics::RigidBodyRequests::SetGravityEnabled, false);
+        Physics::RigidBodyRequestBus::Event(floatingEntity->GetId(), &Physics::RigidBodyRequests::ForceAwake);
+
+        TransformChangedCounter fallingCounter(fallingEntity->GetId());
+        TransformChangedCounter floatingCounter(floatingEntity->GetId());
+
+        const int numSteps = 10;
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, numSteps);
+
+        EXPECT_EQ(fallingCounter.m_numNotifications, numSteps);
+        EXPECT_EQ(floatingCounter.m_numNotifications, 0);
+    }
+
     class PhysXSceneActiveSimulatedBodiesFixture
         : public testing::Test
     {
@@ -585,4 +660,41 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, ActiveRigidBodyTransforms_CorrectlyReported)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* scene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        AzPhysics::RigidBodyConfiguration rigidConfig;
+        rigidConfig.m_position = AZ::Vector3(1.0f, 2.0f, 3.0f);
+        rigidConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+        AzPhysics::SimulatedBodyHandle rigidBodyHandle = scene->AddSimulatedBody(&rigidConfig);
+        AzPhysics::SimulatedBody* rigidBody = scene->GetSimulatedBodyFromHandle(rigidBodyHandle);
+
+        // the poses are reported once per simulation step
+        int numTimesTriggered = 0;
+        OnActiveRigidBodyTransformsUpdatedEvent::Handler transformsHandler(
+            [&numTimesTriggered, this](AzPhysics::SceneHandle sceneHandle, const ActiveRigidBodyTransforms& transforms)
+            {
+                numTimesTriggered++;
+                EXPECT_TRUE(m_testSceneHandle == sceneHandle);
+                EXPECT_EQ(transforms.GetSize(), 1);
+                EXPECT_EQ(transforms.m_positions.size(), transforms.GetSize());
+                EXPECT_EQ(transforms.m_orientations.size(), transforms.GetSize());
+            });
+        scene->RegisterActiveRigidBodyTransformsUpdatedHandler(transformsHandler);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(numTimesTriggered, 1);
+        const ActiveRigidBodyTransforms& transforms = scene->GetActiveRigidBodyTransforms();
+        ASSERT_EQ(transforms.GetSize(), 1);
+        EXPECT_TRUE(transforms.m_bodyHandles[0] == rigidBodyHandle);
+        EXPECT_TRUE(transforms.m_positions[0].IsClose(rigidBody->GetPosition()));
+        EXPECT_TRUE(transforms.m_orientations[0].IsClose(rigidBody->GetOrientation()));
+    }
 }
@@ -13,6 +13,7 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX
 {
@@ -317,4 +318,99 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, SceneSimulationScheduler_StepsScenesWithTheirOwnTimeStep)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        PhysXSceneSimulationScheduler& scheduler = GetPhysXSystem()->GetSceneSimulationScheduler();
+
+        const AzPhysics::SceneHandle fastSceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        const AzPhysics::SceneHandle slowSceneHandle = physicsSystem->AddScene(m_sceneConfigs[1]);
+        const AzPhysics::SceneHandle unscheduledSceneHandle = physicsSystem->AddScene(m_sceneConfigs[2]);
+        // Time steps that are exact in binary, so the number of sub-steps doesn't depend on rounding.
+        const float fastTimeStep = 1.0f / 64.0f;
+        const float slowTimeStep = 1.0f / 32.0f;
+        const float frameDeltaTime = 3.0f / 128.0f;
+        EXPECT_TRUE(scheduler.AddScene(fastSceneHandle, fastTimeStep));
+        EXPECT_TRUE(scheduler.AddScene(slowSceneHandle, slowTimeStep));
+        EXPECT_FALSE(scheduler.AddScene(AzPhysics::InvalidSceneHandle, fastTimeStep));
+        EXPECT_TRUE(scheduler.IsSceneScheduled(fastSceneHandle));
+        EXPECT_FALSE(scheduler.IsSceneScheduled(unscheduledSceneHandle));
+
+        AZStd::vector<float> fastSceneSteps;
+        AZStd::vector<float> slowSceneSteps;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler fastSceneHandler(
+            [&fastSceneSteps]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float deltaTime)
+            {
+                fastSceneSteps.push_back(deltaTime);
+            });
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler slowSceneHandler(
+            [&slowSceneSteps]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float deltaTime)
+            {
+                slowSceneSteps.push_back(deltaTime);
+            });
+        physicsSystem->GetScene(fastSceneHandle)->RegisterSceneSimulationStartHandler(fastSceneHandler);
+        physicsSystem->GetScene(slowSceneHandle)->RegisterSceneSimulationStartHandler(slowSceneHandler);
+
+        // The scheduled scenes only take the sub-steps that fit into their own accumulated time.
+        physicsSystem->Simulate(frameDeltaTime);
+        ASSERT_EQ(fastSceneSteps.size(), 1u);
+        EXPECT_FLOAT_EQ(fastSceneSteps[0], fastTimeStep);
+        EXPECT_TRUE(slowSceneSteps.empty());
+        EXPECT_EQ(scheduler.GetSceneStepStats(fastSceneHandle)->m_numSubSteps, 1u);
+        EXPECT_EQ(scheduler.GetSceneStepStats(slowSceneHandle)->m_numSubSteps, 0u);
+
+        physicsSystem->Simulate(frameDeltaTime);
+        EXPECT_EQ(fastSceneSteps.size(), 3u);
+        EXPECT_EQ(scheduler.GetSceneStepStats(fastSceneHandle)->m_numSubSteps, 2u);
+        ASSERT_EQ(slowSceneSteps.size(), 1u);
+        EXPECT_FLOAT_EQ(slowSceneSteps[0], slowTimeStep);
+
+        // Removing the scene from the physics system removes it from the scheduler.
+        physicsSystem->RemoveScene(fastSceneHandle);
+        EXPECT_FALSE(scheduler.IsSceneScheduled(fastSceneHandle));
+        EXPECT_EQ(scheduler.GetNumScenes(), 1u);
+    }
+
+    TEST_F(PhysXSystemFixture, SceneSimulationScheduler_LargeDeltaTime_SubStepsAreClamped)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        PhysXSceneSimulationScheduler& scheduler = GetPhysXSystem()->GetSceneSimulationScheduler();
+
+        const AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        EXPECT_TRUE(scheduler.AddScene(sceneHandle, 0.001f, 3));
+
+        physicsSystem->Simulate(0.02f);
+        EXPECT_EQ(scheduler.GetSceneStepStats(sceneHandle)->m_numSubSteps, 3u);
+
+        // The time that didn't fit into the sub-steps got dropped.
+        physicsSystem->Simulate(0.0015f);
+        EXPECT_EQ(scheduler.GetSceneStepStats(sceneHandle)->m_numSubSteps, 1u);
+    }
+
+    TEST_F(PhysXSystemFixture, Simulate_CpuDispatchStats_CoverAllScenesOfTheFrame)
+    {
+        PhysXSystem* physXSystem = GetPhysXSystem();
+        if (!physXSystem->GetPhysXCpuDispatcher())
+        {
+            GTEST_SKIP() << "PhysX does not run its tasks through a PhysXCpuDispatcher on this platform.";
+        }
+
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        PhysXSceneSimulationScheduler& scheduler = physXSystem->GetSceneSimulationScheduler();
+        const AzPhysics::SceneHandle firstSceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        const AzPhysics::SceneHandle secondSceneHandle = physicsSystem->AddScene(m_sceneConfigs[1]);
+        EXPECT_TRUE(scheduler.AddScene(firstSceneHandle, 1.0f / 64.0f));
+        EXPECT_TRUE(scheduler.AddScene(secondSceneHandle, 1.0f / 64.0f));
+
+        // Both scenes step at the same time, so the stats are only available for the whole frame.
+        physicsSystem->Simulate(1.0f / 64.0f);
+        const PhysXCpuDispatchStats stats = physXSystem->GetLastSimulateCpuDispatchStats();
+        EXPECT_GT(stats.m_numTasks, 0u);
+        EXPECT_LE(stats.m_numJobs, stats.m_numTasks);
+
+        // A frame in which no scene takes a step doesn't dispatch anything.
+        physicsSystem->Simulate(1.0f / 256.0f);
+        EXPECT_EQ(physXSystem->GetLastSimulateCpuDispatchStats().m_numTasks, 0u);
+    }
 }
@@ -120,10 +120,14 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXSceneSimulationScheduler.h
+    Source/Scene/PhysXSceneSimulationScheduler.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
+    Source/System/PhysXCookingCache.cpp
+    Source/System/PhysXCookingCache.h
     Source/System/PhysXCpuDispatcher.cpp
     Source/System/PhysXCpuDispatcher.h
     Source/System/PhysXJob.cpp
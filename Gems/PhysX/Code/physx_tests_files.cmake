@@ -25,6 +25,8 @@ set(FILES
     Tests/PhysXSceneTests.cpp
     Tests/PhysXSceneQueryTests.cpp
     Tests/PhysXSystemTests.cpp
+    Tests/PhysXCpuDispatcherTests.cpp
+    Tests/PhysXCookingCacheTests.cpp
     Tests/PhysXTestFixtures.h
     Tests/PhysXTestFixtures.cpp
     Tests/PhysXTestUtil.h
@@ -47,4 +49,5 @@ set(FILES
     Tests/Benchmarks/PhysXSceneQueryBenchmarks.cpp
     Tests/Benchmarks/PhysXRigidBodyBenchmarks.cpp
     Tests/Benchmarks/PhysXJointBenchmarks.cpp
+    Tests/Benchmarks/PhysXMultiSceneBenchmarks.cpp
 )